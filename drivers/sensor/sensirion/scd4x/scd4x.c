@@ -11,32 +11,42 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/byteorder.h>
-#include <zephyr/sys/crc.h>
 #include <zephyr/devicetree.h>
+#include <zephyr/rtio/rtio.h>
 
 #include <zephyr/drivers/sensor/scd4x.h>
 #include "scd4x.h"
+#include "scd4x_decoder.h"
+#include "../sensirion_core/sensirion_common.h"
+#include "../sensirion_core/sensirion_job.h"
+#include "../sensirion_core/sensirion_rtio.h"
 
 LOG_MODULE_REGISTER(SCD4X, CONFIG_SENSOR_LOG_LEVEL);
 
-static uint8_t scd4x_calc_crc(uint16_t value)
+static int scd4x_send_command(const struct device *dev, uint8_t cmd, const uint16_t *data,
+			      uint8_t data_size)
 {
-	uint8_t buf[2];
+	const struct scd4x_config *cfg = dev->config;
+	uint8_t tx_buf[((data_size * 3) + 2)];
+
+	sys_put_be16(scd4x_cmds[cmd].cmd, tx_buf);
 
-	sys_put_be16(value, buf);
+	uint8_t tx_buf_pos = 2;
+
+	for (uint8_t i = 0; i < data_size; i++) {
+		sys_put_be16(data[i], &tx_buf[tx_buf_pos]);
+		tx_buf_pos += 2;
+		tx_buf[tx_buf_pos++] = sensirion_i2c_word_crc(data[i]);
+	}
 
-	return crc8(buf, 2, SCD4X_CRC_POLY, SCD4X_CRC_INIT, false);
+	return i2c_write_dt(&cfg->bus, tx_buf, sizeof(tx_buf));
 }
 
 static int scd4x_write_command(const struct device *dev, uint8_t cmd)
 {
-	const struct scd4x_config *cfg = dev->config;
-	uint8_t tx_buf[2];
 	int ret;
 
-	sys_put_be16(scd4x_cmds[cmd].cmd, tx_buf);
-
-	ret = i2c_write_dt(&cfg->bus, tx_buf, sizeof(tx_buf));
+	ret = scd4x_send_command(dev, cmd, NULL, 0);
 
 	if (scd4x_cmds[cmd].cmd_duration_ms) {
 		k_msleep(scd4x_cmds[cmd].cmd_duration_ms);
@@ -56,42 +66,11 @@ static int scd4x_read_reg(const struct device *dev, uint8_t *rx_buf, uint8_t rx_
 		return ret;
 	}
 
-	for (uint8_t i = 0; i < (rx_buf_size / 3); i++) {
-		ret = scd4x_calc_crc(sys_get_be16(&rx_buf[i * 3]));
-		if (ret != rx_buf[(i * 3) + 2]) {
-			LOG_ERR("Invalid CRC.");
-			return -EIO;
-		}
-	}
-
-	return 0;
-}
-
-static int scd4x_write_reg(const struct device *dev, uint8_t cmd, uint16_t *data, uint8_t data_size)
-{
-	const struct scd4x_config *cfg = dev->config;
-	int ret;
-	uint8_t tx_buf[((data_size * 3) + 2)];
-
-	sys_put_be16(scd4x_cmds[cmd].cmd, tx_buf);
-
-	uint8_t tx_buf_pos = 2;
-
-	for (uint8_t i = 0; i < data_size; i++) {
-		sys_put_be16(data[i], &tx_buf[tx_buf_pos]);
-		tx_buf_pos += 2;
-		tx_buf[tx_buf_pos++] = scd4x_calc_crc(data[i]);
-	}
-
-	ret = i2c_write_dt(&cfg->bus, tx_buf, sizeof(tx_buf));
-	if (ret < 0) {
-		LOG_ERR("Failed to write i2c data.");
-		return ret;
+	if (sensirion_i2c_check_frame(rx_buf, rx_buf_size / 3) != NO_ERROR) {
+		LOG_ERR("Invalid CRC.");
+		return -EIO;
 	}
 
-	if (scd4x_cmds[cmd].cmd_duration_ms) {
-		k_msleep(scd4x_cmds[cmd].cmd_duration_ms);
-	}
 	return 0;
 }
 
@@ -147,36 +126,61 @@ static int scd4x_read_sample(const struct device *dev)
 	return 0;
 }
 
-static int scd4x_setup_measurement(const struct device *dev)
+/*
+ * Sends the command that sets up the configured measurement mode, without
+ * waiting for it. Returns its execution time in milliseconds.
+ */
+static int scd4x_start_measurement(const struct device *dev)
 {
 	const struct scd4x_config *cfg = dev->config;
+	uint8_t cmd;
 	int ret;
 
 	switch ((enum scd4x_mode_t)cfg->mode) {
 	case SCD4X_MODE_NORMAL:
-		ret = scd4x_write_command(dev, SCD4X_CMD_START_PERIODIC_MEASUREMENT);
-		if (ret < 0) {
-			LOG_ERR("Failed to write start_periodic_measurement command.");
-			return ret;
-		}
+		cmd = SCD4X_CMD_START_PERIODIC_MEASUREMENT;
 		break;
 	case SCD4X_MODE_LOW_POWER:
-		ret = scd4x_write_command(dev, SCD4X_CMD_LOW_POWER_PERIODIC_MEASUREMENT);
-		if (ret < 0) {
-			LOG_ERR("Failed to write start_low_power_periodic_measurement command.");
-			return ret;
-		}
+		cmd = SCD4X_CMD_LOW_POWER_PERIODIC_MEASUREMENT;
 		break;
 	case SCD4X_MODE_SINGLE_SHOT:
-		ret = scd4x_write_command(dev, SCD4X_CMD_POWER_DOWN);
-		if (ret < 0) {
-			LOG_ERR("Failed to write power_down command.");
-			return ret;
-		}
+		cmd = SCD4X_CMD_POWER_DOWN;
 		break;
 	default:
 		return -EINVAL;
 	}
+
+	ret = scd4x_send_command(dev, cmd, NULL, 0);
+	if (ret < 0) {
+		LOG_ERR("Failed to write command 0x%04x.", scd4x_cmds[cmd].cmd);
+		return ret;
+	}
+
+#ifdef CONFIG_SCD4X_STREAM
+	struct scd4x_data *data = dev->data;
+
+	if (cfg->mode != SCD4X_MODE_SINGLE_SHOT) {
+		sensirion_stream_start(&data->stream, cfg->mode == SCD4X_MODE_LOW_POWER
+							      ? SCD4X_LOW_POWER_INTERVAL_MS
+							      : SCD4X_PERIODIC_INTERVAL_MS);
+	}
+#endif
+	return scd4x_cmds[cmd].cmd_duration_ms;
+}
+
+static int scd4x_setup_measurement(const struct device *dev)
+{
+	int ret;
+
+	ret = scd4x_start_measurement(dev);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (ret > 0) {
+		k_msleep(ret);
+	}
+
 	return 0;
 }
 
@@ -194,6 +198,12 @@ static int scd4x_set_idle_mode(const struct device *dev)
 			return ret;
 		}
 	} else {
+#ifdef CONFIG_SCD4X_STREAM
+		struct scd4x_data *data = dev->data;
+
+		/* The sensor NACKs reads until the measurement is set up again */
+		sensirion_stream_stop(&data->stream);
+#endif
 		ret = scd4x_write_command(dev, SCD4X_CMD_STOP_PERIODIC_MEASUREMENT);
 		if (ret < 0) {
 			LOG_ERR("Failed to write stop_periodic_measurement command.");
@@ -204,381 +214,434 @@ static int scd4x_set_idle_mode(const struct device *dev)
 	return 0;
 }
 
-static int scd4x_set_temperature_offset(const struct device *dev, const struct sensor_value *val)
+/* States shared by the long running commands, see scd4x_job_command() */
+enum scd4x_job_state {
+	SCD4X_JOB_IDLE,
+	SCD4X_JOB_WAKE_UP,
+	SCD4X_JOB_COMMAND,
+	SCD4X_JOB_RESULT,
+	SCD4X_JOB_SETUP,
+};
+
+/*
+ * Non-blocking counterpart of scd4x_set_idle_mode() followed by a command: every
+ * state sends one command and hands its execution time back to the work queue.
+ * Returns SENSIRION_JOB_DONE once the response word, if any, has been read.
+ */
+static int scd4x_job_command(struct sensirion_job *job, uint8_t cmd, const uint16_t *arg,
+			     uint16_t *word)
 {
+	const struct scd4x_config *cfg = job->dev->config;
+	uint8_t rx_buf[3];
 	int ret;
-	/*Calculation from Datasheet*/
-	uint16_t offset_temp =
-		(float)(val->val1 + (val->val2 / 1000000.0)) * 0xFFFF / SCD4X_MAX_TEMP;
 
-	ret = scd4x_write_reg(dev, SCD4X_CMD_SET_TEMPERATURE_OFFSET, &offset_temp, 1);
-	if (ret < 0) {
-		LOG_ERR("Failed to write set_temperature_offset register.");
-		return ret;
+	switch ((enum scd4x_job_state)job->state) {
+	case SCD4X_JOB_IDLE:
+		if (cfg->mode == SCD4X_MODE_SINGLE_SHOT) {
+			/* the first wake up is expected to be nacked in power down mode */
+			(void)scd4x_send_command(job->dev, SCD4X_CMD_WAKE_UP, NULL, 0);
+			job->state = SCD4X_JOB_WAKE_UP;
+			return scd4x_cmds[SCD4X_CMD_WAKE_UP].cmd_duration_ms;
+		}
+#ifdef CONFIG_SCD4X_STREAM
+		sensirion_stream_stop(&((struct scd4x_data *)job->dev->data)->stream);
+#endif
+		ret = scd4x_send_command(job->dev, SCD4X_CMD_STOP_PERIODIC_MEASUREMENT, NULL, 0);
+		if (ret < 0) {
+			LOG_ERR("Failed to write stop_periodic_measurement command.");
+			return ret;
+		}
+		job->state = SCD4X_JOB_COMMAND;
+		return scd4x_cmds[SCD4X_CMD_STOP_PERIODIC_MEASUREMENT].cmd_duration_ms;
+	case SCD4X_JOB_WAKE_UP:
+		ret = scd4x_send_command(job->dev, SCD4X_CMD_WAKE_UP, NULL, 0);
+		if (ret < 0) {
+			LOG_ERR("Failed write wake_up command.");
+			return ret;
+		}
+		job->state = SCD4X_JOB_COMMAND;
+		return scd4x_cmds[SCD4X_CMD_WAKE_UP].cmd_duration_ms;
+	case SCD4X_JOB_COMMAND:
+		ret = scd4x_send_command(job->dev, cmd, arg, arg != NULL ? 1 : 0);
+		if (ret < 0) {
+			LOG_ERR("Failed to write command 0x%04x.", scd4x_cmds[cmd].cmd);
+			return ret;
+		}
+		job->state = SCD4X_JOB_RESULT;
+		return scd4x_cmds[cmd].cmd_duration_ms;
+	case SCD4X_JOB_RESULT:
+		if (word != NULL) {
+			ret = scd4x_read_reg(job->dev, rx_buf, sizeof(rx_buf));
+			if (ret < 0) {
+				return ret;
+			}
+			*word = sys_get_be16(rx_buf);
+		}
+		return SENSIRION_JOB_DONE;
+	default:
+		return -EINVAL;
 	}
-
-	return 0;
 }
 
-static int scd4x_set_sensor_altitude(const struct device *dev, const struct sensor_value *val)
+/*
+ * Non-blocking counterpart of scd4x_setup_measurement(), the last state of
+ * every job. Returns SENSIRION_JOB_DONE once the setup command has executed.
+ */
+static int scd4x_job_setup_measurement(struct sensirion_job *job)
 {
-	int ret;
-	uint16_t altitude = val->val1;
-
-	ret = scd4x_write_reg(dev, SCD4X_CMD_SET_SENSOR_ALTITUDE, &altitude, 1);
-	if (ret < 0) {
-		LOG_ERR("Failed to write set_sensor_altitude register.");
-		return ret;
+	if (job->state == SCD4X_JOB_SETUP) {
+		return SENSIRION_JOB_DONE;
 	}
-	return 0;
+
+	job->state = SCD4X_JOB_SETUP;
+
+	return scd4x_start_measurement(job->dev);
 }
 
-static int scd4x_set_ambient_pressure(const struct device *dev, const struct sensor_value *val)
+static int scd4x_forced_recalibration_step(struct sensirion_job *job)
 {
+	uint16_t frc_correction;
 	int ret;
 
-	uint16_t ambient_pressure = val->val1;
+	if (job->state == SCD4X_JOB_SETUP) {
+		return scd4x_job_setup_measurement(job);
+	}
 
-	ret = scd4x_write_reg(dev, SCD4X_CMD_SET_AMBIENT_PRESSURE, &ambient_pressure, 1);
-	if (ret < 0) {
-		LOG_ERR("Failed to write set_ambient_pressure register.");
+	ret = scd4x_job_command(job, SCD4X_CMD_FORCED_RECALIB, &job->arg, &frc_correction);
+	if (ret != SENSIRION_JOB_DONE) {
 		return ret;
 	}
 
-	return 0;
-}
-
-static int scd4x_set_automatic_calib_enable(const struct device *dev,
-					    const struct sensor_value *val)
-{
-	int ret;
-	uint16_t automatic_calib_enable = val->val1;
-
-	ret = scd4x_write_reg(dev, SCD4X_CMD_SET_AUTOMATIC_CALIB_ENABLE, &automatic_calib_enable,
-			      1);
-	if (ret < 0) {
-		LOG_ERR("Failed to write set_automatic_calibration_enable register.");
-		return ret;
+	/*from datasheet*/
+	if (frc_correction == 0xFFFF) {
+		LOG_ERR("FRC failed. Returned 0xFFFF.");
+		return -EIO;
 	}
 
-	return 0;
+	*(uint16_t *)job->out = frc_correction - 0x8000;
+
+	return scd4x_job_setup_measurement(job);
 }
 
-static int scd4x_set_self_calib_initial_period(const struct device *dev,
-					       const struct sensor_value *val)
+static int scd4x_self_test_step(struct sensirion_job *job)
 {
+	uint16_t is_malfunction;
 	int ret;
-	uint16_t initial_period = val->val1;
 
-	ret = scd4x_write_reg(dev, SCD4X_CMD_SET_SELF_CALIB_INITIAL_PERIOD, &initial_period, 1);
-	if (ret < 0) {
-		LOG_ERR("Failed to write set_automatic_self_calibration_initial_period register.");
-		return ret;
+	if (job->state == SCD4X_JOB_SETUP) {
+		return scd4x_job_setup_measurement(job);
 	}
 
-	return 0;
-}
-
-static int scd4x_set_self_calib_standard_period(const struct device *dev,
-						const struct sensor_value *val)
-{
-	int ret;
-	uint16_t standard_period = val->val1;
-
-	ret = scd4x_write_reg(dev, SCD4X_CMD_SET_SELF_CALIB_STANDARD_PERIOD, &standard_period, 1);
-	if (ret < 0) {
-		LOG_ERR("Failed to write set_automatic_self_calibration_standard_period register.");
+	ret = scd4x_job_command(job, SCD4X_CMD_SELF_TEST, NULL, &is_malfunction);
+	if (ret != SENSIRION_JOB_DONE) {
 		return ret;
 	}
 
-	return 0;
+	if (is_malfunction) {
+		LOG_ERR("malfunction detected.");
+		return -EIO;
+	}
+
+	return scd4x_job_setup_measurement(job);
 }
 
-static int scd4x_get_temperature_offset(const struct device *dev, struct sensor_value *val)
+static int scd4x_persist_settings_step(struct sensirion_job *job)
 {
 	int ret;
-	uint8_t rx_buf[3];
 
-	ret = scd4x_write_command(dev, SCD4X_CMD_GET_TEMPERATURE_OFFSET);
-	if (ret < 0) {
-		LOG_ERR("Failed to write get_temperature_offset command.");
-		return ret;
+	if (job->state == SCD4X_JOB_SETUP) {
+		return scd4x_job_setup_measurement(job);
 	}
 
-	ret = scd4x_read_reg(dev, rx_buf, sizeof(rx_buf));
-	if (ret < 0) {
-		LOG_ERR("Failed to read get_temperature_offset register.");
+	ret = scd4x_job_command(job, SCD4X_CMD_PERSIST_SETTINGS, NULL, NULL);
+	if (ret != SENSIRION_JOB_DONE) {
 		return ret;
 	}
 
-	int32_t temp;
-
-	/*Calculation from Datasheet*/
-	temp = sys_get_be16(rx_buf) * SCD4X_MAX_TEMP;
-	val->val1 = (int32_t)(temp / 0xFFFF);
-	val->val2 = ((temp % 0xFFFF) * 1000000) / 0xFFFF;
-
-	return 0;
+	return scd4x_job_setup_measurement(job);
 }
 
-static int scd4x_get_sensor_altitude(const struct device *dev, struct sensor_value *val)
+static int scd4x_factory_reset_step(struct sensirion_job *job)
 {
 	int ret;
-	uint8_t rx_buf[3];
 
-	ret = scd4x_write_command(dev, SCD4X_CMD_GET_SENSOR_ALTITUDE);
-	if (ret < 0) {
-		LOG_ERR("Failed to write get_sensor_altitude command.");
-		return ret;
+	if (job->state == SCD4X_JOB_SETUP) {
+		return scd4x_job_setup_measurement(job);
 	}
 
-	ret = scd4x_read_reg(dev, rx_buf, sizeof(rx_buf));
-	if (ret < 0) {
-		LOG_ERR("Failed to read get_sensor_altitude register.");
+	ret = scd4x_job_command(job, SCD4X_CMD_FACTORY_RESET, NULL, NULL);
+	if (ret != SENSIRION_JOB_DONE) {
 		return ret;
 	}
 
-	val->val1 = sys_get_be16(rx_buf);
-	val->val2 = 0;
+	return scd4x_job_setup_measurement(job);
+}
 
-	return 0;
+/* The ambient pressure can be accessed while the sensor measures periodically */
+static bool scd4x_attr_needs_idle(const struct scd4x_config *cfg, uint8_t cmd)
+{
+	switch (cmd) {
+	case SCD4X_CMD_SET_AMBIENT_PRESSURE:
+		return false;
+	case SCD4X_CMD_GET_AMBIENT_PRESSURE:
+		return cfg->mode == SCD4X_MODE_SINGLE_SHOT;
+	default:
+		return true;
+	}
 }
 
-static int scd4x_get_ambient_pressure(const struct device *dev, struct sensor_value *val)
+/*
+ * Writes the sensor value @c job->out points to with the command in
+ * @c job->arg, leaving and restoring the measurement mode if needed.
+ */
+static int scd4x_attr_set_step(struct sensirion_job *job)
 {
+	const struct scd4x_config *cfg = job->dev->config;
+	const struct sensor_value *val = job->out;
+	uint8_t cmd = job->arg;
+	bool idle = scd4x_attr_needs_idle(cfg, cmd);
+	uint16_t word = val->val1;
 	int ret;
-	uint8_t rx_buf[3];
 
-	ret = scd4x_write_command(dev, SCD4X_CMD_GET_AMBIENT_PRESSURE);
-	if (ret < 0) {
-		LOG_ERR("Failed to write get_ambient_pressure command.");
-		return ret;
+	if (job->state == SCD4X_JOB_SETUP) {
+		return scd4x_job_setup_measurement(job);
+	}
+	if (job->state == SCD4X_JOB_IDLE && !idle) {
+		job->state = SCD4X_JOB_COMMAND;
 	}
 
-	ret = scd4x_read_reg(dev, rx_buf, sizeof(rx_buf));
-	if (ret < 0) {
-		LOG_ERR("Failed to read get_ambient_pressure register.");
-		return ret;
+	if (cmd == SCD4X_CMD_SET_TEMPERATURE_OFFSET) {
+		/*Calculation from Datasheet*/
+		word = (float)(val->val1 + (val->val2 / 1000000.0)) * 0xFFFF / SCD4X_MAX_TEMP;
 	}
 
-	val->val1 = sys_get_be16(rx_buf);
-	val->val2 = 0;
+	ret = scd4x_job_command(job, cmd, &word, NULL);
+	if (ret != SENSIRION_JOB_DONE) {
+		return ret;
+	}
 
-	return 0;
+	return idle ? scd4x_job_setup_measurement(job) : SENSIRION_JOB_DONE;
 }
 
-static int scd4x_get_automatic_calib_enable(const struct device *dev, struct sensor_value *val)
+/*
+ * Reads an attribute with the command in @c job->arg into the sensor value
+ * @c job->out points to.
+ */
+static int scd4x_attr_get_step(struct sensirion_job *job)
 {
+	const struct scd4x_config *cfg = job->dev->config;
+	struct sensor_value *val = job->out;
+	uint8_t cmd = job->arg;
+	bool idle = scd4x_attr_needs_idle(cfg, cmd);
+	uint16_t word;
+	int32_t temp;
 	int ret;
-	uint8_t rx_buf[3];
 
-	ret = scd4x_write_command(dev, SCD4X_CMD_GET_AUTOMATIC_CALIB_ENABLE);
-	if (ret < 0) {
-		LOG_ERR("Failed to write get_automatic_calibration_enable command.");
-		return ret;
+	if (job->state == SCD4X_JOB_SETUP) {
+		return scd4x_job_setup_measurement(job);
+	}
+	if (job->state == SCD4X_JOB_IDLE && !idle) {
+		job->state = SCD4X_JOB_COMMAND;
 	}
 
-	ret = scd4x_read_reg(dev, rx_buf, sizeof(rx_buf));
-	if (ret < 0) {
-		LOG_ERR("Failed to read get_automatic_calibration_enabled register.");
+	ret = scd4x_job_command(job, cmd, NULL, &word);
+	if (ret != SENSIRION_JOB_DONE) {
 		return ret;
 	}
 
-	val->val1 = sys_get_be16(rx_buf);
-	val->val2 = 0;
+	if (cmd == SCD4X_CMD_GET_TEMPERATURE_OFFSET) {
+		/*Calculation from Datasheet*/
+		temp = word * SCD4X_MAX_TEMP;
+		val->val1 = (int32_t)(temp / 0xFFFF);
+		val->val2 = ((temp % 0xFFFF) * 1000000LL) / 0xFFFF;
+	} else {
+		val->val1 = word;
+		val->val2 = 0;
+	}
 
-	return 0;
+	return idle ? scd4x_job_setup_measurement(job) : SENSIRION_JOB_DONE;
 }
 
-static int scd4x_get_self_calib_initial_period(const struct device *dev, struct sensor_value *val)
+/* Returns the command that writes or reads an attribute, or a negative error code */
+static int scd4x_attr_cmd(const struct device *dev, enum sensor_channel chan,
+			  enum sensor_attribute attr, bool set)
 {
-	int ret;
-	uint8_t rx_buf[3];
+	const struct scd4x_config *cfg = dev->config;
+	int cmd;
 
-	ret = scd4x_write_command(dev, SCD4X_CMD_GET_SELF_CALIB_INITIAL_PERIOD);
-	if (ret < 0) {
-		LOG_ERR("Failed to write get_automati_calibration_initial_period command.");
-		return ret;
+	if (chan != SENSOR_CHAN_ALL && chan != SENSOR_CHAN_AMBIENT_TEMP &&
+	    chan != SENSOR_CHAN_HUMIDITY && chan != SENSOR_CHAN_CO2) {
+		return -ENOTSUP;
 	}
 
-	ret = scd4x_read_reg(dev, rx_buf, sizeof(rx_buf));
-	if (ret < 0) {
-		LOG_ERR("Failed to read get_automatic_calibration_initial_period register.");
-		return ret;
+	switch ((enum sensor_attribute_scd4x)attr) {
+	case SENSOR_ATTR_SCD4X_TEMPERATURE_OFFSET:
+		cmd = SCD4X_CMD_SET_TEMPERATURE_OFFSET;
+		break;
+	case SENSOR_ATTR_SCD4X_SENSOR_ALTITUDE:
+		cmd = SCD4X_CMD_SET_SENSOR_ALTITUDE;
+		break;
+	case SENSOR_ATTR_SCD4X_AMBIENT_PRESSURE:
+		cmd = SCD4X_CMD_SET_AMBIENT_PRESSURE;
+		break;
+	case SENSOR_ATTR_SCD4X_AUTOMATIC_CALIB_ENABLE:
+		cmd = SCD4X_CMD_SET_AUTOMATIC_CALIB_ENABLE;
+		break;
+	case SENSOR_ATTR_SCD4X_SELF_CALIB_INITIAL_PERIOD:
+		if (cfg->model == SCD4X_MODEL_SCD40) {
+			LOG_ERR("SELF_CALIB_INITIAL_PERIOD not available for SCD40.");
+			return -ENOTSUP;
+		}
+		cmd = SCD4X_CMD_SET_SELF_CALIB_INITIAL_PERIOD;
+		break;
+	case SENSOR_ATTR_SCD4X_SELF_CALIB_STANDARD_PERIOD:
+		if (cfg->model == SCD4X_MODEL_SCD40) {
+			LOG_ERR("SELF_CALIB_STANDARD_PERIOD not available for SCD40.");
+			return -ENOTSUP;
+		}
+		cmd = SCD4X_CMD_SET_SELF_CALIB_STANDARD_PERIOD;
+		break;
+	default:
+		return -ENOTSUP;
 	}
 
-	val->val1 = sys_get_be16(rx_buf);
-	val->val2 = 0;
-
-	return 0;
+	/* Every get command directly follows its set command in scd4x_cmds[] */
+	return set ? cmd : cmd + 1;
 }
 
-static int scd4x_get_self_calib_standard_period(const struct device *dev, struct sensor_value *val)
+static int scd4x_attr_check(enum sensor_attribute attr, const struct sensor_value *val)
 {
-	int ret;
-	uint8_t rx_buf[3];
-
-	ret = scd4x_write_command(dev, SCD4X_CMD_GET_SELF_CALIB_STANDARD_PERIOD);
-	if (ret < 0) {
-		LOG_ERR("Failed to write get_automatic_self_calibration_standard_period command.");
-		return ret;
+	if (val->val1 < 0 || val->val2 < 0) {
+		return -EINVAL;
 	}
 
-	ret = scd4x_read_reg(dev, rx_buf, sizeof(rx_buf));
-	if (ret < 0) {
-		LOG_ERR("Failed to read get_automatic_self_calibration_standard_period register.");
-		return ret;
+	switch ((enum sensor_attribute_scd4x)attr) {
+	case SENSOR_ATTR_SCD4X_TEMPERATURE_OFFSET:
+		return val->val1 > SCD4X_TEMPERATURE_OFFSET_IDX_MAX ? -EINVAL : 0;
+	case SENSOR_ATTR_SCD4X_SENSOR_ALTITUDE:
+		return val->val1 > SCD4X_SENSOR_ALTITUDE_IDX_MAX ? -EINVAL : 0;
+	case SENSOR_ATTR_SCD4X_AMBIENT_PRESSURE:
+		return (val->val1 > SCD4X_AMBIENT_PRESSURE_IDX_MAX || val->val1 < 700) ? -EINVAL
+											 : 0;
+	case SENSOR_ATTR_SCD4X_AUTOMATIC_CALIB_ENABLE:
+		return val->val1 > SCD4X_BOOL_IDX_MAX ? -EINVAL : 0;
+	case SENSOR_ATTR_SCD4X_SELF_CALIB_INITIAL_PERIOD:
+	case SENSOR_ATTR_SCD4X_SELF_CALIB_STANDARD_PERIOD:
+		return (val->val1 % 4) ? -EINVAL : 0;
+	default:
+		return 0;
 	}
-
-	val->val1 = sys_get_be16(rx_buf);
-	val->val2 = 0;
-
-	return 0;
 }
 
 int scd4x_forced_recalibration(const struct device *dev, uint16_t target_concentration,
 			       uint16_t *frc_correction)
 {
-	uint8_t rx_buf[3];
-	int ret;
+	struct scd4x_data *data = dev->data;
 
-	ret = scd4x_set_idle_mode(dev);
-	if (ret < 0) {
-		LOG_ERR("Failed to set idle mode.");
-		return ret;
-	}
+	return sensirion_job_run(&data->job, scd4x_forced_recalibration_step,
+				 target_concentration, frc_correction);
+}
 
-	ret = scd4x_write_reg(dev, SCD4X_CMD_FORCED_RECALIB, &target_concentration, 1);
-	if (ret < 0) {
-		LOG_ERR("Failed to write perform_forced_recalibration register.");
-		return ret;
-	}
+int scd4x_self_test(const struct device *dev)
+{
+	struct scd4x_data *data = dev->data;
 
-	ret = scd4x_read_reg(dev, rx_buf, sizeof(rx_buf));
-	if (ret < 0) {
-		LOG_ERR("Failed to read perform_forced_recalibration register.");
-		return ret;
-	}
+	return sensirion_job_run(&data->job, scd4x_self_test_step, 0, NULL);
+}
 
-	*frc_correction = sys_get_be16(rx_buf);
+int scd4x_persist_settings(const struct device *dev)
+{
+	struct scd4x_data *data = dev->data;
 
-	/*from datasheet*/
-	if (*frc_correction == 0xFFFF) {
-		LOG_ERR("FRC failed. Returned 0xFFFF.");
-		return -EIO;
-	}
-
-	*frc_correction -= 0x8000;
+	return sensirion_job_run(&data->job, scd4x_persist_settings_step, 0, NULL);
+}
 
-	ret = scd4x_setup_measurement(dev);
-	if (ret < 0) {
-		LOG_ERR("Failed to setup measurement.");
-		return ret;
-	}
+int scd4x_factory_reset(const struct device *dev)
+{
+	struct scd4x_data *data = dev->data;
 
-	return 0;
+	return sensirion_job_run(&data->job, scd4x_factory_reset_step, 0, NULL);
 }
 
-int scd4x_self_test(const struct device *dev)
+int scd4x_forced_recalibration_async(const struct device *dev, uint16_t target_concentration,
+				     uint16_t *frc_correction, scd4x_callback_t cb,
+				     void *user_data)
 {
-	int ret;
-	uint8_t rx_buf[3];
+	struct scd4x_data *data = dev->data;
 
-	ret = scd4x_set_idle_mode(dev);
-	if (ret < 0) {
-		LOG_ERR("Failed to set idle mode.");
-		return ret;
-	}
+	return sensirion_job_start(&data->job, scd4x_forced_recalibration_step,
+				   target_concentration, frc_correction, cb, user_data);
+}
 
-	ret = scd4x_write_command(dev, SCD4X_CMD_SELF_TEST);
-	if (ret < 0) {
-		LOG_ERR("Failed to write perform_self_test command.");
-		return ret;
-	}
+int scd4x_self_test_async(const struct device *dev, scd4x_callback_t cb, void *user_data)
+{
+	struct scd4x_data *data = dev->data;
 
-	ret = scd4x_read_reg(dev, rx_buf, sizeof(rx_buf));
-	if (ret < 0) {
-		LOG_ERR("Failed to read perform_self_test register.");
-		return ret;
-	}
+	return sensirion_job_start(&data->job, scd4x_self_test_step, 0, NULL, cb, user_data);
+}
 
-	uint16_t is_malfunction = sys_get_be16(rx_buf);
+int scd4x_persist_settings_async(const struct device *dev, scd4x_callback_t cb, void *user_data)
+{
+	struct scd4x_data *data = dev->data;
 
-	if (is_malfunction) {
-		LOG_ERR("malfunction detected.");
-		return -EIO;
-	}
+	return sensirion_job_start(&data->job, scd4x_persist_settings_step, 0, NULL, cb,
+				   user_data);
+}
 
-	ret = scd4x_setup_measurement(dev);
-	if (ret < 0) {
-		LOG_ERR("Failed to setup measurement.");
-		return ret;
-	}
+int scd4x_factory_reset_async(const struct device *dev, scd4x_callback_t cb, void *user_data)
+{
+	struct scd4x_data *data = dev->data;
 
-	return 0;
+	return sensirion_job_start(&data->job, scd4x_factory_reset_step, 0, NULL, cb, user_data);
 }
 
-int scd4x_persist_settings(const struct device *dev)
+int scd4x_attr_set_async(const struct device *dev, enum sensor_attribute attr,
+			 const struct sensor_value *val, scd4x_callback_t cb, void *user_data)
 {
+	struct scd4x_data *data = dev->data;
+	int cmd = scd4x_attr_cmd(dev, SENSOR_CHAN_ALL, attr, true);
 	int ret;
 
-	ret = scd4x_set_idle_mode(dev);
-	if (ret < 0) {
-		LOG_ERR("Failed to set idle mode.");
-		return ret;
-	}
-
-	ret = scd4x_write_command(dev, SCD4X_CMD_PERSIST_SETTINGS);
-	if (ret < 0) {
-		LOG_ERR("Failed to write persist_settings command.");
-		return ret;
+	if (cmd < 0) {
+		return cmd;
 	}
 
-	ret = scd4x_setup_measurement(dev);
+	ret = scd4x_attr_check(attr, val);
 	if (ret < 0) {
-		LOG_ERR("Failed to setup measurement.");
 		return ret;
 	}
 
-	return 0;
+	/* The step only reads the value */
+	return sensirion_job_start(&data->job, scd4x_attr_set_step, cmd, (void *)val, cb,
+				   user_data);
 }
 
-int scd4x_factory_reset(const struct device *dev)
+int scd4x_attr_get_async(const struct device *dev, enum sensor_attribute attr,
+			 struct sensor_value *val, scd4x_callback_t cb, void *user_data)
 {
-	int ret;
-
-	ret = scd4x_set_idle_mode(dev);
-	if (ret < 0) {
-		LOG_ERR("Failed to set idle mode.");
-		return ret;
-	}
+	struct scd4x_data *data = dev->data;
+	int cmd = scd4x_attr_cmd(dev, SENSOR_CHAN_ALL, attr, false);
 
-	ret = scd4x_write_command(dev, SCD4X_CMD_FACTORY_RESET);
-	if (ret < 0) {
-		LOG_ERR("Failed to write perfom_factory_reset command.");
-		return ret;
+	if (cmd < 0) {
+		return cmd;
 	}
 
-	ret = scd4x_setup_measurement(dev);
-	if (ret < 0) {
-		LOG_ERR("Failed to setup measurement.");
-		return ret;
-	}
+	return sensirion_job_start(&data->job, scd4x_attr_get_step, cmd, val, cb, user_data);
+}
 
-	return 0;
+#ifdef CONFIG_POLL
+void scd4x_signal_cb(const struct device *dev, int result, void *user_data)
+{
+	sensirion_job_signal_cb(dev, result, user_data);
 }
+#endif /* CONFIG_POLL */
 
-static int scd4x_sample_fetch(const struct device *dev, enum sensor_channel chan)
+static int scd4x_fetch_sample(const struct device *dev, enum sensor_channel chan)
 {
 	const struct scd4x_config *cfg = dev->config;
 	bool is_data_ready;
 	int ret;
 
-	if (chan != SENSOR_CHAN_ALL && chan != SENSOR_CHAN_AMBIENT_TEMP &&
-	    chan != SENSOR_CHAN_HUMIDITY && chan != SENSOR_CHAN_CO2) {
-		return -ENOTSUP;
-	}
-
 	if (cfg->mode == SCD4X_MODE_SINGLE_SHOT) {
 		ret = scd4x_set_idle_mode(dev);
 		if (ret < 0) {
@@ -626,6 +689,311 @@ static int scd4x_sample_fetch(const struct device *dev, enum sensor_channel chan
 	return 0;
 }
 
+static int scd4x_sample_fetch(const struct device *dev, enum sensor_channel chan)
+{
+	struct scd4x_data *data = dev->data;
+	int ret;
+
+	if (chan != SENSOR_CHAN_ALL && chan != SENSOR_CHAN_AMBIENT_TEMP &&
+	    chan != SENSOR_CHAN_HUMIDITY && chan != SENSOR_CHAN_CO2) {
+		return -ENOTSUP;
+	}
+
+	/* Hold the job slot, so that no job is started while the sample is read */
+	ret = sensirion_job_claim(&data->job);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = scd4x_fetch_sample(dev, chan);
+	sensirion_job_release(&data->job);
+
+	return ret;
+}
+
+#ifdef CONFIG_SENSOR_ASYNC_API
+static int scd4x_prep_command(const struct scd4x_config *cfg, uint8_t cmd, uint32_t sqe_flags)
+{
+	/* Let the executor wait out the command execution time instead of sleeping */
+	return sensirion_rtio_prep_cmd(cfg->rtio_ctx, cfg->iodev, scd4x_cmds[cmd].cmd,
+				       scd4x_cmds[cmd].cmd_duration_ms * USEC_PER_MSEC, sqe_flags);
+}
+
+static int scd4x_drain_result(struct rtio *ctx, const uint8_t *rx_buf, uint16_t num_words)
+{
+	int ret = sensirion_rtio_finish(ctx, rx_buf, num_words);
+
+	if (ret < 0) {
+		LOG_ERR("Failed to read i2c data.");
+	}
+
+	return ret;
+}
+
+static void scd4x_complete_result(struct rtio *ctx, const struct rtio_sqe *sqe, int result,
+				  void *arg)
+{
+	struct rtio_iodev_sqe *iodev_sqe = (struct rtio_iodev_sqe *)arg;
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	struct scd4x_data *data = read_cfg->sensor->data;
+	struct scd4x_encoded_data *edata = sqe->userdata;
+	int ret;
+
+	ARG_UNUSED(result);
+
+	ret = scd4x_drain_result(ctx, edata->frame, SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+	sensirion_rtio_release(&data->rtio_busy);
+	if (ret < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
+
+	edata->header.has_data = true;
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+static void scd4x_data_ready_result(struct rtio *ctx, const struct rtio_sqe *sqe, int result,
+				    void *arg)
+{
+	struct rtio_iodev_sqe *iodev_sqe = (struct rtio_iodev_sqe *)arg;
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	const struct scd4x_config *cfg = read_cfg->sensor->config;
+	struct scd4x_data *data = read_cfg->sensor->data;
+	struct scd4x_encoded_data *edata = sqe->userdata;
+	int ret;
+
+	ARG_UNUSED(result);
+
+	ret = scd4x_drain_result(ctx, edata->status, SENSIRION_RTIO_FRAME_WORDS(edata->status));
+	if (ret < 0) {
+		sensirion_rtio_release(&data->rtio_busy);
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
+
+	/* Least significant 11 bits = 0 --> data not ready */
+	if ((sys_get_be16(edata->status) & 0x07FF) == 0) {
+		sensirion_rtio_release(&data->rtio_busy);
+		rtio_iodev_sqe_ok(iodev_sqe, 0);
+		return;
+	}
+
+	/* The context stays claimed for the read of the measurement */
+	ret = scd4x_prep_command(cfg, SCD4X_CMD_READ_MEASUREMENT, 0);
+	if (ret == 0) {
+		ret = sensirion_rtio_prep_read(ctx, cfg->iodev, edata->frame,
+					       SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+	}
+	if (ret == 0) {
+		ret = sensirion_rtio_submit(ctx, scd4x_complete_result, iodev_sqe, edata);
+	}
+	if (ret < 0) {
+		LOG_ERR("Failed to acquire SQEs");
+		sensirion_rtio_release(&data->rtio_busy);
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+	}
+}
+
+static int scd4x_prep_single_shot(const struct scd4x_config *cfg,
+				  struct scd4x_encoded_data *edata)
+{
+	uint8_t measure_cmd = SCD4X_CMD_MEASURE_SINGLE_SHOT;
+	int ret;
+
+	/* send wake up command twice because of an expected nack return in power down mode */
+	ret = scd4x_prep_command(cfg, SCD4X_CMD_WAKE_UP, RTIO_SQE_NO_RESPONSE);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = scd4x_prep_command(cfg, SCD4X_CMD_WAKE_UP, 0);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if ((edata->header.channels & SCD4X_CHAN_CO2_BIT) == 0) {
+		measure_cmd = SCD4X_CMD_MEASURE_SINGLE_SHOT_RHT;
+	}
+
+	ret = scd4x_prep_command(cfg, measure_cmd, 0);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = scd4x_prep_command(cfg, SCD4X_CMD_READ_MEASUREMENT, 0);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = sensirion_rtio_prep_read(cfg->rtio_ctx, cfg->iodev, edata->frame,
+				       SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+	if (ret < 0) {
+		return ret;
+	}
+
+	return scd4x_prep_command(cfg, SCD4X_CMD_POWER_DOWN, 0);
+}
+
+#ifdef CONFIG_SCD4X_STREAM
+static void scd4x_stream_result(struct rtio *ctx, const struct rtio_sqe *sqe, int result,
+				void *arg)
+{
+	const struct device *dev = arg;
+	struct scd4x_data *data = dev->data;
+	struct scd4x_encoded_data *edata = sqe->userdata;
+	int ret;
+
+	ARG_UNUSED(result);
+
+	ret = sensirion_rtio_drain(ctx);
+	sensirion_rtio_release(&data->rtio_busy);
+
+	/* The sensor NACKs read_measurement until the next result is available */
+	if (ret < 0) {
+		sensirion_stream_complete(&data->stream, -EAGAIN);
+		return;
+	}
+
+	ret = sensirion_rtio_check_frame(edata->frame, SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+	if (ret < 0) {
+		LOG_ERR("Invalid CRC.");
+	}
+
+	edata->header.has_data = ret == 0;
+	sensirion_stream_complete(&data->stream, ret);
+}
+
+static int scd4x_stream_read(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	const struct scd4x_config *cfg = dev->config;
+	struct scd4x_data *data = dev->data;
+	uint32_t min_buf_len = sizeof(struct scd4x_encoded_data);
+	struct scd4x_encoded_data *edata;
+	uint8_t *buf;
+	uint32_t buf_len;
+	int ret;
+
+	if (sensirion_job_busy(&data->job)) {
+		return -EAGAIN;
+	}
+
+	ret = rtio_sqe_rx_buf(iodev_sqe, min_buf_len, min_buf_len, &buf, &buf_len);
+	if (ret < 0 || buf_len < min_buf_len) {
+		LOG_ERR("Failed to get a read buffer of size %u bytes", min_buf_len);
+		return ret < 0 ? ret : -ENOMEM;
+	}
+
+	edata = (struct scd4x_encoded_data *)buf;
+
+	ret = scd4x_encode(dev, read_cfg, buf);
+	if (ret < 0) {
+		LOG_ERR("Failed to encode sensor data");
+		return ret;
+	}
+
+	/* Retried by the stream while a single read is in flight */
+	if (sensirion_rtio_claim(&data->rtio_busy) < 0) {
+		return -EAGAIN;
+	}
+
+	ret = scd4x_prep_command(cfg, SCD4X_CMD_READ_MEASUREMENT, 0);
+	if (ret == 0) {
+		ret = sensirion_rtio_prep_read(cfg->rtio_ctx, cfg->iodev, edata->frame,
+					       SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+	}
+	if (ret == 0) {
+		ret = sensirion_rtio_submit(cfg->rtio_ctx, scd4x_stream_result, (void *)dev, edata);
+	}
+	if (ret < 0) {
+		LOG_ERR("Failed to acquire SQEs");
+		sensirion_rtio_release(&data->rtio_busy);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_SCD4X_STREAM */
+
+static void scd4x_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	const struct scd4x_config *cfg = dev->config;
+	struct scd4x_data *data = dev->data;
+	uint32_t min_buf_len = sizeof(struct scd4x_encoded_data);
+	struct scd4x_encoded_data *edata;
+	uint8_t *buf;
+	uint32_t buf_len;
+	int ret;
+
+	if (read_cfg->is_streaming) {
+#ifdef CONFIG_SCD4X_STREAM
+		sensirion_stream_submit(&data->stream, iodev_sqe);
+#else
+		LOG_ERR("Streaming not supported");
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+#endif
+		return;
+	}
+
+	if (sensirion_job_busy(&data->job)) {
+		rtio_iodev_sqe_err(iodev_sqe, -EBUSY);
+		return;
+	}
+
+#ifdef CONFIG_SCD4X_STREAM
+	/* Stream reads are issued on the same RTIO context */
+	if (sensirion_stream_active(&data->stream)) {
+		rtio_iodev_sqe_err(iodev_sqe, -EBUSY);
+		return;
+	}
+#endif
+
+	ret = rtio_sqe_rx_buf(iodev_sqe, min_buf_len, min_buf_len, &buf, &buf_len);
+	if (ret < 0 || buf_len < min_buf_len) {
+		LOG_ERR("Failed to get a read buffer of size %u bytes", min_buf_len);
+		rtio_iodev_sqe_err(iodev_sqe, ret < 0 ? ret : -ENOMEM);
+		return;
+	}
+
+	edata = (struct scd4x_encoded_data *)buf;
+
+	ret = scd4x_encode(dev, read_cfg, buf);
+	if (ret < 0) {
+		LOG_ERR("Failed to encode sensor data");
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
+
+	ret = sensirion_rtio_claim(&data->rtio_busy);
+	if (ret < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
+
+	if (cfg->mode == SCD4X_MODE_SINGLE_SHOT) {
+		ret = scd4x_prep_single_shot(cfg, edata);
+	} else {
+		ret = scd4x_prep_command(cfg, SCD4X_CMD_GET_DATA_READY_STATUS, 0);
+		if (ret == 0) {
+			ret = sensirion_rtio_prep_read(cfg->rtio_ctx, cfg->iodev, edata->status,
+						       SENSIRION_RTIO_FRAME_WORDS(edata->status));
+		}
+	}
+	if (ret == 0) {
+		ret = sensirion_rtio_submit(cfg->rtio_ctx,
+					    cfg->mode == SCD4X_MODE_SINGLE_SHOT
+						    ? scd4x_complete_result
+						    : scd4x_data_ready_result,
+					    iodev_sqe, edata);
+	}
+	if (ret < 0) {
+		LOG_ERR("Failed to acquire SQEs");
+		sensirion_rtio_release(&data->rtio_busy);
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+	}
+}
+#endif /* CONFIG_SENSOR_ASYNC_API */
+
 static int scd4x_channel_get(const struct device *dev, enum sensor_channel chan,
 			     struct sensor_value *val)
 {
@@ -655,202 +1023,61 @@ static int scd4x_channel_get(const struct device *dev, enum sensor_channel chan,
 	return 0;
 }
 
-int scd4x_attr_set(const struct device *dev, enum sensor_channel chan, enum sensor_attribute attr,
-		   const struct sensor_value *val)
+static int scd4x_attr_set(const struct device *dev, enum sensor_channel chan,
+			  enum sensor_attribute attr, const struct sensor_value *val)
 {
-	const struct scd4x_config *cfg = dev->config;
+	struct scd4x_data *data = dev->data;
+	int cmd = scd4x_attr_cmd(dev, chan, attr, true);
 	int ret;
 
-	if (chan != SENSOR_CHAN_ALL && chan != SENSOR_CHAN_AMBIENT_TEMP &&
-	    chan != SENSOR_CHAN_HUMIDITY && chan != SENSOR_CHAN_CO2) {
-		return -ENOTSUP;
-	}
-
-	if ((enum sensor_attribute_scd4x)attr != SENSOR_ATTR_SCD4X_AMBIENT_PRESSURE) {
-		ret = scd4x_set_idle_mode(dev);
-		if (ret < 0) {
-			LOG_ERR("Failed to set idle mode.");
-			return ret;
-		}
-	}
-
-	if (val->val1 < 0 || val->val2 < 0) {
-		return -EINVAL;
-	}
-
-	switch ((enum sensor_attribute_scd4x)attr) {
-	case SENSOR_ATTR_SCD4X_TEMPERATURE_OFFSET:
-		if (val->val1 > SCD4X_TEMPERATURE_OFFSET_IDX_MAX) {
-			return -EINVAL;
-		}
-		ret = scd4x_set_temperature_offset(dev, val);
-		if (ret < 0) {
-			LOG_ERR("Failed to set temperature offset.");
-			return ret;
-		}
-		break;
-	case SENSOR_ATTR_SCD4X_SENSOR_ALTITUDE:
-		if (val->val1 > SCD4X_SENSOR_ALTITUDE_IDX_MAX) {
-			return -EINVAL;
-		}
-		ret = scd4x_set_sensor_altitude(dev, val);
-		if (ret < 0) {
-			LOG_ERR("Failed to set sensor altitude.");
-			return ret;
-		}
-		break;
-	case SENSOR_ATTR_SCD4X_AMBIENT_PRESSURE:
-		if (val->val1 > SCD4X_AMBIENT_PRESSURE_IDX_MAX || val->val1 < 700) {
-			return -EINVAL;
-		}
-		ret = scd4x_set_ambient_pressure(dev, val);
-		if (ret < 0) {
-			LOG_ERR("Failed to set ambient pressure.");
-			return ret;
-		}
-		/* return 0 to not call scd4x_start_measurement */
-		return 0;
-	case SENSOR_ATTR_SCD4X_AUTOMATIC_CALIB_ENABLE:
-		if (val->val1 > SCD4X_BOOL_IDX_MAX) {
-			return -EINVAL;
-		}
-		ret = scd4x_set_automatic_calib_enable(dev, val);
-		if (ret < 0) {
-			LOG_ERR("Failed to set automatic calib enable.");
-			return ret;
-		}
-		break;
-	case SENSOR_ATTR_SCD4X_SELF_CALIB_INITIAL_PERIOD:
-		if (val->val1 % 4) {
-			return -EINVAL;
-		}
-		if (cfg->model == SCD4X_MODEL_SCD40) {
-			LOG_ERR("SELF_CALIB_INITIAL_PERIOD not available for SCD40.");
-			return -ENOTSUP;
-		}
-		ret = scd4x_set_self_calib_initial_period(dev, val);
-		if (ret < 0) {
-			LOG_ERR("Failed to set self calib initial period.");
-			return ret;
-		}
-		break;
-	case SENSOR_ATTR_SCD4X_SELF_CALIB_STANDARD_PERIOD:
-		if (val->val1 % 4) {
-			return -EINVAL;
-		}
-		if (cfg->model == SCD4X_MODEL_SCD40) {
-			LOG_ERR("SELF_CALIB_STANDARD_PERIOD not available for SCD40.");
-			return -ENOTSUP;
-		}
-		ret = scd4x_set_self_calib_standard_period(dev, val);
-		if (ret < 0) {
-			LOG_ERR("Failed to set self calib standard period.");
-			return ret;
-		}
-		break;
-	default:
-		return -ENOTSUP;
+	if (cmd < 0) {
+		return cmd;
 	}
 
-	ret = scd4x_setup_measurement(dev);
+	ret = scd4x_attr_check(attr, val);
 	if (ret < 0) {
-		LOG_ERR("Failed to setup measurement.");
 		return ret;
 	}
 
-	return 0;
+	/* The same steps as scd4x_attr_set_async(), run in the calling thread */
+	ret = sensirion_job_run(&data->job, scd4x_attr_set_step, cmd, (void *)val);
+	if (ret < 0 && ret != -EBUSY) {
+		LOG_ERR("Failed to set attribute %d.", attr);
+	}
+
+	return ret;
 }
 
 static int scd4x_attr_get(const struct device *dev, enum sensor_channel chan,
 			  enum sensor_attribute attr, struct sensor_value *val)
 {
-	const struct scd4x_config *cfg = dev->config;
+	struct scd4x_data *data = dev->data;
+	int cmd = scd4x_attr_cmd(dev, chan, attr, false);
 	int ret;
 
-	if (chan != SENSOR_CHAN_ALL && chan != SENSOR_CHAN_AMBIENT_TEMP &&
-	    chan != SENSOR_CHAN_HUMIDITY && chan != SENSOR_CHAN_CO2) {
-		return -ENOTSUP;
+	if (cmd < 0) {
+		return cmd;
 	}
 
-	if ((enum sensor_attribute_scd4x)attr != SENSOR_ATTR_SCD4X_AMBIENT_PRESSURE ||
-	    cfg->mode == SCD4X_MODE_SINGLE_SHOT) {
-		ret = scd4x_set_idle_mode(dev);
-		if (ret < 0) {
-			LOG_ERR("Failed to set idle mode.");
-			return ret;
-		}
+	ret = sensirion_job_run(&data->job, scd4x_attr_get_step, cmd, val);
+	if (ret < 0 && ret != -EBUSY) {
+		LOG_ERR("Failed to get attribute %d.", attr);
 	}
 
-	switch ((enum sensor_attribute_scd4x)attr) {
-	case SENSOR_ATTR_SCD4X_TEMPERATURE_OFFSET:
-		ret = scd4x_get_temperature_offset(dev, val);
-		if (ret < 0) {
-			LOG_ERR("Failed to get temperature offset.");
-			return ret;
-		}
-		break;
-	case SENSOR_ATTR_SCD4X_SENSOR_ALTITUDE:
-		ret = scd4x_get_sensor_altitude(dev, val);
-		if (ret < 0) {
-			LOG_ERR("Failed to get sensor altitude.");
-			return ret;
-		}
-		break;
-	case SENSOR_ATTR_SCD4X_AMBIENT_PRESSURE:
-		ret = scd4x_get_ambient_pressure(dev, val);
-		if (ret < 0) {
-			LOG_ERR("Failed to get ambient pressure.");
-			return ret;
-		}
-		/* return 0 to not call scd4x_setup_measurement */
-		return 0;
-	case SENSOR_ATTR_SCD4X_AUTOMATIC_CALIB_ENABLE:
-		ret = scd4x_get_automatic_calib_enable(dev, val);
-		if (ret < 0) {
-			LOG_ERR("Failed to get automatic calib.");
-			return ret;
-		}
-		break;
-	case SENSOR_ATTR_SCD4X_SELF_CALIB_INITIAL_PERIOD:
-		if (cfg->model == SCD4X_MODEL_SCD40) {
-			LOG_ERR("SELF_CALIB_INITIAL_PERIOD not available for SCD40.");
-			return -ENOTSUP;
-		}
-		ret = scd4x_get_self_calib_initial_period(dev, val);
-		if (ret < 0) {
-			LOG_ERR("Failed to set get self calib initial period.");
-			return ret;
-		}
-		break;
-	case SENSOR_ATTR_SCD4X_SELF_CALIB_STANDARD_PERIOD:
-		if (cfg->model == SCD4X_MODEL_SCD40) {
-			LOG_ERR("SELF_CALIB_STANDARD_PERIOD not available for SCD40.");
-			return -ENOTSUP;
-		}
-		ret = scd4x_get_self_calib_standard_period(dev, val);
-		if (ret < 0) {
-			LOG_ERR("Failed to set get self calib standard period.");
-			return ret;
-		}
-		break;
-	default:
-		return -ENOTSUP;
-	}
-
-	ret = scd4x_setup_measurement(dev);
-	if (ret < 0) {
-		LOG_ERR("Failed to setup measurement.");
-		return ret;
-	}
-
-	return 0;
+	return ret;
 }
 
 static int scd4x_init(const struct device *dev)
 {
 	const struct scd4x_config *cfg = dev->config;
+	struct scd4x_data *data = dev->data;
 	int ret;
 
+	sensirion_job_init(&data->job, dev);
+#ifdef CONFIG_SCD4X_STREAM
+	sensirion_stream_init(&data->stream, dev, scd4x_stream_read);
+#endif
+
 	if (!i2c_is_ready_dt(&cfg->bus)) {
 		LOG_ERR("Device not ready.");
 		return -ENODEV;
@@ -886,14 +1113,26 @@ static DEVICE_API(sensor, scd4x_api_funcs) = {
 	.channel_get = scd4x_channel_get,
 	.attr_set = scd4x_attr_set,
 	.attr_get = scd4x_attr_get,
+#ifdef CONFIG_SENSOR_ASYNC_API
+	.submit = scd4x_submit,
+	.get_decoder = scd4x_get_decoder,
+#endif
 };
 
+#define SCD4X_RTIO_DEFINE(inst, scd4x_model)                                                       \
+	RTIO_DEFINE(scd4x_rtio_ctx_##scd4x_model##_##inst, 16, 16);                                \
+	I2C_DT_IODEV_DEFINE(scd4x_iodev_##scd4x_model##_##inst, DT_DRV_INST(inst));
+
 #define SCD4X_INIT(inst, scd4x_model)                                                              \
 	static struct scd4x_data scd4x_data_##scd4x_model##_##inst;                                \
+	IF_ENABLED(CONFIG_SENSOR_ASYNC_API, (SCD4X_RTIO_DEFINE(inst, scd4x_model)))                \
 	static const struct scd4x_config scd4x_config_##scd4x_model##_##inst = {                   \
 		.bus = I2C_DT_SPEC_INST_GET(inst),                                                 \
 		.model = scd4x_model,                                                              \
 		.mode = DT_INST_ENUM_IDX_OR(inst, mode, SCD4X_MODE_NORMAL),                        \
+		IF_ENABLED(CONFIG_SENSOR_ASYNC_API,                                                \
+			   (.rtio_ctx = &scd4x_rtio_ctx_##scd4x_model##_##inst,                    \
+			    .iodev = &scd4x_iodev_##scd4x_model##_##inst,))                        \
 	};                                                                                         \
 	SENSOR_DEVICE_DT_INST_DEFINE(inst, scd4x_init, NULL, &scd4x_data_##scd4x_model##_##inst,   \
 				     &scd4x_config_##scd4x_model##_##inst, POST_KERNEL,            \
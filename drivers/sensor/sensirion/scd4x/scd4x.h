@@ -9,6 +9,9 @@
 
 #include <zephyr/device.h>
 
+#include "../sensirion_core/sensirion_job.h"
+#include "../sensirion_core/sensirion_stream.h"
+
 #define SCD4X_CMD_REINIT                         0
 #define SCD4X_CMD_START_PERIODIC_MEASUREMENT     1
 #define SCD4X_CMD_STOP_PERIODIC_MEASUREMENT      2
@@ -36,11 +39,12 @@
 #define SCD4X_CMD_SET_SELF_CALIB_STANDARD_PERIOD 24
 #define SCD4X_CMD_GET_SELF_CALIB_STANDARD_PERIOD 25
 
-#define SCD4X_CRC_POLY 0x31
-#define SCD4X_CRC_INIT 0xFF
-
 #define SCD4X_STARTUP_TIME_MS 30
 
+/* Measurement intervals of the periodic modes */
+#define SCD4X_PERIODIC_INTERVAL_MS  5000
+#define SCD4X_LOW_POWER_INTERVAL_MS 30000
+
 #define SCD4X_TEMPERATURE_OFFSET_IDX_MAX 20
 #define SCD4X_SENSOR_ALTITUDE_IDX_MAX    3000
 #define SCD4X_AMBIENT_PRESSURE_IDX_MAX   1200
@@ -64,12 +68,25 @@ struct scd4x_config {
 	struct i2c_dt_spec bus;
 	enum scd4x_model_t model;
 	enum scd4x_mode_t mode;
+#ifdef CONFIG_SENSOR_ASYNC_API
+	struct rtio *rtio_ctx;
+	struct rtio_iodev *iodev;
+#endif
 };
 
 struct scd4x_data {
 	uint16_t temp_sample;
 	uint16_t humi_sample;
 	uint16_t co2_sample;
+	/* Long running command started through one of the *_async() helpers */
+	struct sensirion_job job;
+#ifdef CONFIG_SCD4X_STREAM
+	struct sensirion_stream stream;
+#endif
+#ifdef CONFIG_SENSOR_ASYNC_API
+	/* Set while a chain is in flight on rtio_ctx */
+	atomic_t rtio_busy;
+#endif
 };
 
 struct cmds_t {
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/sensor_clock.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include "scd4x_decoder.h"
+
+static uint8_t scd4x_encode_channel(enum sensor_channel chan)
+{
+	switch (chan) {
+	case SENSOR_CHAN_CO2:
+		return SCD4X_CHAN_CO2_BIT;
+	case SENSOR_CHAN_AMBIENT_TEMP:
+		return SCD4X_CHAN_TEMP_BIT;
+	case SENSOR_CHAN_HUMIDITY:
+		return SCD4X_CHAN_RH_BIT;
+	case SENSOR_CHAN_ALL:
+		return SCD4X_CHAN_CO2_BIT | SCD4X_CHAN_TEMP_BIT | SCD4X_CHAN_RH_BIT;
+	default:
+		return 0;
+	}
+}
+
+int scd4x_encode(const struct device *dev, const struct sensor_read_config *read_config,
+		 uint8_t *buf)
+{
+	struct scd4x_encoded_data *edata = (struct scd4x_encoded_data *)buf;
+	uint64_t cycles;
+	int ret;
+
+	ARG_UNUSED(dev);
+
+	edata->header.channels = 0;
+	edata->header.has_data = false;
+	edata->header.data_ready = read_config->is_streaming;
+	for (size_t i = 0; i < read_config->count; i++) {
+		if (!read_config->is_streaming) {
+			edata->header.channels |=
+				scd4x_encode_channel(read_config->channels[i].chan_type);
+		} else if (read_config->triggers[i].opt == SENSOR_STREAM_DATA_INCLUDE) {
+			edata->header.channels |= scd4x_encode_channel(SENSOR_CHAN_ALL);
+		}
+	}
+
+	ret = sensor_clock_get_cycles(&cycles);
+	if (ret != 0) {
+		return ret;
+	}
+
+	edata->header.timestamp = sensor_clock_cycles_to_ns(cycles);
+
+	return 0;
+}
+
+static int scd4x_decoder_get_frame_count(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+					 uint16_t *frame_count)
+{
+	const struct scd4x_encoded_data *edata = (const struct scd4x_encoded_data *)buffer;
+	uint8_t channel_request = scd4x_encode_channel(chan_spec.chan_type);
+
+	if (chan_spec.chan_idx != 0 || channel_request == 0 ||
+	    chan_spec.chan_type == SENSOR_CHAN_ALL) {
+		return -ENOTSUP;
+	}
+
+	if (!edata->header.has_data || (edata->header.channels & channel_request) == 0) {
+		return -ENODATA;
+	}
+
+	*frame_count = 1;
+
+	return 0;
+}
+
+static int scd4x_decoder_get_size_info(struct sensor_chan_spec chan_spec, size_t *base_size,
+				       size_t *frame_size)
+{
+	switch (chan_spec.chan_type) {
+	case SENSOR_CHAN_CO2:
+	case SENSOR_CHAN_AMBIENT_TEMP:
+	case SENSOR_CHAN_HUMIDITY:
+		*base_size = sizeof(struct sensor_q31_data);
+		*frame_size = sizeof(struct sensor_q31_sample_data);
+		return 0;
+	default:
+		return -ENOTSUP;
+	}
+}
+
+static int scd4x_decoder_decode(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+				uint32_t *fit, uint16_t max_count, void *data_out)
+{
+	const struct scd4x_encoded_data *edata = (const struct scd4x_encoded_data *)buffer;
+	uint8_t channel_request = scd4x_encode_channel(chan_spec.chan_type);
+	struct sensor_q31_data *out = data_out;
+	int64_t raw;
+
+	if (*fit != 0 || max_count == 0) {
+		return 0;
+	}
+
+	if (chan_spec.chan_idx != 0) {
+		return -ENOTSUP;
+	}
+
+	if (!edata->header.has_data || (edata->header.channels & channel_request) == 0) {
+		return -ENODATA;
+	}
+
+	/* Calculation from Datasheet */
+	switch (chan_spec.chan_type) {
+	case SENSOR_CHAN_CO2:
+		raw = sys_get_be16(&edata->frame[0]);
+		out->readings[0].value = (q31_t)(raw << (31 - SCD4X_CO2_Q31_SHIFT));
+		out->shift = SCD4X_CO2_Q31_SHIFT;
+		break;
+	case SENSOR_CHAN_AMBIENT_TEMP:
+		raw = sys_get_be16(&edata->frame[3]);
+		out->readings[0].temperature =
+			(q31_t)(((raw * 175) << (31 - SCD4X_TEMP_Q31_SHIFT)) / 0xFFFF -
+				((int64_t)45 << (31 - SCD4X_TEMP_Q31_SHIFT)));
+		out->shift = SCD4X_TEMP_Q31_SHIFT;
+		break;
+	case SENSOR_CHAN_HUMIDITY:
+		raw = sys_get_be16(&edata->frame[6]);
+		out->readings[0].humidity =
+			(q31_t)(((raw * 100) << (31 - SCD4X_RH_Q31_SHIFT)) / 0xFFFF);
+		out->shift = SCD4X_RH_Q31_SHIFT;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	out->header.base_timestamp_ns = edata->header.timestamp;
+	out->header.reading_count = 1;
+	*fit = 1;
+
+	return 1;
+}
+
+static bool scd4x_decoder_has_trigger(const uint8_t *buffer, enum sensor_trigger_type trigger)
+{
+	const struct scd4x_encoded_data *edata = (const struct scd4x_encoded_data *)buffer;
+
+	return trigger == SENSOR_TRIG_DATA_READY && edata->header.data_ready;
+}
+
+#define SCD4X_DECODER_API                                                                          \
+	{                                                                                          \
+		.get_frame_count = scd4x_decoder_get_frame_count,                                  \
+		.get_size_info = scd4x_decoder_get_size_info,                                      \
+		.decode = scd4x_decoder_decode,                                                    \
+		.has_trigger = scd4x_decoder_has_trigger,                                          \
+	}
+
+/* Both compatibles share the same frame layout */
+#define DT_DRV_COMPAT sensirion_scd40
+SENSOR_DECODER_API_DT_DEFINE() = SCD4X_DECODER_API;
+#undef DT_DRV_COMPAT
+
+#define DT_DRV_COMPAT sensirion_scd41
+SENSOR_DECODER_API_DT_DEFINE() = SCD4X_DECODER_API;
+
+int scd4x_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder)
+{
+	ARG_UNUSED(dev);
+	*decoder = &SENSOR_DECODER_NAME();
+
+	return 0;
+}
+#undef DT_DRV_COMPAT
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_DRIVERS_SENSOR_SCD4X_SCD4X_DECODER_H_
+#define ZEPHYR_DRIVERS_SENSOR_SCD4X_SCD4X_DECODER_H_
+
+#include <stdint.h>
+#include <zephyr/drivers/sensor.h>
+
+#define SCD4X_CHAN_CO2_BIT  BIT(0)
+#define SCD4X_CHAN_TEMP_BIT BIT(1)
+#define SCD4X_CHAN_RH_BIT   BIT(2)
+
+#define SCD4X_CO2_Q31_SHIFT  16
+#define SCD4X_TEMP_Q31_SHIFT 8
+#define SCD4X_RH_Q31_SHIFT   8
+
+struct scd4x_encoded_header {
+	uint64_t timestamp;
+	uint8_t channels;
+	/* False if the sensor had no new measurement when it was polled */
+	bool has_data;
+	/* Result of a stream, delivered on SENSOR_TRIG_DATA_READY */
+	bool data_ready;
+};
+
+struct scd4x_encoded_data {
+	struct scd4x_encoded_header header;
+	/* Raw get_data_ready_status response, only used in periodic modes */
+	uint8_t status[3];
+	/* Raw read_measurement response: CO2, T and RH words, each followed by a CRC */
+	uint8_t frame[9];
+};
+
+int scd4x_encode(const struct device *dev, const struct sensor_read_config *read_config,
+		 uint8_t *buf);
+
+int scd4x_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder);
+
+#endif /* ZEPHYR_DRIVERS_SENSOR_SCD4X_SCD4X_DECODER_H_ */
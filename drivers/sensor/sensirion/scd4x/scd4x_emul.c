@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/logging/log.h>
+
+#include "../sensirion_core/sensirion_emul.h"
+
+LOG_MODULE_DECLARE(SCD4X, CONFIG_SENSOR_LOG_LEVEL);
+
+#define SCD4X_EMUL_CMD_REINIT                   0x3646
+#define SCD4X_EMUL_CMD_START_PERIODIC           0x21B1
+#define SCD4X_EMUL_CMD_START_LOW_POWER          0x21AC
+#define SCD4X_EMUL_CMD_STOP_PERIODIC            0x3F86
+#define SCD4X_EMUL_CMD_READ_MEASUREMENT         0xEC05
+#define SCD4X_EMUL_CMD_GET_DATA_READY           0xE4B8
+#define SCD4X_EMUL_CMD_AMBIENT_PRESSURE         0xE000
+#define SCD4X_EMUL_CMD_FORCED_RECALIB           0x362F
+#define SCD4X_EMUL_CMD_PERSIST_SETTINGS         0x3615
+#define SCD4X_EMUL_CMD_GET_SERIAL               0x3682
+#define SCD4X_EMUL_CMD_SELF_TEST                0x3639
+#define SCD4X_EMUL_CMD_FACTORY_RESET            0x3632
+#define SCD4X_EMUL_CMD_MEASURE_SINGLE_SHOT      0x219D
+#define SCD4X_EMUL_CMD_MEASURE_SINGLE_SHOT_RHT  0x2196
+#define SCD4X_EMUL_CMD_POWER_DOWN               0x36E0
+#define SCD4X_EMUL_CMD_WAKE_UP                  0x36F6
+
+/* Measurement intervals of the periodic modes */
+#define SCD4X_EMUL_PERIODIC_INTERVAL_MS  5000
+#define SCD4X_EMUL_LOW_POWER_INTERVAL_MS 30000
+
+/* get_data_ready_status: the 11 least significant bits are 0 if no data is ready */
+#define SCD4X_EMUL_DATA_READY     0x8006
+#define SCD4X_EMUL_DATA_NOT_READY 0x8000
+
+/* Offset of the forced recalibration result, 0xFFFF reports a failure */
+#define SCD4X_EMUL_FRC_OFFSET 0x8000
+
+struct scd4x_emul_setting {
+	uint16_t set_cmd;
+	uint16_t get_cmd;
+	uint16_t default_value;
+};
+
+static const struct scd4x_emul_setting settings[] = {
+	/* Temperature offset of 4 °C in ticks of 175 °C / 2^16 */
+	{0x241D, 0x2318, 1498},
+	/* Sensor altitude in m */
+	{0x2427, 0x2322, 0},
+	/* Ambient pressure in Pa / 100, set and read with the same command */
+	{SCD4X_EMUL_CMD_AMBIENT_PRESSURE, SCD4X_EMUL_CMD_AMBIENT_PRESSURE, 1013},
+	/* Automatic self calibration enabled */
+	{0x2416, 0x2313, 1},
+	/* Automatic self calibration initial and standard period in hours */
+	{0x2445, 0x2340, 44},
+	{0x244E, 0x234B, 156},
+};
+
+static const uint16_t scd4x_emul_serial[] = {0xF896, 0x9F07, 0x3BB3};
+
+struct scd4x_emul_cfg {
+	struct sensirion_emul_cfg common;
+	/* Single shot and power down commands are only available on the SCD41 */
+	bool is_scd41;
+};
+
+struct scd4x_emul_data {
+	struct sensirion_emul_data common;
+	uint16_t settings[ARRAY_SIZE(settings)];
+	/* Measurement interval in periodic mode, 0 while the sensor is idle */
+	uint16_t interval_ms;
+	/* Uptime in ticks of the next periodic measurement */
+	int64_t next_sample;
+	bool data_ready;
+	/* The pending measurement did not measure CO2 */
+	bool rht_only;
+};
+
+static void scd4x_emul_reset_settings(struct scd4x_emul_data *data)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(settings); i++) {
+		data->settings[i] = settings[i].default_value;
+	}
+}
+
+static void scd4x_emul_update(struct scd4x_emul_data *data)
+{
+	int64_t now = k_uptime_ticks();
+
+	if (data->interval_ms == 0 || now < data->next_sample) {
+		return;
+	}
+
+	data->data_ready = true;
+	do {
+		data->next_sample += k_ms_to_ticks_ceil64(data->interval_ms);
+	} while (data->next_sample <= now);
+}
+
+static void scd4x_emul_start_periodic(struct scd4x_emul_data *data, uint16_t interval_ms)
+{
+	data->interval_ms = interval_ms;
+	data->next_sample = k_uptime_ticks() + k_ms_to_ticks_ceil64(interval_ms);
+	data->data_ready = false;
+	data->rht_only = false;
+}
+
+static int scd4x_emul_read_measurement(struct scd4x_emul_data *data)
+{
+	/* The CO2 output of a humidity and temperature only measurement is 0 */
+	const uint16_t sample[] = {
+		data->rht_only ? 0 : data->common.signals[SENSIRION_EMUL_CO2],
+		data->common.signals[SENSIRION_EMUL_TEMPERATURE],
+		data->common.signals[SENSIRION_EMUL_HUMIDITY],
+	};
+
+	scd4x_emul_update(data);
+
+	/* Without a new measurement the read is NACKed */
+	if (data->data_ready) {
+		sensirion_emul_respond(&data->common, sample, ARRAY_SIZE(sample), 1000);
+		data->data_ready = false;
+	}
+
+	return 0;
+}
+
+static int scd4x_emul_setting(struct scd4x_emul_data *data, uint16_t cmd, const uint16_t *args,
+			      uint8_t num_args)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(settings); i++) {
+		if (cmd == settings[i].set_cmd && num_args == 1) {
+			data->settings[i] = args[0];
+			sensirion_emul_respond(&data->common, NULL, 0, 1000);
+			return 0;
+		}
+		if (cmd == settings[i].get_cmd && num_args == 0) {
+			sensirion_emul_respond(&data->common, &data->settings[i], 1, 1000);
+			return 0;
+		}
+	}
+
+	LOG_DBG("Unknown command 0x%04x", cmd);
+
+	return -EIO;
+}
+
+/* Commands that are also accepted while a periodic measurement is running */
+static int scd4x_emul_periodic_command(struct scd4x_emul_data *data, uint16_t cmd,
+				       const uint16_t *args, uint8_t num_args)
+{
+	uint16_t status;
+
+	switch (cmd) {
+	case SCD4X_EMUL_CMD_READ_MEASUREMENT:
+		return scd4x_emul_read_measurement(data);
+	case SCD4X_EMUL_CMD_GET_DATA_READY:
+		scd4x_emul_update(data);
+		status = data->data_ready ? SCD4X_EMUL_DATA_READY : SCD4X_EMUL_DATA_NOT_READY;
+		sensirion_emul_respond(&data->common, &status, 1, 1000);
+		return 0;
+	case SCD4X_EMUL_CMD_STOP_PERIODIC:
+		data->interval_ms = 0;
+		sensirion_emul_respond(&data->common, NULL, 0, 500 * USEC_PER_MSEC);
+		return 0;
+	case SCD4X_EMUL_CMD_AMBIENT_PRESSURE:
+		return scd4x_emul_setting(data, cmd, args, num_args);
+	default:
+		LOG_DBG("Command 0x%04x not available in periodic mode", cmd);
+		return -EIO;
+	}
+}
+
+static int scd4x_emul_command(const struct emul *target, uint16_t cmd, const uint16_t *args,
+			      uint8_t num_args)
+{
+	const struct scd4x_emul_cfg *cfg = target->cfg;
+	struct scd4x_emul_data *data = target->data;
+	uint16_t result;
+
+	if (data->common.sleeping) {
+		/* The sensor wakes up but does not acknowledge the command */
+		if (cmd == SCD4X_EMUL_CMD_WAKE_UP) {
+			data->common.sleeping = false;
+			sensirion_emul_respond(&data->common, NULL, 0, 30 * USEC_PER_MSEC);
+		}
+		return -EIO;
+	}
+
+	if (data->interval_ms != 0 || cmd == SCD4X_EMUL_CMD_READ_MEASUREMENT ||
+	    cmd == SCD4X_EMUL_CMD_GET_DATA_READY) {
+		return scd4x_emul_periodic_command(data, cmd, args, num_args);
+	}
+
+	switch (cmd) {
+	case SCD4X_EMUL_CMD_START_PERIODIC:
+		scd4x_emul_start_periodic(data, SCD4X_EMUL_PERIODIC_INTERVAL_MS);
+		return 0;
+	case SCD4X_EMUL_CMD_START_LOW_POWER:
+		scd4x_emul_start_periodic(data, SCD4X_EMUL_LOW_POWER_INTERVAL_MS);
+		return 0;
+	case SCD4X_EMUL_CMD_STOP_PERIODIC:
+		sensirion_emul_respond(&data->common, NULL, 0, 500 * USEC_PER_MSEC);
+		return 0;
+	case SCD4X_EMUL_CMD_REINIT:
+		sensirion_emul_respond(&data->common, NULL, 0, 30 * USEC_PER_MSEC);
+		return 0;
+	case SCD4X_EMUL_CMD_FORCED_RECALIB:
+		if (num_args != 1) {
+			return -EIO;
+		}
+		result = SCD4X_EMUL_FRC_OFFSET + args[0] - data->common.signals[SENSIRION_EMUL_CO2];
+		sensirion_emul_respond(&data->common, &result, 1, 400 * USEC_PER_MSEC);
+		return 0;
+	case SCD4X_EMUL_CMD_PERSIST_SETTINGS:
+		sensirion_emul_respond(&data->common, NULL, 0, 800 * USEC_PER_MSEC);
+		return 0;
+	case SCD4X_EMUL_CMD_GET_SERIAL:
+		sensirion_emul_respond(&data->common, scd4x_emul_serial,
+				       ARRAY_SIZE(scd4x_emul_serial), 1000);
+		return 0;
+	case SCD4X_EMUL_CMD_SELF_TEST:
+		/* 0 means no malfunction detected */
+		result = 0;
+		sensirion_emul_respond(&data->common, &result, 1, 10000 * USEC_PER_MSEC);
+		return 0;
+	case SCD4X_EMUL_CMD_FACTORY_RESET:
+		scd4x_emul_reset_settings(data);
+		sensirion_emul_respond(&data->common, NULL, 0, 1200 * USEC_PER_MSEC);
+		return 0;
+	case SCD4X_EMUL_CMD_MEASURE_SINGLE_SHOT:
+		if (!cfg->is_scd41) {
+			break;
+		}
+		data->data_ready = true;
+		data->rht_only = false;
+		sensirion_emul_respond(&data->common, NULL, 0, 5000 * USEC_PER_MSEC);
+		return 0;
+	case SCD4X_EMUL_CMD_MEASURE_SINGLE_SHOT_RHT:
+		if (!cfg->is_scd41) {
+			break;
+		}
+		data->data_ready = true;
+		data->rht_only = true;
+		sensirion_emul_respond(&data->common, NULL, 0, 50 * USEC_PER_MSEC);
+		return 0;
+	case SCD4X_EMUL_CMD_POWER_DOWN:
+		if (!cfg->is_scd41) {
+			break;
+		}
+		data->common.sleeping = true;
+		sensirion_emul_respond(&data->common, NULL, 0, 1000);
+		return 0;
+	case SCD4X_EMUL_CMD_WAKE_UP:
+		if (!cfg->is_scd41) {
+			break;
+		}
+		sensirion_emul_respond(&data->common, NULL, 0, 30 * USEC_PER_MSEC);
+		return 0;
+	default:
+		return scd4x_emul_setting(data, cmd, args, num_args);
+	}
+
+	LOG_DBG("Command 0x%04x not available on the SCD40", cmd);
+
+	return -EIO;
+}
+
+static int scd4x_emul_init(const struct emul *target, const struct device *parent)
+{
+	struct scd4x_emul_data *data = target->data;
+
+	ARG_UNUSED(parent);
+
+	sensirion_emul_init_data(&data->common);
+	scd4x_emul_reset_settings(data);
+	data->interval_ms = 0;
+	data->data_ready = false;
+
+	return 0;
+}
+
+#define SCD4X_EMUL(n, scd41)                                                                       \
+	static struct scd4x_emul_data scd4x_emul_data_##scd41##_##n;                               \
+	static const struct scd4x_emul_cfg scd4x_emul_cfg_##scd41##_##n = {                        \
+		.common =                                                                          \
+			{                                                                          \
+				.command = scd4x_emul_command,                                     \
+				.cmd_size = 2,                                                     \
+			},                                                                         \
+		.is_scd41 = scd41,                                                                 \
+	};                                                                                         \
+	EMUL_DT_INST_DEFINE(n, scd4x_emul_init, &scd4x_emul_data_##scd41##_##n,                    \
+			    &scd4x_emul_cfg_##scd41##_##n, &sensirion_emul_api_i2c, NULL)
+
+#define DT_DRV_COMPAT sensirion_scd40
+DT_INST_FOREACH_STATUS_OKAY_VARGS(SCD4X_EMUL, 0)
+#undef DT_DRV_COMPAT
+
+#define DT_DRV_COMPAT sensirion_scd41
+DT_INST_FOREACH_STATUS_OKAY_VARGS(SCD4X_EMUL, 1)
+#undef DT_DRV_COMPAT
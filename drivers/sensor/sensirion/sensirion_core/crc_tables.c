@@ -6,7 +6,8 @@
 
 #include <stdint.h>
 
-uint8_t crc8_poly31_table[256] = {
+/* CRC-8 of a single byte, polynomial 0x31 */
+const uint8_t crc8_poly31_table[256] = {
 	0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0xB9, 0x88, 0xDB, 0xEA, 0x7D, 0x4C, 0x1F,
 	0x2E, 0x43, 0x72, 0x21, 0x10, 0x87, 0xB6, 0xE5, 0xD4, 0xFA, 0xCB, 0x98, 0xA9, 0x3E, 0x0F,
 	0x5C, 0x6D, 0x86, 0xB7, 0xE4, 0xD5, 0x42, 0x73, 0x20, 0x11, 0x3F, 0x0E, 0x5D, 0x6C, 0xFB,
@@ -25,3 +26,27 @@ uint8_t crc8_poly31_table[256] = {
 	0xF0, 0xA3, 0x92, 0x05, 0x34, 0x67, 0x56, 0x78, 0x49, 0x1A, 0x2B, 0xBC, 0x8D, 0xDE, 0xEF,
 	0x82, 0xB3, 0xE0, 0xD1, 0x46, 0x77, 0x24, 0x15, 0x3B, 0x0A, 0x59, 0x68, 0xFF, 0xCE, 0x9D,
 	0xAC};
+
+/*
+ * crc8_poly31_table applied twice, used to process two bytes per step:
+ * crc(b0, b1) = crc8_poly31_table2[crc ^ b0] ^ crc8_poly31_table[b1]
+ */
+const uint8_t crc8_poly31_table2[256] = {
+	0x00, 0xF4, 0xD9, 0x2D, 0x83, 0x77, 0x5A, 0xAE, 0x37, 0xC3, 0xEE, 0x1A, 0xB4, 0x40, 0x6D,
+	0x99, 0x6E, 0x9A, 0xB7, 0x43, 0xED, 0x19, 0x34, 0xC0, 0x59, 0xAD, 0x80, 0x74, 0xDA, 0x2E,
+	0x03, 0xF7, 0xDC, 0x28, 0x05, 0xF1, 0x5F, 0xAB, 0x86, 0x72, 0xEB, 0x1F, 0x32, 0xC6, 0x68,
+	0x9C, 0xB1, 0x45, 0xB2, 0x46, 0x6B, 0x9F, 0x31, 0xC5, 0xE8, 0x1C, 0x85, 0x71, 0x5C, 0xA8,
+	0x06, 0xF2, 0xDF, 0x2B, 0x89, 0x7D, 0x50, 0xA4, 0x0A, 0xFE, 0xD3, 0x27, 0xBE, 0x4A, 0x67,
+	0x93, 0x3D, 0xC9, 0xE4, 0x10, 0xE7, 0x13, 0x3E, 0xCA, 0x64, 0x90, 0xBD, 0x49, 0xD0, 0x24,
+	0x09, 0xFD, 0x53, 0xA7, 0x8A, 0x7E, 0x55, 0xA1, 0x8C, 0x78, 0xD6, 0x22, 0x0F, 0xFB, 0x62,
+	0x96, 0xBB, 0x4F, 0xE1, 0x15, 0x38, 0xCC, 0x3B, 0xCF, 0xE2, 0x16, 0xB8, 0x4C, 0x61, 0x95,
+	0x0C, 0xF8, 0xD5, 0x21, 0x8F, 0x7B, 0x56, 0xA2, 0x23, 0xD7, 0xFA, 0x0E, 0xA0, 0x54, 0x79,
+	0x8D, 0x14, 0xE0, 0xCD, 0x39, 0x97, 0x63, 0x4E, 0xBA, 0x4D, 0xB9, 0x94, 0x60, 0xCE, 0x3A,
+	0x17, 0xE3, 0x7A, 0x8E, 0xA3, 0x57, 0xF9, 0x0D, 0x20, 0xD4, 0xFF, 0x0B, 0x26, 0xD2, 0x7C,
+	0x88, 0xA5, 0x51, 0xC8, 0x3C, 0x11, 0xE5, 0x4B, 0xBF, 0x92, 0x66, 0x91, 0x65, 0x48, 0xBC,
+	0x12, 0xE6, 0xCB, 0x3F, 0xA6, 0x52, 0x7F, 0x8B, 0x25, 0xD1, 0xFC, 0x08, 0xAA, 0x5E, 0x73,
+	0x87, 0x29, 0xDD, 0xF0, 0x04, 0x9D, 0x69, 0x44, 0xB0, 0x1E, 0xEA, 0xC7, 0x33, 0xC4, 0x30,
+	0x1D, 0xE9, 0x47, 0xB3, 0x9E, 0x6A, 0xF3, 0x07, 0x2A, 0xDE, 0x70, 0x84, 0xA9, 0x5D, 0x76,
+	0x82, 0xAF, 0x5B, 0xF5, 0x01, 0x2C, 0xD8, 0x41, 0xB5, 0x98, 0x6C, 0xC2, 0x36, 0x1B, 0xEF,
+	0x18, 0xEC, 0xC1, 0x35, 0x9B, 0x6F, 0x42, 0xB6, 0x2F, 0xDB, 0xF6, 0x02, 0xAC, 0x58, 0x75,
+	0x81};
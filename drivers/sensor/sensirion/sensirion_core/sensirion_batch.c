@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/sensor/sensirion_batch.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include "sensirion_rtio.h"
+
+LOG_MODULE_REGISTER(sensirion_batch, CONFIG_SENSOR_LOG_LEVEL);
+
+#define SENSIRION_BATCH_TINY_WRITE_MAX sizeof(((struct rtio_sqe *)NULL)->tiny_tx.buf)
+
+static const struct sensirion_batch_sensor *sensirion_batch_find(const struct device *dev)
+{
+	STRUCT_SECTION_FOREACH(sensirion_batch_sensor, sensor) {
+		if (sensor->dev == dev) {
+			return sensor;
+		}
+	}
+
+	return NULL;
+}
+
+static int sensirion_batch_prep(const struct device *dev, uint8_t *buf, uint32_t buf_len,
+				struct sensirion_batch_measurement *meas)
+{
+	const struct sensirion_batch_sensor *sensor = sensirion_batch_find(dev);
+	const struct sensor_chan_spec all = {SENSOR_CHAN_ALL, 0};
+	const struct sensor_read_config read_cfg = {
+		.sensor = dev,
+		.is_streaming = false,
+		.channels = (struct sensor_chan_spec *)&all,
+		.count = 1,
+		.max = 1,
+	};
+
+	if (sensor == NULL) {
+		LOG_ERR("%s does not support batched reads", dev->name);
+		return -ENOTSUP;
+	}
+
+	if (buf_len < sensor->buf_size) {
+		LOG_ERR("%s needs a buffer of %u bytes", dev->name, sensor->buf_size);
+		return -ENOMEM;
+	}
+
+	return sensor->prep(dev, &read_cfg, buf, meas);
+}
+
+/*
+ * Issue the measure command of every sensor that has not failed yet, all in a
+ * single submission. The transfers are not chained, so a sensor that NACKs
+ * does not cancel the transfers of the others; they are still executed in
+ * order, as the bus processes one transaction at a time.
+ */
+static void sensirion_batch_start(struct sensirion_batch *batch)
+{
+	struct rtio *ctx = batch->ctx;
+	uint32_t count = 0;
+
+	for (size_t i = 0; i < batch->num_devs; i++) {
+		struct sensirion_batch_measurement *meas = &batch->meas[i];
+		struct rtio_sqe *sqe;
+
+		if (meas->result < 0) {
+			continue;
+		}
+
+		sqe = rtio_sqe_acquire(ctx);
+		if (sqe == NULL) {
+			meas->result = -ENOMEM;
+			continue;
+		}
+
+		if (meas->cmd_len <= SENSIRION_BATCH_TINY_WRITE_MAX) {
+			rtio_sqe_prep_tiny_write(sqe, meas->iodev, RTIO_PRIO_NORM, meas->cmd,
+						 meas->cmd_len, (void *)(uintptr_t)i);
+		} else {
+			rtio_sqe_prep_write(sqe, meas->iodev, RTIO_PRIO_NORM, meas->cmd,
+					    meas->cmd_len, (void *)(uintptr_t)i);
+		}
+		sqe->iodev_flags |= RTIO_IODEV_I2C_STOP;
+		count++;
+	}
+
+	if (count == 0) {
+		return;
+	}
+
+	rtio_submit(ctx, count);
+
+	for (uint32_t i = 0; i < count; i++) {
+		struct rtio_cqe *cqe = rtio_cqe_consume_block(ctx);
+		size_t idx = (uintptr_t)cqe->userdata;
+
+		if (cqe->result < 0) {
+			batch->meas[idx].result = cqe->result;
+		}
+		rtio_cqe_release(ctx, cqe);
+	}
+}
+
+/*
+ * Read the results of all started measurements behind a delay covering the
+ * longest conversion time. The delay and the reads form a single chain, so
+ * the executor waits out the conversions and the reads still go out in
+ * order. A sensor that NACKs cancels the reads chained after it; those are
+ * resubmitted without the delay, their conversions are complete by then.
+ */
+static void sensirion_batch_collect(struct sensirion_batch *batch, uint32_t delay_us)
+{
+	struct rtio *ctx = batch->ctx;
+	bool pending = false;
+
+	for (size_t i = 0; i < batch->num_devs; i++) {
+		if (batch->meas[i].result == 0) {
+			batch->meas[i].result = -EINPROGRESS;
+			pending = true;
+		}
+	}
+
+	while (pending) {
+		struct rtio_sqe *last = NULL;
+		struct rtio_sqe *sqe;
+		uint32_t count = 0;
+
+		if (delay_us > 0) {
+			sqe = rtio_sqe_acquire(ctx);
+			if (sqe != NULL) {
+				rtio_sqe_prep_delay(sqe, K_USEC(delay_us),
+						    (void *)(uintptr_t)batch->num_devs);
+				sqe->flags |= RTIO_SQE_CHAINED;
+				count++;
+			}
+			delay_us = 0;
+		}
+
+		for (size_t i = 0; i < batch->num_devs; i++) {
+			struct sensirion_batch_measurement *meas = &batch->meas[i];
+
+			if (meas->result != -EINPROGRESS) {
+				continue;
+			}
+
+			sqe = rtio_sqe_acquire(ctx);
+			if (sqe == NULL) {
+				meas->result = -ENOMEM;
+				continue;
+			}
+
+			rtio_sqe_prep_read(sqe, meas->iodev, RTIO_PRIO_NORM, meas->frame,
+					   SENSIRION_RTIO_FRAME_SIZE(meas->num_words),
+					   (void *)(uintptr_t)i);
+			sqe->flags |= RTIO_SQE_CHAINED;
+			sqe->iodev_flags |= RTIO_IODEV_I2C_RESTART | RTIO_IODEV_I2C_STOP;
+			last = sqe;
+			count++;
+		}
+
+		if (last == NULL) {
+			/* Nothing left to read, drop a lone delay */
+			rtio_sqe_drop_all(ctx);
+			break;
+		}
+		last->flags &= ~RTIO_SQE_CHAINED;
+
+		rtio_submit(ctx, count);
+
+		pending = false;
+		for (uint32_t i = 0; i < count; i++) {
+			struct rtio_cqe *cqe = rtio_cqe_consume_block(ctx);
+			size_t idx = (uintptr_t)cqe->userdata;
+
+			if (idx < batch->num_devs) {
+				if (cqe->result == -ECANCELED) {
+					pending = true;
+				} else {
+					batch->meas[idx].result = cqe->result;
+				}
+			}
+			rtio_cqe_release(ctx, cqe);
+		}
+	}
+}
+
+int sensirion_batch_read(struct sensirion_batch *batch, uint8_t *const bufs[], uint32_t buf_len,
+			 int results[])
+{
+	uint32_t delay_us = 0;
+	int ret = 0;
+
+	k_mutex_lock(&batch->lock, K_FOREVER);
+
+	for (size_t i = 0; i < batch->num_devs; i++) {
+		struct sensirion_batch_measurement *meas = &batch->meas[i];
+
+		meas->result = sensirion_batch_prep(batch->devs[i], bufs[i], buf_len, meas);
+		if (meas->result == 0) {
+			delay_us = MAX(delay_us, meas->delay_us);
+		}
+	}
+
+	/* Start all conversions back-to-back */
+	sensirion_batch_start(batch);
+
+	/*
+	 * Every conversion started before the last command completed, so the
+	 * longest conversion time from now on covers all of them.
+	 */
+	sensirion_batch_collect(batch, delay_us);
+
+	for (size_t i = 0; i < batch->num_devs; i++) {
+		struct sensirion_batch_measurement *meas = &batch->meas[i];
+
+		if (meas->result == 0) {
+			meas->result = sensirion_rtio_check_frame(meas->frame, meas->num_words);
+		}
+		if (meas->result < 0) {
+			LOG_DBG("%s: batched read failed (%d)", batch->devs[i]->name, meas->result);
+			if (ret == 0) {
+				ret = meas->result;
+			}
+		}
+		if (results != NULL) {
+			results[i] = meas->result;
+		}
+	}
+
+	k_mutex_unlock(&batch->lock);
+
+	return ret;
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SENSIRION_COMP_H
+#define SENSIRION_COMP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/toolchain.h>
+
+/*
+ * Temperature and humidity compensation between Sensirion sensors, linked in
+ * the devicetree: a gas sensor with a compensation-source property takes the
+ * latest sample of that humidity sensor into its next measurement, without a
+ * round trip through the application.
+ *
+ * The humidity sensor publishes every sample it measures in its compensation
+ * source. The sample is kept in SHT4x ticks, the format both the SGP40 (for
+ * the temperature) and the STCC4 take their compensation in:
+ *   T  = -45 + 175 * t_ticks / 65535 [°C]
+ *   RH =  -6 + 125 * rh_ticks / 65535 [%RH]
+ * Both words are packed into one atomic variable, so a consumer always sees
+ * a consistent pair and neither side takes a lock; publishing is safe from
+ * RTIO completions.
+ */
+
+struct sensirion_comp_source {
+	/* t_ticks << 16 | rh_ticks, 0 until the first sample was published */
+	atomic_t sample;
+};
+
+#define SENSIRION_COMP_SOURCE_NAME(node_id) _CONCAT(__sensirion_comp_source_, DT_DEP_ORD(node_id))
+
+/**
+ * SENSIRION_COMP_SOURCE_DEFINE() - define the compensation source of a
+ *                                  humidity sensor instance
+ * @param node_id Devicetree node of the humidity sensor
+ */
+#define SENSIRION_COMP_SOURCE_DEFINE(node_id)                                                      \
+	struct sensirion_comp_source SENSIRION_COMP_SOURCE_NAME(node_id)
+
+/**
+ * SENSIRION_COMP_SOURCE_DT_INST_DECLARE() - declare the compensation source
+ *                                           of a gas sensor instance, if any
+ * @param inst Instance number of the gas sensor
+ */
+#define SENSIRION_COMP_SOURCE_DT_INST_DECLARE(inst)                                                \
+	IF_ENABLED(DT_INST_NODE_HAS_PROP(inst, compensation_source),                               \
+		   (Z_SENSIRION_COMP_SOURCE_DECLARE(DT_INST_PHANDLE(inst, compensation_source))))
+
+#define Z_SENSIRION_COMP_SOURCE_DECLARE(node_id)                                                   \
+	BUILD_ASSERT(DT_NODE_HAS_COMPAT(node_id, sensirion_sht4x),                                 \
+		     "compensation-source must be a sensirion,sht4x");                             \
+	BUILD_ASSERT(DT_NODE_HAS_STATUS_OKAY(node_id),                                             \
+		     "compensation-source must be enabled");                                       \
+	extern struct sensirion_comp_source SENSIRION_COMP_SOURCE_NAME(node_id);
+
+/**
+ * SENSIRION_COMP_SOURCE_DT_INST_GET() - get the compensation source of a gas
+ *                                       sensor instance
+ * @param inst Instance number of the gas sensor
+ * @return Pointer to the compensation source, NULL without compensation-source
+ */
+#define SENSIRION_COMP_SOURCE_DT_INST_GET(inst)                                                    \
+	COND_CODE_1(DT_INST_NODE_HAS_PROP(inst, compensation_source),                              \
+		    (&SENSIRION_COMP_SOURCE_NAME(DT_INST_PHANDLE(inst, compensation_source))),     \
+		    (NULL))
+
+/**
+ * sensirion_comp_publish() - publish the latest sample of a humidity sensor
+ *
+ * @param src      Compensation source of the humidity sensor
+ * @param t_ticks  Temperature in SHT4x ticks
+ * @param rh_ticks Relative humidity in SHT4x ticks
+ */
+static inline void sensirion_comp_publish(struct sensirion_comp_source *src, uint16_t t_ticks,
+					  uint16_t rh_ticks)
+{
+	(void)atomic_set(&src->sample, (atomic_val_t)(((uint32_t)t_ticks << 16) | rh_ticks));
+}
+
+/**
+ * sensirion_comp_get() - get the latest sample of a compensation source
+ *
+ * @param src Compensation source, may be NULL
+ *
+ * @return The packed sample, see sensirion_comp_t_ticks() and
+ *         sensirion_comp_rh_ticks(), or 0 if there is none yet
+ */
+static inline uint32_t sensirion_comp_get(const struct sensirion_comp_source *src)
+{
+	return src != NULL ? (uint32_t)atomic_get(&src->sample) : 0;
+}
+
+static inline uint16_t sensirion_comp_t_ticks(uint32_t sample)
+{
+	return (uint16_t)(sample >> 16);
+}
+
+static inline uint16_t sensirion_comp_rh_ticks(uint32_t sample)
+{
+	return (uint16_t)sample;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSIRION_COMP_H */
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sensirion_emul.h"
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+
+LOG_MODULE_REGISTER(sensirion_emul, CONFIG_SENSOR_LOG_LEVEL);
+
+/* Data word followed by its CRC */
+#define SENSIRION_EMUL_FRAME_SIZE 3
+
+/*
+ * Deliberately not the table driven implementation of the drivers, so the
+ * emulators check the drivers against an independent reference.
+ */
+static uint8_t sensirion_emul_crc(const uint8_t *word)
+{
+	return crc8(word, 2, 0x31, 0xFF, false);
+}
+
+void sensirion_emul_init_data(struct sensirion_emul_data *data)
+{
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	/* 25 °C and 50 %RH in the ticks of the humidity and temperature sensors */
+	data->signals[SENSIRION_EMUL_TEMPERATURE] = 0x6666;
+	data->signals[SENSIRION_EMUL_HUMIDITY] = 0x8000;
+	data->signals[SENSIRION_EMUL_CO2] = 400;
+	data->signals[SENSIRION_EMUL_VOC] = 30000;
+	data->num_response = 0;
+	data->busy_until = 0;
+	data->num_commands = 0;
+	data->num_last_args = 0;
+	data->sleeping = false;
+	data->crc_error = false;
+	data->nack = false;
+	k_spin_unlock(&data->lock, key);
+}
+
+void sensirion_emul_respond(struct sensirion_emul_data *data, const uint16_t *words,
+			    uint8_t num_words, uint32_t duration_us)
+{
+	__ASSERT_NO_MSG(num_words <= SENSIRION_EMUL_MAX_WORDS);
+
+	if (num_words > 0) {
+		memcpy(data->response, words, num_words * sizeof(words[0]));
+	}
+	data->num_response = num_words;
+
+	/* Round down so a driver waiting the nominal time never races the sensor */
+	data->busy_until = k_uptime_ticks() + k_us_to_ticks_floor64(duration_us);
+}
+
+void sensirion_emul_reset(const struct emul *target)
+{
+	sensirion_emul_init_data(target->data);
+}
+
+void sensirion_emul_set_signal(const struct emul *target, enum sensirion_emul_signal signal,
+			       uint16_t raw)
+{
+	struct sensirion_emul_data *data = target->data;
+	k_spinlock_key_t key;
+
+	__ASSERT_NO_MSG(signal < SENSIRION_EMUL_NUM_SIGNALS);
+
+	key = k_spin_lock(&data->lock);
+	data->signals[signal] = raw;
+	k_spin_unlock(&data->lock, key);
+}
+
+void sensirion_emul_set_crc_error(const struct emul *target, bool enable)
+{
+	struct sensirion_emul_data *data = target->data;
+
+	data->crc_error = enable;
+}
+
+void sensirion_emul_set_nack(const struct emul *target, bool enable)
+{
+	struct sensirion_emul_data *data = target->data;
+
+	data->nack = enable;
+}
+
+uint32_t sensirion_emul_get_num_commands(const struct emul *target)
+{
+	struct sensirion_emul_data *data = target->data;
+
+	return data->num_commands;
+}
+
+int sensirion_emul_get_last_args(const struct emul *target, uint16_t *cmd,
+				  uint16_t args[SENSIRION_EMUL_MAX_ARGS])
+{
+	struct sensirion_emul_data *data = target->data;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	int num_args = data->num_last_args;
+
+	*cmd = data->last_args_cmd;
+	memcpy(args, data->last_args, num_args * sizeof(args[0]));
+	k_spin_unlock(&data->lock, key);
+
+	return num_args;
+}
+
+static int sensirion_emul_write(const struct emul *target, const struct i2c_msg *msg)
+{
+	const struct sensirion_emul_cfg *cfg = target->cfg;
+	struct sensirion_emul_data *data = target->data;
+	uint16_t args[SENSIRION_EMUL_MAX_ARGS];
+	uint8_t num_args;
+	uint16_t cmd;
+
+	if (msg->len < cfg->cmd_size ||
+	    (msg->len - cfg->cmd_size) % SENSIRION_EMUL_FRAME_SIZE != 0) {
+		LOG_DBG("Write of %u bytes is not a command", msg->len);
+		return -EIO;
+	}
+
+	num_args = (msg->len - cfg->cmd_size) / SENSIRION_EMUL_FRAME_SIZE;
+	if (num_args > SENSIRION_EMUL_MAX_ARGS) {
+		LOG_DBG("Command with %u arguments not supported", num_args);
+		return -EIO;
+	}
+
+	cmd = cfg->cmd_size == 1 ? msg->buf[0] : sys_get_be16(msg->buf);
+
+	for (uint8_t i = 0; i < num_args; i++) {
+		const uint8_t *frame = &msg->buf[cfg->cmd_size + i * SENSIRION_EMUL_FRAME_SIZE];
+
+		if (sensirion_emul_crc(frame) != frame[2]) {
+			LOG_DBG("Invalid CRC in argument %u of command 0x%04x", i, cmd);
+			return -EIO;
+		}
+		args[i] = sys_get_be16(frame);
+	}
+
+	/* A new command discards the unread result of the previous one */
+	data->num_response = 0;
+	data->num_commands++;
+
+	if (num_args > 0) {
+		data->last_args_cmd = cmd;
+		data->num_last_args = num_args;
+		memcpy(data->last_args, args, num_args * sizeof(args[0]));
+	}
+
+	return cfg->command(target, cmd, args, num_args);
+}
+
+static int sensirion_emul_read(struct sensirion_emul_data *data, struct i2c_msg *msg)
+{
+	size_t num_words = msg->len / SENSIRION_EMUL_FRAME_SIZE;
+
+	if (data->sleeping || data->num_response == 0) {
+		LOG_DBG("No data to read");
+		return -EIO;
+	}
+
+	if (msg->len % SENSIRION_EMUL_FRAME_SIZE != 0 || num_words > data->num_response) {
+		LOG_DBG("Read of %u bytes does not match the %u words available", msg->len,
+			data->num_response);
+		return -EIO;
+	}
+
+	for (size_t i = 0; i < num_words; i++) {
+		uint8_t *frame = &msg->buf[i * SENSIRION_EMUL_FRAME_SIZE];
+
+		sys_put_be16(data->response[i], frame);
+		frame[2] = sensirion_emul_crc(frame);
+	}
+
+	if (data->crc_error && num_words > 0) {
+		msg->buf[msg->len - 1] ^= 0xFF;
+	}
+
+	/* Results can only be read once */
+	data->num_response = 0;
+
+	return 0;
+}
+
+static int sensirion_emul_transfer_i2c(const struct emul *target, struct i2c_msg *msgs,
+				       int num_msgs, int addr)
+{
+	struct sensirion_emul_data *data = target->data;
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	ARG_UNUSED(addr);
+
+	if (data->nack) {
+		return -EIO;
+	}
+
+	key = k_spin_lock(&data->lock);
+	for (int i = 0; i < num_msgs && ret == 0; i++) {
+		/* The sensor does not respond while it is executing a command */
+		if (k_uptime_ticks() < data->busy_until) {
+			LOG_DBG("Transfer while busy");
+			ret = -EIO;
+			break;
+		}
+
+		if (msgs[i].flags & I2C_MSG_READ) {
+			ret = sensirion_emul_read(data, &msgs[i]);
+		} else {
+			ret = sensirion_emul_write(target, &msgs[i]);
+		}
+	}
+	k_spin_unlock(&data->lock, key);
+
+	return ret;
+}
+
+const struct i2c_emul_api sensirion_emul_api_i2c = {
+	.transfer = sensirion_emul_transfer_i2c,
+};
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SENSIRION_EMUL_H
+#define SENSIRION_EMUL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/kernel.h>
+
+/*
+ * Common part of the I2C emulators of the Sensirion sensors. All of them speak
+ * the same protocol: a write carries an 8- or 16-bit command followed by
+ * CRC-protected argument words, the sensor then executes the command for a
+ * while and NACKs every transfer in the meantime, and a subsequent read
+ * returns the result as CRC-protected words. The core implements the framing,
+ * the CRC checks, the execution time and fault injection, the emulator of a
+ * sensor only decodes its commands in a sensirion_emul_command_t handler.
+ */
+
+/** Maximum number of words a command returns */
+#define SENSIRION_EMUL_MAX_WORDS 9
+
+/** Maximum number of argument words a command takes */
+#define SENSIRION_EMUL_MAX_ARGS 4
+
+/** Physical signals reported by the emulated sensors */
+enum sensirion_emul_signal {
+	/** Temperature in sensor ticks */
+	SENSIRION_EMUL_TEMPERATURE,
+	/** Relative humidity in sensor ticks */
+	SENSIRION_EMUL_HUMIDITY,
+	/** CO2 concentration in ppm */
+	SENSIRION_EMUL_CO2,
+	/** Raw VOC signal (SRAW) in sensor ticks */
+	SENSIRION_EMUL_VOC,
+	SENSIRION_EMUL_NUM_SIGNALS,
+};
+
+/**
+ * typedef sensirion_emul_command_t - execute a command on an emulated sensor
+ *
+ * Called with the emulator locked, so it must not block. The handler updates
+ * the sensor state and announces the result of the command with
+ * sensirion_emul_respond().
+ *
+ * @param target   The emulator
+ * @param cmd      Command as sent on the bus
+ * @param args     Argument words, CRC already checked
+ * @param num_args Number of argument words
+ *
+ * @return 0 to acknowledge the command, -EIO to NACK it
+ */
+typedef int (*sensirion_emul_command_t)(const struct emul *target, uint16_t cmd,
+					 const uint16_t *args, uint8_t num_args);
+
+/*
+ * The configuration and data of every Sensirion emulator start with these
+ * structures, so the common transfer function can access them.
+ */
+struct sensirion_emul_cfg {
+	sensirion_emul_command_t command;
+	/* Width of the commands on the bus in bytes, 1 or 2 */
+	uint8_t cmd_size;
+};
+
+struct sensirion_emul_data {
+	struct k_spinlock lock;
+	uint16_t signals[SENSIRION_EMUL_NUM_SIGNALS];
+	/* Result of the last command, returned by the next read */
+	uint16_t response[SENSIRION_EMUL_MAX_WORDS];
+	uint8_t num_response;
+	/* Uptime in ticks until which the last command executes */
+	int64_t busy_until;
+	uint32_t num_commands;
+	/* Last command that carried arguments, for the tests to check */
+	uint16_t last_args_cmd;
+	uint16_t last_args[SENSIRION_EMUL_MAX_ARGS];
+	uint8_t num_last_args;
+	/* Set by the command handler while the sensor is in a sleep mode */
+	bool sleeping;
+	bool crc_error;
+	bool nack;
+};
+
+/** I2C emulator API shared by all Sensirion emulators */
+extern const struct i2c_emul_api sensirion_emul_api_i2c;
+
+/**
+ * sensirion_emul_init_data() - reset the common emulator state
+ *
+ * Clears injected faults and sets the signals to room conditions: 25 °C,
+ * 50 %RH, 400 ppm CO2 and a typical VOC raw signal.
+ *
+ * @param data Common data of the emulator
+ */
+void sensirion_emul_init_data(struct sensirion_emul_data *data);
+
+/**
+ * sensirion_emul_respond() - complete a command
+ *
+ * To be called from a command handler. The sensor NACKs every transfer for
+ * @p duration_us, afterwards the next read returns @p words.
+ *
+ * @param data        Common data of the emulator
+ * @param words       Result of the command, may be NULL if @p num_words is 0
+ * @param num_words   Number of result words, at most SENSIRION_EMUL_MAX_WORDS
+ * @param duration_us Execution time of the command in microseconds
+ */
+void sensirion_emul_respond(struct sensirion_emul_data *data, const uint16_t *words,
+			    uint8_t num_words, uint32_t duration_us);
+
+/**
+ * sensirion_emul_reset() - reset the common state of an emulator
+ *
+ * Like sensirion_emul_init_data(), for tests that start from a clean
+ * emulator: also forgets the received commands and their arguments.
+ *
+ * @param target The emulator
+ */
+void sensirion_emul_reset(const struct emul *target);
+
+/**
+ * sensirion_emul_set_signal() - set a signal reported by the sensor
+ *
+ * The value is returned by all measurements started afterwards. Sensors that
+ * do not measure @p signal ignore it.
+ *
+ * @param target The emulator
+ * @param signal Signal to set
+ * @param raw    Value as reported by the sensor, see enum sensirion_emul_signal
+ */
+void sensirion_emul_set_signal(const struct emul *target, enum sensirion_emul_signal signal,
+			       uint16_t raw);
+
+/**
+ * sensirion_emul_set_crc_error() - corrupt the CRC of the last word of every read
+ *
+ * @param target The emulator
+ * @param enable true to inject CRC errors
+ */
+void sensirion_emul_set_crc_error(const struct emul *target, bool enable);
+
+/**
+ * sensirion_emul_set_nack() - NACK every transfer
+ *
+ * @param target The emulator
+ * @param enable true to fail all transfers with -EIO
+ */
+void sensirion_emul_set_nack(const struct emul *target, bool enable);
+
+/**
+ * sensirion_emul_get_num_commands() - get the number of commands received
+ *
+ * Counts the well-formed command writes since the emulator was initialized,
+ * including commands NACKed by the sensor.
+ *
+ * @param target The emulator
+ *
+ * @return Number of commands
+ */
+uint32_t sensirion_emul_get_num_commands(const struct emul *target);
+
+/**
+ * sensirion_emul_get_last_args() - get the last command that carried arguments
+ *
+ * @param target The emulator
+ * @param cmd    Receives the command
+ * @param args   Receives its argument words
+ *
+ * @return Number of argument words, 0 if no command carried any
+ */
+int sensirion_emul_get_last_args(const struct emul *target, uint16_t *cmd,
+				  uint16_t args[SENSIRION_EMUL_MAX_ARGS]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSIRION_EMUL_H */
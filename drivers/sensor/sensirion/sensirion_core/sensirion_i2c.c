@@ -10,13 +10,16 @@
 #include <zephyr/device.h>
 #include <zephyr/drivers/i2c.h>
 
-extern uint8_t crc8_poly31_table[256];
-
 uint8_t sensirion_i2c_generate_crc(const uint8_t *data, uint16_t count)
 {
 	uint8_t crc = CRC8_INIT;
+	size_t i = 0;
 
-	for (size_t i = 0; i < count; i++) {
+	/* Two bytes per step, the lookup of the second byte does not depend on the first */
+	for (; i + 1 < count; i += 2) {
+		crc = crc8_poly31_table2[crc ^ data[i]] ^ crc8_poly31_table[data[i + 1]];
+	}
+	if (i < count) {
 		crc = crc8_poly31_table[crc ^ data[i]];
 	}
 	return crc;
@@ -30,6 +33,20 @@ int8_t sensirion_i2c_check_crc(const uint8_t *data, uint16_t count, uint8_t chec
 	return NO_ERROR;
 }
 
+int8_t sensirion_i2c_check_frame(const uint8_t *frame, uint16_t num_words)
+{
+	uint8_t mismatch = 0;
+
+	/* Collect the mismatches of all words instead of branching on each of them */
+	for (uint16_t i = 0; i < num_words; i++) {
+		mismatch |= crc8_poly31_table2[CRC8_INIT ^ frame[0]] ^
+			    crc8_poly31_table[frame[1]] ^ frame[SENSIRION_WORD_SIZE];
+		frame += SENSIRION_WORD_SIZE + CRC8_LEN;
+	}
+
+	return mismatch == 0 ? NO_ERROR : CRC_ERROR;
+}
+
 int sensirion_i2c_general_call_reset(const struct i2c_dt_spec *i2c_spec)
 {
 	const uint8_t data = 0x06;
@@ -51,9 +68,7 @@ uint16_t sensirion_i2c_fill_cmd_send_buf(uint8_t *buf, uint16_t cmd, const uint1
 		buf[idx++] = (uint8_t)((args[i] & 0xFF00) >> 8);
 		buf[idx++] = (uint8_t)((args[i] & 0x00FF) >> 0);
 
-		uint8_t crc =
-			sensirion_i2c_generate_crc((uint8_t *)&buf[idx - 2], SENSIRION_WORD_SIZE);
-		buf[idx++] = crc;
+		buf[idx++] = sensirion_i2c_word_crc(args[i]);
 	}
 	return idx;
 }
@@ -72,15 +87,12 @@ int sensirion_i2c_read_words_as_bytes(const struct i2c_dt_spec *i2c_spec, uint8_
 		return error;
 	}
 
-	/* check the CRC for each word */
-	for (i = 0, j = 0; i < size; i += SENSIRION_WORD_SIZE + CRC8_LEN) {
-
-		error = sensirion_i2c_check_crc(&buf8[i], SENSIRION_WORD_SIZE,
-						buf8[i + SENSIRION_WORD_SIZE]);
-		if (error != NO_ERROR) {
-			return error;
-		}
+	error = sensirion_i2c_check_frame(buf8, num_words);
+	if (error != NO_ERROR) {
+		return error;
+	}
 
+	for (i = 0, j = 0; i < size; i += SENSIRION_WORD_SIZE + CRC8_LEN) {
 		data[j++] = buf8[i];
 		data[j++] = buf8[i + 1];
 	}
@@ -275,13 +287,12 @@ int sensirion_i2c_read_data_inplace(const struct i2c_dt_spec *i2c_spec, uint8_t
 		return error;
 	}
 
-	for (i = 0, j = 0; i < size; i += SENSIRION_WORD_SIZE + CRC8_LEN) {
+	error = sensirion_i2c_check_frame(buffer, expected_data_length / SENSIRION_WORD_SIZE);
+	if (error) {
+		return error;
+	}
 
-		error = sensirion_i2c_check_crc(&buffer[i], SENSIRION_WORD_SIZE,
-						buffer[i + SENSIRION_WORD_SIZE]);
-		if (error) {
-			return error;
-		}
+	for (i = 0, j = 0; i < size; i += SENSIRION_WORD_SIZE + CRC8_LEN) {
 		buffer[j++] = buffer[i];
 		buffer[j++] = buffer[i + 1];
 	}
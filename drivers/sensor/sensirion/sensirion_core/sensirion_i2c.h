@@ -27,10 +27,39 @@ extern "C" {
 #define SENSIRION_NUM_WORDS(x)     (sizeof(x) / SENSIRION_WORD_SIZE)
 #define SENSIRION_MAX_BUFFER_WORDS 32
 
+extern const uint8_t crc8_poly31_table[256];
+extern const uint8_t crc8_poly31_table2[256];
+
 uint8_t sensirion_i2c_generate_crc(const uint8_t *data, uint16_t count);
 
 int8_t sensirion_i2c_check_crc(const uint8_t *data, uint16_t count, uint8_t checksum);
 
+/**
+ * sensirion_i2c_word_crc() - compute the CRC of a single data word
+ *
+ * Both bytes of the word are looked up independently, so the two table reads
+ * do not depend on each other.
+ *
+ * @param word:  Data word, in host byte order
+ *
+ * @return      CRC-8 of the word as sent on the bus
+ */
+static inline uint8_t sensirion_i2c_word_crc(uint16_t word)
+{
+	return crc8_poly31_table2[CRC8_INIT ^ (word >> 8)] ^ crc8_poly31_table[word & 0xFF];
+}
+
+/**
+ * sensirion_i2c_check_frame() - check the CRC of every word of a frame
+ *
+ * @param frame:      Frame as read from the sensor: word MSB, word LSB, CRC
+ *                    for every word
+ * @param num_words:  Number of data words in the frame
+ *
+ * @return      NO_ERROR if all checksums match, CRC_ERROR otherwise
+ */
+int8_t sensirion_i2c_check_frame(const uint8_t *frame, uint16_t num_words);
+
 /**
  * sensirion_i2c_general_call_reset() - Send a general call reset.
  *
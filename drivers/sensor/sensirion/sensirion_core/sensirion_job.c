@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sensirion_job.h"
+
+#include <errno.h>
+
+static void sensirion_job_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct sensirion_job *job = CONTAINER_OF(dwork, struct sensirion_job, work);
+	sensirion_job_callback_t cb;
+	void *user_data;
+	int ret;
+
+	ret = job->step(job);
+	if (ret > 0) {
+		k_work_schedule(&job->work, K_MSEC(ret));
+		return;
+	}
+
+	/* Release the slot first so the callback can start the next job */
+	cb = job->cb;
+	user_data = job->user_data;
+	sensirion_job_release(job);
+
+	if (cb != NULL) {
+		cb(job->dev, ret, user_data);
+	}
+}
+
+void sensirion_job_init(struct sensirion_job *job, const struct device *dev)
+{
+	k_work_init_delayable(&job->work, sensirion_job_handler);
+	job->dev = dev;
+	atomic_clear(&job->busy);
+}
+
+int sensirion_job_start(struct sensirion_job *job, sensirion_job_step_t step, uint16_t arg,
+			void *out, sensirion_job_callback_t cb, void *user_data)
+{
+	int ret;
+
+	ret = sensirion_job_claim(job);
+	if (ret < 0) {
+		return ret;
+	}
+
+	job->step = step;
+	job->arg = arg;
+	job->out = out;
+	job->cb = cb;
+	job->user_data = user_data;
+	job->state = 0;
+
+	k_work_schedule(&job->work, K_NO_WAIT);
+
+	return 0;
+}
+
+int sensirion_job_run(struct sensirion_job *job, sensirion_job_step_t step, uint16_t arg,
+		      void *out)
+{
+	int ret;
+
+	ret = sensirion_job_claim(job);
+	if (ret < 0) {
+		return ret;
+	}
+
+	job->step = step;
+	job->arg = arg;
+	job->out = out;
+	job->cb = NULL;
+	job->user_data = NULL;
+	job->state = 0;
+
+	for (ret = step(job); ret > 0; ret = step(job)) {
+		k_msleep(ret);
+	}
+
+	sensirion_job_release(job);
+
+	return ret;
+}
+
+#ifdef CONFIG_POLL
+void sensirion_job_signal_cb(const struct device *dev, int result, void *user_data)
+{
+	ARG_UNUSED(dev);
+
+	k_poll_signal_raise(user_data, result);
+}
+#endif /* CONFIG_POLL */
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SENSIRION_JOB_H
+#define SENSIRION_JOB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+/*
+ * Some sensor commands take hundreds of milliseconds up to tens of seconds to
+ * execute. A job runs such a command as a state machine on the system work
+ * queue instead of sleeping in the calling thread: every step issues the I2C
+ * transfers that are due and returns the time the sensor needs before the
+ * next step, which is then scheduled on a delayable work item. The caller is
+ * notified through a completion callback once the last step has run.
+ *
+ * The blocking variants of these commands run the same steps through
+ * sensirion_job_run() and claim the same slot, so a blocking command and a
+ * job never talk to the sensor at the same time.
+ */
+
+/** Value returned by a job step when the job is complete */
+#define SENSIRION_JOB_DONE 0
+
+struct sensirion_job;
+
+/**
+ * typedef sensirion_job_step_t - run the next step of a job
+ *
+ * The step function is called from the system work queue. It dispatches on
+ * and advances @c job->state itself.
+ *
+ * @param job The running job
+ *
+ * @return SENSIRION_JOB_DONE when the job is complete, the delay in
+ *         milliseconds until the next step or a negative error code, which
+ *         terminates the job
+ */
+typedef int (*sensirion_job_step_t)(struct sensirion_job *job);
+
+/**
+ * typedef sensirion_job_callback_t - notify the completion of a job
+ *
+ * @param dev       Sensor the job was running on
+ * @param result    0 on success, a negative error code otherwise
+ * @param user_data User data given when the job was started
+ */
+typedef void (*sensirion_job_callback_t)(const struct device *dev, int result, void *user_data);
+
+struct sensirion_job {
+	struct k_work_delayable work;
+	const struct device *dev;
+	sensirion_job_step_t step;
+	sensirion_job_callback_t cb;
+	void *user_data;
+	/* Argument and output of the command, interpreted by the step function */
+	uint16_t arg;
+	void *out;
+	uint8_t state;
+	atomic_t busy;
+};
+
+/**
+ * sensirion_job_init() - initialize the job slot of a sensor instance
+ *
+ * @param job Job slot, usually part of the driver data
+ * @param dev Sensor the jobs run on
+ */
+void sensirion_job_init(struct sensirion_job *job, const struct device *dev);
+
+/**
+ * sensirion_job_start() - start a job
+ *
+ * The first step is scheduled right away with @c job->state set to 0. Only
+ * one job can run per slot at a time.
+ *
+ * @param job       Job slot
+ * @param step      Step function of the job
+ * @param arg       Command argument, available to @p step as @c job->arg
+ * @param out       Command output, available to @p step as @c job->out. Must
+ *                  stay valid until the job has completed.
+ * @param cb        Completion callback, may be NULL
+ * @param user_data Passed to @p cb
+ *
+ * @return 0 on success, -EBUSY if another job is running
+ */
+int sensirion_job_start(struct sensirion_job *job, sensirion_job_step_t step, uint16_t arg,
+			void *out, sensirion_job_callback_t cb, void *user_data);
+
+/**
+ * sensirion_job_run() - run a job in the calling thread
+ *
+ * Blocking counterpart of sensirion_job_start(): the steps run in the calling
+ * thread, which sleeps through the delays between them. The slot is claimed
+ * for the whole run, so jobs started meanwhile fail with -EBUSY.
+ *
+ * @param job  Job slot
+ * @param step Step function of the job
+ * @param arg  Command argument, available to @p step as @c job->arg
+ * @param out  Command output, available to @p step as @c job->out
+ *
+ * @return -EBUSY if another job is running, the result of the job otherwise
+ */
+int sensirion_job_run(struct sensirion_job *job, sensirion_job_step_t step, uint16_t arg,
+		      void *out);
+
+/**
+ * sensirion_job_claim() - claim the slot for a command issued directly
+ *
+ * Short commands that are sent without a job claim the slot while they talk
+ * to the sensor, so that checking for a running job and sending the command
+ * cannot be interleaved with a job being started.
+ *
+ * @param job Job slot
+ *
+ * @return 0 on success, -EBUSY if a job is running
+ */
+static inline int sensirion_job_claim(struct sensirion_job *job)
+{
+	return atomic_cas(&job->busy, 0, 1) ? 0 : -EBUSY;
+}
+
+/**
+ * sensirion_job_release() - release a slot claimed by sensirion_job_claim()
+ *
+ * @param job Job slot
+ */
+static inline void sensirion_job_release(struct sensirion_job *job)
+{
+	atomic_clear(&job->busy);
+}
+
+/**
+ * sensirion_job_busy() - check whether a job is running
+ *
+ * Drivers use this to reject regular requests while the sensor is executing
+ * a long command and would not respond anyway.
+ *
+ * @param job Job slot
+ *
+ * @return true if a job is running
+ */
+static inline bool sensirion_job_busy(struct sensirion_job *job)
+{
+	return atomic_get(&job->busy) != 0;
+}
+
+#ifdef CONFIG_POLL
+/**
+ * sensirion_job_signal_cb() - completion callback raising a poll signal
+ *
+ * Pass this as @p cb and a struct k_poll_signal as @p user_data to wait for
+ * the job with k_poll(). The signal is raised with the job result.
+ */
+void sensirion_job_signal_cb(const struct device *dev, int result, void *user_data);
+#endif /* CONFIG_POLL */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSIRION_JOB_H */
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sensirion_rtio.h"
+#include "sensirion_common.h"
+
+#include <errno.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/sys/byteorder.h>
+
+#define SENSIRION_RTIO_TINY_WRITE_MAX sizeof(((struct rtio_sqe *)NULL)->tiny_tx.buf)
+
+static struct rtio_sqe *sensirion_rtio_acquire(struct rtio *ctx)
+{
+	struct rtio_sqe *sqe = rtio_sqe_acquire(ctx);
+
+	if (sqe == NULL) {
+		rtio_sqe_drop_all(ctx);
+	}
+	return sqe;
+}
+
+static int sensirion_rtio_prep_delay(struct rtio *ctx, uint32_t delay_us)
+{
+	struct rtio_sqe *sqe;
+
+	if (delay_us == 0) {
+		return 0;
+	}
+
+	sqe = sensirion_rtio_acquire(ctx);
+	if (sqe == NULL) {
+		return -ENOMEM;
+	}
+
+	rtio_sqe_prep_delay(sqe, K_USEC(delay_us), NULL);
+	sqe->flags |= RTIO_SQE_CHAINED;
+
+	return 0;
+}
+
+int sensirion_rtio_prep_write(struct rtio *ctx, const struct rtio_iodev *iodev,
+			      const uint8_t *data, uint8_t len, uint32_t delay_us,
+			      uint32_t sqe_flags)
+{
+	struct rtio_sqe *sqe = sensirion_rtio_acquire(ctx);
+
+	if (sqe == NULL) {
+		return -ENOMEM;
+	}
+
+	if (len <= SENSIRION_RTIO_TINY_WRITE_MAX) {
+		rtio_sqe_prep_tiny_write(sqe, iodev, RTIO_PRIO_NORM, data, len, NULL);
+	} else {
+		rtio_sqe_prep_write(sqe, iodev, RTIO_PRIO_NORM, data, len, NULL);
+	}
+	sqe->iodev_flags |= RTIO_IODEV_I2C_STOP;
+	sqe->flags |= RTIO_SQE_CHAINED | sqe_flags;
+
+	return sensirion_rtio_prep_delay(ctx, delay_us);
+}
+
+int sensirion_rtio_prep_cmd(struct rtio *ctx, const struct rtio_iodev *iodev, uint16_t cmd,
+			    uint32_t delay_us, uint32_t sqe_flags)
+{
+	uint8_t buf[SENSIRION_COMMAND_SIZE];
+
+	sys_put_be16(cmd, buf);
+	return sensirion_rtio_prep_write(ctx, iodev, buf, sizeof(buf), delay_us, sqe_flags);
+}
+
+int sensirion_rtio_prep_read(struct rtio *ctx, const struct rtio_iodev *iodev, uint8_t *frame,
+			     uint16_t num_words)
+{
+	struct rtio_sqe *sqe = sensirion_rtio_acquire(ctx);
+
+	if (sqe == NULL) {
+		return -ENOMEM;
+	}
+
+	rtio_sqe_prep_read(sqe, iodev, RTIO_PRIO_NORM, frame, SENSIRION_RTIO_FRAME_SIZE(num_words),
+			   NULL);
+	sqe->iodev_flags |= RTIO_IODEV_I2C_STOP | RTIO_IODEV_I2C_RESTART;
+	sqe->flags |= RTIO_SQE_CHAINED;
+
+	return 0;
+}
+
+int sensirion_rtio_prep_read_cmd(struct rtio *ctx, const struct rtio_iodev *iodev, uint16_t cmd,
+				 uint32_t delay_us, uint8_t *frame, uint16_t num_words)
+{
+	struct rtio_sqe *sqe;
+	uint8_t buf[SENSIRION_COMMAND_SIZE];
+	int ret;
+
+	if (delay_us != 0) {
+		ret = sensirion_rtio_prep_cmd(ctx, iodev, cmd, delay_us, 0);
+		if (ret < 0) {
+			return ret;
+		}
+		return sensirion_rtio_prep_read(ctx, iodev, frame, num_words);
+	}
+
+	/* No execution time: issue the command and the read as one write-read transaction */
+	sqe = sensirion_rtio_acquire(ctx);
+	if (sqe == NULL) {
+		return -ENOMEM;
+	}
+
+	sys_put_be16(cmd, buf);
+	rtio_sqe_prep_tiny_write(sqe, iodev, RTIO_PRIO_NORM, buf, sizeof(buf), NULL);
+	sqe->flags |= RTIO_SQE_TRANSACTION;
+
+	return sensirion_rtio_prep_read(ctx, iodev, frame, num_words);
+}
+
+int sensirion_rtio_submit(struct rtio *ctx, rtio_callback_t cb, void *arg0, void *userdata)
+{
+	struct rtio_sqe *sqe = sensirion_rtio_acquire(ctx);
+
+	if (sqe == NULL) {
+		return -ENOMEM;
+	}
+
+	rtio_sqe_prep_callback_no_cqe(sqe, cb, arg0, userdata);
+	rtio_submit(ctx, 0);
+
+	return 0;
+}
+
+int sensirion_rtio_check_frame(const uint8_t *frame, uint16_t num_words)
+{
+	if (sensirion_i2c_check_frame(frame, num_words) != NO_ERROR) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+int sensirion_rtio_drain(struct rtio *ctx)
+{
+	struct rtio_cqe *cqe;
+	int ret = 0;
+
+	while ((cqe = rtio_cqe_consume(ctx)) != NULL) {
+		if (ret == 0) {
+			ret = cqe->result;
+		}
+		rtio_cqe_release(ctx, cqe);
+	}
+
+	return ret;
+}
+
+int sensirion_rtio_finish(struct rtio *ctx, const uint8_t *frame, uint16_t num_words)
+{
+	int ret = sensirion_rtio_drain(ctx);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	return sensirion_rtio_check_frame(frame, num_words);
+}
+
+int sensirion_rtio_complete(struct rtio *ctx, atomic_t *busy, struct rtio_iodev_sqe *iodev_sqe,
+			    const uint8_t *frame, uint16_t num_words)
+{
+	int ret = sensirion_rtio_finish(ctx, frame, num_words);
+
+	sensirion_rtio_release(busy);
+
+	if (ret < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, 0);
+	}
+
+	return ret;
+}
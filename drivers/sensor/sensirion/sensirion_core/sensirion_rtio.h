@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SENSIRION_RTIO_H
+#define SENSIRION_RTIO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <errno.h>
+#include <stdint.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/atomic.h>
+
+#include "sensirion_i2c.h"
+
+/**
+ * SENSIRION_RTIO_FRAME_SIZE() - size in bytes of a raw frame of CRC-protected
+ *                               words as it is read from the sensor
+ *
+ * @param num_words Number of data words in the frame (without CRC bytes)
+ */
+#define SENSIRION_RTIO_FRAME_SIZE(num_words) ((num_words) * (SENSIRION_WORD_SIZE + CRC8_LEN))
+
+/**
+ * SENSIRION_RTIO_FRAME_WORDS() - number of data words in a raw frame buffer
+ *
+ * @param frame Raw frame buffer (an array, not a pointer)
+ */
+#define SENSIRION_RTIO_FRAME_WORDS(frame) (sizeof(frame) / (SENSIRION_WORD_SIZE + CRC8_LEN))
+
+/*
+ * The helpers below append SQEs to the chain currently being built on an RTIO
+ * context. Every SQE is linked to the next one, so a sequence of
+ * sensirion_rtio_prep_*() calls followed by sensirion_rtio_submit() runs as a
+ * single chain on the RTIO executor: conversion times are waited out by delay
+ * SQEs on the executor timer and no thread sleeps in between. Reads land
+ * directly in the caller's buffer; the CRC bytes stay in place so the buffer
+ * can be handed to a decoder as is.
+ *
+ * If an SQE cannot be acquired, every SQE queued on the context so far is
+ * dropped and -ENOMEM is returned, so callers only need to fail the request.
+ *
+ * Completions are not matched to a chain, so only one chain may be built or be
+ * in flight on a context at a time. Drivers use one context per instance and
+ * guard it with a busy flag through sensirion_rtio_claim() and
+ * sensirion_rtio_release().
+ */
+
+/**
+ * sensirion_rtio_claim() - claim the RTIO context of an instance for a chain
+ *
+ * @param busy Busy flag of the instance
+ *
+ * @return 0 on success, -EBUSY if a chain is already built or in flight
+ */
+static inline int sensirion_rtio_claim(atomic_t *busy)
+{
+	return atomic_cas(busy, 0, 1) ? 0 : -EBUSY;
+}
+
+/**
+ * sensirion_rtio_release() - release the RTIO context of an instance
+ *
+ * Called once the completions of the chain have been consumed, before the
+ * request is completed, so that its completion can submit the next one.
+ *
+ * @param busy Busy flag of the instance
+ */
+static inline void sensirion_rtio_release(atomic_t *busy)
+{
+	atomic_clear(busy);
+}
+
+/**
+ * sensirion_rtio_prep_write() - queue a raw write, optionally followed by a
+ *                               delay
+ *
+ * Writes of up to 7 bytes are copied into the SQE. Longer writes are sent
+ * from @p data, which must stay valid until the chain has completed.
+ *
+ * @param ctx       RTIO context the chain is built on
+ * @param iodev     I2C iodev of the sensor
+ * @param data      Bytes to send
+ * @param len       Number of bytes to send
+ * @param delay_us  Time in microseconds to wait after the write, 0 for none
+ * @param sqe_flags Additional RTIO_SQE_* flags for the write SQE, e.g.
+ *                  RTIO_SQE_NO_RESPONSE for a command that is expected to
+ *                  be NACKed
+ *
+ * @return 0 on success, -ENOMEM if the SQE pool is exhausted
+ */
+int sensirion_rtio_prep_write(struct rtio *ctx, const struct rtio_iodev *iodev,
+			      const uint8_t *data, uint8_t len, uint32_t delay_us,
+			      uint32_t sqe_flags);
+
+/**
+ * sensirion_rtio_prep_cmd() - queue a 16-bit command, optionally followed by
+ *                             its execution time
+ *
+ * @param ctx       RTIO context the chain is built on
+ * @param iodev     I2C iodev of the sensor
+ * @param cmd       Sensor command
+ * @param delay_us  Execution time of the command in microseconds, 0 for none
+ * @param sqe_flags Additional RTIO_SQE_* flags for the write SQE
+ *
+ * @return 0 on success, -ENOMEM if the SQE pool is exhausted
+ */
+int sensirion_rtio_prep_cmd(struct rtio *ctx, const struct rtio_iodev *iodev, uint16_t cmd,
+			    uint32_t delay_us, uint32_t sqe_flags);
+
+/**
+ * sensirion_rtio_prep_read() - queue a read of CRC-protected data words
+ *
+ * @param ctx       RTIO context the chain is built on
+ * @param iodev     I2C iodev of the sensor
+ * @param frame     Buffer receiving the raw frame. Must hold at least
+ *                  SENSIRION_RTIO_FRAME_SIZE(num_words) bytes and stay valid
+ *                  until the chain has completed.
+ * @param num_words Number of data words to read (without CRC bytes)
+ *
+ * @return 0 on success, -ENOMEM if the SQE pool is exhausted
+ */
+int sensirion_rtio_prep_read(struct rtio *ctx, const struct rtio_iodev *iodev, uint8_t *frame,
+			     uint16_t num_words);
+
+/**
+ * sensirion_rtio_prep_read_cmd() - queue a command, wait for the sensor to
+ *                                  process it and read data words back
+ *
+ * This is the asynchronous counterpart of sensirion_i2c_delayed_read_cmd().
+ * Without a delay the command and the read are issued as a single write-read
+ * transaction.
+ *
+ * @param ctx       RTIO context the chain is built on
+ * @param iodev     I2C iodev of the sensor
+ * @param cmd       Sensor command
+ * @param delay_us  Time in microseconds between the command and the read
+ * @param frame     Buffer receiving the raw frame, see
+ *                  sensirion_rtio_prep_read()
+ * @param num_words Number of data words to read (without CRC bytes)
+ *
+ * @return 0 on success, -ENOMEM if the SQE pool is exhausted
+ */
+int sensirion_rtio_prep_read_cmd(struct rtio *ctx, const struct rtio_iodev *iodev, uint16_t cmd,
+				 uint32_t delay_us, uint8_t *frame, uint16_t num_words);
+
+/**
+ * sensirion_rtio_submit() - terminate the chain with a completion callback
+ *                           and submit it
+ *
+ * The callback runs once every SQE of the chain has been processed, also if
+ * one of them failed. It is responsible for consuming the completions, e.g.
+ * with sensirion_rtio_finish().
+ *
+ * @param ctx      RTIO context the chain is built on
+ * @param cb       Completion callback
+ * @param arg0     Argument passed to @p cb
+ * @param userdata Stored in the userdata of the SQE passed to @p cb
+ *
+ * @return 0 on success, -ENOMEM if the SQE pool is exhausted
+ */
+int sensirion_rtio_submit(struct rtio *ctx, rtio_callback_t cb, void *arg0, void *userdata);
+
+/**
+ * sensirion_rtio_check_frame() - verify the CRC of every word in a raw frame
+ *
+ * @param frame     Raw frame as read from the sensor
+ * @param num_words Number of data words in the frame
+ *
+ * @return 0 if all checksums match, -EIO otherwise
+ */
+int sensirion_rtio_check_frame(const uint8_t *frame, uint16_t num_words);
+
+/**
+ * sensirion_rtio_drain() - consume all pending completions of a context
+ *
+ * Completions are not matched to a chain, see sensirion_rtio_claim().
+ *
+ * @param ctx RTIO context
+ *
+ * @return 0 if all operations succeeded, the first error otherwise
+ */
+int sensirion_rtio_drain(struct rtio *ctx);
+
+/**
+ * sensirion_rtio_finish() - consume all pending completions and verify the
+ *                           frame that was read
+ *
+ * @param ctx       RTIO context
+ * @param frame     Raw frame as read from the sensor
+ * @param num_words Number of data words in the frame
+ *
+ * @return 0 on success, the first bus error or -EIO on a CRC mismatch
+ */
+int sensirion_rtio_finish(struct rtio *ctx, const uint8_t *frame, uint16_t num_words);
+
+/**
+ * sensirion_rtio_complete() - finish a chain and complete the sensor request
+ *                             it was issued for
+ *
+ * The context is released in between, see sensirion_rtio_release().
+ *
+ * @param ctx       RTIO context
+ * @param busy      Busy flag the context was claimed with
+ * @param iodev_sqe Sensor request to complete
+ * @param frame     Raw frame as read from the sensor
+ * @param num_words Number of data words in the frame
+ *
+ * @return The result the request was completed with
+ */
+int sensirion_rtio_complete(struct rtio *ctx, atomic_t *busy, struct rtio_iodev_sqe *iodev_sqe,
+			    const uint8_t *frame, uint16_t num_words);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSIRION_RTIO_H */
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sensirion_stream.h"
+
+#include <errno.h>
+#include <zephyr/sys/util.h>
+
+static void sensirion_stream_arm(struct sensirion_stream *stream, int64_t expiry)
+{
+	int64_t delay = expiry - k_uptime_ticks();
+
+	k_timer_start(&stream->timer, K_TICKS(MAX(delay, 0)), K_NO_WAIT);
+}
+
+/* Move the expected time of the next result past @p now */
+static void sensirion_stream_advance(struct sensirion_stream *stream, int64_t now)
+{
+	if (stream->next_sample <= now) {
+		stream->next_sample +=
+			((now - stream->next_sample) / stream->interval + 1) * stream->interval;
+	}
+}
+
+static void sensirion_stream_expiry(struct k_timer *timer)
+{
+	struct sensirion_stream *stream = CONTAINER_OF(timer, struct sensirion_stream, timer);
+	struct rtio_iodev_sqe *iodev_sqe;
+	k_spinlock_key_t key;
+	int ret;
+
+	key = k_spin_lock(&stream->lock);
+	iodev_sqe = stream->iodev_sqe;
+	if (iodev_sqe == NULL || stream->interval == 0) {
+		k_spin_unlock(&stream->lock, key);
+		return;
+	}
+
+	if (FIELD_GET(RTIO_SQE_CANCELED, iodev_sqe->sqe.flags)) {
+		stream->iodev_sqe = NULL;
+		k_spin_unlock(&stream->lock, key);
+		rtio_iodev_sqe_err(iodev_sqe, -ECANCELED);
+		return;
+	}
+
+	stream->reading = true;
+	k_spin_unlock(&stream->lock, key);
+
+	ret = stream->read(stream->dev, iodev_sqe);
+	if (ret < 0) {
+		sensirion_stream_complete(stream, ret);
+	}
+}
+
+void sensirion_stream_init(struct sensirion_stream *stream, const struct device *dev,
+			   sensirion_stream_read_t read)
+{
+	k_timer_init(&stream->timer, sensirion_stream_expiry, NULL);
+	stream->dev = dev;
+	stream->read = read;
+	stream->iodev_sqe = NULL;
+	stream->interval = 0;
+	stream->retries = 0;
+	stream->reading = false;
+}
+
+void sensirion_stream_start(struct sensirion_stream *stream, uint32_t interval_ms)
+{
+	k_spinlock_key_t key = k_spin_lock(&stream->lock);
+
+	stream->interval = k_ms_to_ticks_ceil64(interval_ms);
+	stream->next_sample = k_uptime_ticks() + stream->interval;
+	stream->retries = 0;
+
+	if (stream->iodev_sqe != NULL && !stream->reading) {
+		sensirion_stream_arm(stream, stream->next_sample);
+	}
+
+	k_spin_unlock(&stream->lock, key);
+}
+
+void sensirion_stream_stop(struct sensirion_stream *stream)
+{
+	k_spinlock_key_t key = k_spin_lock(&stream->lock);
+
+	stream->interval = 0;
+	stream->retries = 0;
+	k_timer_stop(&stream->timer);
+
+	k_spin_unlock(&stream->lock, key);
+}
+
+void sensirion_stream_submit(struct sensirion_stream *stream, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	struct rtio_iodev_sqe *canceled = NULL;
+	k_spinlock_key_t key;
+
+	if (read_cfg->count == 0) {
+		rtio_iodev_sqe_err(iodev_sqe, -EINVAL);
+		return;
+	}
+
+	for (size_t i = 0; i < read_cfg->count; i++) {
+		if (read_cfg->triggers[i].trigger != SENSOR_TRIG_DATA_READY) {
+			rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+			return;
+		}
+	}
+
+	key = k_spin_lock(&stream->lock);
+
+	if (stream->interval == 0) {
+		k_spin_unlock(&stream->lock, key);
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	/* A canceled stream is only completed on its next expiry, replace it right away */
+	canceled = stream->iodev_sqe;
+	if (canceled != NULL) {
+		if (stream->reading || !FIELD_GET(RTIO_SQE_CANCELED, canceled->sqe.flags)) {
+			k_spin_unlock(&stream->lock, key);
+			rtio_iodev_sqe_err(iodev_sqe, -EBUSY);
+			return;
+		}
+	}
+
+	stream->iodev_sqe = iodev_sqe;
+	stream->retries = 0;
+	sensirion_stream_arm(stream, stream->next_sample);
+
+	k_spin_unlock(&stream->lock, key);
+
+	if (canceled != NULL) {
+		rtio_iodev_sqe_err(canceled, -ECANCELED);
+	}
+}
+
+void sensirion_stream_complete(struct sensirion_stream *stream, int result)
+{
+	struct rtio_iodev_sqe *iodev_sqe;
+	int64_t now = k_uptime_ticks();
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&stream->lock);
+
+	stream->reading = false;
+	iodev_sqe = stream->iodev_sqe;
+	if (iodev_sqe == NULL) {
+		k_spin_unlock(&stream->lock, key);
+		return;
+	}
+
+	if (result == -EAGAIN && stream->interval == 0) {
+		/* Read again once the periodic measurement restarts */
+		k_spin_unlock(&stream->lock, key);
+		return;
+	}
+
+	if (result == -EAGAIN && stream->retries < SENSIRION_STREAM_RETRIES) {
+		stream->retries++;
+		sensirion_stream_arm(stream,
+				     now + MAX(stream->interval / SENSIRION_STREAM_RETRIES, 1));
+		k_spin_unlock(&stream->lock, key);
+		return;
+	}
+
+	/* While stopped, the next start sets the schedule */
+	if (result == 0 && stream->interval != 0) {
+		if (stream->retries == 0) {
+			/* Results missed in the meantime have been overwritten by the sensor */
+			sensirion_stream_advance(stream, now);
+		} else {
+			/* The result came late, follow the sensor clock */
+			stream->next_sample = now + stream->interval;
+		}
+	}
+
+	/* A multishot request is resubmitted from within the completion */
+	stream->iodev_sqe = NULL;
+	stream->retries = 0;
+
+	k_spin_unlock(&stream->lock, key);
+
+	if (result == 0) {
+		rtio_iodev_sqe_ok(iodev_sqe, 0);
+	} else {
+		rtio_iodev_sqe_err(iodev_sqe, result == -EAGAIN ? -EIO : result);
+	}
+}
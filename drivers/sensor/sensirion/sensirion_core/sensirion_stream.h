@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SENSIRION_STREAM_H
+#define SENSIRION_STREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+
+/*
+ * Sensors in a periodic measurement mode produce a new result once per
+ * measurement interval, but have no data-ready line. Instead of polling a
+ * data-ready status register, a stream arms a timer for the time the next
+ * result is expected and reads it exactly once, which completes one shot of
+ * the multishot SENSOR_TRIG_DATA_READY request the stream was started with.
+ *
+ * The sensor clock is not synchronized with the system clock. A read that
+ * comes too early is NACKed by the sensor; it is retried a few times within
+ * the same interval, and the expected time of the following results is then
+ * realigned to the time the result was found.
+ */
+
+/** Number of retries per measurement interval, also the inverse of the retry period */
+#define SENSIRION_STREAM_RETRIES 16
+
+/**
+ * typedef sensirion_stream_read_t - read the latest measurement of a stream
+ *
+ * Called from the timer expiry function, i.e. in interrupt context, once the
+ * next result is expected. The function submits the read on the RTIO context
+ * of the sensor and passes the outcome to sensirion_stream_complete() from
+ * the completion callback.
+ *
+ * @param dev       Sensor the stream runs on
+ * @param iodev_sqe Stream request, provides the buffer for the result
+ *
+ * @return 0 if the read was submitted, -EAGAIN to retry later or another
+ *         negative error code, which terminates the stream
+ */
+typedef int (*sensirion_stream_read_t)(const struct device *dev,
+				       struct rtio_iodev_sqe *iodev_sqe);
+
+struct sensirion_stream {
+	struct k_timer timer;
+	struct k_spinlock lock;
+	const struct device *dev;
+	sensirion_stream_read_t read;
+	/* Pending stream request, NULL while no stream is running */
+	struct rtio_iodev_sqe *iodev_sqe;
+	/* Measurement interval in ticks, 0 while no periodic measurement runs */
+	k_ticks_t interval;
+	/* Uptime in ticks at which the next result is expected */
+	int64_t next_sample;
+	/* Reads of the current result that came too early */
+	uint8_t retries;
+	/* A read is in flight, the timer is not armed */
+	bool reading;
+};
+
+/**
+ * sensirion_stream_init() - initialize the stream slot of a sensor instance
+ *
+ * @param stream Stream slot, usually part of the driver data
+ * @param dev    Sensor the stream runs on
+ * @param read   Function reading the latest measurement
+ */
+void sensirion_stream_init(struct sensirion_stream *stream, const struct device *dev,
+			   sensirion_stream_read_t read);
+
+/**
+ * sensirion_stream_start() - notify the start of a periodic measurement
+ *
+ * Drivers call this right after sending the command that starts the periodic
+ * measurement. The first result is expected one interval later. A pending
+ * stream request follows the new schedule.
+ *
+ * @param stream      Stream slot
+ * @param interval_ms Measurement interval in milliseconds
+ */
+void sensirion_stream_start(struct sensirion_stream *stream, uint32_t interval_ms);
+
+/**
+ * sensirion_stream_stop() - notify the end of a periodic measurement
+ *
+ * Drivers call this right before sending the command that stops the periodic
+ * measurement. A pending stream request is kept, but no longer read, until
+ * the next sensirion_stream_start().
+ *
+ * @param stream Stream slot
+ */
+void sensirion_stream_stop(struct sensirion_stream *stream);
+
+/**
+ * sensirion_stream_submit() - queue a stream request
+ *
+ * Every trigger of the request must be SENSOR_TRIG_DATA_READY. The request
+ * is completed with an error if the sensor does not measure periodically or
+ * another stream is running.
+ *
+ * @param stream    Stream slot
+ * @param iodev_sqe Streaming request, usually a multishot read
+ */
+void sensirion_stream_submit(struct sensirion_stream *stream, struct rtio_iodev_sqe *iodev_sqe);
+
+/**
+ * sensirion_stream_complete() - report the outcome of a read
+ *
+ * @param stream Stream slot
+ * @param result 0 if a result was read, -EAGAIN if the sensor had no new
+ *               result yet, another negative error code to terminate the
+ *               stream. -EAGAIN keeps the request pending without retrying
+ *               while the periodic measurement is stopped.
+ */
+void sensirion_stream_complete(struct sensirion_stream *stream, int result);
+
+/**
+ * sensirion_stream_active() - check whether a stream request is pending
+ *
+ * Stream reads share the RTIO context of the sensor, so drivers reject one
+ * shot reads while a stream is running.
+ *
+ * @param stream Stream slot
+ *
+ * @return true if a stream request is pending
+ */
+static inline bool sensirion_stream_active(const struct sensirion_stream *stream)
+{
+	return stream->iodev_sqe != NULL;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSIRION_STREAM_H */
@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "sensirion_voc_index.h"
+
+#include <zephyr/sys/util.h>
+
+typedef sensirion_fix16_t fix16_t;
+
+/* Conversion of constants, evaluated at compile time */
+#define F16(x) ((fix16_t)(((x) >= 0) ? ((x) * 65536.0 + 0.5) : ((x) * 65536.0 - 0.5)))
+
+#define FIX16_ONE     F16(1)
+#define FIX16_HALF    F16(0.5)
+#define FIX16_LN2     F16(0.69314718)
+/* Arguments beyond which e^x saturates or rounds to 0 */
+#define FIX16_EXP_MAX F16(10.3972)
+#define FIX16_EXP_MIN F16(-11.7835)
+
+/* Algorithm parameters, in seconds unless noted otherwise */
+#define VOC_INITIAL_BLACKOUT             F16(45)
+#define VOC_INDEX_GAIN                   F16(230)
+#define VOC_SRAW_STD_INITIAL             F16(50)
+#define VOC_SRAW_STD_BONUS               F16(220)
+#define VOC_TAU_MEAN_MS                  (12 * 3600 * 1000ULL)
+#define VOC_TAU_VARIANCE_MS              (12 * 3600 * 1000ULL)
+#define VOC_TAU_INITIAL_MEAN_MS          (20 * 1000ULL)
+#define VOC_TAU_INITIAL_VARIANCE_MS      (2500 * 1000ULL)
+#define VOC_INIT_DURATION_MEAN           F16(3600 * 0.75)
+#define VOC_INIT_DURATION_VARIANCE       F16(3600 * 1.45)
+#define VOC_INIT_TRANSITION              F16(0.01)
+#define VOC_GATING_THRESHOLD             F16(340)
+#define VOC_GATING_THRESHOLD_INITIAL     F16(510)
+#define VOC_GATING_THRESHOLD_TRANSITION  F16(0.09)
+#define VOC_GATING_MAX_DURATION_MINUTES  F16(60 * 3)
+#define VOC_GATING_MAX_RATIO             F16(0.3)
+#define VOC_SIGMOID_L                    F16(500)
+#define VOC_SIGMOID_K                    F16(-0.0065)
+#define VOC_SIGMOID_X0                   F16(213)
+#define VOC_LP_TAU_FAST_MS               (20 * 1000ULL)
+#define VOC_LP_TAU_SLOW_MS               (500 * 1000ULL)
+#define VOC_LP_TAU_FAST                  F16(20)
+#define VOC_LP_TAU_SLOW                  F16(500)
+#define VOC_LP_ALPHA                     F16(-0.2)
+#define VOC_SRAW_MINIMUM                 20000
+#define VOC_SRAW_RANGE                   32767
+#define VOC_SRAW_INVALID                 65000
+
+/*
+ * The variance and the mean are updated with gains far below the resolution
+ * of Q16.16, so both gains are scaled up and the updates scaled down again.
+ */
+#define VOC_GAMMA_SCALING                64
+#define VOC_ADDITIONAL_GAMMA_MEAN_SCALING 8
+#define VOC_STD_SCALING_LIMIT            F16(1440)
+#define VOC_UPTIME_MAX                   F16(32767)
+
+static fix16_t fix16_saturate(int64_t x)
+{
+	return (fix16_t)CLAMP(x, INT32_MIN, INT32_MAX);
+}
+
+static fix16_t fix16_mul(fix16_t a, fix16_t b)
+{
+	return fix16_saturate(((int64_t)a * b + (1 << 15)) >> 16);
+}
+
+static fix16_t fix16_div(fix16_t a, fix16_t b)
+{
+	int64_t num = (int64_t)a * 65536;
+
+	if (b == 0) {
+		return a >= 0 ? INT32_MAX : INT32_MIN;
+	}
+
+	/* Round half away from zero */
+	num += ((num >= 0) == (b >= 0)) ? b / 2 : -(b / 2);
+
+	return fix16_saturate(num / b);
+}
+
+static fix16_t fix16_sqrt(fix16_t x)
+{
+	uint64_t num = (uint64_t)x << 16;
+	uint64_t res = 0;
+	uint64_t bit = 1ULL << 62;
+
+	if (x <= 0) {
+		return 0;
+	}
+
+	while (bit > num) {
+		bit >>= 2;
+	}
+
+	while (bit != 0) {
+		if (num >= res + bit) {
+			num -= res + bit;
+			res = (res >> 1) + bit;
+		} else {
+			res >>= 1;
+		}
+		bit >>= 2;
+	}
+
+	/* Round to nearest */
+	if (num > res) {
+		res++;
+	}
+
+	return (fix16_t)res;
+}
+
+/* e^x = 2^k * e^r with |r| <= ln(2) / 2, e^r from its Taylor series in Q2.30 */
+static fix16_t fix16_exp(fix16_t x)
+{
+	const int64_t one = 1LL << 30;
+	int64_t p = one;
+	int64_t r;
+	int k;
+
+	if (x >= FIX16_EXP_MAX) {
+		return INT32_MAX;
+	}
+	if (x <= FIX16_EXP_MIN) {
+		return 0;
+	}
+
+	k = (x + (x >= 0 ? FIX16_LN2 / 2 : -FIX16_LN2 / 2)) / FIX16_LN2;
+	r = (int64_t)(x - k * FIX16_LN2) * (1 << 14);
+
+	for (int n = 6; n > 0; n--) {
+		p = one + ((r * p) >> 30) / n;
+	}
+
+	/* Scale from Q2.30 to Q16.16 */
+	if (k < 14) {
+		return fix16_saturate((p + (1LL << (13 - k))) >> (14 - k));
+	}
+
+	return fix16_saturate(p << (k - 14));
+}
+
+static fix16_t voc_from_ms(uint64_t num_ms, uint64_t den_ms)
+{
+	return (fix16_t)(((num_ms << 16) + den_ms / 2) / den_ms);
+}
+
+/* 1 / (1 + e^(k * (sample - x0))) */
+static fix16_t voc_sigmoid(fix16_t sample, fix16_t x0, fix16_t k)
+{
+	fix16_t x = fix16_mul(k, sample - x0);
+
+	if (x < F16(-50)) {
+		return FIX16_ONE;
+	}
+	if (x > F16(50)) {
+		return 0;
+	}
+
+	return fix16_div(FIX16_ONE, FIX16_ONE + fix16_exp(x));
+}
+
+static void voc_calculate_gamma(struct sensirion_voc_index *voc)
+{
+	const fix16_t uptime_limit = VOC_UPTIME_MAX - voc->sampling_interval;
+	fix16_t sigmoid_gamma_mean;
+	fix16_t sigmoid_gamma_variance;
+	fix16_t sigmoid_gating_mean;
+	fix16_t sigmoid_gating_variance;
+	fix16_t gamma_mean;
+	fix16_t gamma_variance;
+	fix16_t threshold;
+
+	if (voc->uptime_gamma < uptime_limit) {
+		voc->uptime_gamma += voc->sampling_interval;
+	}
+	if (voc->uptime_gating < uptime_limit) {
+		voc->uptime_gating += voc->sampling_interval;
+	}
+
+	/* Fast initial learning, gated while the index is high */
+	sigmoid_gamma_mean =
+		voc_sigmoid(voc->uptime_gamma, VOC_INIT_DURATION_MEAN, VOC_INIT_TRANSITION);
+	gamma_mean = voc->gamma_mean +
+		     fix16_mul(voc->gamma_initial_mean - voc->gamma_mean, sigmoid_gamma_mean);
+	threshold = VOC_GATING_THRESHOLD +
+		    fix16_mul(VOC_GATING_THRESHOLD_INITIAL - VOC_GATING_THRESHOLD,
+			      voc_sigmoid(voc->uptime_gating, VOC_INIT_DURATION_MEAN,
+					  VOC_INIT_TRANSITION));
+	sigmoid_gating_mean =
+		voc_sigmoid(voc->gas_index, threshold, VOC_GATING_THRESHOLD_TRANSITION);
+	voc->cur_gamma_mean = fix16_mul(sigmoid_gating_mean, gamma_mean);
+
+	sigmoid_gamma_variance =
+		voc_sigmoid(voc->uptime_gamma, VOC_INIT_DURATION_VARIANCE, VOC_INIT_TRANSITION);
+	gamma_variance = voc->gamma_variance +
+			 fix16_mul(voc->gamma_initial_variance - voc->gamma_variance,
+				   sigmoid_gamma_variance - sigmoid_gamma_mean);
+	threshold = VOC_GATING_THRESHOLD +
+		    fix16_mul(VOC_GATING_THRESHOLD_INITIAL - VOC_GATING_THRESHOLD,
+			      voc_sigmoid(voc->uptime_gating, VOC_INIT_DURATION_VARIANCE,
+					  VOC_INIT_TRANSITION));
+	sigmoid_gating_variance =
+		voc_sigmoid(voc->gas_index, threshold, VOC_GATING_THRESHOLD_TRANSITION);
+	voc->cur_gamma_variance = fix16_mul(sigmoid_gating_variance, gamma_variance);
+
+	/* Gating may not last forever, the estimator would never adapt otherwise */
+	voc->gating_duration_minutes +=
+		fix16_mul(voc->gating_step,
+			  fix16_mul(FIX16_ONE - sigmoid_gating_mean,
+				    FIX16_ONE + VOC_GATING_MAX_RATIO) -
+				  VOC_GATING_MAX_RATIO);
+	if (voc->gating_duration_minutes < 0) {
+		voc->gating_duration_minutes = 0;
+	}
+	if (voc->gating_duration_minutes > VOC_GATING_MAX_DURATION_MINUTES) {
+		voc->uptime_gating = 0;
+	}
+}
+
+static void voc_estimate(struct sensirion_voc_index *voc, fix16_t sraw)
+{
+	fix16_t additional_scaling = FIX16_ONE;
+	fix16_t delta;
+	fix16_t c;
+
+	if (!voc->estimator_initialized) {
+		voc->estimator_initialized = true;
+		voc->sraw_offset = sraw;
+		voc->mean = 0;
+		return;
+	}
+
+	/* Keep the mean small, it is tracked relative to an offset */
+	if (voc->mean >= F16(100) || voc->mean <= F16(-100)) {
+		voc->sraw_offset += voc->mean;
+		voc->mean = 0;
+	}
+	sraw -= voc->sraw_offset;
+
+	voc_calculate_gamma(voc);
+
+	delta = fix16_div(sraw - voc->mean, F16(VOC_GAMMA_SCALING));
+	c = voc->std + (delta < 0 ? -delta : delta);
+	if (c > VOC_STD_SCALING_LIMIT) {
+		fix16_t ratio = fix16_div(c, VOC_STD_SCALING_LIMIT);
+
+		additional_scaling = fix16_mul(ratio, ratio);
+	}
+
+	voc->std = fix16_mul(
+		fix16_sqrt(fix16_mul(additional_scaling,
+				     F16(VOC_GAMMA_SCALING) - voc->cur_gamma_variance)),
+		fix16_sqrt(fix16_mul(voc->std,
+				     fix16_div(voc->std, fix16_mul(F16(VOC_GAMMA_SCALING),
+								   additional_scaling))) +
+			   fix16_mul(fix16_div(fix16_mul(voc->cur_gamma_variance, delta),
+					       additional_scaling),
+				     delta)));
+	voc->mean += fix16_div(fix16_mul(voc->cur_gamma_mean, delta),
+			       F16(VOC_ADDITIONAL_GAMMA_MEAN_SCALING));
+}
+
+/* Deviation from the mean, normalized by the standard deviation */
+static fix16_t voc_mox_model(const struct sensirion_voc_index *voc, fix16_t sraw)
+{
+	return fix16_mul(fix16_div(sraw - voc->mox_mean, -(voc->mox_std + VOC_SRAW_STD_BONUS)),
+			 VOC_INDEX_GAIN);
+}
+
+/*
+ * Map the deviation to 0 to 500, the mean to 100. With the default index
+ * offset of 100 the shift of the upper half of the sigmoid is 0.
+ */
+static fix16_t voc_sigmoid_scaled(fix16_t sample)
+{
+	fix16_t x = fix16_mul(VOC_SIGMOID_K, sample - VOC_SIGMOID_X0);
+
+	if (x < F16(-50)) {
+		return VOC_SIGMOID_L;
+	}
+	if (x > F16(50)) {
+		return 0;
+	}
+
+	return fix16_div(VOC_SIGMOID_L, FIX16_ONE + fix16_exp(x));
+}
+
+/* Low-pass filter that follows fast changes and smooths out noise */
+static fix16_t voc_adaptive_lowpass(struct sensirion_voc_index *voc, fix16_t sample)
+{
+	fix16_t abs_delta;
+	fix16_t tau;
+	fix16_t a3;
+
+	if (!voc->lp_initialized) {
+		voc->lp_x1 = sample;
+		voc->lp_x2 = sample;
+		voc->lp_x3 = sample;
+		voc->lp_initialized = true;
+	}
+
+	voc->lp_x1 += fix16_mul(voc->lp_a1, sample - voc->lp_x1);
+	voc->lp_x2 += fix16_mul(voc->lp_a2, sample - voc->lp_x2);
+
+	abs_delta = voc->lp_x1 - voc->lp_x2;
+	if (abs_delta < 0) {
+		abs_delta = -abs_delta;
+	}
+
+	tau = fix16_mul(VOC_LP_TAU_SLOW - VOC_LP_TAU_FAST,
+			fix16_exp(fix16_mul(VOC_LP_ALPHA, abs_delta))) +
+	      VOC_LP_TAU_FAST;
+	a3 = fix16_div(voc->sampling_interval, voc->sampling_interval + tau);
+	voc->lp_x3 += fix16_mul(a3, sample - voc->lp_x3);
+
+	return voc->lp_x3;
+}
+
+void sensirion_voc_index_init(struct sensirion_voc_index *voc, uint32_t sampling_interval_ms)
+{
+	const uint64_t dt = sampling_interval_ms;
+
+	*voc = (struct sensirion_voc_index){0};
+
+	voc->sampling_interval = voc_from_ms(dt, 1000);
+	voc->gating_step = voc_from_ms(dt, 60 * 1000);
+
+	/* gamma = scaling * dt / (tau + dt), computed from milliseconds for precision */
+	voc->gamma_mean = voc_from_ms(VOC_ADDITIONAL_GAMMA_MEAN_SCALING * VOC_GAMMA_SCALING * dt,
+				      VOC_TAU_MEAN_MS + dt);
+	voc->gamma_variance = voc_from_ms(VOC_GAMMA_SCALING * dt, VOC_TAU_VARIANCE_MS + dt);
+	voc->gamma_initial_mean =
+		voc_from_ms(VOC_ADDITIONAL_GAMMA_MEAN_SCALING * VOC_GAMMA_SCALING * dt,
+			    VOC_TAU_INITIAL_MEAN_MS + dt);
+	voc->gamma_initial_variance =
+		voc_from_ms(VOC_GAMMA_SCALING * dt, VOC_TAU_INITIAL_VARIANCE_MS + dt);
+	voc->std = VOC_SRAW_STD_INITIAL;
+
+	voc->mox_mean = voc->mean + voc->sraw_offset;
+	voc->mox_std = voc->std;
+
+	voc->lp_a1 = voc_from_ms(dt, VOC_LP_TAU_FAST_MS + dt);
+	voc->lp_a2 = voc_from_ms(dt, VOC_LP_TAU_SLOW_MS + dt);
+}
+
+int32_t sensirion_voc_index_process(struct sensirion_voc_index *voc, uint16_t sraw)
+{
+	if (voc->uptime <= VOC_INITIAL_BLACKOUT) {
+		/* The sensor is still heating up */
+		voc->uptime += voc->sampling_interval;
+	} else {
+		if (sraw > 0 && sraw < VOC_SRAW_INVALID) {
+			int32_t offset = CLAMP((int32_t)sraw - VOC_SRAW_MINIMUM, 1, VOC_SRAW_RANGE);
+
+			voc->sraw = offset << 16;
+		}
+
+		voc->gas_index = voc_sigmoid_scaled(voc_mox_model(voc, voc->sraw));
+		voc->gas_index = voc_adaptive_lowpass(voc, voc->gas_index);
+		if (voc->gas_index < FIX16_HALF) {
+			voc->gas_index = FIX16_HALF;
+		}
+
+		if (voc->sraw > 0) {
+			voc_estimate(voc, voc->sraw);
+			voc->mox_std = voc->std;
+			voc->mox_mean = voc->mean + voc->sraw_offset;
+		}
+	}
+
+	return (voc->gas_index + FIX16_HALF) >> 16;
+}
+
+int32_t sensirion_voc_index_process_batch(struct sensirion_voc_index *voc, const uint16_t *sraw,
+					  size_t count, int32_t *indices)
+{
+	int32_t index = (voc->gas_index + FIX16_HALF) >> 16;
+
+	for (size_t i = 0; i < count; i++) {
+		index = sensirion_voc_index_process(voc, sraw[i]);
+		if (indices != NULL) {
+			indices[i] = index;
+		}
+	}
+
+	return index;
+}
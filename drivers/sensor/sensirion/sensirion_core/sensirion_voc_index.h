@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SENSIRION_VOC_INDEX_H
+#define SENSIRION_VOC_INDEX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * The VOC index maps the raw signal (SRAW) of a Sensirion VOC sensor to a
+ * scale from 1 to 500, where 100 is the average of the last 24 hours. It is
+ * computed by the Sensirion gas index algorithm, which tracks the mean and
+ * the variance of the raw signal, scales the deviation of every sample with
+ * a sigmoid and smooths the result with an adaptive low-pass filter.
+ *
+ * This is an implementation of the algorithm in Q16.16 fixed point: it needs
+ * neither an FPU nor a math library, and all of its state lives in struct
+ * sensirion_voc_index. The index stays at 0 during the first 45 seconds
+ * while the sensor heats up; samples must be processed at the sampling
+ * interval the state was initialized with.
+ */
+
+/** Q16.16 fixed point number */
+typedef int32_t sensirion_fix16_t;
+
+struct sensirion_voc_index {
+	sensirion_fix16_t sampling_interval;
+	sensirion_fix16_t uptime;
+	sensirion_fix16_t sraw;
+	sensirion_fix16_t gas_index;
+	/* Mean and variance estimator */
+	sensirion_fix16_t gamma_mean;
+	sensirion_fix16_t gamma_variance;
+	sensirion_fix16_t gamma_initial_mean;
+	sensirion_fix16_t gamma_initial_variance;
+	sensirion_fix16_t gating_step;
+	sensirion_fix16_t cur_gamma_mean;
+	sensirion_fix16_t cur_gamma_variance;
+	sensirion_fix16_t uptime_gamma;
+	sensirion_fix16_t uptime_gating;
+	sensirion_fix16_t gating_duration_minutes;
+	sensirion_fix16_t mean;
+	sensirion_fix16_t sraw_offset;
+	sensirion_fix16_t std;
+	/* Mean and standard deviation the MOX model is normalized with */
+	sensirion_fix16_t mox_mean;
+	sensirion_fix16_t mox_std;
+	/* Adaptive low-pass filter */
+	sensirion_fix16_t lp_a1;
+	sensirion_fix16_t lp_a2;
+	sensirion_fix16_t lp_x1;
+	sensirion_fix16_t lp_x2;
+	sensirion_fix16_t lp_x3;
+	bool estimator_initialized;
+	bool lp_initialized;
+};
+
+/**
+ * sensirion_voc_index_init() - reset the VOC index state
+ *
+ * @param voc                  VOC index state
+ * @param sampling_interval_ms Interval between two samples in milliseconds,
+ *                             1000 is the interval the algorithm is tuned for
+ */
+void sensirion_voc_index_init(struct sensirion_voc_index *voc, uint32_t sampling_interval_ms);
+
+/**
+ * sensirion_voc_index_process() - process the next raw sample
+ *
+ * @param voc  VOC index state
+ * @param sraw Raw signal of the sensor in ticks. 0 and values from 65000 on
+ *             are invalid, the last valid sample is used instead.
+ *
+ * @return VOC index from 1 to 500, 0 during the initial blackout
+ */
+int32_t sensirion_voc_index_process(struct sensirion_voc_index *voc, uint16_t sraw);
+
+/**
+ * sensirion_voc_index_process_batch() - process a series of raw samples
+ *
+ * Equivalent to calling sensirion_voc_index_process() for every sample, e.g.
+ * to catch up with samples that were recorded while the index was not being
+ * computed.
+ *
+ * @param voc     VOC index state
+ * @param sraw    Raw samples, oldest first
+ * @param count   Number of samples
+ * @param indices Receives the VOC index after every sample, may be NULL
+ *
+ * @return VOC index after the last sample
+ */
+int32_t sensirion_voc_index_process_batch(struct sensirion_voc_index *voc, const uint16_t *sraw,
+					  size_t count, int32_t *indices);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSIRION_VOC_INDEX_H */
@@ -13,22 +13,17 @@
 #include <zephyr/logging/log.h>
 #include <zephyr/pm/device.h>
 #include <zephyr/sys/byteorder.h>
-#include <zephyr/sys/crc.h>
+#include <zephyr/rtio/rtio.h>
 
 #include <zephyr/drivers/sensor/sgp40.h>
+#include <zephyr/drivers/sensor/sensirion_batch.h>
 #include "sgp40.h"
+#include "sgp40_decoder.h"
+#include "../sensirion_core/sensirion_common.h"
+#include "../sensirion_core/sensirion_rtio.h"
 
 LOG_MODULE_REGISTER(SGP40, CONFIG_SENSOR_LOG_LEVEL);
 
-static uint8_t sgp40_compute_crc(uint16_t value)
-{
-	uint8_t buf[2];
-
-	sys_put_be16(value, buf);
-
-	return crc8(buf, 2, SGP40_CRC_POLY, SGP40_CRC_INIT, false);
-}
-
 static int sgp40_write_command(const struct device *dev, uint16_t cmd)
 {
 
@@ -40,19 +35,92 @@ static int sgp40_write_command(const struct device *dev, uint16_t cmd)
 	return i2c_write_dt(&cfg->bus, tx_buf, sizeof(tx_buf));
 }
 
-static int sgp40_start_measurement(const struct device *dev)
+#ifdef CONFIG_SENSIRION_COMP
+/*
+ * Compensate with the latest sample of the compensation source instead of the
+ * attributes, once there is one. The temperature ticks of the SGP40 are the
+ * same as those of the SHT4x, the humidity ticks span 0 to 100 %RH instead of
+ * -6 to 119 %RH.
+ */
+static bool sgp40_put_comp_sample(const struct device *dev, uint8_t tx_buf[8])
 {
 	const struct sgp40_config *cfg = dev->config;
-	struct sgp40_data *data = dev->data;
-	uint8_t tx_buf[8];
+	uint32_t sample = sensirion_comp_get(cfg->comp);
+	uint16_t t_ticks = sensirion_comp_t_ticks(sample);
+	int32_t rh_ticks;
+
+	if (sample == 0) {
+		return false;
+	}
+
+	rh_ticks = ((int32_t)sensirion_comp_rh_ticks(sample) * 125 - 6 * 65535) / 100;
+	rh_ticks = CLAMP(rh_ticks, 0, UINT16_MAX);
+
+	sys_put_be16((uint16_t)rh_ticks, &tx_buf[2]);
+	tx_buf[4] = sensirion_i2c_word_crc((uint16_t)rh_ticks);
+	sys_put_be16(t_ticks, &tx_buf[5]);
+	tx_buf[7] = sensirion_i2c_word_crc(t_ticks);
+
+	return true;
+}
+#endif /* CONFIG_SENSIRION_COMP */
+
+static void sgp40_fill_measure_cmd(const struct device *dev, uint8_t tx_buf[8])
+{
+	const struct sgp40_data *data = dev->data;
 
 	sys_put_be16(SGP40_CMD_MEASURE_RAW, tx_buf);
+#ifdef CONFIG_SENSIRION_COMP
+	if (sgp40_put_comp_sample(dev, tx_buf)) {
+		return;
+	}
+#endif
 	sys_put_be24(sys_get_be24(data->rh_param), &tx_buf[2]);
 	sys_put_be24(sys_get_be24(data->t_param), &tx_buf[5]);
+}
+
+static int sgp40_start_measurement(const struct device *dev)
+{
+	const struct sgp40_config *cfg = dev->config;
+	uint8_t tx_buf[8];
+
+	sgp40_fill_measure_cmd(dev, tx_buf);
 
 	return i2c_write_dt(&cfg->bus, tx_buf, sizeof(tx_buf));
 }
 
+#ifdef CONFIG_SGP40_VOC_INDEX
+static int32_t sgp40_voc_index_update(const struct device *dev, uint16_t sraw, bool own)
+{
+	struct sgp40_data *data = dev->data;
+	k_spinlock_key_t key = k_spin_lock(&data->voc_lock);
+	int32_t index = sensirion_voc_index_process(&data->voc, sraw);
+
+	data->voc_index = index;
+	data->voc_driver_fed |= own;
+	k_spin_unlock(&data->voc_lock, key);
+
+	return index;
+}
+
+int32_t sgp40_voc_index_feed(const struct device *dev, const uint16_t *sraw, size_t count,
+			     int32_t *indices)
+{
+	struct sgp40_data *data = dev->data;
+	int32_t index = data->voc_index;
+
+	/* One sample at a time, so that completions are not held off for long */
+	for (size_t i = 0; i < count; i++) {
+		index = sgp40_voc_index_update(dev, sraw[i], false);
+		if (indices != NULL) {
+			indices[i] = index;
+		}
+	}
+
+	return index;
+}
+#endif /* CONFIG_SGP40_VOC_INDEX */
+
 static int sgp40_attr_set(const struct device *dev,
 				enum sensor_channel chan,
 				enum sensor_attribute attr,
@@ -75,7 +143,7 @@ static int sgp40_attr_set(const struct device *dev,
 		/* adding +87 to avoid most rounding errors through truncation */
 		t_ticks = (uint16_t)((((tmp + 45) * 65535) + 87) / 175);
 		sys_put_be16(t_ticks, data->t_param);
-		data->t_param[2] = sgp40_compute_crc(t_ticks);
+		data->t_param[2] = sensirion_i2c_word_crc(t_ticks);
 	}
 		break;
 	case SENSOR_ATTR_SGP40_HUMIDITY:
@@ -87,7 +155,7 @@ static int sgp40_attr_set(const struct device *dev,
 		/* adding +50 to eliminate rounding errors through truncation */
 		rh_ticks = (uint16_t)(((tmp * 65535U) + 50U) / 100U);
 		sys_put_be16(rh_ticks, data->rh_param);
-		data->rh_param[2] = sgp40_compute_crc(rh_ticks);
+		data->rh_param[2] = sensirion_i2c_word_crc(rh_ticks);
 	}
 		break;
 	default:
@@ -117,12 +185,13 @@ static int sgp40_selftest(const struct device *dev)
 		return rc;
 	}
 
-	raw_sample = sys_get_be16(rx_buf);
-	if (sgp40_compute_crc(raw_sample) != rx_buf[2]) {
+	if (sensirion_i2c_check_frame(rx_buf, 1) != NO_ERROR) {
 		LOG_ERR("Received invalid CRC from selftest.");
 		return -EIO;
 	}
 
+	raw_sample = sys_get_be16(rx_buf);
+
 	if (raw_sample != SGP40_TEST_OK) {
 		LOG_ERR("Selftest failed.");
 		return -EIO;
@@ -137,10 +206,10 @@ static int sgp40_sample_fetch(const struct device *dev,
 	struct sgp40_data *data = dev->data;
 	const struct sgp40_config *cfg = dev->config;
 	uint8_t rx_buf[3];
-	uint16_t raw_sample;
 	int rc;
 
-	if (chan != SENSOR_CHAN_GAS_RES && chan != SENSOR_CHAN_ALL) {
+	if (chan != SENSOR_CHAN_GAS_RES && chan != SENSOR_CHAN_ALL &&
+	    !(IS_ENABLED(CONFIG_SGP40_VOC_INDEX) && chan == SENSOR_CHAN_VOC)) {
 		return -ENOTSUP;
 	}
 
@@ -158,13 +227,16 @@ static int sgp40_sample_fetch(const struct device *dev,
 		return rc;
 	}
 
-	raw_sample = sys_get_be16(rx_buf);
-	if (sgp40_compute_crc(raw_sample) != rx_buf[2]) {
+	if (sensirion_i2c_check_frame(rx_buf, 1) != NO_ERROR) {
 		LOG_ERR("Invalid CRC8 for data sample.");
 		return -EIO;
 	}
 
-	data->raw_sample = raw_sample;
+	data->raw_sample = sys_get_be16(rx_buf);
+
+#ifdef CONFIG_SGP40_VOC_INDEX
+	(void)sgp40_voc_index_update(dev, data->raw_sample, true);
+#endif
 
 	return 0;
 }
@@ -175,16 +247,148 @@ static int sgp40_channel_get(const struct device *dev,
 {
 	const struct sgp40_data *data = dev->data;
 
-	if (chan != SENSOR_CHAN_GAS_RES) {
+	switch (chan) {
+	case SENSOR_CHAN_GAS_RES:
+		val->val1 = data->raw_sample;
+		break;
+#ifdef CONFIG_SGP40_VOC_INDEX
+	case SENSOR_CHAN_VOC:
+		val->val1 = data->voc_index;
+		break;
+#endif
+	default:
 		return -ENOTSUP;
 	}
-
-	val->val1 = data->raw_sample;
 	val->val2 = 0;
 
 	return 0;
 }
 
+#ifdef CONFIG_SENSOR_ASYNC_API
+static void sgp40_complete_result(struct rtio *ctx, const struct rtio_sqe *sqe, int result,
+				  void *arg)
+{
+	struct rtio_iodev_sqe *iodev_sqe = (struct rtio_iodev_sqe *)arg;
+	struct sgp40_encoded_data *edata = sqe->userdata;
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	struct sgp40_data *data = read_cfg->sensor->data;
+	int rc;
+
+	ARG_UNUSED(result);
+
+	rc = sensirion_rtio_finish(ctx, edata->frame, SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+	sensirion_rtio_release(&data->rtio_busy);
+	if (rc < 0) {
+		LOG_ERR("Failed to read data sample.");
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+		return;
+	}
+
+#ifdef CONFIG_SGP40_VOC_INDEX
+	edata->voc_index = (int16_t)sgp40_voc_index_update(read_cfg->sensor,
+							   sys_get_be16(edata->frame), true);
+#endif
+
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+static void sgp40_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	const struct sgp40_config *cfg = dev->config;
+	struct sgp40_data *data = dev->data;
+	uint32_t min_buf_len = sizeof(struct sgp40_encoded_data);
+	struct sgp40_encoded_data *edata;
+	uint8_t *buf;
+	uint32_t buf_len;
+	int rc;
+
+	if (read_cfg->is_streaming) {
+		LOG_ERR("Streaming not supported");
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	rc = rtio_sqe_rx_buf(iodev_sqe, min_buf_len, min_buf_len, &buf, &buf_len);
+	if (rc < 0 || buf_len < min_buf_len) {
+		LOG_ERR("Failed to get a read buffer of size %u bytes", min_buf_len);
+		rtio_iodev_sqe_err(iodev_sqe, rc < 0 ? rc : -ENOMEM);
+		return;
+	}
+
+	edata = (struct sgp40_encoded_data *)buf;
+
+	rc = sgp40_encode(dev, read_cfg, buf);
+	if (rc < 0) {
+		LOG_ERR("Failed to encode sensor data");
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+		return;
+	}
+
+	rc = sensirion_rtio_claim(&data->rtio_busy);
+	if (rc < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+		return;
+	}
+
+	sgp40_fill_measure_cmd(dev, edata->cmd);
+
+	/* The command is longer than a tiny write and is sent from the read buffer */
+	rc = sensirion_rtio_prep_write(cfg->rtio_ctx, cfg->iodev, edata->cmd, sizeof(edata->cmd),
+				       SGP40_MEASURE_WAIT_MS * USEC_PER_MSEC, 0);
+	if (rc == 0) {
+		rc = sensirion_rtio_prep_read(cfg->rtio_ctx, cfg->iodev, edata->frame,
+					      SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+	}
+	if (rc == 0) {
+		rc = sensirion_rtio_submit(cfg->rtio_ctx, sgp40_complete_result, iodev_sqe, edata);
+	}
+	if (rc < 0) {
+		LOG_ERR("Failed to acquire SQEs");
+		sensirion_rtio_release(&data->rtio_busy);
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+	}
+}
+
+#ifdef CONFIG_SENSIRION_BATCH
+static int sgp40_batch_prep(const struct device *dev, const struct sensor_read_config *read_cfg,
+			    uint8_t *buf, struct sensirion_batch_measurement *meas)
+{
+	const struct sgp40_config *cfg = dev->config;
+	struct sgp40_encoded_data *edata = (struct sgp40_encoded_data *)buf;
+	int rc;
+
+#ifdef CONFIG_SGP40_VOC_INDEX
+	const struct sgp40_data *data = dev->data;
+
+	/* A batched sample would be missing from the index the driver keeps */
+	if (data->voc_driver_fed) {
+		LOG_DBG("VOC index is fed by the driver");
+		return -EBUSY;
+	}
+#endif
+
+	rc = sgp40_encode(dev, read_cfg, buf);
+	if (rc < 0) {
+		return rc;
+	}
+
+	/* Batched reads bypass the driver, see sgp40_voc_index_feed() */
+	edata->header.has_voc = false;
+
+	BUILD_ASSERT(sizeof(edata->cmd) <= SENSIRION_BATCH_CMD_MAX);
+
+	meas->iodev = cfg->iodev;
+	sgp40_fill_measure_cmd(dev, meas->cmd);
+	meas->cmd_len = sizeof(edata->cmd);
+	meas->delay_us = SGP40_MEASURE_WAIT_MS * USEC_PER_MSEC;
+	meas->frame = edata->frame;
+	meas->num_words = SENSIRION_RTIO_FRAME_WORDS(edata->frame);
+
+	return 0;
+}
+#endif /* CONFIG_SENSIRION_BATCH */
+#endif /* CONFIG_SENSOR_ASYNC_API */
 
 #ifdef CONFIG_PM_DEVICE
 static int sgp40_pm_action(const struct device *dev,
@@ -211,6 +415,9 @@ static int sgp40_pm_action(const struct device *dev,
 static int sgp40_init(const struct device *dev)
 {
 	const struct sgp40_config *cfg = dev->config;
+#ifdef CONFIG_SGP40_VOC_INDEX
+	struct sgp40_data *data = dev->data;
+#endif
 	struct sensor_value comp_data;
 
 	if (!device_is_ready(cfg->bus.bus)) {
@@ -228,6 +435,10 @@ static int sgp40_init(const struct device *dev)
 		LOG_DBG("Selftest succeeded!");
 	}
 
+#ifdef CONFIG_SGP40_VOC_INDEX
+	sensirion_voc_index_init(&data->voc, CONFIG_SGP40_VOC_INDEX_SAMPLING_INTERVAL_MS);
+#endif
+
 	comp_data.val1 = SGP40_COMP_DEFAULT_T;
 	sensor_attr_set(dev,
 			SENSOR_CHAN_GAS_RES,
@@ -246,14 +457,32 @@ static DEVICE_API(sensor, sgp40_api) = {
 	.sample_fetch = sgp40_sample_fetch,
 	.channel_get = sgp40_channel_get,
 	.attr_set = sgp40_attr_set,
+#ifdef CONFIG_SENSOR_ASYNC_API
+	.submit = sgp40_submit,
+	.get_decoder = sgp40_get_decoder,
+#endif
 };
 
+#define SGP40_RTIO_DEFINE(n)					\
+	RTIO_DEFINE(sgp40_rtio_ctx_##n, 8, 8);			\
+	I2C_DT_IODEV_DEFINE(sgp40_iodev_##n, DT_DRV_INST(n));
+
 #define SGP40_INIT(n)						\
 	static struct sgp40_data sgp40_data_##n;		\
 								\
+	IF_ENABLED(CONFIG_SENSIRION_COMP,			\
+		   (SENSIRION_COMP_SOURCE_DT_INST_DECLARE(n)))	\
+								\
+	IF_ENABLED(CONFIG_SENSOR_ASYNC_API, (SGP40_RTIO_DEFINE(n)))	\
+								\
 	static const struct sgp40_config sgp40_config_##n = {	\
 		.bus = I2C_DT_SPEC_INST_GET(n),			\
 		.selftest = DT_INST_PROP(n, enable_selftest),	\
+		IF_ENABLED(CONFIG_SENSIRION_COMP,		\
+			   (.comp = SENSIRION_COMP_SOURCE_DT_INST_GET(n),))	\
+		IF_ENABLED(CONFIG_SENSOR_ASYNC_API,		\
+			   (.rtio_ctx = &sgp40_rtio_ctx_##n,	\
+			    .iodev = &sgp40_iodev_##n,))	\
 	};							\
 								\
 	PM_DEVICE_DT_INST_DEFINE(n, sgp40_pm_action);		\
@@ -265,6 +494,10 @@ static DEVICE_API(sensor, sgp40_api) = {
 			      &sgp40_config_##n,		\
 			      POST_KERNEL,			\
 			      CONFIG_SENSOR_INIT_PRIORITY,	\
-			      &sgp40_api);
+			      &sgp40_api);			\
+	IF_ENABLED(CONFIG_SENSIRION_BATCH,			\
+		   (SENSIRION_BATCH_SENSOR_DEFINE(sgp40_batch_##n,	\
+			DEVICE_DT_INST_GET(n), sgp40_batch_prep,	\
+			sizeof(struct sgp40_encoded_data));))
 
 DT_INST_FOREACH_STATUS_OKAY(SGP40_INIT)
@@ -8,6 +8,11 @@
 #define ZEPHYR_DRIVERS_SENSOR_SGP40_SGP40_H_
 
 #include <zephyr/device.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/atomic.h>
+
+#include "../sensirion_core/sensirion_comp.h"
+#include "../sensirion_core/sensirion_voc_index.h"
 
 #define SGP40_CMD_MEASURE_RAW	0x260F
 #define SGP40_CMD_MEASURE_TEST	0x280E
@@ -20,13 +25,6 @@
 #define SGP40_MEASURE_WAIT_MS	30
 #define SGP40_TEST_WAIT_MS	250
 
-/*
- * CRC parameters were taken from the
- * "Checksum Calculation" section of the datasheet.
- */
-#define SGP40_CRC_POLY		0x31
-#define SGP40_CRC_INIT		0xFF
-
 /*
  * Value range of compensation data parameters
  */
@@ -40,12 +38,31 @@
 struct sgp40_config {
 	struct i2c_dt_spec bus;
 	bool selftest;
+#ifdef CONFIG_SENSIRION_COMP
+	const struct sensirion_comp_source *comp;
+#endif
+#ifdef CONFIG_SENSOR_ASYNC_API
+	struct rtio *rtio_ctx;
+	struct rtio_iodev *iodev;
+#endif
 };
 
 struct sgp40_data {
 	uint16_t raw_sample;
 	int8_t rh_param[3];
 	int8_t t_param[3];
+#ifdef CONFIG_SGP40_VOC_INDEX
+	/* Protects the VOC index state, which is also updated on completions */
+	struct k_spinlock voc_lock;
+	struct sensirion_voc_index voc;
+	int32_t voc_index;
+	/* The index is fed by the driver's own fetches and reads */
+	bool voc_driver_fed;
+#endif
+#ifdef CONFIG_SENSOR_ASYNC_API
+	/* Set while a chain is in flight on rtio_ctx */
+	atomic_t rtio_busy;
+#endif
 };
 
 #endif /* ZEPHYR_DRIVERS_SENSOR_SGP40_SGP40_H_ */
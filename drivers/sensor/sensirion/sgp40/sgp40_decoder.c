@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sensirion_sgp40
+
+#include <zephyr/drivers/sensor_clock.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include "sgp40_decoder.h"
+
+static bool sgp40_decoder_has_channel(const struct sgp40_encoded_data *edata,
+				      enum sensor_channel chan)
+{
+	return chan == SENSOR_CHAN_GAS_RES ? edata->header.has_gas_res : edata->header.has_voc;
+}
+
+int sgp40_encode(const struct device *dev, const struct sensor_read_config *read_config,
+		 uint8_t *buf)
+{
+	struct sgp40_encoded_data *edata = (struct sgp40_encoded_data *)buf;
+	uint64_t cycles;
+	int rc;
+
+	ARG_UNUSED(dev);
+
+	edata->header.has_gas_res = false;
+	edata->header.has_voc = false;
+	for (size_t i = 0; i < read_config->count; i++) {
+		enum sensor_channel chan = read_config->channels[i].chan_type;
+
+		if (chan == SENSOR_CHAN_ALL || chan == SENSOR_CHAN_GAS_RES) {
+			edata->header.has_gas_res = true;
+		}
+		if (IS_ENABLED(CONFIG_SGP40_VOC_INDEX) &&
+		    (chan == SENSOR_CHAN_ALL || chan == SENSOR_CHAN_VOC)) {
+			edata->header.has_voc = true;
+		}
+	}
+
+	rc = sensor_clock_get_cycles(&cycles);
+	if (rc != 0) {
+		return rc;
+	}
+
+	edata->header.timestamp = sensor_clock_cycles_to_ns(cycles);
+
+	return 0;
+}
+
+static int sgp40_decoder_get_frame_count(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+					 uint16_t *frame_count)
+{
+	const struct sgp40_encoded_data *edata = (const struct sgp40_encoded_data *)buffer;
+
+	if (chan_spec.chan_idx != 0 ||
+	    (chan_spec.chan_type != SENSOR_CHAN_GAS_RES && chan_spec.chan_type != SENSOR_CHAN_VOC)) {
+		return -ENOTSUP;
+	}
+
+	if (!sgp40_decoder_has_channel(edata, chan_spec.chan_type)) {
+		return -ENODATA;
+	}
+
+	*frame_count = 1;
+
+	return 0;
+}
+
+static int sgp40_decoder_get_size_info(struct sensor_chan_spec chan_spec, size_t *base_size,
+				       size_t *frame_size)
+{
+	if (chan_spec.chan_type != SENSOR_CHAN_GAS_RES && chan_spec.chan_type != SENSOR_CHAN_VOC) {
+		return -ENOTSUP;
+	}
+
+	*base_size = sizeof(struct sensor_q31_data);
+	*frame_size = sizeof(struct sensor_q31_sample_data);
+
+	return 0;
+}
+
+static int sgp40_decoder_decode(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+				uint32_t *fit, uint16_t max_count, void *data_out)
+{
+	const struct sgp40_encoded_data *edata = (const struct sgp40_encoded_data *)buffer;
+	struct sensor_q31_data *out = data_out;
+
+	if (*fit != 0 || max_count == 0) {
+		return 0;
+	}
+
+	if (chan_spec.chan_idx != 0 ||
+	    (chan_spec.chan_type != SENSOR_CHAN_GAS_RES && chan_spec.chan_type != SENSOR_CHAN_VOC)) {
+		return -ENOTSUP;
+	}
+
+	if (!sgp40_decoder_has_channel(edata, chan_spec.chan_type)) {
+		return -ENODATA;
+	}
+
+	if (chan_spec.chan_type == SENSOR_CHAN_VOC) {
+		out->readings[0].value = (q31_t)edata->voc_index << (31 - SGP40_VOC_Q31_SHIFT);
+		out->shift = SGP40_VOC_Q31_SHIFT;
+	} else {
+		out->readings[0].resistance = (q31_t)sys_get_be16(edata->frame)
+					      << (31 - SGP40_GAS_RES_Q31_SHIFT);
+		out->shift = SGP40_GAS_RES_Q31_SHIFT;
+	}
+	out->header.base_timestamp_ns = edata->header.timestamp;
+	out->header.reading_count = 1;
+	*fit = 1;
+
+	return 1;
+}
+
+SENSOR_DECODER_API_DT_DEFINE() = {
+	.get_frame_count = sgp40_decoder_get_frame_count,
+	.get_size_info = sgp40_decoder_get_size_info,
+	.decode = sgp40_decoder_decode,
+};
+
+int sgp40_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder)
+{
+	ARG_UNUSED(dev);
+	*decoder = &SENSOR_DECODER_NAME();
+
+	return 0;
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_DRIVERS_SENSOR_SGP40_SGP40_DECODER_H_
+#define ZEPHYR_DRIVERS_SENSOR_SGP40_SGP40_DECODER_H_
+
+#include <stdint.h>
+#include <zephyr/drivers/sensor.h>
+
+/* The raw signal is reported in ticks (0 - 65535) */
+#define SGP40_GAS_RES_Q31_SHIFT	16
+/* The VOC index ranges from 0 to 500 */
+#define SGP40_VOC_Q31_SHIFT	9
+
+struct sgp40_encoded_header {
+	uint64_t timestamp;
+	bool has_gas_res;
+	bool has_voc;
+};
+
+struct sgp40_encoded_data {
+	struct sgp40_encoded_header header;
+	/*
+	 * Measure command including the RH and T compensation words it was
+	 * issued with. It lives in the read buffer so that it outlives the
+	 * asynchronous bus transfer.
+	 */
+	uint8_t cmd[8];
+	/* Raw frame as read from the sensor: SRAW MSB, SRAW LSB, CRC */
+	uint8_t frame[3];
+	/* VOC index after this sample, computed once the frame was read */
+	int16_t voc_index;
+};
+
+int sgp40_encode(const struct device *dev, const struct sensor_read_config *read_config,
+		 uint8_t *buf);
+
+int sgp40_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder);
+
+#endif /* ZEPHYR_DRIVERS_SENSOR_SGP40_SGP40_DECODER_H_ */
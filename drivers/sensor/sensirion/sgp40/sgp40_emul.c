@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sensirion_sgp40
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/logging/log.h>
+
+#include "../sensirion_core/sensirion_emul.h"
+#include "sgp40.h"
+
+LOG_MODULE_DECLARE(SGP40, CONFIG_SENSOR_LOG_LEVEL);
+
+#define SGP40_EMUL_CMD_GET_SERIAL 0x3682
+
+#define SGP40_EMUL_GET_SERIAL_TIME_US 1000
+
+static const uint16_t sgp40_emul_serial[] = {0x0000, 0x04A1, 0x5E3C};
+
+static int sgp40_emul_command(const struct emul *target, uint16_t cmd, const uint16_t *args,
+			      uint8_t num_args)
+{
+	struct sensirion_emul_data *data = target->data;
+	const uint16_t test_result = SGP40_TEST_OK;
+
+	ARG_UNUSED(args);
+
+	switch (cmd) {
+	case SGP40_CMD_MEASURE_RAW:
+		/*
+		 * The humidity and temperature arguments only compensate the
+		 * signal. Without them the sensor just turns on the hotplate.
+		 */
+		if (num_args != 2 && num_args != 0) {
+			return -EIO;
+		}
+		sensirion_emul_respond(data, &data->signals[SENSIRION_EMUL_VOC], 1,
+				       SGP40_MEASURE_WAIT_MS * USEC_PER_MSEC);
+		return 0;
+	case SGP40_CMD_MEASURE_TEST:
+		if (num_args != 0) {
+			return -EIO;
+		}
+		sensirion_emul_respond(data, &test_result, 1, SGP40_TEST_WAIT_MS * USEC_PER_MSEC);
+		return 0;
+	case SGP40_CMD_HEATER_OFF:
+		if (num_args != 0) {
+			return -EIO;
+		}
+		return 0;
+	case SGP40_EMUL_CMD_GET_SERIAL:
+		if (num_args != 0) {
+			return -EIO;
+		}
+		sensirion_emul_respond(data, sgp40_emul_serial, ARRAY_SIZE(sgp40_emul_serial),
+				       SGP40_EMUL_GET_SERIAL_TIME_US);
+		return 0;
+	default:
+		LOG_DBG("Unknown command 0x%04x", cmd);
+		return -EIO;
+	}
+}
+
+static int sgp40_emul_init(const struct emul *target, const struct device *parent)
+{
+	ARG_UNUSED(parent);
+
+	sensirion_emul_init_data(target->data);
+
+	return 0;
+}
+
+static const struct sensirion_emul_cfg sgp40_emul_cfg = {
+	.command = sgp40_emul_command,
+	.cmd_size = 2,
+};
+
+#define SGP40_EMUL(n)                                                                              \
+	static struct sensirion_emul_data sgp40_emul_data_##n;                                     \
+	EMUL_DT_INST_DEFINE(n, sgp40_emul_init, &sgp40_emul_data_##n, &sgp40_emul_cfg,             \
+			    &sensirion_emul_api_i2c, NULL)
+
+DT_INST_FOREACH_STATUS_OKAY(SGP40_EMUL)
@@ -11,12 +11,16 @@
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/sensor.h>
+#include <zephyr/drivers/sensor/sensirion_batch.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/byteorder.h>
-#include <zephyr/sys/crc.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/rtio/rtio.h>
 
 #include "sht3xd.h"
+#include "sht3xd_decoder.h"
+#include "../sensirion_core/sensirion_common.h"
+#include "../sensirion_core/sensirion_rtio.h"
 
 LOG_MODULE_REGISTER(SHT3XD, CONFIG_SENSOR_LOG_LEVEL);
 
@@ -34,23 +38,17 @@ static const uint16_t measure_cmd[5][3] = {
 	{ 0x272A, 0x2721, 0x2737 }
 };
 #endif
+#ifdef CONFIG_SHT3XD_STREAM
+/* Measurement interval in ms for each MPS setting */
+static const uint16_t measure_interval[5] = {
+	2000, 1000, 500, 250, 100
+};
+#endif
 
 static const int measure_wait[3] = {
 	4000, 6000, 15000
 };
 
-/*
- * CRC algorithm parameters were taken from the
- * "Checksum Calculation" section of the datasheet.
- */
-static uint8_t sht3xd_compute_crc(uint16_t value)
-{
-	uint8_t buf[2];
-
-	sys_put_be16(value, buf);
-	return crc8(buf, 2, 0x31, 0xFF, false);
-}
-
 int sht3xd_write_command(const struct device *dev, uint16_t cmd)
 {
 	const struct sht3xd_config *config = dev->config;
@@ -67,7 +65,7 @@ int sht3xd_write_reg(const struct device *dev, uint16_t cmd, uint16_t val)
 
 	sys_put_be16(cmd, &tx_buf[0]);
 	sys_put_be16(val, &tx_buf[2]);
-	tx_buf[4] = sht3xd_compute_crc(val);
+	tx_buf[4] = sensirion_i2c_word_crc(val);
 
 	return i2c_write_dt(&config->bus, tx_buf, sizeof(tx_buf));
 }
@@ -109,17 +107,13 @@ static int sht3xd_sample_fetch(const struct device *dev,
 	}
 #endif
 
-	t_sample = sys_get_be16(&rx_buf[0]);
-	if (sht3xd_compute_crc(t_sample) != rx_buf[2]) {
-		LOG_DBG("Received invalid temperature CRC!");
+	if (sensirion_i2c_check_frame(rx_buf, 2) != NO_ERROR) {
+		LOG_DBG("Received invalid CRC!");
 		return -EIO;
 	}
 
+	t_sample = sys_get_be16(&rx_buf[0]);
 	rh_sample = sys_get_be16(&rx_buf[3]);
-	if (sht3xd_compute_crc(rh_sample) != rx_buf[5]) {
-		LOG_DBG("Received invalid relative humidity CRC!");
-		return -EIO;
-	}
 
 	data->t_sample = t_sample;
 	data->rh_sample = rh_sample;
@@ -127,6 +121,195 @@ static int sht3xd_sample_fetch(const struct device *dev,
 	return 0;
 }
 
+#ifdef CONFIG_SENSOR_ASYNC_API
+static void sht3xd_complete_result(struct rtio *ctx, const struct rtio_sqe *sqe, int result,
+				   void *arg)
+{
+	struct rtio_iodev_sqe *iodev_sqe = (struct rtio_iodev_sqe *)arg;
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	struct sht3xd_data *data = read_cfg->sensor->data;
+	const struct sht3xd_encoded_data *edata = sqe->userdata;
+
+	ARG_UNUSED(result);
+
+	if (sensirion_rtio_complete(ctx, &data->rtio_busy, iodev_sqe, edata->frame,
+				    SENSIRION_RTIO_FRAME_WORDS(edata->frame)) < 0) {
+		LOG_DBG("Failed to read data sample!");
+	}
+}
+
+#ifdef CONFIG_SHT3XD_STREAM
+static void sht3xd_stream_result(struct rtio *ctx, const struct rtio_sqe *sqe, int result,
+				 void *arg)
+{
+	const struct device *dev = arg;
+	struct sht3xd_data *data = dev->data;
+	const struct sht3xd_encoded_data *edata = sqe->userdata;
+	int rc;
+
+	ARG_UNUSED(result);
+
+	rc = sensirion_rtio_drain(ctx);
+	sensirion_rtio_release(&data->rtio_busy);
+
+	/* The sensor NACKs the fetch until the next result is available */
+	if (rc < 0) {
+		sensirion_stream_complete(&data->stream, -EAGAIN);
+		return;
+	}
+
+	rc = sensirion_rtio_check_frame(edata->frame, SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+	if (rc < 0) {
+		LOG_DBG("Received invalid CRC!");
+	}
+
+	sensirion_stream_complete(&data->stream, rc);
+}
+
+static int sht3xd_stream_read(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	const struct sht3xd_config *config = dev->config;
+	struct sht3xd_data *data = dev->data;
+	uint32_t min_buf_len = sizeof(struct sht3xd_encoded_data);
+	struct sht3xd_encoded_data *edata;
+	uint8_t *buf;
+	uint32_t buf_len;
+	int rc;
+
+	rc = rtio_sqe_rx_buf(iodev_sqe, min_buf_len, min_buf_len, &buf, &buf_len);
+	if (rc < 0 || buf_len < min_buf_len) {
+		LOG_ERR("Failed to get a read buffer of size %u bytes", min_buf_len);
+		return rc < 0 ? rc : -ENOMEM;
+	}
+
+	edata = (struct sht3xd_encoded_data *)buf;
+
+	rc = sht3xd_encode(dev, read_cfg, buf);
+	if (rc < 0) {
+		LOG_ERR("Failed to encode sensor data");
+		return rc;
+	}
+
+	/* Retried by the stream while a single read is in flight */
+	if (sensirion_rtio_claim(&data->rtio_busy) < 0) {
+		return -EAGAIN;
+	}
+
+	rc = sensirion_rtio_prep_read_cmd(config->rtio_ctx, config->iodev, SHT3XD_CMD_FETCH, 0,
+					  edata->frame, SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+	if (rc == 0) {
+		rc = sensirion_rtio_submit(config->rtio_ctx, sht3xd_stream_result, (void *)dev,
+					   edata);
+	}
+	if (rc < 0) {
+		LOG_ERR("Failed to acquire SQEs");
+		sensirion_rtio_release(&data->rtio_busy);
+	}
+
+	return rc;
+}
+#endif /* CONFIG_SHT3XD_STREAM */
+
+static void sht3xd_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	const struct sht3xd_config *config = dev->config;
+	struct sht3xd_data *data = dev->data;
+	uint32_t min_buf_len = sizeof(struct sht3xd_encoded_data);
+	struct sht3xd_encoded_data *edata;
+	uint8_t *buf;
+	uint32_t buf_len;
+	int rc;
+
+	if (read_cfg->is_streaming) {
+#ifdef CONFIG_SHT3XD_STREAM
+		sensirion_stream_submit(&data->stream, iodev_sqe);
+#else
+		LOG_ERR("Streaming not supported");
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+#endif
+		return;
+	}
+
+#ifdef CONFIG_SHT3XD_STREAM
+	/* Stream reads are issued on the same RTIO context */
+	if (sensirion_stream_active(&data->stream)) {
+		rtio_iodev_sqe_err(iodev_sqe, -EBUSY);
+		return;
+	}
+#endif
+
+	rc = rtio_sqe_rx_buf(iodev_sqe, min_buf_len, min_buf_len, &buf, &buf_len);
+	if (rc < 0 || buf_len < min_buf_len) {
+		LOG_ERR("Failed to get a read buffer of size %u bytes", min_buf_len);
+		rtio_iodev_sqe_err(iodev_sqe, rc < 0 ? rc : -ENOMEM);
+		return;
+	}
+
+	edata = (struct sht3xd_encoded_data *)buf;
+
+	rc = sht3xd_encode(dev, read_cfg, buf);
+	if (rc < 0) {
+		LOG_ERR("Failed to encode sensor data");
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+		return;
+	}
+
+	rc = sensirion_rtio_claim(&data->rtio_busy);
+	if (rc < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+		return;
+	}
+
+#ifdef CONFIG_SHT3XD_SINGLE_SHOT_MODE
+	/* start single shot measurement and let the executor wait out the conversion */
+	rc = sensirion_rtio_prep_read_cmd(config->rtio_ctx, config->iodev,
+					  measure_cmd[SHT3XD_REPEATABILITY_IDX],
+					  measure_wait[SHT3XD_REPEATABILITY_IDX], edata->frame,
+					  SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+#endif
+#ifdef CONFIG_SHT3XD_PERIODIC_MODE
+	/* fetch the latest periodic result in a single write-read transaction */
+	rc = sensirion_rtio_prep_read_cmd(config->rtio_ctx, config->iodev, SHT3XD_CMD_FETCH, 0,
+					  edata->frame, SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+#endif
+	if (rc == 0) {
+		rc = sensirion_rtio_submit(config->rtio_ctx, sht3xd_complete_result, iodev_sqe,
+					   edata);
+	}
+	if (rc < 0) {
+		LOG_ERR("Failed to acquire SQEs");
+		sensirion_rtio_release(&data->rtio_busy);
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+	}
+}
+
+#if defined(CONFIG_SENSIRION_BATCH) && defined(CONFIG_SHT3XD_SINGLE_SHOT_MODE)
+static int sht3xd_batch_prep(const struct device *dev, const struct sensor_read_config *read_cfg,
+			     uint8_t *buf, struct sensirion_batch_measurement *meas)
+{
+	const struct sht3xd_config *config = dev->config;
+	struct sht3xd_encoded_data *edata = (struct sht3xd_encoded_data *)buf;
+	int rc;
+
+	rc = sht3xd_encode(dev, read_cfg, buf);
+	if (rc < 0) {
+		return rc;
+	}
+
+	meas->iodev = config->iodev;
+	sys_put_be16(measure_cmd[SHT3XD_REPEATABILITY_IDX], meas->cmd);
+	meas->cmd_len = SENSIRION_COMMAND_SIZE;
+	meas->delay_us = measure_wait[SHT3XD_REPEATABILITY_IDX];
+	meas->frame = edata->frame;
+	meas->num_words = SENSIRION_RTIO_FRAME_WORDS(edata->frame);
+
+	return 0;
+}
+#endif /* CONFIG_SENSIRION_BATCH && CONFIG_SHT3XD_SINGLE_SHOT_MODE */
+#endif /* CONFIG_SENSOR_ASYNC_API */
+
 static int sht3xd_channel_get(const struct device *dev,
 			      enum sensor_channel chan,
 			      struct sensor_value *val)
@@ -163,11 +346,16 @@ static DEVICE_API(sensor, sht3xd_driver_api) = {
 #endif
 	.sample_fetch = sht3xd_sample_fetch,
 	.channel_get = sht3xd_channel_get,
+#ifdef CONFIG_SENSOR_ASYNC_API
+	.submit = sht3xd_submit,
+	.get_decoder = sht3xd_get_decoder,
+#endif
 };
 
 static int sht3xd_init(const struct device *dev)
 {
 	const struct sht3xd_config *cfg = dev->config;
+	__maybe_unused struct sht3xd_data *data = dev->data;
 
 	if (!device_is_ready(cfg->bus.bus)) {
 		LOG_ERR("I2C bus %s is not ready!", cfg->bus.bus->name);
@@ -193,9 +381,12 @@ static int sht3xd_init(const struct device *dev)
 
 	k_busy_wait(measure_wait[SHT3XD_REPEATABILITY_IDX]);
 #endif
+#ifdef CONFIG_SHT3XD_STREAM
+	/* The first result is due one interval after the measurement has started */
+	sensirion_stream_init(&data->stream, dev, sht3xd_stream_read);
+	sensirion_stream_start(&data->stream, measure_interval[SHT3XD_MPS_IDX]);
+#endif
 #ifdef CONFIG_SHT3XD_TRIGGER
-	struct sht3xd_data *data = dev->data;
-
 	data->dev = dev;
 	if (sht3xd_init_interrupt(dev) < 0) {
 		LOG_DBG("Failed to initialize interrupt");
@@ -213,15 +404,39 @@ static int sht3xd_init(const struct device *dev)
 #define SHT3XD_TRIGGER_INIT(inst)
 #endif
 
+#ifdef CONFIG_SENSOR_ASYNC_API
+#define SHT3XD_RTIO_DEFINE(inst)						\
+	RTIO_DEFINE(sht3xd_rtio_ctx_##inst, 8, 8);				\
+	I2C_DT_IODEV_DEFINE(sht3xd_iodev_##inst, DT_DRV_INST(inst));
+#define SHT3XD_RTIO_INIT(inst)							\
+	.rtio_ctx = &sht3xd_rtio_ctx_##inst,					\
+	.iodev = &sht3xd_iodev_##inst,
+#else
+#define SHT3XD_RTIO_DEFINE(inst)
+#define SHT3XD_RTIO_INIT(inst)
+#endif
+
+#if defined(CONFIG_SENSIRION_BATCH) && defined(CONFIG_SHT3XD_SINGLE_SHOT_MODE)
+#define SHT3XD_BATCH_DEFINE(inst)						\
+	SENSIRION_BATCH_SENSOR_DEFINE(sht3xd_batch_##inst,			\
+		DEVICE_DT_INST_GET(inst), sht3xd_batch_prep,			\
+		sizeof(struct sht3xd_encoded_data));
+#else
+#define SHT3XD_BATCH_DEFINE(inst)
+#endif
+
 #define SHT3XD_DEFINE(inst)							\
 	struct sht3xd_data sht3xd0_data_##inst;					\
+	SHT3XD_RTIO_DEFINE(inst)						\
 	static const struct sht3xd_config sht3xd0_cfg_##inst = {		\
 		.bus = I2C_DT_SPEC_INST_GET(inst),				\
 		SHT3XD_TRIGGER_INIT(inst)					\
+		SHT3XD_RTIO_INIT(inst)						\
 	};									\
 	SENSOR_DEVICE_DT_INST_DEFINE(inst, sht3xd_init, NULL,			\
 		&sht3xd0_data_##inst, &sht3xd0_cfg_##inst,			\
 		POST_KERNEL, CONFIG_SENSOR_INIT_PRIORITY,			\
-		&sht3xd_driver_api);
+		&sht3xd_driver_api);						\
+	SHT3XD_BATCH_DEFINE(inst)
 
 DT_INST_FOREACH_STATUS_OKAY(SHT3XD_DEFINE)
@@ -12,6 +12,8 @@
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/drivers/i2c.h>
 
+#include "../sensirion_core/sensirion_stream.h"
+
 #define SHT3XD_CMD_FETCH                0xE000
 #define SHT3XD_CMD_ART                  0x2B32
 #define SHT3XD_CMD_READ_STATUS          0xF32D
@@ -50,12 +52,26 @@ struct sht3xd_config {
 #ifdef CONFIG_SHT3XD_TRIGGER
 	struct gpio_dt_spec alert_gpio;
 #endif /* CONFIG_SHT3XD_TRIGGER */
+
+#ifdef CONFIG_SENSOR_ASYNC_API
+	struct rtio *rtio_ctx;
+	struct rtio_iodev *iodev;
+#endif /* CONFIG_SENSOR_ASYNC_API */
 };
 
 struct sht3xd_data {
 	uint16_t t_sample;
 	uint16_t rh_sample;
 
+#ifdef CONFIG_SENSOR_ASYNC_API
+	/* Set while a chain is in flight on rtio_ctx */
+	atomic_t rtio_busy;
+#endif /* CONFIG_SENSOR_ASYNC_API */
+
+#ifdef CONFIG_SHT3XD_STREAM
+	struct sensirion_stream stream;
+#endif /* CONFIG_SHT3XD_STREAM */
+
 #ifdef CONFIG_SHT3XD_TRIGGER
 	const struct device *dev;
 	struct gpio_callback alert_cb;
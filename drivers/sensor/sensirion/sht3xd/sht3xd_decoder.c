@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sensirion_sht3xd
+
+#include <zephyr/drivers/sensor_clock.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include "sht3xd_decoder.h"
+
+static uint8_t sht3xd_encode_channel(enum sensor_channel chan)
+{
+	switch (chan) {
+	case SENSOR_CHAN_AMBIENT_TEMP:
+		return SHT3XD_CHAN_TEMP_BIT;
+	case SENSOR_CHAN_HUMIDITY:
+		return SHT3XD_CHAN_RH_BIT;
+	case SENSOR_CHAN_ALL:
+		return SHT3XD_CHAN_TEMP_BIT | SHT3XD_CHAN_RH_BIT;
+	default:
+		return 0;
+	}
+}
+
+int sht3xd_encode(const struct device *dev, const struct sensor_read_config *read_config,
+		 uint8_t *buf)
+{
+	struct sht3xd_encoded_data *edata = (struct sht3xd_encoded_data *)buf;
+	uint64_t cycles;
+	int rc;
+
+	ARG_UNUSED(dev);
+
+	edata->header.channels = 0;
+	edata->header.data_ready = read_config->is_streaming;
+	for (size_t i = 0; i < read_config->count; i++) {
+		if (!read_config->is_streaming) {
+			edata->header.channels |=
+				sht3xd_encode_channel(read_config->channels[i].chan_type);
+		} else if (read_config->triggers[i].opt == SENSOR_STREAM_DATA_INCLUDE) {
+			edata->header.channels |= sht3xd_encode_channel(SENSOR_CHAN_ALL);
+		}
+	}
+
+	rc = sensor_clock_get_cycles(&cycles);
+	if (rc != 0) {
+		return rc;
+	}
+
+	edata->header.timestamp = sensor_clock_cycles_to_ns(cycles);
+
+	return 0;
+}
+
+static int sht3xd_decoder_get_frame_count(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+					 uint16_t *frame_count)
+{
+	const struct sht3xd_encoded_data *edata = (const struct sht3xd_encoded_data *)buffer;
+	uint8_t channel_request = sht3xd_encode_channel(chan_spec.chan_type);
+
+	if (chan_spec.chan_idx != 0 || channel_request == 0 ||
+	    chan_spec.chan_type == SENSOR_CHAN_ALL) {
+		return -ENOTSUP;
+	}
+
+	if ((edata->header.channels & channel_request) == 0) {
+		return -ENODATA;
+	}
+
+	/* This sensor lacks a FIFO; there will always only be one frame at a time. */
+	*frame_count = 1;
+
+	return 0;
+}
+
+static int sht3xd_decoder_get_size_info(struct sensor_chan_spec chan_spec, size_t *base_size,
+				       size_t *frame_size)
+{
+	switch (chan_spec.chan_type) {
+	case SENSOR_CHAN_AMBIENT_TEMP:
+	case SENSOR_CHAN_HUMIDITY:
+		*base_size = sizeof(struct sensor_q31_data);
+		*frame_size = sizeof(struct sensor_q31_sample_data);
+		return 0;
+	default:
+		return -ENOTSUP;
+	}
+}
+
+static int sht3xd_decoder_decode(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+				uint32_t *fit, uint16_t max_count, void *data_out)
+{
+	const struct sht3xd_encoded_data *edata = (const struct sht3xd_encoded_data *)buffer;
+	struct sensor_q31_data *out = data_out;
+	int64_t raw;
+
+	if (*fit != 0 || max_count == 0) {
+		return 0;
+	}
+
+	if (chan_spec.chan_idx != 0) {
+		return -ENOTSUP;
+	}
+
+	/* See datasheet "Conversion of Signal Output" section */
+	switch (chan_spec.chan_type) {
+	case SENSOR_CHAN_AMBIENT_TEMP:
+		if ((edata->header.channels & SHT3XD_CHAN_TEMP_BIT) == 0) {
+			return -ENODATA;
+		}
+		raw = sys_get_be16(&edata->frame[0]);
+		out->readings[0].temperature =
+			(int32_t)(((raw * 175) << (31 - SHT3XD_Q31_SHIFT)) / 0xFFFF -
+				  ((int64_t)45 << (31 - SHT3XD_Q31_SHIFT)));
+		break;
+	case SENSOR_CHAN_HUMIDITY:
+		if ((edata->header.channels & SHT3XD_CHAN_RH_BIT) == 0) {
+			return -ENODATA;
+		}
+		raw = sys_get_be16(&edata->frame[3]);
+		out->readings[0].humidity =
+			(int32_t)(((raw * 100) << (31 - SHT3XD_Q31_SHIFT)) / 0xFFFF);
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	out->header.base_timestamp_ns = edata->header.timestamp;
+	out->header.reading_count = 1;
+	out->shift = SHT3XD_Q31_SHIFT;
+	*fit = 1;
+
+	return 1;
+}
+
+static bool sht3xd_decoder_has_trigger(const uint8_t *buffer, enum sensor_trigger_type trigger)
+{
+	const struct sht3xd_encoded_data *edata = (const struct sht3xd_encoded_data *)buffer;
+
+	return trigger == SENSOR_TRIG_DATA_READY && edata->header.data_ready;
+}
+
+SENSOR_DECODER_API_DT_DEFINE() = {
+	.get_frame_count = sht3xd_decoder_get_frame_count,
+	.get_size_info = sht3xd_decoder_get_size_info,
+	.decode = sht3xd_decoder_decode,
+	.has_trigger = sht3xd_decoder_has_trigger,
+};
+
+int sht3xd_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder)
+{
+	ARG_UNUSED(dev);
+	*decoder = &SENSOR_DECODER_NAME();
+
+	return 0;
+}
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sensirion_sht3xd
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/logging/log.h>
+
+#include "../sensirion_core/sensirion_emul.h"
+#include "sht3xd.h"
+
+LOG_MODULE_DECLARE(SHT3XD, CONFIG_SENSOR_LOG_LEVEL);
+
+#define SHT3XD_EMUL_CMD_BREAK              0x3093
+#define SHT3XD_EMUL_CMD_SOFT_RESET         0x30A2
+#define SHT3XD_EMUL_CMD_READ_TH_HIGH_SET   0xE11F
+#define SHT3XD_EMUL_CMD_READ_TH_HIGH_CLEAR 0xE114
+#define SHT3XD_EMUL_CMD_READ_TH_LOW_CLEAR  0xE109
+#define SHT3XD_EMUL_CMD_READ_TH_LOW_SET    0xE102
+
+/* Status after a reset: alert pending and system reset detected */
+#define SHT3XD_EMUL_STATUS_RESET 0x8010
+
+#define SHT3XD_EMUL_BREAK_TIME_US      1000
+#define SHT3XD_EMUL_SOFT_RESET_TIME_US 1500
+
+/* Typical measurement durations at high, medium and low repeatability */
+#define SHT3XD_EMUL_HIGH_US   12500
+#define SHT3XD_EMUL_MEDIUM_US 4500
+#define SHT3XD_EMUL_LOW_US    2500
+
+struct sht3xd_emul_measure_cmd {
+	uint16_t cmd;
+	/* Measurement period in ms, 0 for a single shot measurement */
+	uint16_t period_ms;
+	/* Measurement duration, 0 if the sensor stretches the clock instead */
+	uint16_t duration_us;
+};
+
+static const struct sht3xd_emul_measure_cmd measure_cmds[] = {
+	/* Single shot without and with clock stretching */
+	{0x2400, 0, SHT3XD_EMUL_HIGH_US},
+	{0x240B, 0, SHT3XD_EMUL_MEDIUM_US},
+	{0x2416, 0, SHT3XD_EMUL_LOW_US},
+	{0x2C06, 0, 0},
+	{0x2C0D, 0, 0},
+	{0x2C10, 0, 0},
+	/* Periodic data acquisition at 0.5, 1, 2, 4 and 10 measurements per second */
+	{0x2032, 2000, SHT3XD_EMUL_HIGH_US},
+	{0x2024, 2000, SHT3XD_EMUL_MEDIUM_US},
+	{0x202F, 2000, SHT3XD_EMUL_LOW_US},
+	{0x2130, 1000, SHT3XD_EMUL_HIGH_US},
+	{0x2126, 1000, SHT3XD_EMUL_MEDIUM_US},
+	{0x212D, 1000, SHT3XD_EMUL_LOW_US},
+	{0x2236, 500, SHT3XD_EMUL_HIGH_US},
+	{0x2220, 500, SHT3XD_EMUL_MEDIUM_US},
+	{0x222B, 500, SHT3XD_EMUL_LOW_US},
+	{0x2334, 250, SHT3XD_EMUL_HIGH_US},
+	{0x2322, 250, SHT3XD_EMUL_MEDIUM_US},
+	{0x2329, 250, SHT3XD_EMUL_LOW_US},
+	{0x2737, 100, SHT3XD_EMUL_HIGH_US},
+	{0x2721, 100, SHT3XD_EMUL_MEDIUM_US},
+	{0x272A, 100, SHT3XD_EMUL_LOW_US},
+	/* Accelerated response time: 4 measurements per second */
+	{SHT3XD_CMD_ART, 250, SHT3XD_EMUL_HIGH_US},
+};
+
+/* Alert limits in the order of the register indices below */
+static const uint16_t limit_write_cmds[] = {
+	SHT3XD_CMD_WRITE_TH_HIGH_SET,
+	SHT3XD_CMD_WRITE_TH_HIGH_CLEAR,
+	SHT3XD_CMD_WRITE_TH_LOW_CLEAR,
+	SHT3XD_CMD_WRITE_TH_LOW_SET,
+};
+
+static const uint16_t limit_read_cmds[] = {
+	SHT3XD_EMUL_CMD_READ_TH_HIGH_SET,
+	SHT3XD_EMUL_CMD_READ_TH_HIGH_CLEAR,
+	SHT3XD_EMUL_CMD_READ_TH_LOW_CLEAR,
+	SHT3XD_EMUL_CMD_READ_TH_LOW_SET,
+};
+
+struct sht3xd_emul_data {
+	struct sensirion_emul_data common;
+	uint16_t limits[ARRAY_SIZE(limit_write_cmds)];
+	uint16_t status;
+	/* Measurement period in periodic mode, 0 while the sensor is idle */
+	uint16_t period_ms;
+	/* Uptime in ticks at which the next periodic measurement is available */
+	int64_t next_sample;
+};
+
+static void sht3xd_emul_respond_sample(struct sht3xd_emul_data *data, uint32_t duration_us)
+{
+	const uint16_t sample[] = {
+		data->common.signals[SENSIRION_EMUL_TEMPERATURE],
+		data->common.signals[SENSIRION_EMUL_HUMIDITY],
+	};
+
+	sensirion_emul_respond(&data->common, sample, ARRAY_SIZE(sample), duration_us);
+}
+
+static void sht3xd_emul_fetch(struct sht3xd_emul_data *data)
+{
+	int64_t now = k_uptime_ticks();
+	int64_t period = k_ms_to_ticks_ceil64(data->period_ms);
+
+	/* Without a new measurement the read is NACKed */
+	if (data->period_ms == 0 || now < data->next_sample) {
+		return;
+	}
+
+	sht3xd_emul_respond_sample(data, 0);
+
+	/* Measurements missed in the meantime are overwritten */
+	do {
+		data->next_sample += period;
+	} while (data->next_sample <= now);
+}
+
+static int sht3xd_emul_measure(struct sht3xd_emul_data *data, uint16_t cmd)
+{
+	const struct sht3xd_emul_measure_cmd *measure = NULL;
+
+	for (size_t i = 0; i < ARRAY_SIZE(measure_cmds); i++) {
+		if (measure_cmds[i].cmd == cmd) {
+			measure = &measure_cmds[i];
+			break;
+		}
+	}
+
+	if (measure == NULL) {
+		LOG_DBG("Unknown command 0x%04x", cmd);
+		return -EIO;
+	}
+
+	/* Only a break ends the periodic mode */
+	if (data->period_ms != 0) {
+		return -EIO;
+	}
+
+	if (measure->period_ms == 0) {
+		sht3xd_emul_respond_sample(data, measure->duration_us);
+	} else {
+		data->period_ms = measure->period_ms;
+		data->next_sample = k_uptime_ticks() + k_us_to_ticks_ceil64(measure->duration_us);
+	}
+
+	return 0;
+}
+
+static int sht3xd_emul_command(const struct emul *target, uint16_t cmd, const uint16_t *args,
+			       uint8_t num_args)
+{
+	struct sht3xd_emul_data *data = target->data;
+
+	for (size_t i = 0; i < ARRAY_SIZE(limit_write_cmds); i++) {
+		if (cmd == limit_write_cmds[i] && num_args == 1) {
+			data->limits[i] = args[0];
+			return 0;
+		}
+		if (cmd == limit_read_cmds[i] && num_args == 0) {
+			sensirion_emul_respond(&data->common, &data->limits[i], 1, 0);
+			return 0;
+		}
+	}
+
+	if (num_args != 0) {
+		return -EIO;
+	}
+
+	switch (cmd) {
+	case SHT3XD_CMD_FETCH:
+		sht3xd_emul_fetch(data);
+		return 0;
+	case SHT3XD_CMD_READ_STATUS:
+		sensirion_emul_respond(&data->common, &data->status, 1, 0);
+		return 0;
+	case SHT3XD_CMD_CLEAR_STATUS:
+		data->status = 0;
+		return 0;
+	case SHT3XD_EMUL_CMD_BREAK:
+		data->period_ms = 0;
+		sensirion_emul_respond(&data->common, NULL, 0, SHT3XD_EMUL_BREAK_TIME_US);
+		return 0;
+	case SHT3XD_EMUL_CMD_SOFT_RESET:
+		data->period_ms = 0;
+		data->status = SHT3XD_EMUL_STATUS_RESET;
+		sensirion_emul_respond(&data->common, NULL, 0, SHT3XD_EMUL_SOFT_RESET_TIME_US);
+		return 0;
+	default:
+		return sht3xd_emul_measure(data, cmd);
+	}
+}
+
+static int sht3xd_emul_init(const struct emul *target, const struct device *parent)
+{
+	struct sht3xd_emul_data *data = target->data;
+
+	ARG_UNUSED(parent);
+
+	sensirion_emul_init_data(&data->common);
+	data->period_ms = 0;
+	data->status = SHT3XD_EMUL_STATUS_RESET;
+
+	return 0;
+}
+
+static const struct sensirion_emul_cfg sht3xd_emul_cfg = {
+	.command = sht3xd_emul_command,
+	.cmd_size = 2,
+};
+
+#define SHT3XD_EMUL(n)                                                                             \
+	static struct sht3xd_emul_data sht3xd_emul_data_##n;                                       \
+	EMUL_DT_INST_DEFINE(n, sht3xd_emul_init, &sht3xd_emul_data_##n, &sht3xd_emul_cfg,          \
+			    &sensirion_emul_api_i2c, NULL)
+
+DT_INST_FOREACH_STATUS_OKAY(SHT3XD_EMUL)
@@ -11,25 +11,20 @@
 #include <zephyr/kernel.h>
 #include <zephyr/pm/device.h>
 #include <zephyr/drivers/sensor.h>
+#include <zephyr/drivers/sensor/sensirion_batch.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/byteorder.h>
-#include <zephyr/sys/crc.h>
+#include <zephyr/rtio/rtio.h>
 
 #include <zephyr/drivers/sensor/sht4x.h>
 #include "sht4x.h"
+#include "sht4x_decoder.h"
+#include "../sensirion_core/sensirion_common.h"
+#include "../sensirion_core/sensirion_rtio.h"
 
 LOG_MODULE_REGISTER(SHT4X, CONFIG_SENSOR_LOG_LEVEL);
 
-static uint8_t sht4x_compute_crc(uint16_t value)
-{
-	uint8_t buf[2];
-
-	sys_put_be16(value, buf);
-
-	return crc8(buf, 2, SHT4X_CRC_POLY, SHT4X_CRC_INIT, false);
-}
-
 static int sht4x_write_command(const struct device *dev, uint8_t cmd)
 {
 	const struct sht4x_config *cfg = dev->config;
@@ -52,21 +47,30 @@ static int sht4x_read_sample(const struct device *dev,
 		return rc;
 	}
 
-	*t_sample = sys_get_be16(rx_buf);
-	if (sht4x_compute_crc(*t_sample) != rx_buf[2]) {
-		LOG_ERR("Invalid CRC for T.");
+	if (sensirion_i2c_check_frame(rx_buf, 2) != NO_ERROR) {
+		LOG_ERR("Invalid CRC.");
 		return -EIO;
 	}
 
+	*t_sample = sys_get_be16(rx_buf);
 	*rh_sample = sys_get_be16(&rx_buf[3]);
-	if (sht4x_compute_crc(*rh_sample) != rx_buf[5]) {
-		LOG_ERR("Invalid CRC for RH.");
-		return -EIO;
-	}
 
 	return 0;
 }
 
+static void sht4x_publish_sample(const struct device *dev, uint16_t t_sample, uint16_t rh_sample)
+{
+#ifdef CONFIG_SENSIRION_COMP
+	const struct sht4x_config *cfg = dev->config;
+
+	sensirion_comp_publish(cfg->comp, t_sample, rh_sample);
+#else
+	ARG_UNUSED(dev);
+	ARG_UNUSED(t_sample);
+	ARG_UNUSED(rh_sample);
+#endif
+}
+
 /* public API for handling the heater */
 int sht4x_fetch_with_heater(const struct device *dev)
 {
@@ -82,6 +86,10 @@ int sht4x_fetch_with_heater(const struct device *dev)
 
 	k_sleep(K_MSEC(heater_wait_ms[data->heater_duration]));
 
+	/*
+	 * Not published for compensation, a sample taken with the heater on
+	 * does not reflect the ambient conditions.
+	 */
 	rc = sht4x_read_sample(dev, &data->t_sample, &data->rh_sample);
 	if (rc < 0) {
 		LOG_ERR("Failed to fetch data.");
@@ -118,6 +126,8 @@ static int sht4x_sample_fetch(const struct device *dev,
 		return rc;
 	}
 
+	sht4x_publish_sample(dev, data->t_sample, data->rh_sample);
+
 	return 0;
 }
 
@@ -150,6 +160,113 @@ static int sht4x_channel_get(const struct device *dev,
 	return 0;
 }
 
+#ifdef CONFIG_SENSOR_ASYNC_API
+static void sht4x_complete_result(struct rtio *ctx, const struct rtio_sqe *sqe, int result,
+				  void *arg)
+{
+	struct rtio_iodev_sqe *iodev_sqe = (struct rtio_iodev_sqe *)arg;
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	const struct sht4x_encoded_data *edata = sqe->userdata;
+	struct sht4x_data *data = read_cfg->sensor->data;
+	int rc;
+
+	ARG_UNUSED(result);
+
+	rc = sensirion_rtio_finish(ctx, edata->frame, SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+	sensirion_rtio_release(&data->rtio_busy);
+	if (rc < 0) {
+		LOG_ERR("Failed to read measurement.");
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+		return;
+	}
+
+	/* The buffer belongs to the application once the request is completed */
+	sht4x_publish_sample(read_cfg->sensor, sys_get_be16(edata->frame),
+			     sys_get_be16(&edata->frame[3]));
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+static void sht4x_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	const struct sht4x_config *cfg = dev->config;
+	struct sht4x_data *data = dev->data;
+	uint32_t min_buf_len = sizeof(struct sht4x_encoded_data);
+	struct sht4x_encoded_data *edata;
+	uint8_t *buf;
+	uint32_t buf_len;
+	int rc;
+
+	if (read_cfg->is_streaming) {
+		LOG_ERR("Streaming not supported");
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	rc = rtio_sqe_rx_buf(iodev_sqe, min_buf_len, min_buf_len, &buf, &buf_len);
+	if (rc < 0 || buf_len < min_buf_len) {
+		LOG_ERR("Failed to get a read buffer of size %u bytes", min_buf_len);
+		rtio_iodev_sqe_err(iodev_sqe, rc < 0 ? rc : -ENOMEM);
+		return;
+	}
+
+	edata = (struct sht4x_encoded_data *)buf;
+
+	rc = sht4x_encode(dev, read_cfg, buf);
+	if (rc < 0) {
+		LOG_ERR("Failed to encode sensor data");
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+		return;
+	}
+
+	rc = sensirion_rtio_claim(&data->rtio_busy);
+	if (rc < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+		return;
+	}
+
+	/* Start the measurement, let the executor wait out the conversion, then read */
+	rc = sensirion_rtio_prep_write(cfg->rtio_ctx, cfg->iodev, &measure_cmd[cfg->repeatability],
+				       1, measure_wait_us[cfg->repeatability], 0);
+	if (rc == 0) {
+		rc = sensirion_rtio_prep_read(cfg->rtio_ctx, cfg->iodev, edata->frame,
+					      SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+	}
+	if (rc == 0) {
+		rc = sensirion_rtio_submit(cfg->rtio_ctx, sht4x_complete_result, iodev_sqe, edata);
+	}
+	if (rc < 0) {
+		LOG_ERR("Failed to acquire SQEs");
+		sensirion_rtio_release(&data->rtio_busy);
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+	}
+}
+
+#ifdef CONFIG_SENSIRION_BATCH
+static int sht4x_batch_prep(const struct device *dev, const struct sensor_read_config *read_cfg,
+			    uint8_t *buf, struct sensirion_batch_measurement *meas)
+{
+	const struct sht4x_config *cfg = dev->config;
+	struct sht4x_encoded_data *edata = (struct sht4x_encoded_data *)buf;
+	int rc;
+
+	rc = sht4x_encode(dev, read_cfg, buf);
+	if (rc < 0) {
+		return rc;
+	}
+
+	meas->iodev = cfg->iodev;
+	meas->cmd[0] = measure_cmd[cfg->repeatability];
+	meas->cmd_len = 1;
+	meas->delay_us = measure_wait_us[cfg->repeatability];
+	meas->frame = edata->frame;
+	meas->num_words = SENSIRION_RTIO_FRAME_WORDS(edata->frame);
+
+	return 0;
+}
+#endif /* CONFIG_SENSIRION_BATCH */
+#endif /* CONFIG_SENSOR_ASYNC_API */
+
 static int sht4x_attr_set(const struct device *dev,
 				enum sensor_channel chan,
 				enum sensor_attribute attr,
@@ -236,14 +353,33 @@ static DEVICE_API(sensor, sht4x_api) = {
 	.sample_fetch = sht4x_sample_fetch,
 	.channel_get = sht4x_channel_get,
 	.attr_set = sht4x_attr_set,
+#ifdef CONFIG_SENSOR_ASYNC_API
+	.submit = sht4x_submit,
+	.get_decoder = sht4x_get_decoder,
+#endif
 };
 
+#define SHT4X_RTIO_DEFINE(n)						\
+	RTIO_DEFINE(sht4x_rtio_ctx_##n, 8, 8);				\
+	I2C_DT_IODEV_DEFINE(sht4x_iodev_##n, DT_DRV_INST(n));
+
 #define SHT4X_INIT(n)						\
 	static struct sht4x_data sht4x_data_##n;		\
 								\
+	IF_ENABLED(CONFIG_SENSIRION_COMP,			\
+		   (SENSIRION_COMP_SOURCE_DEFINE(DT_DRV_INST(n));))	\
+								\
+	IF_ENABLED(CONFIG_SENSOR_ASYNC_API, (SHT4X_RTIO_DEFINE(n)))	\
+								\
 	static const struct sht4x_config sht4x_config_##n = {	\
 		.bus = I2C_DT_SPEC_INST_GET(n),			\
-		.repeatability = DT_INST_PROP(n, repeatability)	\
+		.repeatability = DT_INST_PROP(n, repeatability),	\
+		IF_ENABLED(CONFIG_SENSIRION_COMP,		\
+			   (.comp = &SENSIRION_COMP_SOURCE_NAME(	\
+				    DT_DRV_INST(n)),))		\
+		IF_ENABLED(CONFIG_SENSOR_ASYNC_API,		\
+			   (.rtio_ctx = &sht4x_rtio_ctx_##n,	\
+			    .iodev = &sht4x_iodev_##n,))	\
 	};							\
 	PM_DEVICE_DT_INST_DEFINE(n, sht4x_pm_action);	\
 	SENSOR_DEVICE_DT_INST_DEFINE(n,				\
@@ -253,6 +389,10 @@ static DEVICE_API(sensor, sht4x_api) = {
 			      &sht4x_config_##n,		\
 			      POST_KERNEL,			\
 			      CONFIG_SENSOR_INIT_PRIORITY,	\
-			      &sht4x_api);
+			      &sht4x_api);			\
+	IF_ENABLED(CONFIG_SENSIRION_BATCH,			\
+		   (SENSIRION_BATCH_SENSOR_DEFINE(sht4x_batch_##n,	\
+			DEVICE_DT_INST_GET(n), sht4x_batch_prep,	\
+			sizeof(struct sht4x_encoded_data));))
 
 DT_INST_FOREACH_STATUS_OKAY(SHT4X_INIT)
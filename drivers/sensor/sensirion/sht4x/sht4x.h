@@ -8,6 +8,9 @@
 #define ZEPHYR_DRIVERS_SENSOR_SHT4X_SHT4X_H_
 
 #include <zephyr/device.h>
+#include <zephyr/sys/atomic.h>
+
+#include "../sensirion_core/sensirion_comp.h"
 
 #define SHT4X_CMD_READ_SERIAL	0x89
 #define SHT4X_CMD_RESET		0x94
@@ -18,16 +21,16 @@
 #define SHT4X_HEATER_POWER_IDX_MAX	3
 #define SHT4X_HEATER_DURATION_IDX_MAX	2
 
-/*
- * CRC parameters were taken from the
- * "Checksum Calculation" section of the datasheet.
- */
-#define SHT4X_CRC_POLY		0x31
-#define SHT4X_CRC_INIT		0xFF
-
 struct sht4x_config {
 	struct i2c_dt_spec bus;
 	uint8_t repeatability;
+#ifdef CONFIG_SENSIRION_COMP
+	struct sensirion_comp_source *comp;
+#endif
+#ifdef CONFIG_SENSOR_ASYNC_API
+	struct rtio *rtio_ctx;
+	struct rtio_iodev *iodev;
+#endif
 };
 
 struct sht4x_data {
@@ -35,6 +38,10 @@ struct sht4x_data {
 	uint16_t rh_sample;
 	uint8_t heater_power;
 	uint8_t heater_duration;
+#ifdef CONFIG_SENSOR_ASYNC_API
+	/* Set while a chain is in flight on rtio_ctx */
+	atomic_t rtio_busy;
+#endif
 };
 
 static const uint8_t measure_cmd[3] = {
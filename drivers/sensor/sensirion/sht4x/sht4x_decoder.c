@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sensirion_sht4x
+
+#include <zephyr/drivers/sensor_clock.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include "sht4x_decoder.h"
+
+static uint8_t sht4x_encode_channel(enum sensor_channel chan)
+{
+	switch (chan) {
+	case SENSOR_CHAN_AMBIENT_TEMP:
+		return SHT4X_CHAN_TEMP_BIT;
+	case SENSOR_CHAN_HUMIDITY:
+		return SHT4X_CHAN_RH_BIT;
+	case SENSOR_CHAN_ALL:
+		return SHT4X_CHAN_TEMP_BIT | SHT4X_CHAN_RH_BIT;
+	default:
+		return 0;
+	}
+}
+
+int sht4x_encode(const struct device *dev, const struct sensor_read_config *read_config,
+		 uint8_t *buf)
+{
+	struct sht4x_encoded_data *edata = (struct sht4x_encoded_data *)buf;
+	uint64_t cycles;
+	int rc;
+
+	ARG_UNUSED(dev);
+
+	edata->header.channels = 0;
+	for (size_t i = 0; i < read_config->count; i++) {
+		edata->header.channels |= sht4x_encode_channel(read_config->channels[i].chan_type);
+	}
+
+	rc = sensor_clock_get_cycles(&cycles);
+	if (rc != 0) {
+		return rc;
+	}
+
+	edata->header.timestamp = sensor_clock_cycles_to_ns(cycles);
+
+	return 0;
+}
+
+static int sht4x_decoder_get_frame_count(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+					 uint16_t *frame_count)
+{
+	const struct sht4x_encoded_data *edata = (const struct sht4x_encoded_data *)buffer;
+	uint8_t channel_request = sht4x_encode_channel(chan_spec.chan_type);
+
+	if (chan_spec.chan_idx != 0 || channel_request == 0 ||
+	    chan_spec.chan_type == SENSOR_CHAN_ALL) {
+		return -ENOTSUP;
+	}
+
+	if ((edata->header.channels & channel_request) == 0) {
+		return -ENODATA;
+	}
+
+	/* This sensor lacks a FIFO; there will always only be one frame at a time. */
+	*frame_count = 1;
+
+	return 0;
+}
+
+static int sht4x_decoder_get_size_info(struct sensor_chan_spec chan_spec, size_t *base_size,
+				       size_t *frame_size)
+{
+	switch (chan_spec.chan_type) {
+	case SENSOR_CHAN_AMBIENT_TEMP:
+	case SENSOR_CHAN_HUMIDITY:
+		*base_size = sizeof(struct sensor_q31_data);
+		*frame_size = sizeof(struct sensor_q31_sample_data);
+		return 0;
+	default:
+		return -ENOTSUP;
+	}
+}
+
+static int sht4x_decoder_decode(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+				uint32_t *fit, uint16_t max_count, void *data_out)
+{
+	const struct sht4x_encoded_data *edata = (const struct sht4x_encoded_data *)buffer;
+	struct sensor_q31_data *out = data_out;
+	int64_t raw;
+
+	if (*fit != 0 || max_count == 0) {
+		return 0;
+	}
+
+	if (chan_spec.chan_idx != 0) {
+		return -ENOTSUP;
+	}
+
+	/* See datasheet "Conversion of Signal Output" section */
+	switch (chan_spec.chan_type) {
+	case SENSOR_CHAN_AMBIENT_TEMP:
+		if ((edata->header.channels & SHT4X_CHAN_TEMP_BIT) == 0) {
+			return -ENODATA;
+		}
+		raw = sys_get_be16(&edata->frame[0]);
+		out->readings[0].temperature =
+			(int32_t)(((raw * 175) << (31 - SHT4X_Q31_SHIFT)) / 0xFFFF -
+				  ((int64_t)45 << (31 - SHT4X_Q31_SHIFT)));
+		break;
+	case SENSOR_CHAN_HUMIDITY:
+		if ((edata->header.channels & SHT4X_CHAN_RH_BIT) == 0) {
+			return -ENODATA;
+		}
+		raw = sys_get_be16(&edata->frame[3]);
+		out->readings[0].humidity =
+			(int32_t)(((raw * 125) << (31 - SHT4X_Q31_SHIFT)) / 0xFFFF -
+				  ((int64_t)6 << (31 - SHT4X_Q31_SHIFT)));
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	out->header.base_timestamp_ns = edata->header.timestamp;
+	out->header.reading_count = 1;
+	out->shift = SHT4X_Q31_SHIFT;
+	*fit = 1;
+
+	return 1;
+}
+
+SENSOR_DECODER_API_DT_DEFINE() = {
+	.get_frame_count = sht4x_decoder_get_frame_count,
+	.get_size_info = sht4x_decoder_get_size_info,
+	.decode = sht4x_decoder_decode,
+};
+
+int sht4x_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder)
+{
+	ARG_UNUSED(dev);
+	*decoder = &SENSOR_DECODER_NAME();
+
+	return 0;
+}
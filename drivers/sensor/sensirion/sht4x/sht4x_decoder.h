@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_DRIVERS_SENSOR_SHT4X_SHT4X_DECODER_H_
+#define ZEPHYR_DRIVERS_SENSOR_SHT4X_SHT4X_DECODER_H_
+
+#include <stdint.h>
+#include <zephyr/drivers/sensor.h>
+
+#define SHT4X_CHAN_TEMP_BIT	BIT(0)
+#define SHT4X_CHAN_RH_BIT	BIT(1)
+
+/* Q31 shift used for both the temperature and the humidity readings */
+#define SHT4X_Q31_SHIFT		8
+
+struct sht4x_encoded_header {
+	uint64_t timestamp;
+	uint8_t channels;
+};
+
+struct sht4x_encoded_data {
+	struct sht4x_encoded_header header;
+	/* Raw frame as read from the sensor: T MSB, T LSB, CRC, RH MSB, RH LSB, CRC */
+	uint8_t frame[6];
+};
+
+int sht4x_encode(const struct device *dev, const struct sensor_read_config *read_config,
+		 uint8_t *buf);
+
+int sht4x_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder);
+
+#endif /* ZEPHYR_DRIVERS_SENSOR_SHT4X_SHT4X_DECODER_H_ */
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sensirion_sht4x
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/logging/log.h>
+
+#include "../sensirion_core/sensirion_emul.h"
+
+LOG_MODULE_DECLARE(SHT4X, CONFIG_SENSOR_LOG_LEVEL);
+
+#define SHT4X_EMUL_CMD_MEASURE_HIGH   0xFD
+#define SHT4X_EMUL_CMD_MEASURE_MEDIUM 0xF6
+#define SHT4X_EMUL_CMD_MEASURE_LOW    0xE0
+#define SHT4X_EMUL_CMD_READ_SERIAL    0x89
+#define SHT4X_EMUL_CMD_RESET          0x94
+
+/* Heater pulses of 1 s and 0.1 s at high, medium and low power */
+#define SHT4X_EMUL_CMD_HEATER_HIGH_LONG    0x39
+#define SHT4X_EMUL_CMD_HEATER_HIGH_SHORT   0x32
+#define SHT4X_EMUL_CMD_HEATER_MEDIUM_LONG  0x2F
+#define SHT4X_EMUL_CMD_HEATER_MEDIUM_SHORT 0x24
+#define SHT4X_EMUL_CMD_HEATER_LOW_LONG     0x1E
+#define SHT4X_EMUL_CMD_HEATER_LOW_SHORT    0x15
+
+#define SHT4X_EMUL_SERIAL_HIGH 0x0F41
+#define SHT4X_EMUL_SERIAL_LOW  0x2B5C
+
+static int sht4x_emul_command(const struct emul *target, uint16_t cmd, const uint16_t *args,
+			      uint8_t num_args)
+{
+	struct sensirion_emul_data *data = target->data;
+	const uint16_t sample[] = {
+		data->signals[SENSIRION_EMUL_TEMPERATURE],
+		data->signals[SENSIRION_EMUL_HUMIDITY],
+	};
+	const uint16_t serial[] = {SHT4X_EMUL_SERIAL_HIGH, SHT4X_EMUL_SERIAL_LOW};
+
+	ARG_UNUSED(args);
+
+	if (num_args != 0) {
+		return -EIO;
+	}
+
+	/* Execution times are the maximum values of the datasheet */
+	switch (cmd) {
+	case SHT4X_EMUL_CMD_MEASURE_HIGH:
+		sensirion_emul_respond(data, sample, ARRAY_SIZE(sample), 8300);
+		break;
+	case SHT4X_EMUL_CMD_MEASURE_MEDIUM:
+		sensirion_emul_respond(data, sample, ARRAY_SIZE(sample), 4500);
+		break;
+	case SHT4X_EMUL_CMD_MEASURE_LOW:
+		sensirion_emul_respond(data, sample, ARRAY_SIZE(sample), 1600);
+		break;
+	case SHT4X_EMUL_CMD_HEATER_HIGH_LONG:
+	case SHT4X_EMUL_CMD_HEATER_MEDIUM_LONG:
+	case SHT4X_EMUL_CMD_HEATER_LOW_LONG:
+		/* Typical pulse length, the driver does not wait for the maximum */
+		sensirion_emul_respond(data, sample, ARRAY_SIZE(sample), 1000 * USEC_PER_MSEC);
+		break;
+	case SHT4X_EMUL_CMD_HEATER_HIGH_SHORT:
+	case SHT4X_EMUL_CMD_HEATER_MEDIUM_SHORT:
+	case SHT4X_EMUL_CMD_HEATER_LOW_SHORT:
+		sensirion_emul_respond(data, sample, ARRAY_SIZE(sample), 100 * USEC_PER_MSEC);
+		break;
+	case SHT4X_EMUL_CMD_READ_SERIAL:
+		sensirion_emul_respond(data, serial, ARRAY_SIZE(serial), 0);
+		break;
+	case SHT4X_EMUL_CMD_RESET:
+		sensirion_emul_respond(data, NULL, 0, 1000);
+		break;
+	default:
+		LOG_DBG("Unknown command 0x%02x", cmd);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int sht4x_emul_init(const struct emul *target, const struct device *parent)
+{
+	ARG_UNUSED(parent);
+
+	sensirion_emul_init_data(target->data);
+
+	return 0;
+}
+
+static const struct sensirion_emul_cfg sht4x_emul_cfg = {
+	.command = sht4x_emul_command,
+	.cmd_size = 1,
+};
+
+#define SHT4X_EMUL(n)                                                                              \
+	static struct sensirion_emul_data sht4x_emul_data_##n;                                     \
+	EMUL_DT_INST_DEFINE(n, sht4x_emul_init, &sht4x_emul_data_##n, &sht4x_emul_cfg,             \
+			    &sensirion_emul_api_i2c, NULL)
+
+DT_INST_FOREACH_STATUS_OKAY(SHT4X_EMUL)
@@ -12,10 +12,13 @@
 #include <zephyr/drivers/sensor.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/byteorder.h>
-#include <zephyr/sys/crc.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/rtio/rtio.h>
 
 #include "shtcx.h"
+#include "shtcx_decoder.h"
+#include "../sensirion_core/sensirion_common.h"
+#include "../sensirion_core/sensirion_rtio.h"
 
 LOG_MODULE_REGISTER(SHTCX, CONFIG_SENSOR_LOG_LEVEL);
 
@@ -33,18 +36,6 @@ static const uint16_t measure_wait_us[2][2] = {
 	{ 12100, 800 }, /* shtc3 */
 };
 
-/*
- * CRC algorithm parameters were taken from the
- * "Checksum Calculation" section of the datasheet.
- */
-static uint8_t shtcx_compute_crc(uint16_t value)
-{
-	uint8_t buf[2];
-
-	sys_put_be16(value, buf);
-	return crc8(buf, 2, 0x31, 0xFF, false);
-}
-
 /* val = -45 + 175 * sample / (2^16) */
 static void shtcx_temperature_from_raw(uint16_t raw, struct sensor_value *val)
 {
@@ -82,7 +73,6 @@ static int shtcx_read_words(const struct device *dev, uint16_t cmd, uint16_t *da
 	const struct shtcx_config *cfg = dev->config;
 	int status = 0;
 	uint32_t raw_len = num_words * (SHTCX_WORD_LEN + SHTCX_CRC8_LEN);
-	uint16_t temp16;
 	uint8_t rx_buf[SHTCX_MAX_READ_LEN];
 	int dst = 0;
 
@@ -102,14 +92,13 @@ static int shtcx_read_words(const struct device *dev, uint16_t cmd, uint16_t *da
 		return -EIO;
 	}
 
-	for (int i = 0; i < raw_len; i += (SHTCX_WORD_LEN + SHTCX_CRC8_LEN)) {
-		temp16 = sys_get_be16(&rx_buf[i]);
-		if (shtcx_compute_crc(temp16) != rx_buf[i+2]) {
-			LOG_DBG("invalid received invalid crc");
-			return -EIO;
-		}
+	if (sensirion_i2c_check_frame(rx_buf, num_words) != NO_ERROR) {
+		LOG_DBG("invalid received invalid crc");
+		return -EIO;
+	}
 
-		data[dst++] = temp16;
+	for (int i = 0; i < raw_len; i += (SHTCX_WORD_LEN + SHTCX_CRC8_LEN)) {
+		data[dst++] = sys_get_be16(&rx_buf[i]);
 	}
 
 	return 0;
@@ -166,6 +155,111 @@ static int shtcx_sample_fetch(const struct device *dev,
 	return 0;
 }
 
+#ifdef CONFIG_SENSOR_ASYNC_API
+static void shtcx_complete_result(struct rtio *ctx, const struct rtio_sqe *sqe, int result,
+				  void *arg)
+{
+	struct rtio_iodev_sqe *iodev_sqe = (struct rtio_iodev_sqe *)arg;
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	struct shtcx_data *data = read_cfg->sensor->data;
+	const struct shtcx_encoded_data *edata = sqe->userdata;
+
+	ARG_UNUSED(result);
+
+	if (sensirion_rtio_complete(ctx, &data->rtio_busy, iodev_sqe, edata->frame,
+				    SENSIRION_RTIO_FRAME_WORDS(edata->frame)) < 0) {
+		LOG_DBG("Failed read measurements!");
+	}
+}
+
+static int shtcx_prep_measurement(const struct shtcx_config *cfg,
+				  struct shtcx_encoded_data *edata)
+{
+	uint32_t wait_us = 0;
+	int rc;
+
+	if (cfg->chip == SHTC3) {
+		rc = sensirion_rtio_prep_cmd(cfg->rtio_ctx, cfg->iodev, SHTCX_CMD_WAKEUP, 100, 0);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	if (!cfg->clock_stretching) {
+		wait_us = measure_wait_us[cfg->chip][cfg->measure_mode];
+	}
+
+	rc = sensirion_rtio_prep_cmd(cfg->rtio_ctx, cfg->iodev,
+				     measure_cmd[cfg->measure_mode][cfg->clock_stretching], wait_us,
+				     0);
+	if (rc < 0) {
+		return rc;
+	}
+
+	rc = sensirion_rtio_prep_read(cfg->rtio_ctx, cfg->iodev, edata->frame,
+				      SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+	if (rc < 0) {
+		return rc;
+	}
+
+	if (cfg->chip == SHTC3) {
+		return sensirion_rtio_prep_cmd(cfg->rtio_ctx, cfg->iodev, SHTCX_CMD_SLEEP, 0, 0);
+	}
+
+	return 0;
+}
+
+static void shtcx_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	const struct shtcx_config *cfg = dev->config;
+	struct shtcx_data *data = dev->data;
+	uint32_t min_buf_len = sizeof(struct shtcx_encoded_data);
+	struct shtcx_encoded_data *edata;
+	uint8_t *buf;
+	uint32_t buf_len;
+	int rc;
+
+	if (read_cfg->is_streaming) {
+		LOG_ERR("Streaming not supported");
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	rc = rtio_sqe_rx_buf(iodev_sqe, min_buf_len, min_buf_len, &buf, &buf_len);
+	if (rc < 0 || buf_len < min_buf_len) {
+		LOG_ERR("Failed to get a read buffer of size %u bytes", min_buf_len);
+		rtio_iodev_sqe_err(iodev_sqe, rc < 0 ? rc : -ENOMEM);
+		return;
+	}
+
+	edata = (struct shtcx_encoded_data *)buf;
+
+	rc = shtcx_encode(dev, read_cfg, buf);
+	if (rc < 0) {
+		LOG_ERR("Failed to encode sensor data");
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+		return;
+	}
+
+	rc = sensirion_rtio_claim(&data->rtio_busy);
+	if (rc < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+		return;
+	}
+
+	rc = shtcx_prep_measurement(cfg, edata);
+	if (rc == 0) {
+		rc = sensirion_rtio_submit(cfg->rtio_ctx, shtcx_complete_result, iodev_sqe, edata);
+	}
+	if (rc < 0) {
+		LOG_ERR("Failed to acquire SQEs");
+		sensirion_rtio_release(&data->rtio_busy);
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+	}
+}
+#endif /* CONFIG_SENSOR_ASYNC_API */
+
 static int shtcx_channel_get(const struct device *dev,
 			      enum sensor_channel chan,
 			      struct sensor_value *val)
@@ -186,6 +280,10 @@ static int shtcx_channel_get(const struct device *dev,
 static DEVICE_API(sensor, shtcx_driver_api) = {
 	.sample_fetch = shtcx_sample_fetch,
 	.channel_get = shtcx_channel_get,
+#ifdef CONFIG_SENSOR_ASYNC_API
+	.submit = shtcx_submit,
+	.get_decoder = shtcx_get_decoder,
+#endif
 };
 
 static int shtcx_init(const struct device *dev)
@@ -245,11 +343,19 @@ static int shtcx_init(const struct device *dev)
 		.i2c = I2C_DT_SPEC_INST_GET(inst),			       \
 		.chip = SHTCX_CHIP(inst),				       \
 		.measure_mode = DT_INST_ENUM_IDX(inst, measure_mode),	       \
-		.clock_stretching = DT_INST_PROP(inst, clock_stretching)       \
+		.clock_stretching = DT_INST_PROP(inst, clock_stretching),      \
+		IF_ENABLED(CONFIG_SENSOR_ASYNC_API,			       \
+			   (.rtio_ctx = &shtcx_rtio_ctx_##inst,		       \
+			    .iodev = &shtcx_iodev_##inst,))		       \
 	}
 
+#define SHTCX_RTIO_DEFINE(inst)						\
+	RTIO_DEFINE(shtcx_rtio_ctx_##inst, 8, 8);			\
+	I2C_DT_IODEV_DEFINE(shtcx_iodev_##inst, DT_DRV_INST(inst));
+
 #define SHTCX_DEFINE(inst)						\
 	static struct shtcx_data shtcx_data_##inst;			\
+	IF_ENABLED(CONFIG_SENSOR_ASYNC_API, (SHTCX_RTIO_DEFINE(inst)))	\
 	static struct shtcx_config shtcx_config_##inst =		\
 		SHTCX_CONFIG(inst);					\
 	SENSOR_DEVICE_DT_INST_DEFINE(inst,				\
@@ -59,10 +59,18 @@ struct shtcx_config {
 	enum shtcx_chip chip;
 	enum shtcx_measure_mode measure_mode;
 	bool clock_stretching;
+#ifdef CONFIG_SENSOR_ASYNC_API
+	struct rtio *rtio_ctx;
+	struct rtio_iodev *iodev;
+#endif
 };
 
 struct shtcx_data {
 	struct shtcx_sample sample;
+#ifdef CONFIG_SENSOR_ASYNC_API
+	/* Set while a chain is in flight on rtio_ctx */
+	atomic_t rtio_busy;
+#endif
 };
 
 #endif /* ZEPHYR_DRIVERS_SENSOR_SHTCX_SHTCX_H_ */
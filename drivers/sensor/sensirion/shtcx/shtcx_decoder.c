@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sensirion_shtcx
+
+#include <zephyr/drivers/sensor_clock.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include "shtcx_decoder.h"
+
+static uint8_t shtcx_encode_channel(enum sensor_channel chan)
+{
+	switch (chan) {
+	case SENSOR_CHAN_AMBIENT_TEMP:
+		return SHTCX_CHAN_TEMP_BIT;
+	case SENSOR_CHAN_HUMIDITY:
+		return SHTCX_CHAN_RH_BIT;
+	case SENSOR_CHAN_ALL:
+		return SHTCX_CHAN_TEMP_BIT | SHTCX_CHAN_RH_BIT;
+	default:
+		return 0;
+	}
+}
+
+int shtcx_encode(const struct device *dev, const struct sensor_read_config *read_config,
+		 uint8_t *buf)
+{
+	struct shtcx_encoded_data *edata = (struct shtcx_encoded_data *)buf;
+	uint64_t cycles;
+	int rc;
+
+	ARG_UNUSED(dev);
+
+	edata->header.channels = 0;
+	for (size_t i = 0; i < read_config->count; i++) {
+		edata->header.channels |= shtcx_encode_channel(read_config->channels[i].chan_type);
+	}
+
+	rc = sensor_clock_get_cycles(&cycles);
+	if (rc != 0) {
+		return rc;
+	}
+
+	edata->header.timestamp = sensor_clock_cycles_to_ns(cycles);
+
+	return 0;
+}
+
+static int shtcx_decoder_get_frame_count(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+					 uint16_t *frame_count)
+{
+	const struct shtcx_encoded_data *edata = (const struct shtcx_encoded_data *)buffer;
+	uint8_t channel_request = shtcx_encode_channel(chan_spec.chan_type);
+
+	if (chan_spec.chan_idx != 0 || channel_request == 0 ||
+	    chan_spec.chan_type == SENSOR_CHAN_ALL) {
+		return -ENOTSUP;
+	}
+
+	if ((edata->header.channels & channel_request) == 0) {
+		return -ENODATA;
+	}
+
+	/* This sensor lacks a FIFO; there will always only be one frame at a time. */
+	*frame_count = 1;
+
+	return 0;
+}
+
+static int shtcx_decoder_get_size_info(struct sensor_chan_spec chan_spec, size_t *base_size,
+				       size_t *frame_size)
+{
+	switch (chan_spec.chan_type) {
+	case SENSOR_CHAN_AMBIENT_TEMP:
+	case SENSOR_CHAN_HUMIDITY:
+		*base_size = sizeof(struct sensor_q31_data);
+		*frame_size = sizeof(struct sensor_q31_sample_data);
+		return 0;
+	default:
+		return -ENOTSUP;
+	}
+}
+
+static int shtcx_decoder_decode(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+				uint32_t *fit, uint16_t max_count, void *data_out)
+{
+	const struct shtcx_encoded_data *edata = (const struct shtcx_encoded_data *)buffer;
+	struct sensor_q31_data *out = data_out;
+	int64_t raw;
+
+	if (*fit != 0 || max_count == 0) {
+		return 0;
+	}
+
+	if (chan_spec.chan_idx != 0) {
+		return -ENOTSUP;
+	}
+
+	switch (chan_spec.chan_type) {
+	case SENSOR_CHAN_AMBIENT_TEMP:
+		if ((edata->header.channels & SHTCX_CHAN_TEMP_BIT) == 0) {
+			return -ENODATA;
+		}
+		/* val = -45 + 175 * sample / (2^16) */
+		raw = sys_get_be16(&edata->frame[0]);
+		out->readings[0].temperature =
+			(int32_t)(((raw * 175) << (31 - SHTCX_Q31_SHIFT - 16)) -
+				  ((int64_t)45 << (31 - SHTCX_Q31_SHIFT)));
+		break;
+	case SENSOR_CHAN_HUMIDITY:
+		if ((edata->header.channels & SHTCX_CHAN_RH_BIT) == 0) {
+			return -ENODATA;
+		}
+		/* val = 100 * sample / (2^16) */
+		raw = sys_get_be16(&edata->frame[3]);
+		out->readings[0].humidity = (int32_t)((raw * 100) << (31 - SHTCX_Q31_SHIFT - 16));
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	out->header.base_timestamp_ns = edata->header.timestamp;
+	out->header.reading_count = 1;
+	out->shift = SHTCX_Q31_SHIFT;
+	*fit = 1;
+
+	return 1;
+}
+
+SENSOR_DECODER_API_DT_DEFINE() = {
+	.get_frame_count = shtcx_decoder_get_frame_count,
+	.get_size_info = shtcx_decoder_get_size_info,
+	.decode = shtcx_decoder_decode,
+};
+
+int shtcx_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder)
+{
+	ARG_UNUSED(dev);
+	*decoder = &SENSOR_DECODER_NAME();
+
+	return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sensirion_shtcx
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/logging/log.h>
+
+#include "../sensirion_core/sensirion_emul.h"
+#include "shtcx.h"
+
+LOG_MODULE_DECLARE(SHTCX, CONFIG_SENSOR_LOG_LEVEL);
+
+/* Measurement commands reading the temperature first */
+#define SHTCX_EMUL_CMD_MEASURE_NORMAL            0x7866
+#define SHTCX_EMUL_CMD_MEASURE_NORMAL_STRETCH    0x7CA2
+#define SHTCX_EMUL_CMD_MEASURE_LOW_POWER         0x609C
+#define SHTCX_EMUL_CMD_MEASURE_LOW_POWER_STRETCH 0x6458
+
+#define SHTCX_EMUL_WAKEUP_TIME_US 100
+
+/* Maximum measurement durations: measure_us[chip][measure mode] */
+static const uint16_t measure_us[2][2] = {
+	{14400, 940}, /* shtc1 */
+	{12100, 800}, /* shtc3 */
+};
+
+static const uint16_t product_id[2] = {SHTC1_ID_VALUE, SHTC3_ID_VALUE};
+
+struct shtcx_emul_cfg {
+	struct sensirion_emul_cfg common;
+	enum shtcx_chip chip;
+};
+
+static int shtcx_emul_measure(struct sensirion_emul_data *data, uint32_t duration_us)
+{
+	const uint16_t sample[] = {
+		data->signals[SENSIRION_EMUL_TEMPERATURE],
+		data->signals[SENSIRION_EMUL_HUMIDITY],
+	};
+
+	sensirion_emul_respond(data, sample, ARRAY_SIZE(sample), duration_us);
+
+	return 0;
+}
+
+static int shtcx_emul_command(const struct emul *target, uint16_t cmd, const uint16_t *args,
+			      uint8_t num_args)
+{
+	const struct shtcx_emul_cfg *cfg = target->cfg;
+	struct sensirion_emul_data *data = target->data;
+	bool is_shtc3 = cfg->chip == SHTC3;
+
+	ARG_UNUSED(args);
+
+	if (num_args != 0) {
+		return -EIO;
+	}
+
+	/* The SHTC3 ignores everything but the wakeup command while it sleeps */
+	if (data->sleeping && cmd != SHTCX_CMD_WAKEUP) {
+		return -EIO;
+	}
+
+	switch (cmd) {
+	case SHTCX_EMUL_CMD_MEASURE_NORMAL:
+		return shtcx_emul_measure(data, measure_us[cfg->chip][NORMAL]);
+	case SHTCX_EMUL_CMD_MEASURE_LOW_POWER:
+		return shtcx_emul_measure(data, measure_us[cfg->chip][LOW_POWER]);
+	case SHTCX_EMUL_CMD_MEASURE_NORMAL_STRETCH:
+	case SHTCX_EMUL_CMD_MEASURE_LOW_POWER_STRETCH:
+		/* The sensor holds the clock until the result is ready */
+		return shtcx_emul_measure(data, 0);
+	case SHTCX_CMD_READ_ID:
+		sensirion_emul_respond(data, &product_id[cfg->chip], 1, 0);
+		return 0;
+	case SHTCX_CMD_SOFT_RESET:
+		sensirion_emul_respond(data, NULL, 0, SHTCX_SOFT_RESET_TIME_US);
+		return 0;
+	case SHTCX_CMD_SLEEP:
+		if (!is_shtc3) {
+			break;
+		}
+		data->sleeping = true;
+		return 0;
+	case SHTCX_CMD_WAKEUP:
+		if (!is_shtc3) {
+			break;
+		}
+		data->sleeping = false;
+		sensirion_emul_respond(data, NULL, 0, SHTCX_EMUL_WAKEUP_TIME_US);
+		return 0;
+	default:
+		break;
+	}
+
+	LOG_DBG("Unknown command 0x%04x", cmd);
+
+	return -EIO;
+}
+
+static int shtcx_emul_init(const struct emul *target, const struct device *parent)
+{
+	ARG_UNUSED(parent);
+
+	sensirion_emul_init_data(target->data);
+
+	return 0;
+}
+
+#define SHTCX_EMUL_CHIP(n)                                                                         \
+	(DT_INST_NODE_HAS_COMPAT(n, sensirion_shtc1) ? CHIP_SHTC1 : CHIP_SHTC3)
+
+#define SHTCX_EMUL(n)                                                                              \
+	static struct sensirion_emul_data shtcx_emul_data_##n;                                     \
+	static const struct shtcx_emul_cfg shtcx_emul_cfg_##n = {                                  \
+		.common =                                                                          \
+			{                                                                          \
+				.command = shtcx_emul_command,                                     \
+				.cmd_size = 2,                                                     \
+			},                                                                         \
+		.chip = SHTCX_EMUL_CHIP(n),                                                        \
+	};                                                                                         \
+	EMUL_DT_INST_DEFINE(n, shtcx_emul_init, &shtcx_emul_data_##n, &shtcx_emul_cfg_##n,         \
+			    &sensirion_emul_api_i2c, NULL)
+
+DT_INST_FOREACH_STATUS_OKAY(SHTCX_EMUL)
@@ -9,292 +9,357 @@
 #include "stcc4.h"
 #include "../sensirion_core/sensirion_common.h"
 #include "../sensirion_core/sensirion_i2c.h"
+#include "../sensirion_core/sensirion_job.h"
+#include "../sensirion_core/sensirion_rtio.h"
 
 #include <zephyr/device.h>
 #include <zephyr/drivers/i2c.h>
 #include <zephyr/drivers/sensor.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/rtio/rtio.h>
 
 #include <zephyr/drivers/sensor/stcc4.h>
+#include "stcc4_decoder.h"
 
 LOG_MODULE_REGISTER(STCC4, CONFIG_SENSOR_LOG_LEVEL);
 
-static const struct i2c_dt_spec *i2c_spec;
-
-static uint8_t communication_buffer[18] = {0};
+/*
+ * Every command below builds its frame in the communication buffer of the
+ * instance and holds the instance lock until the response has been read, so
+ * commands to the same sensor never interleave while independent instances
+ * proceed in parallel. The lock is recursive, which lets the composite
+ * helpers call the primitive ones.
+ *
+ * The lock is never held across the execution time of a command. Commands
+ * that take longer than a few milliseconds run as a job, either on the work
+ * queue or in the calling thread through sensirion_job_run(), and the short
+ * public commands claim the job slot along with the lock. A job step thus
+ * never waits for the lock while a blocking command sleeps.
+ *
+ * Reads through RTIO do not take the lock, as they may be submitted and
+ * completed in interrupt context. They must not be issued concurrently with
+ * the commands below on the same instance.
+ */
 
-int stcc4_start_continuous_measurement(void)
+/* Takes the instance lock for a public command, unless a job is running */
+static int stcc4_lock(const struct device *dev)
 {
-	int local_error = NO_ERROR;
-	uint8_t *buffer_ptr = communication_buffer;
-	uint16_t local_offset = 0;
+	struct stcc4_data *data = dev->data;
+	int ret;
 
-	local_offset = sensirion_i2c_add_command16_to_buffer(
-		buffer_ptr, local_offset, STCC4_START_CONTINUOUS_MEASUREMENT_CMD_ID);
-	local_error = sensirion_i2c_write_data(i2c_spec, buffer_ptr, local_offset);
-	if (local_error != NO_ERROR) {
-		return local_error;
+	k_mutex_lock(&data->lock, K_FOREVER);
+	ret = sensirion_job_claim(&data->job);
+	if (ret < 0) {
+		k_mutex_unlock(&data->lock);
 	}
-	return local_error;
+
+	return ret;
+}
+
+static void stcc4_unlock(const struct device *dev)
+{
+	struct stcc4_data *data = dev->data;
+
+	sensirion_job_release(&data->job);
+	k_mutex_unlock(&data->lock);
 }
 
-int stcc4_read_measurement_raw(int16_t *co2_concentration_raw, uint16_t *temperature_raw,
-			       uint16_t *relative_humidity_raw, uint16_t *sensor_status_raw)
+static int stcc4_send_command(const struct device *dev, uint16_t cmd, const uint16_t *args,
+			      size_t num_args)
 {
+	const struct stcc4_config *cfg = dev->config;
+	struct stcc4_data *data = dev->data;
 	int local_error = NO_ERROR;
-	uint8_t *buffer_ptr = communication_buffer;
+	uint8_t *buffer_ptr = data->communication_buffer;
 	uint16_t local_offset = 0;
 
-	local_offset = sensirion_i2c_add_command16_to_buffer(buffer_ptr, local_offset,
-							     STCC4_READ_MEASUREMENT_RAW_CMD_ID);
-	local_error = sensirion_i2c_write_data(i2c_spec, buffer_ptr, local_offset);
-	if (local_error != NO_ERROR) {
-		return local_error;
+	k_mutex_lock(&data->lock, K_FOREVER);
+	local_offset = sensirion_i2c_add_command16_to_buffer(buffer_ptr, local_offset, cmd);
+	for (size_t i = 0; i < num_args; i++) {
+		local_offset = sensirion_i2c_add_uint16_t_to_buffer(buffer_ptr, local_offset, args[i]);
 	}
-	k_msleep(1);
-	local_error = sensirion_i2c_read_data_inplace(i2c_spec, buffer_ptr, 8);
-	if (local_error != NO_ERROR) {
-		return local_error;
-	}
-	*co2_concentration_raw = sensirion_common_bytes_to_int16_t(&buffer_ptr[0]);
-	*temperature_raw = sensirion_common_bytes_to_uint16_t(&buffer_ptr[2]);
-	*relative_humidity_raw = sensirion_common_bytes_to_uint16_t(&buffer_ptr[4]);
-	*sensor_status_raw = sensirion_common_bytes_to_uint16_t(&buffer_ptr[6]);
+	local_error = sensirion_i2c_write_data(&cfg->bus, buffer_ptr, local_offset);
+	k_mutex_unlock(&data->lock);
 	return local_error;
 }
 
-int stcc4_stop_continuous_measurement(void)
+static int stcc4_read_word(const struct device *dev, uint16_t *word)
 {
+	const struct stcc4_config *cfg = dev->config;
+	struct stcc4_data *data = dev->data;
 	int local_error = NO_ERROR;
-	uint8_t *buffer_ptr = communication_buffer;
-	uint16_t local_offset = 0;
+	uint8_t *buffer_ptr = data->communication_buffer;
 
-	local_offset = sensirion_i2c_add_command16_to_buffer(
-		buffer_ptr, local_offset, STCC4_STOP_CONTINUOUS_MEASUREMENT_CMD_ID);
-	local_error = sensirion_i2c_write_data(i2c_spec, buffer_ptr, local_offset);
-	if (local_error != NO_ERROR) {
-		return local_error;
+	k_mutex_lock(&data->lock, K_FOREVER);
+	local_error = sensirion_i2c_read_data_inplace(&cfg->bus, buffer_ptr, 2);
+	if (local_error == NO_ERROR) {
+		*word = sensirion_common_bytes_to_uint16_t(&buffer_ptr[0]);
 	}
-	k_msleep(1200);
+	k_mutex_unlock(&data->lock);
 	return local_error;
 }
 
-int stcc4_measure_single_shot(void)
+/*
+ * Runs a command as a job: the command is sent in the first step, the
+ * execution time is left to the work queue and the response word, if any, is
+ * read in the second step.
+ */
+static int stcc4_job_command(struct sensirion_job *job, uint16_t cmd, bool has_arg,
+			     uint16_t duration_ms, bool has_result)
 {
-	int local_error = NO_ERROR;
-	uint8_t *buffer_ptr = communication_buffer;
-	uint16_t local_offset = 0;
+	int local_error;
 
-	local_offset = sensirion_i2c_add_command16_to_buffer(buffer_ptr, local_offset,
-							     STCC4_MEASURE_SINGLE_SHOT_CMD_ID);
-	local_error = sensirion_i2c_write_data(i2c_spec, buffer_ptr, local_offset);
-	if (local_error != NO_ERROR) {
-		return local_error;
+	switch (job->state++) {
+	case 0:
+		local_error = stcc4_send_command(job->dev, cmd, &job->arg, has_arg ? 1 : 0);
+		if (local_error != NO_ERROR) {
+			return local_error < 0 ? local_error : -EIO;
+		}
+		return duration_ms;
+	case 1:
+		if (!has_result) {
+			return SENSIRION_JOB_DONE;
+		}
+		local_error = stcc4_read_word(job->dev, job->out);
+		if (local_error != NO_ERROR) {
+			return local_error < 0 ? local_error : -EIO;
+		}
+		return SENSIRION_JOB_DONE;
+	default:
+		return -EINVAL;
 	}
-	k_msleep(500);
-	return local_error;
 }
 
-int stcc4_perform_forced_recalibration(int16_t target_co2_concentration, int16_t *frc_correction)
+static int stcc4_stop_continuous_measurement_step(struct sensirion_job *job)
+{
+	return stcc4_job_command(job, STCC4_STOP_CONTINUOUS_MEASUREMENT_CMD_ID, false, 1200, false);
+}
+
+static int stcc4_measure_single_shot_step(struct sensirion_job *job)
 {
+	return stcc4_job_command(job, STCC4_MEASURE_SINGLE_SHOT_CMD_ID, false, 500, false);
+}
+
+static int stcc4_perform_forced_recalibration_step(struct sensirion_job *job)
+{
+	return stcc4_job_command(job, STCC4_PERFORM_FORCED_RECALIBRATION_CMD_ID, true, 90, true);
+}
+
+static int stcc4_perform_self_test_step(struct sensirion_job *job)
+{
+	return stcc4_job_command(job, STCC4_PERFORM_SELF_TEST_CMD_ID, false, 360, true);
+}
+
+static int stcc4_perform_conditioning_step(struct sensirion_job *job)
+{
+	return stcc4_job_command(job, STCC4_PERFORM_CONDITIONING_CMD_ID, false, 22000, false);
+}
+
+static int stcc4_perform_factory_reset_step(struct sensirion_job *job)
+{
+	return stcc4_job_command(job, STCC4_PERFORM_FACTORY_RESET_CMD_ID, false, 90, true);
+}
+
+int stcc4_start_continuous_measurement(const struct device *dev)
+{
+	const struct stcc4_config *cfg = dev->config;
+	struct stcc4_data *data = dev->data;
 	int local_error = NO_ERROR;
-	uint8_t *buffer_ptr = communication_buffer;
+	uint8_t *buffer_ptr = data->communication_buffer;
 	uint16_t local_offset = 0;
 
-	local_offset = sensirion_i2c_add_command16_to_buffer(
-		buffer_ptr, local_offset, STCC4_PERFORM_FORCED_RECALIBRATION_CMD_ID);
-	local_offset = sensirion_i2c_add_int16_t_to_buffer(buffer_ptr, local_offset,
-							   target_co2_concentration);
-	local_error = sensirion_i2c_write_data(i2c_spec, buffer_ptr, local_offset);
-	if (local_error != NO_ERROR) {
+	local_error = stcc4_lock(dev);
+	if (local_error < 0) {
 		return local_error;
 	}
-	k_msleep(90);
-	local_error = sensirion_i2c_read_data_inplace(i2c_spec, buffer_ptr, 2);
-	if (local_error != NO_ERROR) {
-		return local_error;
-	}
-	*frc_correction = sensirion_common_bytes_to_int16_t(&buffer_ptr[0]);
+
+	local_offset = sensirion_i2c_add_command16_to_buffer(
+		buffer_ptr, local_offset, STCC4_START_CONTINUOUS_MEASUREMENT_CMD_ID);
+	local_error = sensirion_i2c_write_data(&cfg->bus, buffer_ptr, local_offset);
+	stcc4_unlock(dev);
 	return local_error;
 }
 
-int stcc4_get_product_id(uint32_t *product_id, uint64_t *serial_number)
+static int stcc4_read_measurement_raw(const struct device *dev, int16_t *co2_concentration_raw,
+				      uint16_t *temperature_raw, uint16_t *relative_humidity_raw,
+				      uint16_t *sensor_status_raw)
 {
+	const struct stcc4_config *cfg = dev->config;
+	struct stcc4_data *data = dev->data;
 	int local_error = NO_ERROR;
-	uint8_t *buffer_ptr = communication_buffer;
+	uint8_t *buffer_ptr = data->communication_buffer;
 	uint16_t local_offset = 0;
 
+	k_mutex_lock(&data->lock, K_FOREVER);
 	local_offset = sensirion_i2c_add_command16_to_buffer(buffer_ptr, local_offset,
-							     STCC4_GET_PRODUCT_ID_CMD_ID);
-	local_error = sensirion_i2c_write_data(i2c_spec, buffer_ptr, local_offset);
+							     STCC4_READ_MEASUREMENT_RAW_CMD_ID);
+	local_error = sensirion_i2c_write_data(&cfg->bus, buffer_ptr, local_offset);
 	if (local_error != NO_ERROR) {
-		return local_error;
+		goto unlock;
 	}
 	k_msleep(1);
-	local_error = sensirion_i2c_read_data_inplace(i2c_spec, buffer_ptr, 12);
+	local_error = sensirion_i2c_read_data_inplace(&cfg->bus, buffer_ptr, 8);
 	if (local_error != NO_ERROR) {
-		return local_error;
+		goto unlock;
 	}
-	*product_id = sensirion_common_bytes_to_uint32_t(&buffer_ptr[0]);
-	sensirion_common_to_integer(&buffer_ptr[4], (uint8_t *)serial_number, LONG_INTEGER, 8);
+	*co2_concentration_raw = sensirion_common_bytes_to_int16_t(&buffer_ptr[0]);
+	*temperature_raw = sensirion_common_bytes_to_uint16_t(&buffer_ptr[2]);
+	*relative_humidity_raw = sensirion_common_bytes_to_uint16_t(&buffer_ptr[4]);
+	*sensor_status_raw = sensirion_common_bytes_to_uint16_t(&buffer_ptr[6]);
+unlock:
+	k_mutex_unlock(&data->lock);
 	return local_error;
 }
 
-int stcc4_set_rht_compensation(uint16_t raw_temperature, uint16_t raw_humidity)
+int stcc4_stop_continuous_measurement(const struct device *dev)
 {
-	int local_error = NO_ERROR;
-	uint8_t *buffer_ptr = communication_buffer;
-	uint16_t local_offset = 0;
+	struct stcc4_data *data = dev->data;
 
-	local_offset = sensirion_i2c_add_command16_to_buffer(buffer_ptr, local_offset,
-							     STCC4_SET_RHT_COMPENSATION_CMD_ID);
-	local_offset =
-		sensirion_i2c_add_uint16_t_to_buffer(buffer_ptr, local_offset, raw_temperature);
-	local_offset = sensirion_i2c_add_uint16_t_to_buffer(buffer_ptr, local_offset, raw_humidity);
-	local_error = sensirion_i2c_write_data(i2c_spec, buffer_ptr, local_offset);
-	if (local_error != NO_ERROR) {
-		return local_error;
-	}
-	k_msleep(1);
-	return local_error;
+	return sensirion_job_run(&data->job, stcc4_stop_continuous_measurement_step, 0, NULL);
 }
 
-int stcc4_set_pressure_compensation_raw(uint16_t pressure)
+int stcc4_measure_single_shot(const struct device *dev)
 {
-	int local_error = NO_ERROR;
-	uint8_t *buffer_ptr = communication_buffer;
-	uint16_t local_offset = 0;
+	struct stcc4_data *data = dev->data;
 
-	local_offset = sensirion_i2c_add_command16_to_buffer(
-		buffer_ptr, local_offset, STCC4_SET_PRESSURE_COMPENSATION_RAW_CMD_ID);
-	local_offset = sensirion_i2c_add_uint16_t_to_buffer(buffer_ptr, local_offset, pressure);
-	local_error = sensirion_i2c_write_data(i2c_spec, buffer_ptr, local_offset);
-	if (local_error != NO_ERROR) {
-		return local_error;
-	}
-	k_msleep(1);
-	return local_error;
+	return sensirion_job_run(&data->job, stcc4_measure_single_shot_step, 0, NULL);
 }
 
-int stcc4_perform_self_test(uint16_t *test_result)
+int stcc4_perform_forced_recalibration(const struct device *dev, int16_t target_co2_concentration,
+				       int16_t *frc_correction)
 {
+	struct stcc4_data *data = dev->data;
+
+	return sensirion_job_run(&data->job, stcc4_perform_forced_recalibration_step,
+				 (uint16_t)target_co2_concentration, frc_correction);
+}
+
+int stcc4_get_product_id(const struct device *dev, uint32_t *product_id, uint64_t *serial_number)
+{
+	const struct stcc4_config *cfg = dev->config;
+	struct stcc4_data *data = dev->data;
 	int local_error = NO_ERROR;
-	uint8_t *buffer_ptr = communication_buffer;
+	uint8_t *buffer_ptr = data->communication_buffer;
 	uint16_t local_offset = 0;
 
+	local_error = stcc4_lock(dev);
+	if (local_error < 0) {
+		return local_error;
+	}
+
 	local_offset = sensirion_i2c_add_command16_to_buffer(buffer_ptr, local_offset,
-							     STCC4_PERFORM_SELF_TEST_CMD_ID);
-	local_error = sensirion_i2c_write_data(i2c_spec, buffer_ptr, local_offset);
+							     STCC4_GET_PRODUCT_ID_CMD_ID);
+	local_error = sensirion_i2c_write_data(&cfg->bus, buffer_ptr, local_offset);
 	if (local_error != NO_ERROR) {
-		return local_error;
+		goto unlock;
 	}
-	k_msleep(360);
-	local_error = sensirion_i2c_read_data_inplace(i2c_spec, buffer_ptr, 2);
+	k_msleep(1);
+	local_error = sensirion_i2c_read_data_inplace(&cfg->bus, buffer_ptr, 12);
 	if (local_error != NO_ERROR) {
-		return local_error;
+		goto unlock;
 	}
-	*test_result = sensirion_common_bytes_to_uint16_t(&buffer_ptr[0]);
+	*product_id = sensirion_common_bytes_to_uint32_t(&buffer_ptr[0]);
+	sensirion_common_to_integer(&buffer_ptr[4], (uint8_t *)serial_number, LONG_INTEGER, 8);
+unlock:
+	stcc4_unlock(dev);
 	return local_error;
 }
 
-int stcc4_perform_conditioning(void)
+int stcc4_enter_sleep_mode(const struct device *dev)
 {
+	const struct stcc4_config *cfg = dev->config;
+	struct stcc4_data *data = dev->data;
 	int local_error = NO_ERROR;
-	uint8_t *buffer_ptr = communication_buffer;
+	uint8_t *buffer_ptr = data->communication_buffer;
 	uint16_t local_offset = 0;
 
-	local_offset = sensirion_i2c_add_command16_to_buffer(buffer_ptr, local_offset,
-							     STCC4_PERFORM_CONDITIONING_CMD_ID);
-	local_error = sensirion_i2c_write_data(i2c_spec, buffer_ptr, local_offset);
-	if (local_error != NO_ERROR) {
+	local_error = stcc4_lock(dev);
+	if (local_error < 0) {
 		return local_error;
 	}
-	k_msleep(22000);
-	return local_error;
-}
-
-int stcc4_enter_sleep_mode(void)
-{
-	int local_error = NO_ERROR;
-	uint8_t *buffer_ptr = communication_buffer;
-	uint16_t local_offset = 0;
 
 	local_offset = sensirion_i2c_add_command16_to_buffer(buffer_ptr, local_offset,
 							     STCC4_ENTER_SLEEP_MODE_CMD_ID);
-	local_error = sensirion_i2c_write_data(i2c_spec, buffer_ptr, local_offset);
-	if (local_error != NO_ERROR) {
-		return local_error;
+	local_error = sensirion_i2c_write_data(&cfg->bus, buffer_ptr, local_offset);
+	if (local_error == NO_ERROR) {
+		k_msleep(2);
 	}
-	k_msleep(2);
+	stcc4_unlock(dev);
 	return local_error;
 }
 
-int stcc4_exit_sleep_mode(void)
+int stcc4_exit_sleep_mode(const struct device *dev)
 {
+	const struct stcc4_config *cfg = dev->config;
+	struct stcc4_data *data = dev->data;
 	int local_error = NO_ERROR;
-	uint8_t *buffer_ptr = communication_buffer;
+	uint8_t *buffer_ptr = data->communication_buffer;
 	uint16_t local_offset = 0;
 
+	local_error = stcc4_lock(dev);
+	if (local_error < 0) {
+		return local_error;
+	}
+
 	local_offset = sensirion_i2c_add_command8_to_buffer(buffer_ptr, local_offset,
 							    STCC4_EXIT_SLEEP_MODE_CMD_ID);
-	sensirion_i2c_write_data(i2c_spec, buffer_ptr, local_offset);
+	/* The sensor does not acknowledge the wake-up command */
+	sensirion_i2c_write_data(&cfg->bus, buffer_ptr, local_offset);
 	k_msleep(5);
+	stcc4_unlock(dev);
 	return local_error;
 }
 
-int stcc4_enable_testing_mode(void)
+int stcc4_enable_testing_mode(const struct device *dev)
 {
+	const struct stcc4_config *cfg = dev->config;
+	struct stcc4_data *data = dev->data;
 	int local_error = NO_ERROR;
-	uint8_t *buffer_ptr = communication_buffer;
+	uint8_t *buffer_ptr = data->communication_buffer;
 	uint16_t local_offset = 0;
 
-	local_offset = sensirion_i2c_add_command16_to_buffer(buffer_ptr, local_offset,
-							     STCC4_ENABLE_TESTING_MODE_CMD_ID);
-	local_error = sensirion_i2c_write_data(i2c_spec, buffer_ptr, local_offset);
-	if (local_error != NO_ERROR) {
+	local_error = stcc4_lock(dev);
+	if (local_error < 0) {
 		return local_error;
 	}
+
+	local_offset = sensirion_i2c_add_command16_to_buffer(buffer_ptr, local_offset,
+							     STCC4_ENABLE_TESTING_MODE_CMD_ID);
+	local_error = sensirion_i2c_write_data(&cfg->bus, buffer_ptr, local_offset);
+	stcc4_unlock(dev);
 	return local_error;
 }
 
-int stcc4_disable_testing_mode(void)
+int stcc4_disable_testing_mode(const struct device *dev)
 {
+	const struct stcc4_config *cfg = dev->config;
+	struct stcc4_data *data = dev->data;
 	int local_error = NO_ERROR;
-	uint8_t *buffer_ptr = communication_buffer;
+	uint8_t *buffer_ptr = data->communication_buffer;
 	uint16_t local_offset = 0;
 
-	local_offset = sensirion_i2c_add_command16_to_buffer(buffer_ptr, local_offset,
-							     STCC4_DISABLE_TESTING_MODE_CMD_ID);
-	local_error = sensirion_i2c_write_data(i2c_spec, buffer_ptr, local_offset);
-	if (local_error != NO_ERROR) {
+	local_error = stcc4_lock(dev);
+	if (local_error < 0) {
 		return local_error;
 	}
+
+	local_offset = sensirion_i2c_add_command16_to_buffer(buffer_ptr, local_offset,
+							     STCC4_DISABLE_TESTING_MODE_CMD_ID);
+	local_error = sensirion_i2c_write_data(&cfg->bus, buffer_ptr, local_offset);
+	stcc4_unlock(dev);
 	return local_error;
 }
 
-int stcc4_perform_factory_reset(uint16_t *factory_reset_result)
+int stcc4_perform_factory_reset(const struct device *dev, uint16_t *factory_reset_result)
 {
-	int local_error = NO_ERROR;
-	uint8_t *buffer_ptr = communication_buffer;
-	uint16_t local_offset = 0;
+	struct stcc4_data *data = dev->data;
 
-	local_offset = sensirion_i2c_add_command16_to_buffer(buffer_ptr, local_offset,
-							     STCC4_PERFORM_FACTORY_RESET_CMD_ID);
-	local_error = sensirion_i2c_write_data(i2c_spec, buffer_ptr, local_offset);
-	if (local_error != NO_ERROR) {
-		return local_error;
-	}
-	k_msleep(90);
-	local_error = sensirion_i2c_read_data_inplace(i2c_spec, buffer_ptr, 2);
-	if (local_error != NO_ERROR) {
-		return local_error;
-	}
-	*factory_reset_result = sensirion_common_bytes_to_uint16_t(&buffer_ptr[0]);
-	return local_error;
+	return sensirion_job_run(&data->job, stcc4_perform_factory_reset_step, 0,
+				 factory_reset_result);
 }
 
-float stcc4_signal_temperature(uint16_t raw_temperature)
+static float stcc4_signal_temperature(uint16_t raw_temperature)
 {
 	float temperature = 0.0;
 
@@ -302,7 +367,7 @@ float stcc4_signal_temperature(uint16_t raw_temperature)
 	return temperature;
 }
 
-float stcc4_signal_relative_humidity(uint16_t raw_relative_humidity)
+static float stcc4_signal_relative_humidity(uint16_t raw_relative_humidity)
 {
 	float relative_humidity = 0.0;
 
@@ -310,8 +375,8 @@ float stcc4_signal_relative_humidity(uint16_t raw_relative_humidity)
 	return relative_humidity;
 }
 
-int stcc4_read_measurement(int16_t *co2_concentration, float *temperature, float *relative_humidity,
-			   uint16_t *sensor_status)
+int stcc4_read_measurement(const struct device *dev, int16_t *co2_concentration,
+			   float *temperature, float *relative_humidity, uint16_t *sensor_status)
 {
 	int16_t raw_co2_concentration = 0;
 	uint16_t raw_temperature = 0;
@@ -319,8 +384,14 @@ int stcc4_read_measurement(int16_t *co2_concentration, float *temperature, float
 	uint16_t sensor_status_raw = 0;
 	int local_error = 0;
 
-	local_error = stcc4_read_measurement_raw(&raw_co2_concentration, &raw_temperature,
+	local_error = stcc4_lock(dev);
+	if (local_error < 0) {
+		return local_error;
+	}
+
+	local_error = stcc4_read_measurement_raw(dev, &raw_co2_concentration, &raw_temperature,
 						 &raw_relative_humidity, &sensor_status_raw);
+	stcc4_unlock(dev);
 	if (local_error != NO_ERROR) {
 		return local_error;
 	}
@@ -331,56 +402,116 @@ int stcc4_read_measurement(int16_t *co2_concentration, float *temperature, float
 	return local_error;
 }
 
-int stcc4_set_pressure_compensation(uint32_t pressure)
+int stcc4_stop_continuous_measurement_async(const struct device *dev, stcc4_callback_t cb,
+					    void *user_data)
 {
-	int local_error = 0;
+	struct stcc4_data *data = dev->data;
 
-	local_error = stcc4_set_pressure_compensation_raw((uint32_t)(pressure / 2));
-	if (local_error != NO_ERROR) {
-		return local_error;
-	}
-	return local_error;
+	return sensirion_job_start(&data->job, stcc4_stop_continuous_measurement_step, 0, NULL, cb,
+				   user_data);
 }
 
-int stcc4_select_rht_compensation(uint16_t temperature_compensation, uint16_t humidity_compensation)
+int stcc4_measure_single_shot_async(const struct device *dev, stcc4_callback_t cb,
+				    void *user_data)
 {
-	int local_error = 0;
+	struct stcc4_data *data = dev->data;
 
-	if (temperature_compensation || humidity_compensation) {
-		local_error =
-			stcc4_set_rht_compensation(temperature_compensation, humidity_compensation);
-		if (local_error != NO_ERROR) {
-			return local_error;
-		}
-	}
-	return local_error;
+	return sensirion_job_start(&data->job, stcc4_measure_single_shot_step, 0, NULL, cb,
+				   user_data);
 }
 
-int stcc4_select_perform_conditioning(bool do_perform_conditioning)
+int stcc4_perform_forced_recalibration_async(const struct device *dev,
+					     int16_t target_co2_concentration,
+					     int16_t *frc_correction, stcc4_callback_t cb,
+					     void *user_data)
 {
-	int local_error = 0;
+	struct stcc4_data *data = dev->data;
 
-	if (do_perform_conditioning) {
-		local_error = stcc4_perform_conditioning();
-		if (local_error != NO_ERROR) {
-			return local_error;
-		}
+	return sensirion_job_start(&data->job, stcc4_perform_forced_recalibration_step,
+				   (uint16_t)target_co2_concentration, frc_correction, cb,
+				   user_data);
+}
+
+int stcc4_perform_self_test_async(const struct device *dev, uint16_t *test_result,
+				  stcc4_callback_t cb, void *user_data)
+{
+	struct stcc4_data *data = dev->data;
+
+	return sensirion_job_start(&data->job, stcc4_perform_self_test_step, 0, test_result, cb,
+				   user_data);
+}
+
+int stcc4_perform_conditioning_async(const struct device *dev, stcc4_callback_t cb,
+				     void *user_data)
+{
+	struct stcc4_data *data = dev->data;
+
+	return sensirion_job_start(&data->job, stcc4_perform_conditioning_step, 0, NULL, cb,
+				   user_data);
+}
+
+int stcc4_perform_factory_reset_async(const struct device *dev, uint16_t *factory_reset_result,
+				      stcc4_callback_t cb, void *user_data)
+{
+	struct stcc4_data *data = dev->data;
+
+	return sensirion_job_start(&data->job, stcc4_perform_factory_reset_step, 0,
+				   factory_reset_result, cb, user_data);
+}
+
+#ifdef CONFIG_POLL
+void stcc4_signal_cb(const struct device *dev, int result, void *user_data)
+{
+	sensirion_job_signal_cb(dev, result, user_data);
+}
+#endif /* CONFIG_POLL */
+
+#ifdef CONFIG_SENSIRION_COMP
+/*
+ * Claims the sample of the compensation source the sensor has not been given
+ * yet, so that no other read sends it as well. Returns 0 if there is none.
+ * The STCC4 takes its RHT compensation in SHT4x ticks, so the sample is
+ * passed on as is.
+ */
+static uint32_t stcc4_comp_claim(const struct device *dev)
+{
+	const struct stcc4_config *cfg = dev->config;
+	struct stcc4_data *data = dev->data;
+	uint32_t sample = sensirion_comp_get(cfg->comp);
+	atomic_val_t sent = atomic_get(&data->comp_sample);
+
+	if (sample == 0 || sample == (uint32_t)sent ||
+	    !atomic_cas(&data->comp_sample, sent, (atomic_val_t)sample)) {
+		return 0;
 	}
-	return local_error;
+
+	return sample;
 }
 
-bool stcc4_check_self_test(void)
+static int stcc4_update_compensation(const struct device *dev)
 {
-	int local_error = 0;
-	uint16_t self_test_result = 0;
+	struct stcc4_data *data = dev->data;
+	uint32_t sample = stcc4_comp_claim(dev);
+	uint16_t args[2];
+	int ret;
 
-	local_error = stcc4_perform_self_test(&self_test_result);
-	if (local_error != NO_ERROR) {
-		return false;
+	if (sample == 0) {
+		return NO_ERROR;
+	}
+
+	args[0] = sensirion_comp_t_ticks(sample);
+	args[1] = sensirion_comp_rh_ticks(sample);
+	ret = stcc4_send_command(dev, STCC4_SET_RHT_COMPENSATION_CMD_ID, args, ARRAY_SIZE(args));
+	if (ret == NO_ERROR) {
+		k_msleep(1);
+	} else {
+		/* Resend it next time, unless a newer sample was claimed meanwhile */
+		(void)atomic_cas(&data->comp_sample, (atomic_val_t)sample, 0);
 	}
 
-	return self_test_result == 0;
+	return ret;
 }
+#endif /* CONFIG_SENSIRION_COMP */
 
 static int stcc4_sample_fetch(const struct device *dev, enum sensor_channel chan)
 {
@@ -391,13 +522,24 @@ static int stcc4_sample_fetch(const struct device *dev, enum sensor_channel chan
 		LOG_ERR("Channel not supported.");
 		return -ENOTSUP;
 	}
-	int ret =
-		stcc4_read_measurement_raw(&data->co2_concentration_raw, &data->temperature_raw,
-					   &data->relative_humidity_raw, &data->sensor_status_raw);
+	int ret = stcc4_lock(dev);
+
 	if (ret < 0) {
-		LOG_ERR("Failed to sample fetch.");
 		return ret;
 	}
+#ifdef CONFIG_SENSIRION_COMP
+	if (stcc4_update_compensation(dev) != NO_ERROR) {
+		/* The measurement is still valid, just compensated with the previous sample */
+		LOG_WRN("Failed to update RHT compensation.");
+	}
+#endif
+	ret = stcc4_read_measurement_raw(dev, &data->co2_concentration_raw, &data->temperature_raw,
+					 &data->relative_humidity_raw, &data->sensor_status_raw);
+	stcc4_unlock(dev);
+	if (ret != NO_ERROR) {
+		LOG_ERR("Failed to sample fetch.");
+		return ret < 0 ? ret : -EIO;
+	}
 	return 0;
 };
 
@@ -437,64 +579,265 @@ static int stcc4_channel_get(const struct device *dev, enum sensor_channel chan,
 	return 0;
 }
 
-int stcc4_init(const struct device *dev)
+#ifdef CONFIG_SENSOR_ASYNC_API
+static void stcc4_complete_result(struct rtio *ctx, const struct rtio_sqe *sqe, int result,
+				  void *arg)
 {
-	int local_error = 0;
+	struct rtio_iodev_sqe *iodev_sqe = (struct rtio_iodev_sqe *)arg;
+	const struct stcc4_encoded_data *edata = sqe->userdata;
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	struct stcc4_data *data = read_cfg->sensor->data;
 
+	ARG_UNUSED(result);
+
+	if (sensirion_rtio_complete(ctx, &data->rtio_busy, iodev_sqe, edata->frame,
+				    SENSIRION_RTIO_FRAME_WORDS(edata->frame)) < 0) {
+		LOG_ERR("Failed to read measurement.");
+#ifdef CONFIG_SENSIRION_COMP
+		/* The compensation may not have reached the sensor, resend it next time */
+		atomic_clear(&data->comp_sample);
+#endif
+	}
+}
+
+static void stcc4_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
 	const struct stcc4_config *cfg = dev->config;
+	struct stcc4_data *data = dev->data;
+	uint32_t min_buf_len = sizeof(struct stcc4_encoded_data);
+	struct stcc4_encoded_data *edata;
+	uint8_t *buf;
+	uint32_t buf_len;
+	int ret;
 
-	i2c_spec = &cfg->bus;
+	if (read_cfg->is_streaming) {
+		LOG_ERR("Streaming not supported");
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
 
-	if (!i2c_is_ready_dt(&cfg->bus)) {
-		LOG_ERR("Device not ready.");
-		return -ENODEV;
+	if (sensirion_job_busy(&data->job)) {
+		rtio_iodev_sqe_err(iodev_sqe, -EBUSY);
+		return;
 	}
 
-	local_error = stcc4_stop_continuous_measurement();
-	if (local_error != NO_ERROR) {
-		printf("error executing stop_continuous_measurement(): %i\n", local_error);
-		return local_error;
+	ret = rtio_sqe_rx_buf(iodev_sqe, min_buf_len, min_buf_len, &buf, &buf_len);
+	if (ret < 0 || buf_len < min_buf_len) {
+		LOG_ERR("Failed to get a read buffer of size %u bytes", min_buf_len);
+		rtio_iodev_sqe_err(iodev_sqe, ret < 0 ? ret : -ENOMEM);
+		return;
 	}
-	if (!stcc4_check_self_test()) {
-		return -EIO;
+
+	edata = (struct stcc4_encoded_data *)buf;
+
+	ret = stcc4_encode(dev, read_cfg, buf);
+	if (ret < 0) {
+		LOG_ERR("Failed to encode sensor data");
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
 	}
-	local_error = stcc4_set_pressure_compensation();
-	if (local_error != NO_ERROR) {
-		printf("error executing set_pressure_compensation(): %i\n", local_error);
-		return local_error;
+
+	ret = sensirion_rtio_claim(&data->rtio_busy);
+	if (ret < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
+
+#ifdef CONFIG_SENSIRION_COMP
+	uint32_t sample = stcc4_comp_claim(dev);
+
+	if (sample != 0) {
+		uint16_t offset = sensirion_i2c_add_command16_to_buffer(
+			edata->comp_cmd, 0, STCC4_SET_RHT_COMPENSATION_CMD_ID);
+
+		offset = sensirion_i2c_add_uint16_t_to_buffer(edata->comp_cmd, offset,
+							      sensirion_comp_t_ticks(sample));
+		offset = sensirion_i2c_add_uint16_t_to_buffer(edata->comp_cmd, offset,
+							      sensirion_comp_rh_ticks(sample));
+		ret = sensirion_rtio_prep_write(cfg->rtio_ctx, cfg->iodev, edata->comp_cmd, offset,
+						1 * USEC_PER_MSEC, 0);
+		if (ret != NO_ERROR) {
+			LOG_ERR("Failed to acquire SQEs");
+			(void)atomic_cas(&data->comp_sample, (atomic_val_t)sample, 0);
+			sensirion_rtio_release(&data->rtio_busy);
+			rtio_iodev_sqe_err(iodev_sqe, ret);
+			return;
+		}
 	}
-	local_error = stcc4_select_rht_compensation();
-	if (local_error != NO_ERROR) {
-		printf("error executing select_rht_compensation(): %i\n", local_error);
-		return local_error;
+#endif
+
+	ret = sensirion_rtio_prep_read_cmd(cfg->rtio_ctx, cfg->iodev,
+					   STCC4_READ_MEASUREMENT_RAW_CMD_ID, 1 * USEC_PER_MSEC,
+					   edata->frame, SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+	if (ret == NO_ERROR) {
+		ret = sensirion_rtio_submit(cfg->rtio_ctx, stcc4_complete_result, iodev_sqe, edata);
 	}
-	local_error = stcc4_select_perform_conditioning();
-	if (local_error != NO_ERROR) {
-		printf("error executing select_perform_conditioning(): %i\n", local_error);
-		return local_error;
+	if (ret != NO_ERROR) {
+		LOG_ERR("Failed to acquire SQEs");
+		sensirion_rtio_release(&data->rtio_busy);
+		rtio_iodev_sqe_err(iodev_sqe, ret);
 	}
-	local_error = stcc4_start_continuous_measurement();
-	if (local_error != NO_ERROR) {
-		printf("error executing start_continuous_measurement(): %i\n", local_error);
-		return local_error;
+}
+#endif /* CONFIG_SENSOR_ASYNC_API */
+
+/* States of the initialization sequence, see stcc4_init_step() */
+enum stcc4_init_state {
+	STCC4_INIT_STOP,
+	STCC4_INIT_SELF_TEST,
+	STCC4_INIT_PRESSURE,
+	STCC4_INIT_RHT,
+	STCC4_INIT_CONDITIONING,
+	STCC4_INIT_START,
+};
+
+/*
+ * Brings the sensor into continuous measurement as a job, so that neither the
+ * boot nor the system work queue sleeps through the 1.6 s of stop and self
+ * test, or the 22 s of the optional conditioning.
+ */
+static int stcc4_init_step(struct sensirion_job *job)
+{
+	const struct stcc4_config *cfg = job->dev->config;
+	uint16_t args[2];
+	int local_error;
+
+	switch ((enum stcc4_init_state)job->state) {
+	case STCC4_INIT_STOP:
+		local_error = stcc4_send_command(job->dev, STCC4_STOP_CONTINUOUS_MEASUREMENT_CMD_ID,
+						 NULL, 0);
+		if (local_error != NO_ERROR) {
+			LOG_ERR("error executing stop_continuous_measurement(): %i", local_error);
+			break;
+		}
+		job->state = STCC4_INIT_SELF_TEST;
+		return 1200;
+	case STCC4_INIT_SELF_TEST:
+		local_error =
+			stcc4_send_command(job->dev, STCC4_PERFORM_SELF_TEST_CMD_ID, NULL, 0);
+		if (local_error != NO_ERROR) {
+			break;
+		}
+		job->state = STCC4_INIT_PRESSURE;
+		return 360;
+	case STCC4_INIT_PRESSURE:
+		local_error = stcc4_read_word(job->dev, &args[0]);
+		if (local_error != NO_ERROR) {
+			break;
+		}
+		if (args[0] != 0) {
+			LOG_ERR("Self test failed: 0x%04x", args[0]);
+			return -EIO;
+		}
+		args[0] = cfg->pressure / 2;
+		local_error = stcc4_send_command(
+			job->dev, STCC4_SET_PRESSURE_COMPENSATION_RAW_CMD_ID, args, 1);
+		if (local_error != NO_ERROR) {
+			LOG_ERR("error executing set_pressure_compensation(): %i", local_error);
+			break;
+		}
+		job->state = STCC4_INIT_RHT;
+		return 1;
+	case STCC4_INIT_RHT:
+		if (cfg->temperature_compensation || cfg->humidity_compensation) {
+			args[0] = cfg->temperature_compensation;
+			args[1] = cfg->humidity_compensation;
+			local_error = stcc4_send_command(job->dev, STCC4_SET_RHT_COMPENSATION_CMD_ID,
+							 args, 2);
+			if (local_error != NO_ERROR) {
+				LOG_ERR("error executing select_rht_compensation(): %i",
+					local_error);
+				break;
+			}
+			job->state = STCC4_INIT_CONDITIONING;
+			return 1;
+		}
+		__fallthrough;
+	case STCC4_INIT_CONDITIONING:
+		if (cfg->do_perform_conditioning) {
+			local_error = stcc4_send_command(job->dev,
+							 STCC4_PERFORM_CONDITIONING_CMD_ID, NULL, 0);
+			if (local_error != NO_ERROR) {
+				LOG_ERR("error executing select_perform_conditioning(): %i",
+					local_error);
+				break;
+			}
+			job->state = STCC4_INIT_START;
+			return 22000;
+		}
+		__fallthrough;
+	case STCC4_INIT_START:
+		local_error = stcc4_send_command(job->dev,
+						 STCC4_START_CONTINUOUS_MEASUREMENT_CMD_ID, NULL, 0);
+		if (local_error != NO_ERROR) {
+			LOG_ERR("error executing start_continuous_measurement(): %i", local_error);
+			break;
+		}
+		return SENSIRION_JOB_DONE;
+	default:
+		return -EINVAL;
 	}
-	return 0;
+
+	return local_error < 0 ? local_error : -EIO;
+}
+
+static void stcc4_init_done(const struct device *dev, int result, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	if (result < 0) {
+		LOG_ERR("%s: initialization failed: %d", dev->name, result);
+	}
+}
+
+static int stcc4_init(const struct device *dev)
+{
+	const struct stcc4_config *cfg = dev->config;
+	struct stcc4_data *data = dev->data;
+
+	k_mutex_init(&data->lock);
+	sensirion_job_init(&data->job, dev);
+
+	if (!i2c_is_ready_dt(&cfg->bus)) {
+		LOG_ERR("Device not ready.");
+		return -ENODEV;
+	}
+
+	/* Requests fail with -EBUSY until the sequence has completed */
+	return sensirion_job_start(&data->job, stcc4_init_step, 0, NULL, stcc4_init_done, NULL);
 }
 
 static DEVICE_API(sensor, stcc4_api) = {
 	.sample_fetch = stcc4_sample_fetch,
 	.channel_get = stcc4_channel_get,
+#ifdef CONFIG_SENSOR_ASYNC_API
+	.submit = stcc4_submit,
+	.get_decoder = stcc4_get_decoder,
+#endif
 };
 
+#define STCC4_RTIO_DEFINE(inst)                                                                    \
+	RTIO_DEFINE(stcc4_rtio_ctx_##inst, 8, 8);                                                  \
+	I2C_DT_IODEV_DEFINE(stcc4_iodev_##inst, DT_DRV_INST(inst));
+
 #define STCC4_INIT(inst)                                                                           \
 	static struct stcc4_data stcc4_data_##inst;                                                \
                                                                                                    \
+	IF_ENABLED(CONFIG_SENSIRION_COMP, (SENSIRION_COMP_SOURCE_DT_INST_DECLARE(inst)))           \
+                                                                                                   \
+	IF_ENABLED(CONFIG_SENSOR_ASYNC_API, (STCC4_RTIO_DEFINE(inst)))                             \
+                                                                                                   \
 	static const struct stcc4_config stcc4_config_##inst = {                                   \
 		.bus = I2C_DT_SPEC_INST_GET(inst),                                                 \
 		.pressure = DT_INST_PROP(inst, pressure),                                          \
 		.humidity_compensation = DT_INST_PROP(inst, humidity_compensation),                \
 		.temperature_compensation = DT_INST_PROP(inst, temperature_compensation),          \
 		.do_perform_conditioning = DT_INST_PROP(inst, do_perform_conditioning),            \
+		IF_ENABLED(CONFIG_SENSIRION_COMP,                                                  \
+			   (.comp = SENSIRION_COMP_SOURCE_DT_INST_GET(inst),))                     \
+		IF_ENABLED(CONFIG_SENSOR_ASYNC_API,                                                \
+			   (.rtio_ctx = &stcc4_rtio_ctx_##inst,                                    \
+			    .iodev = &stcc4_iodev_##inst,))                                        \
 	};                                                                                         \
 	SENSOR_DEVICE_DT_INST_DEFINE(inst, stcc4_init, NULL, &stcc4_data_##inst,                   \
 				     &stcc4_config_##inst, POST_KERNEL,                            \
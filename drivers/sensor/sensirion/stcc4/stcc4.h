@@ -9,9 +9,16 @@
 
 #include <zephyr/device.h>
 #include <zephyr/drivers/i2c.h>
+#include <zephyr/kernel.h>
+
+#include "../sensirion_core/sensirion_comp.h"
+#include "../sensirion_core/sensirion_job.h"
 
 #define STCC4_I2C_ADDR_64 0x64
 
+/* Largest frame exchanged with the sensor: 8 words of get_product_id with CRC */
+#define STCC4_COMMUNICATION_BUFFER_SIZE 18
+
 typedef enum {
 	STCC4_START_CONTINUOUS_MEASUREMENT_CMD_ID = 0x218b,
 	STCC4_READ_MEASUREMENT_RAW_CMD_ID = 0xec05,
@@ -36,6 +43,13 @@ struct stcc4_config {
 	uint16_t humidity_compensation;
 	uint16_t temperature_compensation;
 	bool do_perform_conditioning;
+#ifdef CONFIG_SENSIRION_COMP
+	const struct sensirion_comp_source *comp;
+#endif
+#ifdef CONFIG_SENSOR_ASYNC_API
+	struct rtio *rtio_ctx;
+	struct rtio_iodev *iodev;
+#endif
 };
 
 struct stcc4_data {
@@ -43,6 +57,21 @@ struct stcc4_data {
 	uint16_t temperature_raw;
 	uint16_t relative_humidity_raw;
 	uint16_t sensor_status_raw;
+	/* Serializes commands to this instance and guards communication_buffer */
+	struct k_mutex lock;
+	uint8_t communication_buffer[STCC4_COMMUNICATION_BUFFER_SIZE];
+	/* Long running command started through one of the *_async() helpers */
+	struct sensirion_job job;
+#ifdef CONFIG_SENSIRION_COMP
+	/* Sample of the compensation source the sensor was last given, 0 for none.
+	 * Atomic, as RTIO reads update it without the lock.
+	 */
+	atomic_t comp_sample;
+#endif
+#ifdef CONFIG_SENSOR_ASYNC_API
+	/* Set while a chain is in flight on rtio_ctx */
+	atomic_t rtio_busy;
+#endif
 };
 
 #endif /* ZEPHYR_DRIVERS_SENSOR_STCC4_STCC4_H_*/
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sensirion_stcc4
+
+#include <zephyr/drivers/sensor_clock.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include "stcc4_decoder.h"
+
+static uint8_t stcc4_encode_channel(enum sensor_channel chan)
+{
+	switch (chan) {
+	case SENSOR_CHAN_CO2:
+		return STCC4_CHAN_CO2_BIT;
+	case SENSOR_CHAN_AMBIENT_TEMP:
+		return STCC4_CHAN_TEMP_BIT;
+	case SENSOR_CHAN_HUMIDITY:
+		return STCC4_CHAN_RH_BIT;
+	case SENSOR_CHAN_ALL:
+		return STCC4_CHAN_CO2_BIT | STCC4_CHAN_TEMP_BIT | STCC4_CHAN_RH_BIT;
+	default:
+		return 0;
+	}
+}
+
+int stcc4_encode(const struct device *dev, const struct sensor_read_config *read_config,
+		 uint8_t *buf)
+{
+	struct stcc4_encoded_data *edata = (struct stcc4_encoded_data *)buf;
+	uint64_t cycles;
+	int ret;
+
+	ARG_UNUSED(dev);
+
+	edata->header.channels = 0;
+	for (size_t i = 0; i < read_config->count; i++) {
+		edata->header.channels |= stcc4_encode_channel(read_config->channels[i].chan_type);
+	}
+
+	ret = sensor_clock_get_cycles(&cycles);
+	if (ret != 0) {
+		return ret;
+	}
+
+	edata->header.timestamp = sensor_clock_cycles_to_ns(cycles);
+
+	return 0;
+}
+
+static int stcc4_decoder_get_frame_count(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+					 uint16_t *frame_count)
+{
+	const struct stcc4_encoded_data *edata = (const struct stcc4_encoded_data *)buffer;
+	uint8_t channel_request = stcc4_encode_channel(chan_spec.chan_type);
+
+	if (chan_spec.chan_idx != 0 || channel_request == 0 ||
+	    chan_spec.chan_type == SENSOR_CHAN_ALL) {
+		return -ENOTSUP;
+	}
+
+	if ((edata->header.channels & channel_request) == 0) {
+		return -ENODATA;
+	}
+
+	*frame_count = 1;
+
+	return 0;
+}
+
+static int stcc4_decoder_get_size_info(struct sensor_chan_spec chan_spec, size_t *base_size,
+				       size_t *frame_size)
+{
+	switch (chan_spec.chan_type) {
+	case SENSOR_CHAN_CO2:
+	case SENSOR_CHAN_AMBIENT_TEMP:
+	case SENSOR_CHAN_HUMIDITY:
+		*base_size = sizeof(struct sensor_q31_data);
+		*frame_size = sizeof(struct sensor_q31_sample_data);
+		return 0;
+	default:
+		return -ENOTSUP;
+	}
+}
+
+static int stcc4_decoder_decode(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+				uint32_t *fit, uint16_t max_count, void *data_out)
+{
+	const struct stcc4_encoded_data *edata = (const struct stcc4_encoded_data *)buffer;
+	uint8_t channel_request = stcc4_encode_channel(chan_spec.chan_type);
+	struct sensor_q31_data *out = data_out;
+	int64_t raw;
+
+	if (*fit != 0 || max_count == 0) {
+		return 0;
+	}
+
+	if (chan_spec.chan_idx != 0) {
+		return -ENOTSUP;
+	}
+
+	if ((edata->header.channels & channel_request) == 0) {
+		return -ENODATA;
+	}
+
+	switch (chan_spec.chan_type) {
+	case SENSOR_CHAN_CO2:
+		raw = (int16_t)sys_get_be16(&edata->frame[0]);
+		out->readings[0].value = (q31_t)(raw * (1 << (31 - STCC4_CO2_Q31_SHIFT)));
+		out->shift = STCC4_CO2_Q31_SHIFT;
+		break;
+	case SENSOR_CHAN_AMBIENT_TEMP:
+		raw = sys_get_be16(&edata->frame[3]);
+		out->readings[0].temperature =
+			(q31_t)(((raw * 175) << (31 - STCC4_TEMP_Q31_SHIFT)) / 0xFFFF -
+				((int64_t)45 << (31 - STCC4_TEMP_Q31_SHIFT)));
+		out->shift = STCC4_TEMP_Q31_SHIFT;
+		break;
+	case SENSOR_CHAN_HUMIDITY:
+		raw = sys_get_be16(&edata->frame[6]);
+		out->readings[0].humidity =
+			(q31_t)(((raw * 125) << (31 - STCC4_RH_Q31_SHIFT)) / 0xFFFF -
+				((int64_t)6 << (31 - STCC4_RH_Q31_SHIFT)));
+		out->shift = STCC4_RH_Q31_SHIFT;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	out->header.base_timestamp_ns = edata->header.timestamp;
+	out->header.reading_count = 1;
+	*fit = 1;
+
+	return 1;
+}
+
+SENSOR_DECODER_API_DT_DEFINE() = {
+	.get_frame_count = stcc4_decoder_get_frame_count,
+	.get_size_info = stcc4_decoder_get_size_info,
+	.decode = stcc4_decoder_decode,
+};
+
+int stcc4_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder)
+{
+	ARG_UNUSED(dev);
+	*decoder = &SENSOR_DECODER_NAME();
+
+	return 0;
+}
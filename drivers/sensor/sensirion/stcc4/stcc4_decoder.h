@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_DRIVERS_SENSOR_STCC4_STCC4_DECODER_H_
+#define ZEPHYR_DRIVERS_SENSOR_STCC4_STCC4_DECODER_H_
+
+#include <stdint.h>
+#include <zephyr/drivers/sensor.h>
+
+#define STCC4_CHAN_CO2_BIT  BIT(0)
+#define STCC4_CHAN_TEMP_BIT BIT(1)
+#define STCC4_CHAN_RH_BIT   BIT(2)
+
+#define STCC4_CO2_Q31_SHIFT  16
+#define STCC4_TEMP_Q31_SHIFT 8
+#define STCC4_RH_Q31_SHIFT   8
+
+struct stcc4_encoded_header {
+	uint64_t timestamp;
+	uint8_t channels;
+};
+
+struct stcc4_encoded_data {
+	struct stcc4_encoded_header header;
+	/*
+	 * set_rht_compensation command issued ahead of the read, if the
+	 * compensation source had a new sample. It lives in the read buffer so
+	 * that it outlives the asynchronous bus transfer.
+	 */
+	uint8_t comp_cmd[8];
+	/* Raw read_measurement_raw response: CO2, T, RH and status words, each followed by a CRC */
+	uint8_t frame[12];
+};
+
+int stcc4_encode(const struct device *dev, const struct sensor_read_config *read_config,
+		 uint8_t *buf);
+
+int stcc4_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder);
+
+#endif /* ZEPHYR_DRIVERS_SENSOR_STCC4_STCC4_DECODER_H_ */
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sensirion_stcc4
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/logging/log.h>
+
+#include "../sensirion_core/sensirion_emul.h"
+#include "stcc4.h"
+
+LOG_MODULE_DECLARE(STCC4, CONFIG_SENSOR_LOG_LEVEL);
+
+/* Product id followed by the 64-bit serial number */
+static const uint16_t stcc4_emul_product_id[] = {0x0901, 0x018A, 0x0000, 0x0000, 0x2B7E, 0x1C05};
+
+struct stcc4_emul_data {
+	struct sensirion_emul_data common;
+	bool continuous;
+};
+
+static uint8_t stcc4_emul_num_args(uint16_t cmd)
+{
+	switch (cmd) {
+	case STCC4_SET_RHT_COMPENSATION_CMD_ID:
+		return 2;
+	case STCC4_PERFORM_FORCED_RECALIBRATION_CMD_ID:
+	case STCC4_SET_PRESSURE_COMPENSATION_RAW_CMD_ID:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+static int stcc4_emul_command(const struct emul *target, uint16_t cmd, const uint16_t *args,
+			      uint8_t num_args)
+{
+	struct stcc4_emul_data *data = target->data;
+	const uint16_t sample[] = {
+		data->common.signals[SENSIRION_EMUL_CO2],
+		data->common.signals[SENSIRION_EMUL_TEMPERATURE],
+		data->common.signals[SENSIRION_EMUL_HUMIDITY],
+		/* Sensor status */
+		0,
+	};
+	uint16_t result = 0;
+
+	if (num_args != stcc4_emul_num_args(cmd)) {
+		return -EIO;
+	}
+
+	switch (cmd) {
+	case STCC4_START_CONTINUOUS_MEASUREMENT_CMD_ID:
+		data->continuous = true;
+		break;
+	case STCC4_READ_MEASUREMENT_RAW_CMD_ID:
+		/* Returns the latest measurement, also if it was already read */
+		sensirion_emul_respond(&data->common, sample, ARRAY_SIZE(sample), 1000);
+		break;
+	case STCC4_STOP_CONTINUOUS_MEASUREMENT_CMD_ID:
+		data->continuous = false;
+		sensirion_emul_respond(&data->common, NULL, 0, 1200 * USEC_PER_MSEC);
+		break;
+	case STCC4_MEASURE_SINGLE_SHOT_CMD_ID:
+		if (data->continuous) {
+			return -EIO;
+		}
+		sensirion_emul_respond(&data->common, NULL, 0, 500 * USEC_PER_MSEC);
+		break;
+	case STCC4_PERFORM_FORCED_RECALIBRATION_CMD_ID:
+		if (data->continuous) {
+			return -EIO;
+		}
+		result = args[0] - data->common.signals[SENSIRION_EMUL_CO2];
+		sensirion_emul_respond(&data->common, &result, 1, 90 * USEC_PER_MSEC);
+		break;
+	case STCC4_GET_PRODUCT_ID_CMD_ID:
+		sensirion_emul_respond(&data->common, stcc4_emul_product_id,
+				       ARRAY_SIZE(stcc4_emul_product_id), 1000);
+		break;
+	case STCC4_SET_RHT_COMPENSATION_CMD_ID:
+	case STCC4_SET_PRESSURE_COMPENSATION_RAW_CMD_ID:
+		/* The CO2 signal is set by the test, compensation does not change it */
+		sensirion_emul_respond(&data->common, NULL, 0, 1000);
+		break;
+	case STCC4_PERFORM_SELF_TEST_CMD_ID:
+		/* 0 means the self test passed */
+		sensirion_emul_respond(&data->common, &result, 1, 360 * USEC_PER_MSEC);
+		break;
+	case STCC4_PERFORM_CONDITIONING_CMD_ID:
+		if (data->continuous) {
+			return -EIO;
+		}
+		sensirion_emul_respond(&data->common, NULL, 0, 22000 * USEC_PER_MSEC);
+		break;
+	case STCC4_ENTER_SLEEP_MODE_CMD_ID:
+		/*
+		 * The 8-bit wake-up command cannot be told apart from a
+		 * truncated command, so the emulated sensor stays awake.
+		 */
+		sensirion_emul_respond(&data->common, NULL, 0, 2000);
+		break;
+	case STCC4_ENABLE_TESTING_MODE_CMD_ID:
+	case STCC4_DISABLE_TESTING_MODE_CMD_ID:
+		break;
+	case STCC4_PERFORM_FACTORY_RESET_CMD_ID:
+		/* 0 means the reset succeeded */
+		sensirion_emul_respond(&data->common, &result, 1, 90 * USEC_PER_MSEC);
+		break;
+	default:
+		LOG_DBG("Unknown command 0x%04x", cmd);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int stcc4_emul_init(const struct emul *target, const struct device *parent)
+{
+	struct stcc4_emul_data *data = target->data;
+
+	ARG_UNUSED(parent);
+
+	sensirion_emul_init_data(&data->common);
+	data->continuous = false;
+
+	return 0;
+}
+
+static const struct sensirion_emul_cfg stcc4_emul_cfg = {
+	.command = stcc4_emul_command,
+	.cmd_size = 2,
+};
+
+#define STCC4_EMUL(n)                                                                              \
+	static struct stcc4_emul_data stcc4_emul_data_##n;                                         \
+	EMUL_DT_INST_DEFINE(n, stcc4_emul_init, &stcc4_emul_data_##n, &stcc4_emul_cfg,             \
+			    &sensirion_emul_api_i2c, NULL)
+
+DT_INST_FOREACH_STATUS_OKAY(STCC4_EMUL)
@@ -9,12 +9,17 @@
 #include <zephyr/device.h>
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/sensor.h>
+#include <zephyr/drivers/sensor/sensirion_batch.h>
 #include <zephyr/drivers/i2c.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/byteorder.h>
-#include <zephyr/sys/crc.h>
 #include <zephyr/devicetree.h>
+#include <zephyr/rtio/rtio.h>
+
+#include "sts4x_decoder.h"
+#include "../sensirion_core/sensirion_common.h"
+#include "../sensirion_core/sensirion_rtio.h"
 
 LOG_MODULE_REGISTER(STS4X, CONFIG_SENSOR_LOG_LEVEL);
 
@@ -22,39 +27,29 @@ LOG_MODULE_REGISTER(STS4X, CONFIG_SENSOR_LOG_LEVEL);
 
 #define STS4X_RESET_TIME 1
 
-#define STS4X_CRC_POLY 0x31
-#define STS4X_CRC_INIT 0xFF
-
 #define STS4X_MAX_TEMP 175
 #define STS4X_MIN_TEMP -45
 
 struct sts4x_config {
 	struct i2c_dt_spec bus;
 	uint8_t repeatability;
+#ifdef CONFIG_SENSOR_ASYNC_API
+	struct rtio *rtio_ctx;
+	struct rtio_iodev *iodev;
+#endif
 };
 
 struct sts4x_data {
 	uint16_t temp_sample;
+#ifdef CONFIG_SENSOR_ASYNC_API
+	/* Set while a chain is in flight on rtio_ctx */
+	atomic_t rtio_busy;
+#endif
 };
 
 static const uint8_t measure_cmds[3] = {0xE0, 0xF6, 0xFD};
 static const uint16_t measure_time_us[3] = {1600, 4500, 8300};
 
-static int sts4x_crc_check(uint16_t value, uint8_t sensor_crc)
-{
-	uint8_t buf[2];
-
-	sys_put_be16(value, buf);
-
-	uint8_t calculated_crc = crc8(buf, 2, STS4X_CRC_POLY, STS4X_CRC_INIT, false);
-
-	if (calculated_crc == sensor_crc) {
-		return 0;
-	}
-
-	return -EIO;
-}
-
 static int sts4x_write_command(const struct device *dev, uint8_t cmd)
 {
 	const struct sts4x_config *cfg = dev->config;
@@ -75,13 +70,13 @@ static int sts4x_read_sample(const struct device *dev, uint16_t *temp_sample)
 		return ret;
 	}
 
-	*temp_sample = sys_get_be16(rx_buf);
-	ret = sts4x_crc_check(*temp_sample, rx_buf[2]);
-	if (ret < 0) {
+	if (sensirion_i2c_check_frame(rx_buf, 1) != NO_ERROR) {
 		LOG_ERR("Invalid CRC.");
-		return ret;
+		return -EIO;
 	}
 
+	*temp_sample = sys_get_be16(rx_buf);
+
 	return 0;
 }
 
@@ -129,6 +124,104 @@ static int sts4x_channel_get(const struct device *dev, enum sensor_channel chan,
 	return 0;
 }
 
+#ifdef CONFIG_SENSOR_ASYNC_API
+static void sts4x_complete_result(struct rtio *ctx, const struct rtio_sqe *sqe, int result,
+				  void *arg)
+{
+	struct rtio_iodev_sqe *iodev_sqe = (struct rtio_iodev_sqe *)arg;
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	struct sts4x_data *data = read_cfg->sensor->data;
+	const struct sts4x_encoded_data *edata = sqe->userdata;
+
+	ARG_UNUSED(result);
+
+	if (sensirion_rtio_complete(ctx, &data->rtio_busy, iodev_sqe, edata->frame,
+				    SENSIRION_RTIO_FRAME_WORDS(edata->frame)) < 0) {
+		LOG_ERR("Failed to get temperature data.");
+	}
+}
+
+static void sts4x_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	const struct sts4x_config *cfg = dev->config;
+	struct sts4x_data *data = dev->data;
+	uint32_t min_buf_len = sizeof(struct sts4x_encoded_data);
+	struct sts4x_encoded_data *edata;
+	uint8_t *buf;
+	uint32_t buf_len;
+	int ret;
+
+	if (read_cfg->is_streaming) {
+		LOG_ERR("Streaming not supported");
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	ret = rtio_sqe_rx_buf(iodev_sqe, min_buf_len, min_buf_len, &buf, &buf_len);
+	if (ret < 0 || buf_len < min_buf_len) {
+		LOG_ERR("Failed to get a read buffer of size %u bytes", min_buf_len);
+		rtio_iodev_sqe_err(iodev_sqe, ret < 0 ? ret : -ENOMEM);
+		return;
+	}
+
+	edata = (struct sts4x_encoded_data *)buf;
+
+	ret = sts4x_encode(dev, read_cfg, buf);
+	if (ret < 0) {
+		LOG_ERR("Failed to encode sensor data");
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
+
+	ret = sensirion_rtio_claim(&data->rtio_busy);
+	if (ret < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
+
+	ret = sensirion_rtio_prep_write(cfg->rtio_ctx, cfg->iodev,
+					&measure_cmds[cfg->repeatability], 1,
+					measure_time_us[cfg->repeatability], 0);
+	if (ret == 0) {
+		ret = sensirion_rtio_prep_read(cfg->rtio_ctx, cfg->iodev, edata->frame,
+					       SENSIRION_RTIO_FRAME_WORDS(edata->frame));
+	}
+	if (ret == 0) {
+		ret = sensirion_rtio_submit(cfg->rtio_ctx, sts4x_complete_result, iodev_sqe, edata);
+	}
+	if (ret < 0) {
+		LOG_ERR("Failed to acquire SQEs");
+		sensirion_rtio_release(&data->rtio_busy);
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+	}
+}
+
+#ifdef CONFIG_SENSIRION_BATCH
+static int sts4x_batch_prep(const struct device *dev, const struct sensor_read_config *read_cfg,
+			    uint8_t *buf, struct sensirion_batch_measurement *meas)
+{
+	const struct sts4x_config *cfg = dev->config;
+	struct sts4x_encoded_data *edata = (struct sts4x_encoded_data *)buf;
+	int ret;
+
+	ret = sts4x_encode(dev, read_cfg, buf);
+	if (ret < 0) {
+		return ret;
+	}
+
+	meas->iodev = cfg->iodev;
+	meas->cmd[0] = measure_cmds[cfg->repeatability];
+	meas->cmd_len = 1;
+	meas->delay_us = measure_time_us[cfg->repeatability];
+	meas->frame = edata->frame;
+	meas->num_words = SENSIRION_RTIO_FRAME_WORDS(edata->frame);
+
+	return 0;
+}
+#endif /* CONFIG_SENSIRION_BATCH */
+#endif /* CONFIG_SENSOR_ASYNC_API */
+
 static int sts4x_init(const struct device *dev)
 {
 	const struct sts4x_config *cfg = dev->config;
@@ -153,16 +246,32 @@ static int sts4x_init(const struct device *dev)
 static DEVICE_API(sensor, sts4x_api_funcs) = {
 	.sample_fetch = sts4x_sample_fetch,
 	.channel_get = sts4x_channel_get,
+#ifdef CONFIG_SENSOR_ASYNC_API
+	.submit = sts4x_submit,
+	.get_decoder = sts4x_get_decoder,
+#endif
 };
 
+#define STS4X_RTIO_DEFINE(inst)                                                                    \
+	RTIO_DEFINE(sts4x_rtio_ctx_##inst, 8, 8);                                                  \
+	I2C_DT_IODEV_DEFINE(sts4x_iodev_##inst, DT_DRV_INST(inst));
+
 #define STS4X_INIT(inst)                                                                           \
 	static struct sts4x_data sts4x_data_##inst;                                                \
+	IF_ENABLED(CONFIG_SENSOR_ASYNC_API, (STS4X_RTIO_DEFINE(inst)))                             \
 	static const struct sts4x_config sts4x_config_##inst = {                                   \
 		.bus = I2C_DT_SPEC_INST_GET(inst),                                                 \
 		.repeatability = DT_INST_PROP(inst, repeatability),                                \
+		IF_ENABLED(CONFIG_SENSOR_ASYNC_API,                                                \
+			   (.rtio_ctx = &sts4x_rtio_ctx_##inst,                                    \
+			    .iodev = &sts4x_iodev_##inst,))                                        \
 	};                                                                                         \
 	SENSOR_DEVICE_DT_INST_DEFINE(inst, sts4x_init, NULL, &sts4x_data_##inst,                   \
 				     &sts4x_config_##inst, POST_KERNEL,                            \
-				     CONFIG_SENSOR_INIT_PRIORITY, &sts4x_api_funcs);
+				     CONFIG_SENSOR_INIT_PRIORITY, &sts4x_api_funcs);               \
+	IF_ENABLED(CONFIG_SENSIRION_BATCH,                                                         \
+		   (SENSIRION_BATCH_SENSOR_DEFINE(sts4x_batch_##inst, DEVICE_DT_INST_GET(inst),    \
+						  sts4x_batch_prep,                                \
+						  sizeof(struct sts4x_encoded_data));))
 
 DT_INST_FOREACH_STATUS_OKAY(STS4X_INIT)
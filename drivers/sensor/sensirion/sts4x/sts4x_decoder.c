@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sensirion_sts4x
+
+#include <zephyr/drivers/sensor_clock.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/util.h>
+
+#include "sts4x_decoder.h"
+
+int sts4x_encode(const struct device *dev, const struct sensor_read_config *read_config,
+		 uint8_t *buf)
+{
+	struct sts4x_encoded_data *edata = (struct sts4x_encoded_data *)buf;
+	uint64_t cycles;
+	int ret;
+
+	ARG_UNUSED(dev);
+
+	edata->header.has_temp = false;
+	for (size_t i = 0; i < read_config->count; i++) {
+		enum sensor_channel chan = read_config->channels[i].chan_type;
+
+		if (chan == SENSOR_CHAN_ALL || chan == SENSOR_CHAN_AMBIENT_TEMP) {
+			edata->header.has_temp = true;
+		}
+	}
+
+	ret = sensor_clock_get_cycles(&cycles);
+	if (ret != 0) {
+		return ret;
+	}
+
+	edata->header.timestamp = sensor_clock_cycles_to_ns(cycles);
+
+	return 0;
+}
+
+static int sts4x_decoder_get_frame_count(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+					 uint16_t *frame_count)
+{
+	const struct sts4x_encoded_data *edata = (const struct sts4x_encoded_data *)buffer;
+
+	if (chan_spec.chan_idx != 0 || chan_spec.chan_type != SENSOR_CHAN_AMBIENT_TEMP) {
+		return -ENOTSUP;
+	}
+
+	if (!edata->header.has_temp) {
+		return -ENODATA;
+	}
+
+	/* This sensor lacks a FIFO; there will always only be one frame at a time. */
+	*frame_count = 1;
+
+	return 0;
+}
+
+static int sts4x_decoder_get_size_info(struct sensor_chan_spec chan_spec, size_t *base_size,
+				       size_t *frame_size)
+{
+	if (chan_spec.chan_type != SENSOR_CHAN_AMBIENT_TEMP) {
+		return -ENOTSUP;
+	}
+
+	*base_size = sizeof(struct sensor_q31_data);
+	*frame_size = sizeof(struct sensor_q31_sample_data);
+
+	return 0;
+}
+
+static int sts4x_decoder_decode(const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+				uint32_t *fit, uint16_t max_count, void *data_out)
+{
+	const struct sts4x_encoded_data *edata = (const struct sts4x_encoded_data *)buffer;
+	struct sensor_q31_data *out = data_out;
+	int64_t raw;
+
+	if (*fit != 0 || max_count == 0) {
+		return 0;
+	}
+
+	if (chan_spec.chan_idx != 0 || chan_spec.chan_type != SENSOR_CHAN_AMBIENT_TEMP) {
+		return -ENOTSUP;
+	}
+
+	if (!edata->header.has_temp) {
+		return -ENODATA;
+	}
+
+	/* T = -45 + 175 * raw / (2^16 - 1) */
+	raw = sys_get_be16(edata->frame);
+	out->readings[0].temperature =
+		(int32_t)(((raw * 175) << (31 - STS4X_Q31_SHIFT)) / 0xFFFF -
+			  ((int64_t)45 << (31 - STS4X_Q31_SHIFT)));
+	out->header.base_timestamp_ns = edata->header.timestamp;
+	out->header.reading_count = 1;
+	out->shift = STS4X_Q31_SHIFT;
+	*fit = 1;
+
+	return 1;
+}
+
+SENSOR_DECODER_API_DT_DEFINE() = {
+	.get_frame_count = sts4x_decoder_get_frame_count,
+	.get_size_info = sts4x_decoder_get_size_info,
+	.decode = sts4x_decoder_decode,
+};
+
+int sts4x_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder)
+{
+	ARG_UNUSED(dev);
+	*decoder = &SENSOR_DECODER_NAME();
+
+	return 0;
+}
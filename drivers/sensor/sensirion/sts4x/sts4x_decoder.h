@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_DRIVERS_SENSOR_STS4X_STS4X_DECODER_H_
+#define ZEPHYR_DRIVERS_SENSOR_STS4X_STS4X_DECODER_H_
+
+#include <stdint.h>
+#include <zephyr/drivers/sensor.h>
+
+#define STS4X_Q31_SHIFT 8
+
+struct sts4x_encoded_header {
+	uint64_t timestamp;
+	bool has_temp;
+};
+
+struct sts4x_encoded_data {
+	struct sts4x_encoded_header header;
+	/* Raw frame as read from the sensor: T MSB, T LSB, CRC */
+	uint8_t frame[3];
+};
+
+int sts4x_encode(const struct device *dev, const struct sensor_read_config *read_config,
+		 uint8_t *buf);
+
+int sts4x_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder);
+
+#endif /* ZEPHYR_DRIVERS_SENSOR_STS4X_STS4X_DECODER_H_ */
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sensirion_sts4x
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/logging/log.h>
+
+#include "../sensirion_core/sensirion_emul.h"
+
+LOG_MODULE_DECLARE(STS4X, CONFIG_SENSOR_LOG_LEVEL);
+
+#define STS4X_EMUL_CMD_MEASURE_HIGH   0xFD
+#define STS4X_EMUL_CMD_MEASURE_MEDIUM 0xF6
+#define STS4X_EMUL_CMD_MEASURE_LOW    0xE0
+#define STS4X_EMUL_CMD_READ_SERIAL    0x89
+#define STS4X_EMUL_CMD_RESET          0x94
+
+#define STS4X_EMUL_SERIAL_HIGH 0x1A52
+#define STS4X_EMUL_SERIAL_LOW  0x03C7
+
+static int sts4x_emul_command(const struct emul *target, uint16_t cmd, const uint16_t *args,
+			      uint8_t num_args)
+{
+	struct sensirion_emul_data *data = target->data;
+	const uint16_t sample = data->signals[SENSIRION_EMUL_TEMPERATURE];
+	const uint16_t serial[] = {STS4X_EMUL_SERIAL_HIGH, STS4X_EMUL_SERIAL_LOW};
+
+	ARG_UNUSED(args);
+
+	if (num_args != 0) {
+		return -EIO;
+	}
+
+	/* Execution times are the maximum values of the datasheet */
+	switch (cmd) {
+	case STS4X_EMUL_CMD_MEASURE_HIGH:
+		sensirion_emul_respond(data, &sample, 1, 8300);
+		break;
+	case STS4X_EMUL_CMD_MEASURE_MEDIUM:
+		sensirion_emul_respond(data, &sample, 1, 4500);
+		break;
+	case STS4X_EMUL_CMD_MEASURE_LOW:
+		sensirion_emul_respond(data, &sample, 1, 1600);
+		break;
+	case STS4X_EMUL_CMD_READ_SERIAL:
+		sensirion_emul_respond(data, serial, ARRAY_SIZE(serial), 0);
+		break;
+	case STS4X_EMUL_CMD_RESET:
+		sensirion_emul_respond(data, NULL, 0, 1000);
+		break;
+	default:
+		LOG_DBG("Unknown command 0x%02x", cmd);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+static int sts4x_emul_init(const struct emul *target, const struct device *parent)
+{
+	ARG_UNUSED(parent);
+
+	sensirion_emul_init_data(target->data);
+
+	return 0;
+}
+
+static const struct sensirion_emul_cfg sts4x_emul_cfg = {
+	.command = sts4x_emul_command,
+	.cmd_size = 1,
+};
+
+#define STS4X_EMUL(n)                                                                              \
+	static struct sensirion_emul_data sts4x_emul_data_##n;                                     \
+	EMUL_DT_INST_DEFINE(n, sts4x_emul_init, &sts4x_emul_data_##n, &sts4x_emul_cfg,             \
+			    &sensirion_emul_api_i2c, NULL)
+
+DT_INST_FOREACH_STATUS_OKAY(STS4X_EMUL)
@@ -122,6 +122,136 @@ int scd4x_persist_settings(const struct device *dev);
  */
 int scd4x_factory_reset(const struct device *dev);
 
+/**
+ * @brief Completion callback of an asynchronous SCD4X operation.
+ *
+ * The callback runs on the system work queue. A new asynchronous operation may be started
+ * from within the callback.
+ *
+ * @param dev Pointer to the sensor device
+ * @param result 0 if successful, negative errno code if failure.
+ * @param user_data User data passed when the operation was started.
+ */
+typedef void (*scd4x_callback_t)(const struct device *dev, int result, void *user_data);
+
+/**
+ * @brief Performs a forced recalibration without blocking.
+ *
+ * Asynchronous variant of scd4x_forced_recalibration(). The function returns once the
+ * operation has been queued; the execution times of the individual commands elapse on the
+ * system work queue and the calling thread never sleeps.
+ *
+ * Only one asynchronous operation can be pending per sensor. While it is pending, sample
+ * fetches, attribute accesses, read requests and the blocking commands fail with -EBUSY.
+ * The blocking commands and attribute accesses run the same steps in the calling thread and
+ * are rejected the same way while another one executes.
+ *
+ * @param dev Pointer to the sensor device
+ * @param target_concentration Reference CO2 concentration.
+ * @param frc_correction Previous differences from the target concentration. Must stay valid
+ *                       until @p cb has been called.
+ * @param cb Completion callback, may be NULL.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 if the operation has been started.
+ * @retval -EBUSY if another asynchronous operation is pending.
+ */
+int scd4x_forced_recalibration_async(const struct device *dev, uint16_t target_concentration,
+				     uint16_t *frc_correction, scd4x_callback_t cb,
+				     void *user_data);
+
+/**
+ * @brief Performs a self test without blocking.
+ *
+ * Asynchronous variant of scd4x_self_test(). The self test takes 10 seconds.
+ *
+ * @param dev Pointer to the sensor device
+ * @param cb Completion callback, may be NULL. Called with -EIO if a malfunction was detected.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 if the operation has been started.
+ * @retval -EBUSY if another asynchronous operation is pending.
+ */
+int scd4x_self_test_async(const struct device *dev, scd4x_callback_t cb, void *user_data);
+
+/**
+ * @brief Persists the settings without blocking.
+ *
+ * Asynchronous variant of scd4x_persist_settings().
+ *
+ * @param dev Pointer to the sensor device
+ * @param cb Completion callback, may be NULL.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 if the operation has been started.
+ * @retval -EBUSY if another asynchronous operation is pending.
+ */
+int scd4x_persist_settings_async(const struct device *dev, scd4x_callback_t cb, void *user_data);
+
+/**
+ * @brief Performs a factory reset without blocking.
+ *
+ * Asynchronous variant of scd4x_factory_reset().
+ *
+ * @param dev Pointer to the sensor device
+ * @param cb Completion callback, may be NULL.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 if the operation has been started.
+ * @retval -EBUSY if another asynchronous operation is pending.
+ */
+int scd4x_factory_reset_async(const struct device *dev, scd4x_callback_t cb, void *user_data);
+
+/**
+ * @brief Sets a sensor attribute without blocking.
+ *
+ * Asynchronous variant of sensor_attr_set() for the attributes of
+ * enum sensor_attribute_scd4x. Except for the ambient pressure, the sensor leaves its
+ * measurement mode for the write, which takes about 500 ms in the periodic modes.
+ *
+ * @param dev Pointer to the sensor device
+ * @param attr Attribute to set
+ * @param val Value to set. Must stay valid until @p cb has been called.
+ * @param cb Completion callback, may be NULL.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 if the operation has been started.
+ * @retval -EINVAL if the value is out of range.
+ * @retval -ENOTSUP if the attribute is not supported by the sensor.
+ * @retval -EBUSY if another asynchronous operation is pending.
+ */
+int scd4x_attr_set_async(const struct device *dev, enum sensor_attribute attr,
+			 const struct sensor_value *val, scd4x_callback_t cb, void *user_data);
+
+/**
+ * @brief Reads a sensor attribute without blocking.
+ *
+ * Asynchronous variant of sensor_attr_get() for the attributes of
+ * enum sensor_attribute_scd4x.
+ *
+ * @param dev Pointer to the sensor device
+ * @param attr Attribute to read
+ * @param val Read value. Must stay valid until @p cb has been called.
+ * @param cb Completion callback, may be NULL.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 if the operation has been started.
+ * @retval -ENOTSUP if the attribute is not supported by the sensor.
+ * @retval -EBUSY if another asynchronous operation is pending.
+ */
+int scd4x_attr_get_async(const struct device *dev, enum sensor_attribute attr,
+			 struct sensor_value *val, scd4x_callback_t cb, void *user_data);
+
+#if defined(CONFIG_POLL) || defined(__DOXYGEN__)
+/**
+ * @brief Completion callback raising a poll signal.
+ *
+ * Pass this as callback and a struct k_poll_signal as user data to wait for an asynchronous
+ * operation with k_poll(). The signal is raised with the result of the operation.
+ */
+void scd4x_signal_cb(const struct device *dev, int result, void *user_data);
+#endif /* CONFIG_POLL */
+
 /**
  * @}
  */
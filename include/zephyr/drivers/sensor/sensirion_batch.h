@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Header file for the batched acquisition of Sensirion sensors
+ * @ingroup sensirion_batch_interface
+ *
+ * Reading single shot measurements from several sensors one after the other
+ * adds up their conversion times. A batch starts the measurements of all its
+ * sensors back-to-back and then reads all results in a single RTIO
+ * submission, chained behind one delay covering the longest conversion time,
+ * so reading N sensors takes about as long as reading the slowest of them.
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_SENSOR_SENSIRION_BATCH_H_
+#define ZEPHYR_INCLUDE_DRIVERS_SENSOR_SENSIRION_BATCH_H_
+
+/**
+ * @defgroup sensirion_batch_interface Sensirion batch
+ * @ingroup sensor_interface_ext
+ * @brief Batched acquisition of Sensirion sensors
+ * @{
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/util.h>
+
+/** Maximum length of a measure command including its argument words */
+#define SENSIRION_BATCH_CMD_MAX 8
+
+/**
+ * @brief Single shot measurement of one sensor, filled in by its driver
+ */
+struct sensirion_batch_measurement {
+	/** I2C iodev of the sensor */
+	const struct rtio_iodev *iodev;
+	/** Command starting the measurement, including argument words */
+	uint8_t cmd[SENSIRION_BATCH_CMD_MAX];
+	/** Length of @ref cmd in bytes */
+	uint8_t cmd_len;
+	/** Conversion time in microseconds */
+	uint32_t delay_us;
+	/** Buffer receiving the raw frame, part of the encoded buffer */
+	uint8_t *frame;
+	/** Number of data words in the frame (without CRC bytes) */
+	uint16_t num_words;
+	/** Outcome of the measurement, 0 or a negative error code */
+	int result;
+};
+
+/**
+ * @brief Prepare the single shot measurement of a sensor in a batch
+ *
+ * Encodes the header of @p buf like a one shot read of the sensor would and
+ * describes the measurement in @p meas, the raw frame is read into @p buf.
+ *
+ * @param dev      Sensor device
+ * @param read_cfg Channels to encode
+ * @param buf      Encoded buffer of at least the size the sensor registered
+ * @param meas     Measurement to fill in
+ *
+ * @return 0 on success, a negative error code if the sensor cannot take part
+ */
+typedef int (*sensirion_batch_prep_t)(const struct device *dev,
+				      const struct sensor_read_config *read_cfg, uint8_t *buf,
+				      struct sensirion_batch_measurement *meas);
+
+/**
+ * @brief Registration of a sensor instance that supports batched reads
+ */
+struct sensirion_batch_sensor {
+	/** Sensor device */
+	const struct device *dev;
+	/** Measurement preparation function of the driver */
+	sensirion_batch_prep_t prep;
+	/** Size of the encoded buffer of the sensor */
+	uint32_t buf_size;
+};
+
+/**
+ * @brief Register a sensor instance for batched reads
+ *
+ * Used by the drivers, once per instance.
+ *
+ * @param name      Name of the registration
+ * @param _dev      Sensor device
+ * @param _prep     Measurement preparation function, see @ref sensirion_batch_prep_t
+ * @param _buf_size Size of the encoded buffer of the sensor
+ */
+#define SENSIRION_BATCH_SENSOR_DEFINE(name, _dev, _prep, _buf_size)                                \
+	static const STRUCT_SECTION_ITERABLE(sensirion_batch_sensor, name) = {                     \
+		.dev = _dev,                                                                       \
+		.prep = _prep,                                                                     \
+		.buf_size = _buf_size,                                                             \
+	}
+
+/**
+ * @brief Group of sensors that are read together
+ */
+struct sensirion_batch {
+	/** Sensors of the batch */
+	const struct device *const *devs;
+	/** Measurement state, one per sensor */
+	struct sensirion_batch_measurement *meas;
+	/** Number of sensors */
+	size_t num_devs;
+	/** RTIO context the transfers of the batch are issued on */
+	struct rtio *ctx;
+	/** Serializes the reads of the batch */
+	struct k_mutex lock;
+};
+
+/**
+ * @brief Statically define a batch
+ *
+ * The sensors should share an I2C bus and must not be read by other means
+ * while a batch read is in progress.
+ *
+ * @param _name Name of the batch
+ * @param ...   Sensor devices, e.g. DEVICE_DT_GET(DT_NODELABEL(sht4x))
+ */
+#define SENSIRION_BATCH_DEFINE(_name, ...)                                                         \
+	static const struct device *const _CONCAT(_name, _devs)[] = {__VA_ARGS__};                 \
+	static struct sensirion_batch_measurement                                                  \
+		_CONCAT(_name, _meas)[ARRAY_SIZE(_CONCAT(_name, _devs))];                          \
+	RTIO_DEFINE(_CONCAT(_name, _rtio), ARRAY_SIZE(_CONCAT(_name, _devs)) + 1,                  \
+		    ARRAY_SIZE(_CONCAT(_name, _devs)) + 1);                                        \
+	static struct sensirion_batch _name = {                                                    \
+		.devs = _CONCAT(_name, _devs),                                                     \
+		.meas = _CONCAT(_name, _meas),                                                     \
+		.num_devs = ARRAY_SIZE(_CONCAT(_name, _devs)),                                     \
+		.ctx = &_CONCAT(_name, _rtio),                                                     \
+		.lock = Z_MUTEX_INITIALIZER(_name.lock),                                           \
+	}
+
+/**
+ * @brief Read all sensors of a batch
+ *
+ * Starts the measurements of all sensors, waits for the longest conversion
+ * time and reads the results. Every sensor is read into its own buffer, which
+ * holds the same data as a one shot read of all channels and is decoded with
+ * the decoder of the sensor. A failing sensor does not affect the others.
+ *
+ * @param batch   Batch to read
+ * @param bufs    One buffer per sensor, in the order of the batch definition
+ * @param buf_len Size of each buffer
+ * @param results Optional array receiving the outcome per sensor: 0, -ENOTSUP
+ *                if the sensor does not support batched reads, -ENOMEM if its
+ *                buffer is too small, -EBUSY if the driver is using the sensor
+ *                itself or the error of the transfer
+ *
+ * @return 0 if all sensors were read, the first error otherwise
+ */
+int sensirion_batch_read(struct sensirion_batch *batch, uint8_t *const bufs[], uint32_t buf_len,
+			 int results[]);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_SENSOR_SENSIRION_BATCH_H_ */
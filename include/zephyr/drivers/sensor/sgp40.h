@@ -10,7 +10,8 @@
  * @ingroup sgp40_interface
  *
  * This exposes two attributes for the SGP40 which can be used for
- * setting the on-chip Temperature and Humidity compensation parameters.
+ * setting the on-chip Temperature and Humidity compensation parameters
+ * and an API to feed recorded samples to the VOC index.
  */
 
 #ifndef ZEPHYR_INCLUDE_DRIVERS_SENSOR_SGP40_H_
@@ -27,6 +28,10 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/device.h>
+
 /**
  * @brief Custom sensor attributes for SGP40
  */
@@ -41,6 +46,30 @@ enum sensor_attribute_sgp40 {
 	SENSOR_ATTR_SGP40_HUMIDITY
 };
 
+#if defined(CONFIG_SGP40_VOC_INDEX) || defined(__DOXYGEN__)
+/**
+ * @brief Feeds raw samples to the VOC index of the sensor.
+ *
+ * The VOC index is updated with every sample the driver fetches or reads.
+ * Samples that reached the application by other means, e.g. batched reads or
+ * samples recorded while the index was not being computed, are fed with this
+ * function instead. They must have been taken at the sampling interval of
+ * the index and are processed oldest first. Once the driver fed the index
+ * with a sample of its own, batched reads of the sensor fail with -EBUSY.
+ *
+ * Only available with CONFIG_SGP40_VOC_INDEX.
+ *
+ * @param dev Pointer to the sensor device
+ * @param sraw Raw signal samples in ticks
+ * @param count Number of samples
+ * @param indices Receives the VOC index after every sample, may be NULL
+ *
+ * @return VOC index after the last sample, 0 during the initial blackout
+ */
+int32_t sgp40_voc_index_feed(const struct device *dev, const uint16_t *sraw, size_t count,
+			     int32_t *indices);
+#endif /* CONFIG_SGP40_VOC_INDEX */
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,9 +25,11 @@ extern "C" {
  * 2-3 as required by the application. 5. If desired, set the sensor to sleep
  * with the enter_sleep_mode command.
  *
+ * @param dev Pointer to the sensor device
+ *
  * @return error_code 0 on success, an error code otherwise.
  */
-int stcc4_measure_single_shot(void);
+int stcc4_measure_single_shot(const struct device *dev);
 
 /**
  * @brief Perform a forced recalibration (FRC) of the CO₂ concentration.
@@ -51,13 +53,15 @@ int stcc4_measure_single_shot(void);
  * read out the applied FRC correction. The sensor must remain in idle mode
  * after operation before command execution.
  *
+ * @param dev Pointer to the sensor device
  * @param[in] target_co2_concentration Target CO₂ concentration in ppm.
  * @param[out] frc_correction Returns the FRC correction value if FRC has been
  * successful. 0xFFFF on failure.
  *
  * @return error_code 0 on success, an error code otherwise.
  */
-int stcc4_perform_forced_recalibration(int16_t target_co2_concentration, int16_t *frc_correction);
+int stcc4_perform_forced_recalibration(const struct device *dev, int16_t target_co2_concentration,
+				       int16_t *frc_correction);
 
 /**
  * @brief Read the sensor's 32-bit product id and 64-bit serial number.
@@ -65,12 +69,13 @@ int stcc4_perform_forced_recalibration(int16_t target_co2_concentration, int16_t
  * The get_product_ID command retrieves the product identifier and serial
  * number. The command can be used to check communication with the sensor.
  *
+ * @param dev Pointer to the sensor device
  * @param[out] product_id 32-bit
  * @param[out] serial_number 64-bit unique serial number of the sensor.
  *
  * @return error_code 0 on success, an error code otherwise.
  */
-int stcc4_get_product_id(uint32_t *product_id, uint64_t *serial_number);
+int stcc4_get_product_id(const struct device *dev, uint32_t *product_id, uint64_t *serial_number);
 
 /**
  * @brief Sets the sensor from idle mode into sleep mode.
@@ -80,9 +85,11 @@ int stcc4_get_product_id(uint32_t *product_id, uint64_t *serial_number);
  * compensation values as well as the ASC state will be retained while in sleep
  * mode.
  *
+ * @param dev Pointer to the sensor device
+ *
  * @return error_code 0 on success, an error code otherwise.
  */
-int stcc4_enter_sleep_mode(void);
+int stcc4_enter_sleep_mode(const struct device *dev);
 
 /**
  * @brief The sensor is set from sleep mode into idle mode when it receives the
@@ -92,9 +99,11 @@ int stcc4_enter_sleep_mode(void);
  * interface. The sensor's idle state can be verified by reading out the product
  * ID.
  *
+ * @param dev Pointer to the sensor device
+ *
  * @return error_code 0 on success, an error code otherwise.
  */
-int stcc4_exit_sleep_mode(void);
+int stcc4_exit_sleep_mode(const struct device *dev);
 
 /**
  * @brief Enable the sensor testing mode.
@@ -103,9 +112,11 @@ int stcc4_exit_sleep_mode(void);
  * algorithm disabled. The sensor state can be verified by reading out the
  * sensor status word in the read_measurement command.
  *
+ * @param dev Pointer to the sensor device
+ *
  * @return error_code 0 on success, an error code otherwise.
  */
-int stcc4_enable_testing_mode(void);
+int stcc4_enable_testing_mode(const struct device *dev);
 
 /**
  * @brief Disable the sensor testing mode.
@@ -114,9 +125,11 @@ int stcc4_enable_testing_mode(void);
  * state can be verified by reading out the sensor status word in the
  * read_measurement command.
  *
+ * @param dev Pointer to the sensor device
+ *
  * @return error_code 0 on success, an error code otherwise.
  */
-int stcc4_disable_testing_mode(void);
+int stcc4_disable_testing_mode(const struct device *dev);
 
 /**
  * @brief Reset the FRC and ASC algorithm history.
@@ -124,12 +137,13 @@ int stcc4_disable_testing_mode(void);
  * The perform_factory_reset command can be used to reset the FRC and ASC
  * algorithm history.
  *
+ * @param dev Pointer to the sensor device
  * @param[out] factory_reset_result The result of the factory reset. If the
  * result is ≠ 0, the factory reset failed.
  *
  * @return error_code 0 on success, an error code otherwise.
  */
-int stcc4_perform_factory_reset(uint16_t *factory_reset_result);
+int stcc4_perform_factory_reset(const struct device *dev, uint16_t *factory_reset_result);
 
 /**
  * @brief Start a continuous measurement (interval 1 s).
@@ -143,9 +157,11 @@ int stcc4_perform_factory_reset(uint16_t *factory_reset_result);
  * If desired, stop taking measurements using the stop_continuous_measurement
  * command.
  *
+ * @param dev Pointer to the sensor device
+ *
  * @return error_code 0 on success, an error code otherwise.
  */
-int stcc4_start_continuous_measurement(void);
+int stcc4_start_continuous_measurement(const struct device *dev);
 
 /**
  * @brief The command stops the continuous measurement and puts the sensor into
@@ -156,15 +172,18 @@ int stcc4_start_continuous_measurement(void);
  * Therefore, a wait time of one measurement interval plus a 200 ms clock
  * tolerance is required before a new command is acknowledged.
  *
+ * @param dev Pointer to the sensor device
+ *
  * @return error_code 0 on success, an error code otherwise.
  */
-int stcc4_stop_continuous_measurement(void);
+int stcc4_stop_continuous_measurement(const struct device *dev);
 
 /**
  * @brief stcc4_read_measurement
  *
  * reads measurement data
  *
+ * @param dev Pointer to the sensor device
  * @param[out] co2_concentration
  * @param[out] temperature
  * @param[out] relative_humidity
@@ -172,8 +191,138 @@ int stcc4_stop_continuous_measurement(void);
  *
  * @return error_code 0 on success, an error code otherwise.
  */
-int stcc4_read_measurement(int16_t *co2_concentration, float *temperature, float *relative_humidity,
-			   uint16_t *sensor_status);
+int stcc4_read_measurement(const struct device *dev, int16_t *co2_concentration,
+			   float *temperature, float *relative_humidity, uint16_t *sensor_status);
+
+/**
+ * @brief Completion callback of an asynchronous STCC4 operation.
+ *
+ * The callback runs on the system work queue. A new asynchronous operation
+ * may be started from within the callback.
+ *
+ * @param dev Pointer to the sensor device
+ * @param result 0 on success, a negative error code otherwise.
+ * @param user_data User data passed when the operation was started.
+ */
+typedef void (*stcc4_callback_t)(const struct device *dev, int result, void *user_data);
+
+/**
+ * @brief Stop the continuous measurement without blocking.
+ *
+ * Asynchronous variant of stcc4_stop_continuous_measurement(). The function
+ * returns once the command has been queued; the 1200 ms the sensor needs to
+ * return to idle mode elapse on the system work queue.
+ *
+ * Only one asynchronous operation can be pending per sensor. While it is
+ * pending, sample fetches, read requests and the blocking commands fail with
+ * -EBUSY. The blocking commands that take longer than a few milliseconds run
+ * the same steps in the calling thread and are rejected the same way while
+ * another one executes.
+ *
+ * The driver initialization runs as such an operation: requests fail with
+ * -EBUSY for about 1.6 s after boot, or 23.6 s with do-perform-conditioning.
+ *
+ * @param dev Pointer to the sensor device
+ * @param cb Completion callback, may be NULL.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 if the operation has been started.
+ * @retval -EBUSY if another asynchronous operation is pending.
+ */
+int stcc4_stop_continuous_measurement_async(const struct device *dev, stcc4_callback_t cb,
+					    void *user_data);
+
+/**
+ * @brief Perform a single shot measurement without blocking.
+ *
+ * Asynchronous variant of stcc4_measure_single_shot(). Once @p cb reports
+ * success the result can be read with stcc4_read_measurement().
+ *
+ * @param dev Pointer to the sensor device
+ * @param cb Completion callback, may be NULL.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 if the operation has been started.
+ * @retval -EBUSY if another asynchronous operation is pending.
+ */
+int stcc4_measure_single_shot_async(const struct device *dev, stcc4_callback_t cb,
+				    void *user_data);
+
+/**
+ * @brief Perform a forced recalibration (FRC) without blocking.
+ *
+ * Asynchronous variant of stcc4_perform_forced_recalibration().
+ *
+ * @param dev Pointer to the sensor device
+ * @param[in] target_co2_concentration Target CO₂ concentration in ppm.
+ * @param[out] frc_correction Receives the FRC correction value. Must stay
+ * valid until @p cb has been called.
+ * @param cb Completion callback, may be NULL.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 if the operation has been started.
+ * @retval -EBUSY if another asynchronous operation is pending.
+ */
+int stcc4_perform_forced_recalibration_async(const struct device *dev,
+					     int16_t target_co2_concentration,
+					     int16_t *frc_correction, stcc4_callback_t cb,
+					     void *user_data);
+
+/**
+ * @brief Run the sensor self test without blocking.
+ *
+ * @param dev Pointer to the sensor device
+ * @param[out] test_result Receives the self test result, 0 if the sensor
+ * works correctly. Must stay valid until @p cb has been called.
+ * @param cb Completion callback, may be NULL.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 if the operation has been started.
+ * @retval -EBUSY if another asynchronous operation is pending.
+ */
+int stcc4_perform_self_test_async(const struct device *dev, uint16_t *test_result,
+				  stcc4_callback_t cb, void *user_data);
+
+/**
+ * @brief Run the 22 s sensor conditioning without blocking.
+ *
+ * @param dev Pointer to the sensor device
+ * @param cb Completion callback, may be NULL.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 if the operation has been started.
+ * @retval -EBUSY if another asynchronous operation is pending.
+ */
+int stcc4_perform_conditioning_async(const struct device *dev, stcc4_callback_t cb,
+				     void *user_data);
+
+/**
+ * @brief Reset the FRC and ASC algorithm history without blocking.
+ *
+ * Asynchronous variant of stcc4_perform_factory_reset().
+ *
+ * @param dev Pointer to the sensor device
+ * @param[out] factory_reset_result Receives the result of the factory reset.
+ * Must stay valid until @p cb has been called.
+ * @param cb Completion callback, may be NULL.
+ * @param user_data User data passed to @p cb.
+ *
+ * @retval 0 if the operation has been started.
+ * @retval -EBUSY if another asynchronous operation is pending.
+ */
+int stcc4_perform_factory_reset_async(const struct device *dev, uint16_t *factory_reset_result,
+				      stcc4_callback_t cb, void *user_data);
+
+#if defined(CONFIG_POLL) || defined(__DOXYGEN__)
+/**
+ * @brief Completion callback raising a poll signal.
+ *
+ * Pass this as callback and a struct k_poll_signal as user data to wait for
+ * an asynchronous operation with k_poll(). The signal is raised with the
+ * result of the operation.
+ */
+void stcc4_signal_cb(const struct device *dev, int result, void *user_data);
+#endif /* CONFIG_POLL */
 
 #ifdef __cplusplus
 }
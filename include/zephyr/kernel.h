@@ -2271,6 +2271,31 @@ int k_queue_merge_slist(struct k_queue *queue, sys_slist_t *list);
  */
 __syscall void *k_queue_get(struct k_queue *queue, k_timeout_t timeout);
 
+/**
+ * @brief Get several elements from a queue.
+ *
+ * This routine removes up to @a max_items data items from the head of
+ * @a queue in one locked operation and stores their addresses in @a data.
+ * It waits only while the queue is empty; once a data item is obtained, it
+ * returns with those that are available at that point, without waiting
+ * for more.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue Address of the queue.
+ * @param data Array of @a max_items pointers to hold the data items.
+ * @param max_items Maximum number of data items to obtain.
+ * @param timeout Waiting period to obtain the first data item, or one of the
+ *                special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of data items obtained; 0 if returned without waiting, or
+ * waiting period timed out.
+ */
+__syscall int k_queue_get_many(struct k_queue *queue, void **data, uint32_t max_items,
+			       k_timeout_t timeout);
+
 /**
  * @brief Remove an element from a queue.
  *
@@ -2871,6 +2896,35 @@ struct k_fifo {
 	fg_ret; \
 	})
 
+/**
+ * @brief Get several elements from a FIFO queue.
+ *
+ * This routine removes up to @a max_items data items from @a fifo in a
+ * "first in, first out" manner, in one locked operation. It waits only
+ * while @a fifo is empty. The first word of each data item is reserved for
+ * the kernel's use.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param fifo Address of the FIFO queue.
+ * @param data Array of @a max_items pointers to hold the data items.
+ * @param max_items Maximum number of data items to obtain.
+ * @param timeout Waiting period to obtain the first data item,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of data items obtained; 0 if returned without waiting, or
+ * waiting period timed out.
+ */
+#define k_fifo_get_many(fifo, data, max_items, timeout) \
+	({ \
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_fifo, get_many, fifo, timeout); \
+	int fgm_ret = k_queue_get_many(&(fifo)->_queue, data, max_items, timeout); \
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_fifo, get_many, fifo, timeout, fgm_ret); \
+	fgm_ret; \
+	})
+
 /**
  * @brief Query a FIFO queue to see if it has data available.
  *
@@ -3248,6 +3302,14 @@ struct k_mutex {
 #ifdef CONFIG_OBJ_CORE_MUTEX
 	struct k_obj_core obj_core;
 #endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	/** Contention statistics */
+	struct k_obj_contention_stats contention;
+
+	/** Time (in cycles) when the current owner took the mutex */
+	uint32_t hold_start;
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 };
 
 /**
@@ -3451,6 +3513,10 @@ struct k_sem {
 #ifdef CONFIG_OBJ_CORE_SEM
 	struct k_obj_core  obj_core;
 #endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	struct k_obj_contention_stats contention;
+#endif
 	/** @endcond */
 };
 
@@ -3908,6 +3974,47 @@ void k_work_queue_start(struct k_work_q *queue,
  */
 void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *cfg);
 
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+/** @brief Initialize a work queue animated by a pool of threads.
+ *
+ * This configures @p num_threads threads sharing the queue and starts them
+ * running.  Work items submitted to the queue are processed by whichever
+ * thread is idle, so independent items run concurrently, on several CPUs on
+ * SMP systems.  A given work item is still never run by two threads at the
+ * same time, and flushing, cancelling, draining and stopping apply to the
+ * whole pool.  Unlike on a single threaded queue, items submitted in a row
+ * may complete out of order.
+ *
+ * The function should not be re-invoked on a queue.
+ *
+ * @note The work timeout of @p cfg is not supported and ignored.
+ *
+ * @param queue pointer to the queue structure. It must be initialized
+ *        in zeroed/bss memory or with @ref k_work_queue_init before
+ *        use.
+ *
+ * @param threads array of @p num_threads thread structures.
+ *
+ * @param stacks the first of the stacks of the threads, defined with
+ *        K_THREAD_STACK_ARRAY_DEFINE() for @p num_threads stacks of
+ *        @p stack_size bytes.
+ *
+ * @param num_threads number of threads, at least 1.
+ *
+ * @param stack_size size of every stack area, in bytes, as passed to the
+ *        stack array definition.
+ *
+ * @param prio initial priority of the threads
+ *
+ * @param cfg optional additional configuration parameters.  Pass @c
+ * NULL if not required, to use the defaults documented in
+ * k_work_queue_config.
+ */
+void k_work_queue_pool_start(struct k_work_q *queue, struct k_thread *threads,
+			     k_thread_stack_t *stacks, size_t num_threads, size_t stack_size,
+			     int prio, const struct k_work_queue_config *cfg);
+#endif /* CONFIG_WORKQUEUE_POOL || __DOXYGEN__ */
+
 /** @brief Access the thread that animates a work queue.
  *
  * This is necessary to grant a work queue thread access to things the work
@@ -3915,7 +4022,8 @@ void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *
  *
  * @param queue pointer to the queue structure.
  *
- * @return the thread associated with the work queue.
+ * @return the thread associated with the work queue, the first thread of a
+ * pool.
  */
 static inline k_tid_t k_work_queue_thread_get(struct k_work_q *queue);
 
@@ -4412,6 +4520,12 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#if defined(CONFIG_WORKQUEUE_POOL)
+	/* The work item being flushed, so no other thread of a pool processes
+	 * the flusher while the item is still running.
+	 */
+	struct k_work *target;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -4524,6 +4638,20 @@ struct k_work_q {
 	struct k_work *work;
 	k_timeout_t work_timeout;
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
+
+#if defined(CONFIG_WORKQUEUE_POOL)
+	/* The threads of a pool, NULL if the queue is animated by a single
+	 * thread.
+	 */
+	struct k_thread *pool_threads;
+	uint16_t pool_size;
+
+	/* Number of pool threads running a work item. */
+	uint16_t pool_busy;
+
+	/* Number of pool threads that have not exited. */
+	uint16_t pool_live;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4918,6 +5046,16 @@ struct k_msgq {
 	char *write_ptr;
 	/** Number of used messages */
 	uint32_t used_msgs;
+#ifdef CONFIG_MSGQ_MPSC
+	/** Sequence numbers of the slots of a lock-free queue */
+	atomic_t *seqs;
+	/** Position of the next slot to reserve */
+	atomic_t head;
+	/** Position of the next slot to read */
+	atomic_t tail;
+	/** Threads waiting for a free slot in a lock-free queue */
+	_wait_q_t put_wait_q;
+#endif /* CONFIG_MSGQ_MPSC */
 
 	Z_DECL_POLL_EVENT
 
@@ -4929,6 +5067,11 @@ struct k_msgq {
 #ifdef CONFIG_OBJ_CORE_MSGQ
 	struct k_obj_core  obj_core;
 #endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+	/** Contention statistics */
+	struct k_obj_contention_stats contention;
+#endif /* CONFIG_OBJ_CORE_STATS_MSGQ */
 };
 /**
  * @cond INTERNAL_HIDDEN
@@ -4950,12 +5093,32 @@ struct k_msgq {
 	.flags = 0, \
 	}
 
+#define Z_MSGQ_MPSC_INITIALIZER(obj, q_buffer, q_seqs, q_msg_size, q_max_msgs) \
+	{ \
+	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.lock = {}, \
+	.msg_size = q_msg_size, \
+	.max_msgs = q_max_msgs, \
+	.buffer_start = q_buffer, \
+	.buffer_end = q_buffer + (q_max_msgs * q_msg_size), \
+	.read_ptr = q_buffer, \
+	.write_ptr = q_buffer, \
+	.used_msgs = 0, \
+	.seqs = q_seqs, \
+	.head = ATOMIC_INIT(0), \
+	.tail = ATOMIC_INIT(0), \
+	.put_wait_q = Z_WAIT_Q_INIT(&obj.put_wait_q), \
+	Z_POLL_EVENT_OBJ_INIT(obj) \
+	.flags = K_MSGQ_FLAG_MPSC, \
+	}
+
 /**
  * INTERNAL_HIDDEN @endcond
  */
 
 
 #define K_MSGQ_FLAG_ALLOC	BIT(0)
+#define K_MSGQ_FLAG_MPSC	BIT(1)
 
 /**
  * @brief Message Queue Attributes
@@ -4995,6 +5158,63 @@ struct k_msgq_attrs {
 	       Z_MSGQ_INITIALIZER(q_name, _k_fifo_buf_##q_name,	\
 				  (q_msg_size), (q_max_msgs))
 
+#if defined(CONFIG_MSGQ_MPSC) || defined(__DOXYGEN__)
+/**
+ * @brief Statically define and initialize a lock-free message queue.
+ *
+ * Like K_MSGQ_DEFINE(), but messages are put without taking the lock of the
+ * queue: a producer reserves a slot of the ring buffer with an atomic
+ * operation, copies its message with only the local interrupts locked, and
+ * publishes it through the sequence number of the slot. Any number of
+ * producers, in ISRs or threads, can put messages concurrently, while readers
+ * still take the lock of the queue to read them. Readers blocked on an empty
+ * queue are woken up, and poll events raised, only when the message at the
+ * front of the queue is published.
+ *
+ * Messages are read in the order of their slots, so a message is readable
+ * once all the messages put before it are. k_msgq_put_front() is not
+ * supported, and k_msgq_num_used_get() also counts the messages being
+ * copied. Waiting writers are woken up as slots are freed and compete for
+ * them with the other producers.
+ *
+ * Only available with @kconfig{CONFIG_MSGQ_MPSC}.
+ *
+ * @param q_name Name of the message queue.
+ * @param q_msg_size Message size (in bytes).
+ * @param q_max_msgs Maximum number of messages that can be queued, a power of
+ *                   2 of at least 2.
+ * @param q_align Alignment of the message queue's ring buffer (power of 2).
+ */
+#define K_MSGQ_MPSC_DEFINE(q_name, q_msg_size, q_max_msgs, q_align)	\
+	BUILD_ASSERT(IS_POWER_OF_TWO(q_max_msgs) && ((q_max_msgs) >= 2),	\
+		     "Lock-free message queue length must be a power of 2");	\
+	static char __noinit __aligned(q_align)				\
+		_k_fifo_buf_##q_name[(q_max_msgs) * (q_msg_size)];	\
+	static atomic_t _k_msgq_seqs_##q_name[(q_max_msgs)];		\
+	STRUCT_SECTION_ITERABLE(k_msgq, q_name) =			\
+	       Z_MSGQ_MPSC_INITIALIZER(q_name, _k_fifo_buf_##q_name,	\
+				       _k_msgq_seqs_##q_name,		\
+				       (q_msg_size), (q_max_msgs))
+
+/**
+ * @brief Initialize a lock-free message queue.
+ *
+ * Like k_msgq_init(), for a message queue behaving as described for
+ * K_MSGQ_MPSC_DEFINE().
+ *
+ * Only available with @kconfig{CONFIG_MSGQ_MPSC}.
+ *
+ * @param msgq Address of the message queue.
+ * @param buffer Pointer to ring buffer that holds queued messages.
+ * @param seqs Array of @a max_msgs sequence numbers for the slots.
+ * @param msg_size Message size (in bytes).
+ * @param max_msgs Maximum number of messages that can be queued, a power of 2
+ *                 of at least 2.
+ */
+void k_msgq_mpsc_init(struct k_msgq *msgq, char *buffer, atomic_t *seqs, size_t msg_size,
+		      uint32_t max_msgs);
+#endif /* CONFIG_MSGQ_MPSC */
+
 /**
  * @brief Initialize a message queue.
  *
@@ -5091,9 +5311,40 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  *
  * @retval 0 Message sent.
  * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -ENOTSUP Lock-free message queue.
  */
 __syscall int k_msgq_put_front(struct k_msgq *msgq, const void *data);
 
+/**
+ * @brief Send several messages to the end of a message queue.
+ *
+ * This routine sends up to @a num_msgs consecutive messages from @a data to
+ * message queue @a q in one locked operation, handing them to waiting
+ * readers first and waking them up with a single reschedule. The messages
+ * that fit in the queue are sent without waiting; the routine waits only
+ * when none of them fit, until the first one is sent.
+ *
+ * @note The message content is copied from @a data into @a msgq and the @a data
+ * pointer is not retained, so the message content will not be modified
+ * by this function.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Pointer to the messages.
+ * @param num_msgs Number of messages to send.
+ * @param timeout Waiting period to send the first message, or one of the
+ *                special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of messages sent, starting with the first one of @a data.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_put_many(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+			      k_timeout_t timeout);
+
 /**
  * @brief Receive a message from a message queue.
  *
@@ -5116,6 +5367,34 @@ __syscall int k_msgq_put_front(struct k_msgq *msgq, const void *data);
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Receive several messages from a message queue.
+ *
+ * This routine receives up to @a max_msgs messages from message queue @a q
+ * in a "first in, first out" manner, in one locked operation. The space
+ * they free is refilled from waiting writers, which are woken up with a
+ * single reschedule. The routine waits only while the queue is empty; once
+ * a message is received, it returns with the messages available at that
+ * point, without waiting for more.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of area to hold @a max_msgs received messages.
+ * @param max_msgs Maximum number of messages to receive.
+ * @param timeout Waiting period to receive the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages received.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_get_many(struct k_msgq *msgq, void *data, uint32_t max_msgs,
+			      k_timeout_t timeout);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -5185,9 +5464,26 @@ __syscall void  k_msgq_get_attrs(struct k_msgq *msgq,
 				 struct k_msgq_attrs *attrs);
 
 
+/** @cond INTERNAL_HIDDEN */
+static inline uint32_t z_msgq_used_msgs(struct k_msgq *msgq)
+{
+#ifdef CONFIG_MSGQ_MPSC
+	if ((msgq->flags & K_MSGQ_FLAG_MPSC) != 0U) {
+		/* The tail never passes the head, read it first */
+		uint32_t tail = (uint32_t)atomic_get(&msgq->tail);
+		uint32_t head = (uint32_t)atomic_get(&msgq->head);
+
+		return MIN(head - tail, msgq->max_msgs);
+	}
+#endif /* CONFIG_MSGQ_MPSC */
+
+	return msgq->used_msgs;
+}
+/** @endcond */
+
 static inline uint32_t z_impl_k_msgq_num_free_get(struct k_msgq *msgq)
 {
-	return msgq->max_msgs - msgq->used_msgs;
+	return msgq->max_msgs - z_msgq_used_msgs(msgq);
 }
 
 /**
@@ -5203,7 +5499,7 @@ __syscall uint32_t k_msgq_num_used_get(struct k_msgq *msgq);
 
 static inline uint32_t z_impl_k_msgq_num_used_get(struct k_msgq *msgq)
 {
-	return msgq->used_msgs;
+	return z_msgq_used_msgs(msgq);
 }
 
 /** @} */
@@ -5508,12 +5804,33 @@ struct k_mem_slab_info {
 #endif
 };
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+/* Free blocks cached by a CPU, linked like the free list of the slab.
+ * Other CPUs only take the whole list when flushing it.
+ */
+struct z_mem_slab_cpu_cache {
+	atomic_ptr_t free_list;
+	/* Updated by the owning CPU only */
+	uint32_t count;
+	/* Blocks allocated from this cache, less the ones freed to it,
+	 * wrapping around like its sum with the slab info
+	 */
+	uint32_t num_used;
+};
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
 	char *buffer;
 	char *free_list;
+	/* Leaves out the blocks counted by the CPU caches */
 	struct k_mem_slab_info info;
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	struct z_mem_slab_cpu_cache cpu_caches[CONFIG_MP_MAX_NUM_CPUS];
+	/* Threads that found no free block, freed blocks skip the caches */
+	atomic_t num_waiters;
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
 
@@ -5726,7 +6043,18 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	uint32_t used = slab->info.num_used;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		used += slab->cpu_caches[i].num_used;
+	}
+
+	/* Read without the locks, blocks moving meanwhile may be miscounted */
+	return (uint32_t)CLAMP((int32_t)used, 0, (int32_t)slab->info.num_blocks);
+#else
 	return slab->info.num_used;
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
 }
 
 /**
@@ -5765,7 +6093,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -5808,10 +6136,34 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
 
 /* kernel synchronized heap struct */
 
+#ifdef CONFIG_HEAP_MAGAZINES
+/** @cond INTERNAL_HIDDEN */
+
+/* Free blocks of one size class cached by a CPU, linked through their
+ * first word. Other CPUs only take the whole list when flushing it.
+ */
+struct z_heap_magazine {
+	atomic_ptr_t blocks;
+	/* Updated by the owning CPU only */
+	uint16_t count;
+};
+
+struct z_heap_cpu_cache {
+	struct z_heap_magazine mags[CONFIG_HEAP_MAGAZINE_CLASSES];
+};
+
+/** @endcond */
+#endif /* CONFIG_HEAP_MAGAZINES */
+
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_HEAP_MAGAZINES
+	struct z_heap_cpu_cache cpu_caches[CONFIG_MP_MAX_NUM_CPUS];
+	/* Threads that failed to allocate, freed blocks go to the heap */
+	atomic_t num_waiters;
+#endif /* CONFIG_HEAP_MAGAZINES */
 };
 
 /**
@@ -6110,6 +6462,37 @@ void *k_calloc(size_t nmemb, size_t size);
  */
 void *k_realloc(void *ptr, size_t size);
 
+#if defined(CONFIG_HEAP_MEM_POOL_SLABS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the memory slabs serving small allocations from the heap
+ *
+ * Returns the array of the memory slabs that k_malloc() and related
+ * functions allocate small blocks from, by increasing block size. Their
+ * usage can be read with k_mem_slab_runtime_stats_get(), and is included
+ * in the runtime statistics of the system heap.
+ *
+ * Only available with @kconfig{CONFIG_HEAP_MEM_POOL_SLABS}.
+ *
+ * @param slabs Pointer to location where the slab array address is written
+ * @return Number of slabs, 0 if all the size classes are empty
+ */
+int k_malloc_slab_array_get(struct k_mem_slab *const **slabs);
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+/* Used by sys_heap_runtime_stats_get() and sys_heap_runtime_stats_reset_max()
+ * to account for the slabs in the statistics of the system heap.
+ */
+void z_malloc_slab_runtime_stats_add(struct sys_heap *heap, struct sys_memory_stats *stats);
+void z_malloc_slab_runtime_stats_reset_max(struct sys_heap *heap);
+
+/**
+ * @endcond
+ */
+#endif /* CONFIG_HEAP_MEM_POOL_SLABS */
+
 /** @} */
 
 /* polling API - PRIVATE */
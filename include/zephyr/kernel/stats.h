@@ -30,4 +30,47 @@ struct k_cycle_stats {
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
+/**
+ * Structure used to track the contention on a kernel object or spinlock.
+ *
+ * Times are in hardware cycles. An acquisition is contended when the
+ * object was not available at the first attempt, whether or not the caller
+ * then waited for it.
+ */
+
+struct k_obj_contention_stats {
+	uint64_t  acquisitions; /**< \# of successful acquisitions */
+	uint64_t  contended;    /**< \# of attempts finding the object unavailable */
+	uint64_t  wait_total;   /**< total time spent waiting, in cycles */
+	uint64_t  hold_total;   /**< total time the object was held, in cycles */
+	uint32_t  wait_max;     /**< longest wait, in cycles */
+	uint32_t  hold_max;     /**< longest hold, in cycles */
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+static inline void z_contention_wait_add(struct k_obj_contention_stats *stats,
+					 uint32_t cycles)
+{
+	stats->wait_total += cycles;
+	if (cycles > stats->wait_max) {
+		stats->wait_max = cycles;
+	}
+}
+
+static inline void z_contention_hold_add(struct k_obj_contention_stats *stats,
+					 uint32_t cycles)
+{
+	stats->hold_total += cycles;
+	if (cycles > stats->hold_max) {
+		stats->hold_max = cycles;
+	}
+}
+
+/**
+ * @endcond
+ */
+
 #endif /* ZEPHYR_INCLUDE_KERNEL_STATS_H_ */
@@ -78,6 +78,8 @@ extern "C" {
 #define ZSOCK_MSG_DONTWAIT 0x40
 /** zsock_recv: block until the full amount of data can be returned */
 #define ZSOCK_MSG_WAITALL 0x100
+/** zsock_recvmmsg: block for the first message only */
+#define ZSOCK_MSG_WAITFORONE 0x10000
 /** @} */
 
 /**
@@ -512,6 +514,34 @@ static inline ssize_t zsock_send(int sock, const void *buf, size_t len,
 __syscall ssize_t zsock_sendmsg(int sock, const struct msghdr *msg,
 				int flags);
 
+/** Message header for sending or receiving several messages in one call */
+struct mmsghdr {
+	struct msghdr msg_hdr; /**< Message header */
+	unsigned int  msg_len; /**< Number of bytes transmitted for the message */
+};
+
+/**
+ * @brief Send several messages to arbitrary network addresses
+ *
+ * @details
+ * Send up to @p vlen messages of @p msgvec in one call, as if by
+ * zsock_sendmsg() for each of them, and set the @c msg_len of each sent
+ * message to the number of bytes sent. The messages of concurrent calls on
+ * the same socket may be interleaved. This is a Linux extension, see
+ * https://man7.org/linux/man-pages/man2/sendmmsg.2.html for the description.
+ *
+ * @param sock Socket descriptor
+ * @param msgvec Array of messages to send
+ * @param vlen Number of messages in @p msgvec
+ * @param flags Flags for zsock_sendmsg()
+ *
+ * @return Number of messages sent, which can be less than @p vlen if an
+ * error occurred after the first message, or -1 with errno set if the first
+ * message could not be sent.
+ */
+__syscall int zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
 /**
  * @brief Receive data from an arbitrary network address
  *
@@ -538,6 +568,32 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
  */
 __syscall ssize_t zsock_recvmsg(int sock, struct msghdr *msg, int flags);
 
+/**
+ * @brief Receive several messages from arbitrary network addresses
+ *
+ * @details
+ * Receive up to @p vlen messages into @p msgvec in one call, as if by
+ * zsock_recvmsg() for each of them, and set the @c msg_len of each received
+ * message to the number of bytes received. With @ref ZSOCK_MSG_WAITFORONE,
+ * only the first message is waited for and the call returns the messages
+ * already queued after it. The messages may be interleaved with those
+ * received by concurrent calls on the same socket. This is a Linux
+ * extension, see https://man7.org/linux/man-pages/man2/recvmmsg.2.html
+ * for the description;
+ * unlike Linux, there is no timeout argument, use @c SO_RCVTIMEO instead.
+ *
+ * @param sock Socket descriptor
+ * @param msgvec Array of messages to receive into
+ * @param vlen Number of messages in @p msgvec
+ * @param flags Flags for zsock_recvmsg() and @ref ZSOCK_MSG_WAITFORONE
+ *
+ * @return Number of messages received, which can be less than @p vlen if an
+ * error occurred after the first message, or -1 with errno set if no message
+ * could be received.
+ */
+__syscall int zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
 /**
  * @brief Receive data from a connected peer
  *
@@ -960,6 +1016,11 @@ struct ifreq {
 #define TCP_KEEPINTVL 3
 /** Number of keepalives before dropping connection */
 #define TCP_KEEPCNT 4
+/** Congestion control algorithm, by name */
+#define TCP_CONGESTION 5
+
+/** Maximum length of a congestion control algorithm name, with the terminating null */
+#define TCP_CA_NAME_MAX 16
 
 /** @} */
 
@@ -19,6 +19,9 @@
 #include <zephyr/sys/atomic.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/time_units.h>
+#ifdef CONFIG_SPIN_LOCK_STATS
+#include <zephyr/kernel/stats.h>
+#endif /* CONFIG_SPIN_LOCK_STATS */
 
 #ifdef __cplusplus
 extern "C" {
@@ -76,6 +79,13 @@ struct k_spinlock {
 	 */
 	uint32_t lock_time;
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
+#ifdef CONFIG_SPIN_LOCK_STATS
+	/* Contention statistics, only updated by the lock holder, and
+	 * the time (in cycles) when the lock was taken
+	 */
+	struct k_obj_contention_stats stats;
+	uint32_t hold_start;
+#endif /* CONFIG_SPIN_LOCK_STATS */
 #endif /* CONFIG_SPIN_VALIDATE */
 
 #if defined(CONFIG_CPP) && !defined(CONFIG_SMP) && \
@@ -151,6 +161,27 @@ static ALWAYS_INLINE void z_spinlock_validate_post(struct k_spinlock *l)
 #endif /* CONFIG_SPIN_VALIDATE */
 }
 
+#ifdef CONFIG_SPIN_LOCK_STATS
+static ALWAYS_INLINE void z_spinlock_stats_acquired(struct k_spinlock *l,
+						    uint32_t spin_start,
+						    bool contended)
+{
+	uint32_t now = sys_clock_cycle_get_32();
+
+	l->stats.acquisitions++;
+	if (contended) {
+		l->stats.contended++;
+		z_contention_wait_add(&l->stats, now - spin_start);
+	}
+	l->hold_start = now;
+}
+
+static ALWAYS_INLINE void z_spinlock_stats_release(struct k_spinlock *l)
+{
+	z_contention_hold_add(&l->stats, sys_clock_cycle_get_32() - l->hold_start);
+}
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
 /**
  * @brief Lock a spinlock
  *
@@ -194,6 +225,10 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	k.key = arch_irq_lock();
 
 	z_spinlock_validate_pre(l);
+#ifdef CONFIG_SPIN_LOCK_STATS
+	uint32_t spin_start = sys_clock_cycle_get_32();
+	bool contended = false;
+#endif /* CONFIG_SPIN_LOCK_STATS */
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	/*
@@ -203,15 +238,24 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	atomic_val_t ticket = atomic_inc(&l->tail);
 	/* Spin until our ticket is served */
 	while (atomic_get(&l->owner) != ticket) {
+#ifdef CONFIG_SPIN_LOCK_STATS
+		contended = true;
+#endif /* CONFIG_SPIN_LOCK_STATS */
 		arch_spin_relax();
 	}
 #else
 	while (!atomic_cas(&l->locked, 0, 1)) {
+#ifdef CONFIG_SPIN_LOCK_STATS
+		contended = true;
+#endif /* CONFIG_SPIN_LOCK_STATS */
 		arch_spin_relax();
 	}
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 	z_spinlock_validate_post(l);
+#ifdef CONFIG_SPIN_LOCK_STATS
+	z_spinlock_stats_acquired(l, spin_start, contended);
+#endif /* CONFIG_SPIN_LOCK_STATS */
 
 	return k;
 }
@@ -267,6 +311,9 @@ static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *
 #endif /* CONFIG_TICKET_SPINLOCKS */
 #endif /* CONFIG_SMP */
 	z_spinlock_validate_post(l);
+#ifdef CONFIG_SPIN_LOCK_STATS
+	z_spinlock_stats_acquired(l, 0, false);
+#endif /* CONFIG_SPIN_LOCK_STATS */
 
 	k->key = key;
 
@@ -314,6 +361,9 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 		 "Spin lock %p held %u cycles, longer than limit of %u cycles",
 		 l, delta, CONFIG_SPIN_LOCK_TIME_LIMIT);
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
+#ifdef CONFIG_SPIN_LOCK_STATS
+	z_spinlock_stats_release(l);
+#endif /* CONFIG_SPIN_LOCK_STATS */
 #endif /* CONFIG_SPIN_VALIDATE */
 
 #ifdef CONFIG_SMP
@@ -365,6 +415,9 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 #ifdef CONFIG_SPIN_VALIDATE
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock %p", l);
 #endif
+#ifdef CONFIG_SPIN_LOCK_STATS
+	z_spinlock_stats_release(l);
+#endif /* CONFIG_SPIN_LOCK_STATS */
 #ifdef CONFIG_SMP
 #ifdef CONFIG_TICKET_SPINLOCKS
 	(void)atomic_inc(&l->owner);
@@ -442,6 +495,26 @@ static ALWAYS_INLINE void z_spin_onexit(__maybe_unused k_spinlock_key_t *k)
 	for (k_spinlock_key_t __i K_SPINLOCK_ONEXIT = {}, __key = k_spin_lock(lck); !__i.key;      \
 	     k_spin_unlock((lck), __key), __i.key = 1)
 
+#if defined(CONFIG_SPIN_LOCK_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the contention statistics of a spin lock
+ *
+ * The statistics are read with @p l held, which counts as one
+ * acquisition. The calling CPU must not hold @p l already.
+ *
+ * @param l A pointer to the spinlock
+ * @param stats Where to store the statistics
+ */
+void k_spin_stats_get(struct k_spinlock *l, struct k_obj_contention_stats *stats);
+
+/**
+ * @brief Reset the contention statistics of a spin lock
+ *
+ * @param l A pointer to the spinlock
+ */
+void k_spin_stats_reset(struct k_spinlock *l);
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
 /** @} */
 
 #ifdef __cplusplus
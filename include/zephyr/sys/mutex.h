@@ -11,8 +11,8 @@
  * sys_mutex behaves almost exactly like k_mutex, with the added advantage
  * that a sys_mutex instance can reside in user memory.
  *
- * Further enhancements will support locking/unlocking uncontended sys_mutexes
- * with simple atomic ops instead of syscalls, similar to Linux's
+ * With CONFIG_SYS_MUTEX_FAST_PATH, uncontended sys_mutexes are locked and
+ * unlocked with simple atomic ops instead of syscalls, similar to Linux's
  * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI
  */
 
@@ -24,15 +24,27 @@ extern "C" {
 #include <zephyr/sys/atomic.h>
 #include <zephyr/types.h>
 #include <zephyr/sys_clock.h>
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+#include <zephyr/kernel.h>
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
 
 struct sys_mutex {
-	/* Currently unused, but will be used to store state for fast mutexes
-	 * that can be locked/unlocked with atomic ops if there is no
-	 * contention
+	/* With CONFIG_SYS_MUTEX_FAST_PATH, the owner thread, or 0 if the
+	 * mutex is unlocked, with Z_SYS_MUTEX_WAITERS set while the kernel
+	 * tracks the owner for other threads to wait on it. Unused otherwise.
 	 */
 	atomic_t val;
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	/* Lock count, only accessed by the owner */
+	uint32_t lock_count;
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
 };
 
+/* Thread structures are at least word aligned, leaving the lowest bit of
+ * the owner free.
+ */
+#define Z_SYS_MUTEX_WAITERS ((atomic_val_t)1)
+
 /**
  * @defgroup user_mutex_apis User mode mutex APIs
  * @ingroup usermode_apis
@@ -98,11 +110,40 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  * @retval -EAGAIN Waiting period timed out.
  * @retval -EACCES Caller has no access to provided mutex address
  * @retval -EINVAL Provided mutex not recognized by the kernel
+ *
+ * @note With CONFIG_SYS_MUTEX_FAST_PATH, the mutex is accessed before any
+ * syscall, so that a mutex outside the memory domain of the caller makes
+ * it fault rather than return -EACCES, and a mutex not recognized by the
+ * kernel may make it fault or be corrupted rather than return -EINVAL.
+ * Waiting for the mutex also returns -EINVAL if the caller has no
+ * permission on the thread object of its owner.
  */
 static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	atomic_val_t self = (atomic_val_t)k_current_get();
+	int ret;
+
+	if (atomic_cas(&mutex->val, 0, self)) {
+		mutex->lock_count = 1U;
+		return 0;
+	}
+
+	if ((atomic_get(&mutex->val) & ~Z_SYS_MUTEX_WAITERS) == self) {
+		mutex->lock_count++;
+		return 0;
+	}
+
+	ret = z_sys_mutex_kernel_lock(mutex, timeout);
+	if (ret == 0) {
+		mutex->lock_count = 1U;
+	}
+
+	return ret;
+#else
+	/* Without the fast path, make the syscall unconditionally */
 	return z_sys_mutex_kernel_lock(mutex, timeout);
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
 }
 
 /**
@@ -121,10 +162,31 @@ static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
  * @retval -EINVAL Provided mutex not recognized by the kernel or mutex wasn't
  *                 locked
  * @retval -EPERM Caller does not own the mutex
+ *
+ * @note With CONFIG_SYS_MUTEX_FAST_PATH, the mutex is accessed before any
+ * syscall, so that a mutex outside the memory domain of the caller makes
+ * it fault rather than return -EACCES, and a mutex not recognized by the
+ * kernel may make it fault rather than return -EINVAL.
  */
 static inline int sys_mutex_unlock(struct sys_mutex *mutex)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	atomic_val_t self = (atomic_val_t)k_current_get();
+
+	if ((atomic_get(&mutex->val) & ~Z_SYS_MUTEX_WAITERS) == self) {
+		if (mutex->lock_count > 1U) {
+			mutex->lock_count--;
+			return 0;
+		}
+
+		mutex->lock_count = 0U;
+		if (atomic_cas(&mutex->val, self, 0)) {
+			return 0;
+		}
+	}
+
+	/* Hand the mutex over to a waiting thread, or report the error */
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
 	return z_sys_mutex_kernel_unlock(mutex);
 }
 
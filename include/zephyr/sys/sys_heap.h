@@ -212,6 +212,10 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
  * region of memory until a subsequent sys_heap_free() on the same
  * pointer.
  *
+ * The size is read from the header of the block's own chunk, which other
+ * heap operations do not modify while the block is allocated, so this may
+ * be called concurrently with them.
+ *
  * @param heap Heap containing the block
  * @param mem Pointer to memory allocated from this heap
  * @return Size in bytes of the memory region
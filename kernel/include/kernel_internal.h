@@ -75,6 +75,22 @@ void *z_thread_aligned_alloc(size_t align, size_t size);
  */
 void *z_thread_malloc(size_t size);
 
+typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes);
+
+/**
+ * @brief Allocate memory from a k_heap
+ *
+ * Common implementation of the k_heap allocation APIs and of k_malloc().
+ *
+ * @param heap Heap to allocate from
+ * @param align Alignment passed to @a sys_heap_allocator
+ * @param bytes Memory allocation size
+ * @param timeout How long to wait for memory, K_NO_WAIT from ISRs
+ * @param sys_heap_allocator sys_heap allocation function
+ * @return A pointer to the allocated memory, or NULL on failure
+ */
+void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes,
+			  k_timeout_t timeout, sys_heap_allocator_t *sys_heap_allocator);
 
 #ifdef CONFIG_USE_SWITCH
 /* This is a arch function traditionally, but when the switch-based
@@ -185,6 +201,9 @@ void z_mem_manage_boot_finish(void);
 
 bool z_handle_obj_poll_events(sys_dlist_t *events, uint32_t state);
 
+/* Whether a message can be read from a message queue, for k_poll() */
+bool z_msgq_has_data(struct k_msgq *msgq);
+
 #ifdef CONFIG_PM
 
 /* When the kernel is about to go idle, it calls this function to notify the
@@ -269,6 +288,29 @@ void k_thread_abort_cleanup(struct k_thread *thread);
 void k_thread_abort_cleanup_check_reuse(struct k_thread *thread);
 #endif /* CONFIG_THREAD_ABORT_NEED_CLEANUP */
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+/**
+ * Lock a sys_mutex found locked in user mode.
+ *
+ * @param mutex k_mutex backing the sys_mutex, used to wait for it.
+ * @param word sys_mutex word holding the owner.
+ * @param timeout Waiting period to lock the mutex.
+ *
+ * @return As for k_mutex_lock(), or -EINVAL if the word is invalid.
+ */
+int z_sys_mutex_lock_slow(struct k_mutex *mutex, atomic_t *word, k_timeout_t timeout);
+
+/**
+ * Unlock a sys_mutex that could not be unlocked in user mode.
+ *
+ * @param mutex k_mutex backing the sys_mutex.
+ * @param word sys_mutex word holding the owner.
+ *
+ * @return As for k_mutex_unlock().
+ */
+int z_sys_mutex_unlock_slow(struct k_mutex *mutex, atomic_t *word);
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
+
 #ifdef __cplusplus
 }
 #endif
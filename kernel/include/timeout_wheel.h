@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_KERNEL_INCLUDE_TIMEOUT_WHEEL_H_
+#define ZEPHYR_KERNEL_INCLUDE_TIMEOUT_WHEEL_H_
+
+/**
+ * @file
+ * @brief Hierarchical timing wheel backend of the timeout queue
+ *
+ * Every level of the wheel has 64 slots, a slot of level n spans 64^n
+ * ticks. A timeout is kept at the level of the most significant bit in
+ * which its absolute expiry tick differs from the current tick of the
+ * wheel, in the slot selected by the expiry bits of that level; timeouts
+ * beyond the last level wait in an overflow list. Adding and removing a
+ * timeout is therefore constant time. When the wheel advances into a
+ * slot of a higher level, the timeouts in it are moved down, so every
+ * timeout is moved at most once per level.
+ *
+ * The dticks field of a queued timeout holds its absolute expiry tick.
+ * All functions must be called with the timeout lock held.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define Z_TIMEOUT_WHEEL_SLOT_BITS 6
+#define Z_TIMEOUT_WHEEL_SLOTS     BIT(Z_TIMEOUT_WHEEL_SLOT_BITS)
+
+/* A zero-initialized wheel is empty and ready to use */
+struct z_timeout_wheel {
+	/* Tick the timeouts are placed relative to */
+	uint64_t now;
+	/* Expiry of the first timeout, if first_valid */
+	uint64_t first;
+	bool first_valid;
+	bool has_overflow;
+	/* Bitmap of the slots holding timeouts, per level. Empty slots are
+	 * not initialized.
+	 */
+	uint64_t occupied[CONFIG_TIMEOUT_WHEEL_LEVELS];
+	sys_dlist_t slots[CONFIG_TIMEOUT_WHEEL_LEVELS][Z_TIMEOUT_WHEEL_SLOTS];
+	sys_dlist_t overflow;
+};
+
+/**
+ * @brief Add a timeout to the wheel
+ *
+ * @param wheel  Timing wheel
+ * @param to     Timeout, not queued
+ * @param expiry Absolute expiry tick, not before the current tick of the wheel
+ *
+ * @return true if the timeout may now be the first to expire
+ */
+bool z_timeout_wheel_add(struct z_timeout_wheel *wheel, struct _timeout *to, uint64_t expiry);
+
+/**
+ * @brief Remove a queued timeout from the wheel
+ *
+ * The first expiry is recomputed lazily, the next time it is requested.
+ */
+void z_timeout_wheel_remove(struct z_timeout_wheel *wheel, struct _timeout *to);
+
+/**
+ * @brief Get the absolute expiry tick of the first timeout
+ *
+ * @return Expiry tick, UINT64_MAX if the wheel is empty
+ */
+uint64_t z_timeout_wheel_first(struct z_timeout_wheel *wheel);
+
+/**
+ * @brief Get the first timeout expiring up to a tick
+ *
+ * Advances the wheel to the expiry of that timeout, which stays queued.
+ *
+ * @param wheel Timing wheel
+ * @param limit Absolute tick
+ *
+ * @return The first timeout if it expires up to @p limit, NULL otherwise
+ */
+struct _timeout *z_timeout_wheel_expired(struct z_timeout_wheel *wheel, uint64_t limit);
+
+/**
+ * @brief Advance the current tick of the wheel
+ *
+ * @param wheel Timing wheel
+ * @param tick  New current tick, no timeout may expire before it
+ */
+void z_timeout_wheel_advance(struct z_timeout_wheel *wheel, uint64_t tick);
+
+/**
+ * @brief Move the wheel to a new current tick, keeping the remaining time of
+ *        every queued timeout
+ */
+void z_timeout_wheel_rebase(struct z_timeout_wheel *wheel, uint64_t tick);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_KERNEL_INCLUDE_TIMEOUT_WHEEL_H_ */
@@ -11,6 +11,7 @@
 /* private kernel APIs */
 #include <ksched.h>
 #include <wait_q.h>
+#include <kernel_internal.h>
 
 int k_heap_array_get(struct k_heap **heap)
 {
@@ -23,11 +24,346 @@ int k_heap_array_get(struct k_heap **heap)
 	return num;
 }
 
+#ifdef CONFIG_HEAP_MAGAZINES
+
+#define CACHE_MIN_SHIFT 4
+#define CACHE_MAX_BYTES BIT(CACHE_MIN_SHIFT + CONFIG_HEAP_MAGAZINE_CLASSES - 1)
+#define CACHE_BATCH     (CONFIG_HEAP_MAGAZINE_SIZE / 2)
+
+/* Granularity of the heap chunks, the usable size of a block exceeds the
+ * allocated size by less than this.
+ */
+#define CACHE_SLACK 8U
+
+/*
+ * Every CPU caches the small blocks freed on it, linked through their first
+ * word, in one magazine per power-of-two size class. Only the CPU owning a
+ * cache pushes blocks to its magazines and pops blocks from them, with its
+ * interrupts locked, so the common case takes no lock and touches no cache
+ * line shared with other CPUs. Other CPUs only flush a magazine, by taking
+ * its whole list at once, which makes a concurrent push or pop of the owner
+ * retry. As only the owner pushes, a block popped by the owner cannot be
+ * flushed and pushed back meanwhile. The count of a magazine is only updated
+ * by the owner, and exceeds the length of its list once it was flushed,
+ * until the owner finds it empty.
+ */
+
+static void cache_init(struct k_heap *heap)
+{
+	(void)memset(heap->cpu_caches, 0, sizeof(heap->cpu_caches));
+	atomic_clear(&heap->num_waiters);
+}
+
+/* Called with the interrupts locked */
+static struct z_heap_cpu_cache *cache_get(struct k_heap *heap)
+{
+#ifdef CONFIG_SMP
+	return &heap->cpu_caches[arch_curr_cpu()->id];
+#else
+	return &heap->cpu_caches[0];
+#endif /* CONFIG_SMP */
+}
+
+/* Push a list of blocks to a magazine of the current CPU */
+static void mag_push(struct z_heap_magazine *mag, void *first, void *last, uint16_t count)
+{
+	void *head;
+
+	do {
+		head = atomic_ptr_get(&mag->blocks);
+		*(void **)last = head;
+	} while (!atomic_ptr_cas(&mag->blocks, head, first));
+
+	mag->count += count;
+}
+
+/* Pop a block from a magazine of the current CPU */
+static void *mag_pop(struct z_heap_magazine *mag)
+{
+	void *mem;
+
+	do {
+		mem = atomic_ptr_get(&mag->blocks);
+		if (mem == NULL) {
+			mag->count = 0U;
+			return NULL;
+		}
+	} while (!atomic_ptr_cas(&mag->blocks, mem, *(void **)mem));
+
+	mag->count--;
+
+	return mem;
+}
+
+/* Size class serving allocations of the given size, or -1 */
+static int cache_alloc_class(size_t bytes)
+{
+	if ((bytes == 0U) || (bytes > CACHE_MAX_BYTES)) {
+		return -1;
+	}
+
+	if (bytes <= BIT(CACHE_MIN_SHIFT)) {
+		return 0;
+	}
+
+	return (32 - __builtin_clz((uint32_t)bytes - 1U)) - CACHE_MIN_SHIFT;
+}
+
+/* Size class a block with the given usable size can be cached in, or -1.
+ * Only blocks of the size the caches hand out are taken, so that a cached
+ * block does not retain memory beyond its class.
+ */
+static int cache_free_class(size_t usable)
+{
+	int cls;
+
+	if ((usable < BIT(CACHE_MIN_SHIFT)) || (usable >= (CACHE_MAX_BYTES + CACHE_SLACK))) {
+		return -1;
+	}
+
+	cls = (31 - __builtin_clz((uint32_t)usable)) - CACHE_MIN_SHIFT;
+	if ((usable - BIT(CACHE_MIN_SHIFT + cls)) >= CACHE_SLACK) {
+		return -1;
+	}
+
+	return cls;
+}
+
+/* Free a list of blocks, called with the heap lock held. Returns whether
+ * threads waiting for memory were woken up.
+ */
+static bool free_list_locked(struct k_heap *heap, void *blocks)
+{
+	void *mem;
+
+	if (blocks == NULL) {
+		return false;
+	}
+
+	while (blocks != NULL) {
+		mem = blocks;
+		blocks = *(void **)mem;
+		sys_heap_free(&heap->heap, mem);
+	}
+
+	return IS_ENABLED(CONFIG_MULTITHREADING) && (z_unpend_all(&heap->wait_q) != 0);
+}
+
+static void free_list(struct k_heap *heap, void *blocks)
+{
+	k_spinlock_key_t key;
+
+	if (blocks == NULL) {
+		return;
+	}
+
+	key = k_spin_lock(&heap->lock);
+	if (free_list_locked(heap, blocks)) {
+		z_reschedule(&heap->lock, key);
+	} else {
+		k_spin_unlock(&heap->lock, key);
+	}
+}
+
+/* Refill an empty magazine of the current CPU with a batch of blocks from
+ * the heap
+ */
+static void *cache_refill(struct k_heap *heap, int cls)
+{
+	size_t bytes = BIT(CACHE_MIN_SHIFT + cls);
+	void *blocks = NULL;
+	void *last = NULL;
+	uint16_t count = 0U;
+	k_spinlock_key_t key;
+	int batch;
+	void *mem = NULL;
+
+	key = k_spin_lock(&heap->lock);
+
+	/* The caches must not take memory threads are waiting for */
+	batch = (atomic_get(&heap->num_waiters) != 0) ? 1 : CACHE_BATCH;
+
+	for (int i = 0; i < batch; i++) {
+		mem = sys_heap_alloc(&heap->heap, bytes);
+		if (mem == NULL) {
+			break;
+		}
+
+		*(void **)mem = blocks;
+		blocks = mem;
+		if (last == NULL) {
+			last = mem;
+		}
+		count++;
+	}
+
+	if (blocks != NULL) {
+		mem = blocks;
+		blocks = *(void **)mem;
+		count--;
+	}
+
+	/* Cached before releasing the heap lock, so that a thread failing
+	 * to allocate meanwhile finds them when flushing the caches. The
+	 * lock keeps the interrupts locked.
+	 */
+	if (blocks != NULL) {
+		mag_push(&cache_get(heap)->mags[cls], blocks, last, count);
+	}
+
+	k_spin_unlock(&heap->lock, key);
+
+	return mem;
+}
+
+static void *cache_alloc(struct k_heap *heap, size_t align, size_t bytes)
+{
+	unsigned int key;
+	void *mem;
+	int cls;
+
+	/* Cached blocks are only guaranteed to be aligned on a pointer */
+	if (((align & (align - 1U)) != 0U) || (align > sizeof(void *))) {
+		return NULL;
+	}
+
+	cls = cache_alloc_class(bytes);
+	if (cls < 0) {
+		return NULL;
+	}
+
+	key = arch_irq_lock();
+	mem = mag_pop(&cache_get(heap)->mags[cls]);
+	arch_irq_unlock(key);
+
+	if (mem == NULL) {
+		mem = cache_refill(heap, cls);
+	}
+
+	return mem;
+}
+
+static bool cache_free(struct k_heap *heap, void *mem)
+{
+	struct z_heap_magazine *mag;
+	void *blocks = NULL;
+	unsigned int key;
+	int cls;
+
+	if ((mem == NULL) || (((uintptr_t)mem & (sizeof(void *) - 1U)) != 0U)) {
+		return false;
+	}
+
+	/* The size is recorded in the header of the block's own chunk at
+	 * allocation, and only changes when the block is freed, so it is
+	 * read without the heap lock.
+	 */
+	cls = cache_free_class(sys_heap_usable_size(&heap->heap, mem));
+	if (cls < 0) {
+		return false;
+	}
+
+	key = arch_irq_lock();
+	mag = &cache_get(heap)->mags[cls];
+	mag_push(mag, mem, mem, 1U);
+
+	/* Checked after the push, so that a thread about to wait for memory
+	 * either sees the block when flushing the caches, or is seen here.
+	 */
+	if (atomic_get(&heap->num_waiters) != 0) {
+		blocks = atomic_ptr_set(&mag->blocks, NULL);
+		mag->count = 0U;
+	} else if (mag->count > CONFIG_HEAP_MAGAZINE_SIZE) {
+		/* Return all the blocks beyond the first batch to the heap */
+		void *last = atomic_ptr_set(&mag->blocks, NULL);
+		void *first = last;
+		uint16_t count = 1U;
+
+		while ((last != NULL) && (count < CACHE_BATCH) && (*(void **)last != NULL)) {
+			last = *(void **)last;
+			count++;
+		}
+
+		mag->count = 0U;
+		if (last != NULL) {
+			blocks = *(void **)last;
+			mag_push(mag, first, last, count);
+		}
+	}
+
+	arch_irq_unlock(key);
+
+	free_list(heap, blocks);
+
+	return true;
+}
+
+/* Return the blocks of all caches to the heap, called with the heap lock
+ * held, which is released meanwhile. Returns whether threads waiting for
+ * memory were woken up.
+ */
+static bool cache_flush_locked(struct k_heap *heap, k_spinlock_key_t *key)
+{
+	void *blocks = NULL;
+
+	k_spin_unlock(&heap->lock, *key);
+
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		struct z_heap_cpu_cache *cache = &heap->cpu_caches[cpu];
+
+		for (int cls = 0; cls < CONFIG_HEAP_MAGAZINE_CLASSES; cls++) {
+			void *first = atomic_ptr_set(&cache->mags[cls].blocks, NULL);
+			void *last = first;
+
+			if (first == NULL) {
+				continue;
+			}
+
+			while (*(void **)last != NULL) {
+				last = *(void **)last;
+			}
+			*(void **)last = blocks;
+			blocks = first;
+		}
+	}
+
+	*key = k_spin_lock(&heap->lock);
+
+	return free_list_locked(heap, blocks);
+}
+
+#else
+
+static inline void cache_init(struct k_heap *heap)
+{
+	ARG_UNUSED(heap);
+}
+
+static inline void *cache_alloc(struct k_heap *heap, size_t align, size_t bytes)
+{
+	ARG_UNUSED(heap);
+	ARG_UNUSED(align);
+	ARG_UNUSED(bytes);
+
+	return NULL;
+}
+
+static inline bool cache_free(struct k_heap *heap, void *mem)
+{
+	ARG_UNUSED(heap);
+	ARG_UNUSED(mem);
+
+	return false;
+}
+
+#endif /* CONFIG_HEAP_MAGAZINES */
+
 void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 {
 	z_waitq_init(&heap->wait_q);
 	heap->lock = (struct k_spinlock) {};
 	sys_heap_init(&heap->heap, mem, bytes);
+	cache_init(heap);
 
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
 }
@@ -74,24 +410,47 @@ SYS_INIT_NAMED(statics_init_pre, statics_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_
 SYS_INIT_NAMED(statics_init_post, statics_init, POST_KERNEL, 0);
 #endif /* CONFIG_DEMAND_PAGING && !CONFIG_LINKER_GENERIC_SECTIONS_PRESENT_AT_BOOT */
 
-typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes);
-
-static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes,
-				 k_timeout_t timeout,
-				 sys_heap_allocator_t *sys_heap_allocator)
+void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes,
+			  k_timeout_t timeout,
+			  sys_heap_allocator_t *sys_heap_allocator)
 {
 	k_timepoint_t end = sys_timepoint_calc(timeout);
-	void *ret = NULL;
-
-	k_spinlock_key_t key = k_spin_lock(&heap->lock);
+	void *ret;
 
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
 
+	ret = cache_alloc(heap, align, bytes);
+	if (ret != NULL) {
+		return ret;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&heap->lock);
+
 	bool blocked_alloc = false;
+#ifdef CONFIG_HEAP_MAGAZINES
+	bool flushed = false;
+	bool woken = false;
+	bool waiting = IS_ENABLED(CONFIG_MULTITHREADING) && !K_TIMEOUT_EQ(timeout, K_NO_WAIT);
+#endif /* CONFIG_HEAP_MAGAZINES */
 
 	while (ret == NULL) {
 		ret = sys_heap_allocator(&heap->heap, align, bytes);
 
+#ifdef CONFIG_HEAP_MAGAZINES
+		if ((ret == NULL) && !flushed) {
+			/* Retry with the cached blocks back in the heap, and
+			 * keep the blocks freed from now on out of the caches
+			 * if we may have to wait for them.
+			 */
+			if (waiting) {
+				atomic_inc(&heap->num_waiters);
+			}
+			woken = cache_flush_locked(heap, &key);
+			flushed = true;
+			continue;
+		}
+#endif /* CONFIG_HEAP_MAGAZINES */
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -112,6 +471,17 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 		key = k_spin_lock(&heap->lock);
 	}
 
+#ifdef CONFIG_HEAP_MAGAZINES
+	if (flushed && waiting) {
+		atomic_dec(&heap->num_waiters);
+	}
+
+	if (woken) {
+		z_reschedule(&heap->lock, key);
+		return ret;
+	}
+#endif /* CONFIG_HEAP_MAGAZINES */
+
 	k_spin_unlock(&heap->lock, key);
 	return ret;
 }
@@ -205,6 +575,11 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
+	if (cache_free(heap, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+		return;
+	}
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	sys_heap_free(&heap->heap, mem);
@@ -33,6 +33,7 @@ static int k_mem_slab_stats_raw(struct k_obj_core *obj_core, void *stats)
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
 	memcpy(stats, &slab->info, sizeof(slab->info));
+	((struct k_mem_slab_info *)stats)->num_used = k_mem_slab_num_used_get(slab);
 	k_spin_unlock(&slab->lock, key);
 
 	return 0;
@@ -48,9 +49,8 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
-	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			  slab->info.block_size;
-	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
+	ptr->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
+	ptr->allocated_bytes = k_mem_slab_num_used_get(slab) * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	ptr->max_allocated_bytes = slab->info.max_used * slab->info.block_size;
 #else
@@ -72,7 +72,7 @@ static int k_mem_slab_stats_reset(struct k_obj_core *obj_core)
 	key = k_spin_lock(&slab->lock);
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-	slab->info.max_used = slab->info.num_used;
+	slab->info.max_used = k_mem_slab_num_used_get(slab);
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
 	k_spin_unlock(&slab->lock, key);
@@ -92,6 +92,309 @@ static struct k_obj_core_stats_desc mem_slab_stats_desc = {
 #endif /* CONFIG_OBJ_CORE_STATS_MEM_SLAB */
 #endif /* CONFIG_OBJ_CORE_MEM_SLAB */
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+
+#define CACHE_BATCH (CONFIG_MEM_SLAB_CPU_CACHE_SIZE / 2)
+
+/*
+ * Every CPU caches the blocks freed on it, linked like the free list of the
+ * slab. Only the CPU owning a cache pushes blocks to it and pops blocks from
+ * it, with its interrupts locked, so the common case takes no lock and does
+ * not touch the shared free list. Other CPUs only flush a cache, by taking
+ * its whole list at once, which makes a concurrent push or pop of the owner
+ * retry. As only the owner pushes, a block popped by the owner cannot be
+ * flushed and pushed back meanwhile. The count of a cache is only updated by
+ * the owner, and exceeds the length of its list once it was flushed, until
+ * the owner finds it empty.
+ *
+ * Cached blocks are not counted as used. The blocks a CPU allocates from
+ * its cache, less the ones freed to it, are counted by the cache instead of
+ * the slab info, which the caches do not share.
+ */
+
+static void cache_init(struct k_mem_slab *slab)
+{
+	(void)memset(slab->cpu_caches, 0, sizeof(slab->cpu_caches));
+	atomic_clear(&slab->num_waiters);
+}
+
+/* Called with the interrupts locked */
+static struct z_mem_slab_cpu_cache *cache_get(struct k_mem_slab *slab)
+{
+	return &slab->cpu_caches[arch_curr_cpu()->id];
+}
+
+/* Push a list of blocks to the cache of the current CPU */
+static void cache_push(struct z_mem_slab_cpu_cache *cache, char *first, char *last,
+		       uint32_t count)
+{
+	void *head;
+
+	do {
+		head = atomic_ptr_get(&cache->free_list);
+		*(char **)last = head;
+	} while (!atomic_ptr_cas(&cache->free_list, head, first));
+
+	cache->count += count;
+}
+
+/* Pop a block from the cache of the current CPU */
+static char *cache_pop(struct z_mem_slab_cpu_cache *cache)
+{
+	char *mem;
+
+	do {
+		mem = atomic_ptr_get(&cache->free_list);
+		if (mem == NULL) {
+			cache->count = 0U;
+			return NULL;
+		}
+	} while (!atomic_ptr_cas(&cache->free_list, mem, *(char **)mem));
+
+	cache->count--;
+
+	return mem;
+}
+
+/* Give free blocks to the threads waiting for one, called with the slab
+ * lock held. Returns whether any was woken up.
+ */
+static bool unpend_locked(struct k_mem_slab *slab)
+{
+	struct k_thread *pending_thread;
+	bool woken = false;
+
+	while (slab->free_list != NULL) {
+		pending_thread = z_unpend_first_thread(&slab->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		z_thread_return_value_set_with_data(pending_thread, 0, slab->free_list);
+		slab->free_list = *(char **)(slab->free_list);
+		slab->info.num_used++;
+		z_ready_thread(pending_thread);
+		woken = true;
+	}
+
+	return woken;
+}
+
+/* Return a list of cached blocks to the slab */
+static void free_list(struct k_mem_slab *slab, char *first)
+{
+	k_spinlock_key_t key;
+	char *last = first;
+
+	if (first == NULL) {
+		return;
+	}
+
+	while (*(char **)last != NULL) {
+		last = *(char **)last;
+	}
+
+	key = k_spin_lock(&slab->lock);
+	*(char **)last = slab->free_list;
+	slab->free_list = first;
+
+	/* A thread may have started waiting since these were detached */
+	if (unpend_locked(slab)) {
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
+}
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+/* Only takes the slab lock when the usage exceeds the maximum so far */
+static void cache_max_used_update(struct k_mem_slab *slab)
+{
+	k_spinlock_key_t key;
+
+	if (k_mem_slab_num_used_get(slab) <= slab->info.max_used) {
+		return;
+	}
+
+	key = k_spin_lock(&slab->lock);
+	slab->info.max_used = max(k_mem_slab_num_used_get(slab), slab->info.max_used);
+	k_spin_unlock(&slab->lock, key);
+}
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+
+/* Take a batch of blocks from the slab, return one and cache the others */
+static void *cache_refill(struct k_mem_slab *slab)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	char *mem = slab->free_list;
+	char *last = mem;
+	uint32_t count;
+	uint32_t batch;
+
+	if (mem == NULL) {
+		k_spin_unlock(&slab->lock, key);
+		return NULL;
+	}
+
+	/* The caches must not take blocks threads are waiting for */
+	batch = (atomic_get(&slab->num_waiters) != 0) ? 1 : (CACHE_BATCH + 1);
+
+	for (count = 1U; count < batch; count++) {
+		if (*(char **)last == NULL) {
+			break;
+		}
+		last = *(char **)last;
+	}
+
+	slab->free_list = *(char **)last;
+	slab->info.num_used++;
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	slab->info.max_used = max(k_mem_slab_num_used_get(slab), slab->info.max_used);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+
+	/* Cached before releasing the slab lock, so that a thread finding
+	 * no free block meanwhile gets them when flushing the caches. The
+	 * lock keeps the interrupts locked.
+	 */
+	if (count > 1U) {
+		cache_push(cache_get(slab), *(char **)mem, last, count - 1U);
+	}
+
+	k_spin_unlock(&slab->lock, key);
+
+	return mem;
+}
+
+static void *cache_alloc(struct k_mem_slab *slab)
+{
+	struct z_mem_slab_cpu_cache *cache;
+	unsigned int key = arch_irq_lock();
+	char *mem;
+
+	cache = cache_get(slab);
+	mem = cache_pop(cache);
+	if (mem != NULL) {
+		cache->num_used++;
+	}
+
+	arch_irq_unlock(key);
+
+	if (mem == NULL) {
+		return cache_refill(slab);
+	}
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	cache_max_used_update(slab);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+
+	return mem;
+}
+
+static bool cache_free(struct k_mem_slab *slab, void *mem)
+{
+	struct z_mem_slab_cpu_cache *cache;
+	unsigned int key = arch_irq_lock();
+	char *blocks = NULL;
+
+	cache = cache_get(slab);
+	cache_push(cache, mem, mem, 1U);
+	cache->num_used--;
+
+	/* Checked after the push, so that a thread about to wait for a block
+	 * either gets this one when flushing the caches, or is seen here.
+	 */
+	if (atomic_get(&slab->num_waiters) != 0) {
+		blocks = atomic_ptr_set(&cache->free_list, NULL);
+		cache->count = 0U;
+	} else if (cache->count > CONFIG_MEM_SLAB_CPU_CACHE_SIZE) {
+		/* Return all the blocks beyond the first batch to the slab */
+		char *last = atomic_ptr_set(&cache->free_list, NULL);
+		char *first = last;
+		uint32_t count = 1U;
+
+		while ((last != NULL) && (count < CACHE_BATCH) && (*(char **)last != NULL)) {
+			last = *(char **)last;
+			count++;
+		}
+
+		cache->count = 0U;
+		if (last != NULL) {
+			blocks = *(char **)last;
+			cache_push(cache, first, last, count);
+		}
+	}
+
+	arch_irq_unlock(key);
+
+	free_list(slab, blocks);
+
+	return true;
+}
+
+/* Return the blocks of all caches to the slab, called with the slab lock
+ * held, which is released meanwhile. Returns whether threads waiting for a
+ * block were given one.
+ */
+static bool cache_flush_locked(struct k_mem_slab *slab, k_spinlock_key_t *key)
+{
+	char *first = NULL;
+	char *last = NULL;
+
+	k_spin_unlock(&slab->lock, *key);
+
+	for (unsigned int cpu = 0; cpu < CONFIG_MP_MAX_NUM_CPUS; cpu++) {
+		char *blocks = atomic_ptr_set(&slab->cpu_caches[cpu].free_list, NULL);
+		char *end = blocks;
+
+		if (blocks == NULL) {
+			continue;
+		}
+
+		while (*(char **)end != NULL) {
+			end = *(char **)end;
+		}
+		*(char **)end = first;
+		first = blocks;
+		if (last == NULL) {
+			last = end;
+		}
+	}
+
+	*key = k_spin_lock(&slab->lock);
+
+	if (first != NULL) {
+		*(char **)last = slab->free_list;
+		slab->free_list = first;
+	}
+
+	/* Serve the threads that were already waiting first */
+	return unpend_locked(slab);
+}
+
+#else
+
+static inline void cache_init(struct k_mem_slab *slab)
+{
+	ARG_UNUSED(slab);
+}
+
+static inline void *cache_alloc(struct k_mem_slab *slab)
+{
+	ARG_UNUSED(slab);
+
+	return NULL;
+}
+
+static inline bool cache_free(struct k_mem_slab *slab, void *mem)
+{
+	ARG_UNUSED(slab);
+	ARG_UNUSED(mem);
+
+	return false;
+}
+
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 /**
  * @brief Initialize kernel memory slab subsystem.
  *
@@ -179,6 +482,7 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->buffer = buffer;
 	slab->info.num_used = 0U;
 	slab->lock = (struct k_spinlock) {};
+	cache_init(slab);
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	slab->info.max_used = 0U;
@@ -221,23 +525,49 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
+	*mem = cache_alloc(slab);
+	if (*mem != NULL) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+
+		return 0;
+	}
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 	int result;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	bool waiting = false;
+	bool woken = false;
+
+	if (slab->free_list == NULL) {
+		/* Retry with the cached blocks back in the slab, and keep the
+		 * blocks freed from now on out of the caches if we may have
+		 * to wait for them.
+		 */
+		waiting = IS_ENABLED(CONFIG_MULTITHREADING) && !K_TIMEOUT_EQ(timeout, K_NO_WAIT);
+		if (waiting) {
+			atomic_inc(&slab->num_waiters);
+		}
+		woken = cache_flush_locked(slab, &key);
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	if (slab->free_list != NULL) {
 		/* take a free block */
 		*mem = slab->free_list;
 		slab->free_list = *(char **)(slab->free_list);
 		slab->info.num_used++;
 		__ASSERT((slab->free_list == NULL &&
-			  slab->info.num_used == slab->info.num_blocks) ||
+			  (IS_ENABLED(CONFIG_MEM_SLAB_CPU_CACHE) ||
+			   slab->info.num_used == slab->info.num_blocks)) ||
 			 slab_ptr_is_good(slab, slab->free_list),
 			 "slab corruption detected");
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-		slab->info.max_used = max(slab->info.num_used,
+		slab->info.max_used = max(k_mem_slab_num_used_get(slab),
 					  slab->info.max_used);
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
 
@@ -256,6 +586,12 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 			*mem = _current->base.swap_data;
 		}
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+		if (waiting) {
+			atomic_dec(&slab->num_waiters);
+		}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 		return result;
@@ -263,6 +599,17 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (waiting) {
+		atomic_dec(&slab->num_waiters);
+	}
+
+	if (woken) {
+		z_reschedule(&slab->lock, key);
+		return result;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	k_spin_unlock(&slab->lock, key);
 
 	return result;
@@ -276,6 +623,12 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 		return;
 	}
 
+	if (cache_free(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+		return;
+	}
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
@@ -308,9 +661,8 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
-	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			    slab->info.block_size;
+	stats->allocated_bytes = k_mem_slab_num_used_get(slab) * slab->info.block_size;
+	stats->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->info.max_used *
 				     slab->info.block_size;
@@ -332,7 +684,7 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	slab->info.max_used = slab->info.num_used;
+	slab->info.max_used = k_mem_slab_num_used_get(slab);
 
 	k_spin_unlock(&slab->lock, key);
 
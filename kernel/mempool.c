@@ -8,8 +8,7 @@
 #include <string.h>
 #include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/util.h>
-
-typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes);
+#include <kernel_internal.h>
 
 static void *z_alloc_helper(struct k_heap *heap, size_t align, size_t size,
 			    sys_heap_allocator_t sys_heap_allocator)
@@ -17,7 +16,6 @@ static void *z_alloc_helper(struct k_heap *heap, size_t align, size_t size,
 	void *mem;
 	struct k_heap **heap_ref;
 	size_t __align;
-	k_spinlock_key_t key;
 
 	/* A power of 2 as well as 0 is OK */
 	__ASSERT((align & (align - 1)) == 0,
@@ -36,11 +34,9 @@ static void *z_alloc_helper(struct k_heap *heap, size_t align, size_t size,
 
 	/*
 	 * No point calling k_heap_malloc/k_heap_aligned_alloc with K_NO_WAIT.
-	 * Better bypass them and go directly to sys_heap_*() instead.
+	 * Better bypass them and go directly to their helper instead.
 	 */
-	key = k_spin_lock(&heap->lock);
-	mem = sys_heap_allocator(&heap->heap, __align, size);
-	k_spin_unlock(&heap->lock, key);
+	mem = z_heap_alloc_helper(heap, __align, size, K_NO_WAIT, sys_heap_allocator);
 
 	if (mem == NULL) {
 		return NULL;
@@ -55,9 +51,142 @@ static void *z_alloc_helper(struct k_heap *heap, size_t align, size_t size,
 	return mem;
 }
 
+#if defined(CONFIG_HEAP_MEM_POOL_SLABS)
+#define MALLOC_SLAB_BLOCKS                                                                         \
+	(CONFIG_HEAP_MEM_POOL_SLAB_16 + CONFIG_HEAP_MEM_POOL_SLAB_32 +                             \
+	 CONFIG_HEAP_MEM_POOL_SLAB_64 + CONFIG_HEAP_MEM_POOL_SLAB_128 +                            \
+	 CONFIG_HEAP_MEM_POOL_SLAB_256)
+#else
+#define MALLOC_SLAB_BLOCKS 0
+#endif
+
+#if (MALLOC_SLAB_BLOCKS > 0) && (K_HEAP_MEM_POOL_SIZE > 0)
+
+/* Every slab is aligned on its block size, so that its blocks can serve
+ * aligned allocations up to that size.
+ */
+#define MALLOC_SLAB_DEFINE(size)                                                                   \
+	K_MEM_SLAB_DEFINE_STATIC(malloc_slab_##size, size, CONFIG_HEAP_MEM_POOL_SLAB_##size, size)
+
+#if CONFIG_HEAP_MEM_POOL_SLAB_16 > 0
+MALLOC_SLAB_DEFINE(16);
+#endif
+#if CONFIG_HEAP_MEM_POOL_SLAB_32 > 0
+MALLOC_SLAB_DEFINE(32);
+#endif
+#if CONFIG_HEAP_MEM_POOL_SLAB_64 > 0
+MALLOC_SLAB_DEFINE(64);
+#endif
+#if CONFIG_HEAP_MEM_POOL_SLAB_128 > 0
+MALLOC_SLAB_DEFINE(128);
+#endif
+#if CONFIG_HEAP_MEM_POOL_SLAB_256 > 0
+MALLOC_SLAB_DEFINE(256);
+#endif
+
+/* By increasing block size */
+static struct k_mem_slab *const malloc_slabs[] = {
+#if CONFIG_HEAP_MEM_POOL_SLAB_16 > 0
+	&malloc_slab_16,
+#endif
+#if CONFIG_HEAP_MEM_POOL_SLAB_32 > 0
+	&malloc_slab_32,
+#endif
+#if CONFIG_HEAP_MEM_POOL_SLAB_64 > 0
+	&malloc_slab_64,
+#endif
+#if CONFIG_HEAP_MEM_POOL_SLAB_128 > 0
+	&malloc_slab_128,
+#endif
+#if CONFIG_HEAP_MEM_POOL_SLAB_256 > 0
+	&malloc_slab_256,
+#endif
+};
+
+int k_malloc_slab_array_get(struct k_mem_slab *const **slabs)
+{
+	*slabs = malloc_slabs;
+
+	return ARRAY_SIZE(malloc_slabs);
+}
+
+static void *malloc_slab_alloc(size_t align, size_t size)
+{
+	void *mem;
+
+	/* Smallest class that fits first, then the larger ones if it is full */
+	ARRAY_FOR_EACH(malloc_slabs, i) {
+		struct k_mem_slab *slab = malloc_slabs[i];
+
+		if ((size > slab->info.block_size) || (align > slab->info.block_size)) {
+			continue;
+		}
+
+		if (k_mem_slab_alloc(slab, &mem, K_NO_WAIT) == 0) {
+			return mem;
+		}
+	}
+
+	return NULL;
+}
+
+/* The slab a block was allocated from, or NULL for heap blocks */
+static struct k_mem_slab *malloc_slab_find(void *ptr)
+{
+	uintptr_t addr = (uintptr_t)ptr;
+
+	ARRAY_FOR_EACH(malloc_slabs, i) {
+		struct k_mem_slab *slab = malloc_slabs[i];
+		uintptr_t start = (uintptr_t)slab->buffer;
+
+		if ((addr >= start) &&
+		    (addr < (start + (slab->info.num_blocks * slab->info.block_size)))) {
+			return slab;
+		}
+	}
+
+	return NULL;
+}
+
+#else
+
+#if defined(CONFIG_HEAP_MEM_POOL_SLABS)
+/* All the classes are empty, or there is no heap to fall back to */
+int k_malloc_slab_array_get(struct k_mem_slab *const **slabs)
+{
+	*slabs = NULL;
+
+	return 0;
+}
+#endif /* CONFIG_HEAP_MEM_POOL_SLABS */
+
+static inline void *malloc_slab_alloc(size_t align, size_t size)
+{
+	ARG_UNUSED(align);
+	ARG_UNUSED(size);
+
+	return NULL;
+}
+
+static inline struct k_mem_slab *malloc_slab_find(void *ptr)
+{
+	ARG_UNUSED(ptr);
+
+	return NULL;
+}
+
+#endif /* MALLOC_SLAB_BLOCKS > 0 && K_HEAP_MEM_POOL_SIZE > 0 */
+
 void k_free(void *ptr)
 {
 	struct k_heap **heap_ref;
+	struct k_mem_slab *slab;
+
+	slab = malloc_slab_find(ptr);
+	if (slab != NULL) {
+		k_mem_slab_free(slab, ptr);
+		return;
+	}
 
 	if (ptr != NULL) {
 		heap_ref = ptr;
@@ -81,7 +210,11 @@ void *k_aligned_alloc(size_t align, size_t size)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_aligned_alloc, _SYSTEM_HEAP);
 
-	void *ret = z_alloc_helper(_SYSTEM_HEAP, align, size, sys_heap_aligned_alloc);
+	void *ret = malloc_slab_alloc(align, size);
+
+	if (ret == NULL) {
+		ret = z_alloc_helper(_SYSTEM_HEAP, align, size, sys_heap_aligned_alloc);
+	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_aligned_alloc, _SYSTEM_HEAP, ret);
 
@@ -92,7 +225,11 @@ void *k_malloc(size_t size)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap_sys, k_malloc, _SYSTEM_HEAP);
 
-	void *ret = z_alloc_helper(_SYSTEM_HEAP, 0, size, sys_heap_noalign_alloc);
+	void *ret = malloc_slab_alloc(0, size);
+
+	if (ret == NULL) {
+		ret = z_alloc_helper(_SYSTEM_HEAP, 0, size, sys_heap_noalign_alloc);
+	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap_sys, k_malloc, _SYSTEM_HEAP, ret);
 
@@ -125,6 +262,7 @@ void *k_calloc(size_t nmemb, size_t size)
 void *k_realloc(void *ptr, size_t size)
 {
 	struct k_heap *heap, **heap_ref;
+	struct k_mem_slab *slab;
 	k_spinlock_key_t key;
 	void *ret;
 
@@ -135,6 +273,23 @@ void *k_realloc(void *ptr, size_t size)
 	if (ptr == NULL) {
 		return k_malloc(size);
 	}
+
+	slab = malloc_slab_find(ptr);
+	if (slab != NULL) {
+		/* Slab blocks cannot grow, move to a larger class or the heap */
+		if (size <= slab->info.block_size) {
+			return ptr;
+		}
+
+		ret = k_malloc(size);
+		if (ret != NULL) {
+			(void)memcpy(ret, ptr, slab->info.block_size);
+			k_mem_slab_free(slab, ptr);
+		}
+
+		return ret;
+	}
+
 	heap_ref = ptr;
 	ptr = --heap_ref;
 	heap = *heap_ref;
@@ -202,3 +357,55 @@ void *z_thread_malloc(size_t size)
 {
 	return z_thread_alloc_helper(0, size, sys_heap_noalign_alloc);
 }
+
+#if defined(CONFIG_HEAP_MEM_POOL_SLABS) && defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
+static bool is_malloc_heap(struct sys_heap *heap)
+{
+#if (MALLOC_SLAB_BLOCKS > 0) && (K_HEAP_MEM_POOL_SIZE > 0)
+	return heap == &_system_heap.heap;
+#else
+	ARG_UNUSED(heap);
+
+	return false;
+#endif
+}
+
+void z_malloc_slab_runtime_stats_add(struct sys_heap *heap, struct sys_memory_stats *stats)
+{
+	struct k_mem_slab *const *slabs;
+	struct sys_memory_stats slab_stats;
+	int num = k_malloc_slab_array_get(&slabs);
+
+	if (!is_malloc_heap(heap)) {
+		return;
+	}
+
+	/* The sum of the maxima of the heap and of the slabs, which may not
+	 * all have been reached at the same time.
+	 */
+	for (int i = 0; i < num; i++) {
+		(void)k_mem_slab_runtime_stats_get(slabs[i], &slab_stats);
+		stats->free_bytes += slab_stats.free_bytes;
+		stats->allocated_bytes += slab_stats.allocated_bytes;
+		stats->max_allocated_bytes += slab_stats.max_allocated_bytes;
+	}
+}
+
+void z_malloc_slab_runtime_stats_reset_max(struct sys_heap *heap)
+{
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	struct k_mem_slab *const *slabs;
+	int num = k_malloc_slab_array_get(&slabs);
+
+	if (!is_malloc_heap(heap)) {
+		return;
+	}
+
+	for (int i = 0; i < num; i++) {
+		(void)k_mem_slab_runtime_stats_reset_max(slabs[i]);
+	}
+#else
+	ARG_UNUSED(heap);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+}
+#endif /* CONFIG_HEAP_MEM_POOL_SLABS && CONFIG_SYS_HEAP_RUNTIME_STATS */
@@ -29,6 +29,91 @@
 static struct k_obj_type obj_type_msgq;
 #endif /* CONFIG_OBJ_CORE_MSGQ */
 
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+static int k_msgq_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_msgq *msgq = CONTAINER_OF(obj_core, struct k_msgq, obj_core);
+
+	K_SPINLOCK(&msgq->lock) {
+		memcpy(stats, &msgq->contention, sizeof(msgq->contention));
+	}
+
+	return 0;
+}
+
+static int k_msgq_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_msgq *msgq = CONTAINER_OF(obj_core, struct k_msgq, obj_core);
+
+	K_SPINLOCK(&msgq->lock) {
+		memset(&msgq->contention, 0, sizeof(msgq->contention));
+	}
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc msgq_stats_desc = {
+	.raw_size = sizeof(struct k_obj_contention_stats),
+	.query_size = sizeof(struct k_obj_contention_stats),
+	.raw   = k_msgq_stats_raw,
+	.query = k_msgq_stats_raw,
+	.reset = k_msgq_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+
+/* Called with the message queue locked; the queue is contended when it is
+ * full for a put or empty for a get.
+ */
+static inline void stats_access(struct k_msgq *msgq, bool contended)
+{
+	if (contended) {
+		msgq->contention.contended++;
+	} else {
+		msgq->contention.acquisitions++;
+	}
+}
+
+static inline uint32_t stats_now(void)
+{
+	return k_cycle_get_32();
+}
+
+static void stats_waited(struct k_msgq *msgq, uint32_t start, int result)
+{
+	uint32_t cycles = k_cycle_get_32() - start;
+
+	K_SPINLOCK(&msgq->lock) {
+		z_contention_wait_add(&msgq->contention, cycles);
+		if (result >= 0) {
+			msgq->contention.acquisitions++;
+		}
+	}
+}
+#else
+static inline void stats_access(struct k_msgq *msgq, bool contended)
+{
+	ARG_UNUSED(msgq);
+	ARG_UNUSED(contended);
+}
+
+static inline uint32_t stats_now(void)
+{
+	return 0;
+}
+
+static inline void stats_waited(struct k_msgq *msgq, uint32_t start, int result)
+{
+	ARG_UNUSED(msgq);
+	ARG_UNUSED(start);
+	ARG_UNUSED(result);
+}
+#endif /* CONFIG_OBJ_CORE_STATS_MSGQ */
+
 static inline bool handle_poll_events(struct k_msgq *msgq)
 {
 #ifdef CONFIG_POLL
@@ -40,6 +125,13 @@ static inline bool handle_poll_events(struct k_msgq *msgq)
 #endif /* CONFIG_POLL */
 }
 
+#ifdef CONFIG_MSGQ_MPSC
+static inline bool is_mpsc(struct k_msgq *msgq)
+{
+	return (msgq->flags & K_MSGQ_FLAG_MPSC) != 0U;
+}
+#endif /* CONFIG_MSGQ_MPSC */
+
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs)
 {
@@ -61,6 +153,12 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 	k_obj_core_init_and_link(K_OBJ_CORE(msgq), &obj_type_msgq);
 #endif /* CONFIG_OBJ_CORE_MSGQ */
 
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+	memset(&msgq->contention, 0, sizeof(msgq->contention));
+	k_obj_core_stats_register(K_OBJ_CORE(msgq), &msgq->contention,
+				  sizeof(msgq->contention));
+#endif /* CONFIG_OBJ_CORE_STATS_MSGQ */
+
 	SYS_PORT_TRACING_OBJ_INIT(k_msgq, msgq);
 
 	k_object_init(msgq);
@@ -113,6 +211,13 @@ int k_msgq_cleanup(struct k_msgq *msgq)
 		goto exit;
 	}
 
+#ifdef CONFIG_MSGQ_MPSC
+	CHECKIF(is_mpsc(msgq) && (z_waitq_head(&msgq->put_wait_q) != NULL)) {
+		ret = -EBUSY;
+		goto exit;
+	}
+#endif /* CONFIG_MSGQ_MPSC */
+
 	if ((msgq->flags & K_MSGQ_FLAG_ALLOC) != 0U) {
 		k_free(msgq->buffer_start);
 		msgq->flags &= ~K_MSGQ_FLAG_ALLOC;
@@ -123,6 +228,329 @@ exit:
 	return ret;
 }
 
+static inline uint32_t num_free_msgs(struct k_msgq *msgq)
+{
+	return msgq->max_msgs - msgq->used_msgs;
+}
+
+/* Copy messages to the back of the ring buffer, called with the lock held */
+static void write_msgs(struct k_msgq *msgq, const char *data, uint32_t num_msgs)
+{
+	size_t len = num_msgs * msgq->msg_size;
+	size_t bytes_to_end = msgq->buffer_end - msgq->write_ptr;
+
+	if (len < bytes_to_end) {
+		(void)memcpy(msgq->write_ptr, data, len);
+		msgq->write_ptr += len;
+	} else {
+		/* wrap-around is required */
+		(void)memcpy(msgq->write_ptr, data, bytes_to_end);
+		(void)memcpy(msgq->buffer_start, data + bytes_to_end, len - bytes_to_end);
+		msgq->write_ptr = msgq->buffer_start + (len - bytes_to_end);
+	}
+}
+
+/* Copy messages from the front of the ring buffer, called with the lock held */
+static void read_msgs(struct k_msgq *msgq, char *data, uint32_t num_msgs)
+{
+	size_t len = num_msgs * msgq->msg_size;
+	size_t bytes_to_end = msgq->buffer_end - msgq->read_ptr;
+
+	if (len < bytes_to_end) {
+		(void)memcpy(data, msgq->read_ptr, len);
+		msgq->read_ptr += len;
+	} else {
+		/* wrap-around is required */
+		(void)memcpy(data, msgq->read_ptr, bytes_to_end);
+		(void)memcpy(data + bytes_to_end, msgq->buffer_start, len - bytes_to_end);
+		msgq->read_ptr = msgq->buffer_start + (len - bytes_to_end);
+	}
+}
+
+#ifdef CONFIG_MSGQ_MPSC
+/*
+ * The ring buffer of a lock-free message queue is indexed by free-running
+ * positions. Producers reserve the slot at the head with a compare-and-swap
+ * and copy their message with only the local interrupts locked, so that a
+ * reserved slot is published soon. Readers are serialized by the queue lock
+ * and read the slot at the tail. The sequence number of every slot tells
+ * whether it is free for the position reserving it, or holds the published
+ * message of that position. It is kept relative to the lap of the slot,
+ * the position without the slot index, so that all slots of a zeroed array
+ * are free for the first lap:
+ *
+ *   lap            free for the position of this lap
+ *   lap + 1        message of this lap published
+ *   lap + max_msgs free for the position of the next lap, once read
+ *
+ * Producers take the lock only to publish the message at the tail, when the
+ * queue goes from empty to non-empty for the readers, to wake up a waiting
+ * reader or raise poll events. Readers waiting on an empty queue, and
+ * writers waiting for a free slot on put_wait_q, are woken up without
+ * handing them a message, and retry.
+ */
+
+static inline uint32_t mpsc_lap(struct k_msgq *msgq, uint32_t pos)
+{
+	return pos & ~(msgq->max_msgs - 1U);
+}
+
+static inline atomic_t *mpsc_seq(struct k_msgq *msgq, uint32_t pos)
+{
+	return &msgq->seqs[pos & (msgq->max_msgs - 1U)];
+}
+
+static inline char *mpsc_slot(struct k_msgq *msgq, uint32_t pos)
+{
+	return msgq->buffer_start + ((pos & (msgq->max_msgs - 1U)) * msgq->msg_size);
+}
+
+/* Sequence number of the slot of a position, relative to its lap */
+static inline int32_t mpsc_state(struct k_msgq *msgq, uint32_t pos)
+{
+	return (int32_t)((uint32_t)atomic_get(mpsc_seq(msgq, pos)) - mpsc_lap(msgq, pos));
+}
+
+/* Reserve the slot at the head, returns false if the queue is full */
+static bool mpsc_reserve(struct k_msgq *msgq, uint32_t *pos)
+{
+	uint32_t head = (uint32_t)atomic_get(&msgq->head);
+	int32_t state;
+
+	while (true) {
+		state = mpsc_state(msgq, head);
+		if (state < 0) {
+			/* Still holds the message of the previous lap */
+			return false;
+		}
+
+		if ((state == 0) &&
+		    atomic_cas(&msgq->head, (atomic_val_t)head, (atomic_val_t)(head + 1U))) {
+			*pos = head;
+			return true;
+		}
+
+		/* Reserved by another producer meanwhile */
+		head = (uint32_t)atomic_get(&msgq->head);
+	}
+}
+
+/* Number of messages that can be read, up to max_msgs */
+static uint32_t mpsc_num_readable(struct k_msgq *msgq, uint32_t max_msgs)
+{
+	uint32_t tail = (uint32_t)atomic_get(&msgq->tail);
+	uint32_t num_msgs = 0U;
+
+	while ((num_msgs < max_msgs) && (mpsc_state(msgq, tail + num_msgs) == 1)) {
+		num_msgs++;
+	}
+
+	return num_msgs;
+}
+
+/* Called with the lock held once a message can be read, returns whether a
+ * thread was made ready.
+ */
+static bool mpsc_wake_reader(struct k_msgq *msgq)
+{
+	struct k_thread *pending_thread = z_unpend_first_thread(&msgq->wait_q);
+
+	if (pending_thread == NULL) {
+		return handle_poll_events(msgq);
+	}
+
+	arch_thread_return_value_set(pending_thread, 0);
+	z_ready_thread(pending_thread);
+
+	return true;
+}
+
+static int mpsc_put(struct k_msgq *msgq, const char *data, uint32_t num_msgs,
+		    k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	unsigned int irq_key;
+	uint32_t num_sent = 0U;
+	uint32_t pos;
+	bool waited = false;
+	bool wake = false;
+	int result;
+
+	while (true) {
+		for (; num_sent < num_msgs; num_sent++) {
+			irq_key = arch_irq_lock();
+			if (!mpsc_reserve(msgq, &pos)) {
+				arch_irq_unlock(irq_key);
+				break;
+			}
+			(void)memcpy(mpsc_slot(msgq, pos), data + (num_sent * msgq->msg_size),
+				     msgq->msg_size);
+			atomic_set(mpsc_seq(msgq, pos), (atomic_val_t)(mpsc_lap(msgq, pos) + 1U));
+			arch_irq_unlock(irq_key);
+
+			/* Readers only wait for the message at the tail */
+			wake = wake || (pos == (uint32_t)atomic_get(&msgq->tail));
+		}
+
+		if ((num_sent > 0U) || (num_msgs == 0U)) {
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return waited ? -EAGAIN : -ENOMSG;
+		}
+
+		/* Slots are only freed with the lock held */
+		key = k_spin_lock(&msgq->lock);
+		if (mpsc_state(msgq, (uint32_t)atomic_get(&msgq->head)) >= 0) {
+			k_spin_unlock(&msgq->lock, key);
+			continue;
+		}
+
+		stats_access(msgq, true);
+
+		uint32_t wait_start = stats_now();
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->put_wait_q, timeout);
+		stats_waited(msgq, wait_start, result);
+		if (result != 0) {
+			return result;
+		}
+
+		waited = true;
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	if (wake) {
+		key = k_spin_lock(&msgq->lock);
+		if (mpsc_wake_reader(msgq)) {
+			z_reschedule(&msgq->lock, key);
+		} else {
+			k_spin_unlock(&msgq->lock, key);
+		}
+	}
+
+	return (int)num_sent;
+}
+
+/* Read messages at the tail and free their slots, called with the lock
+ * held. Returns the number of messages read.
+ */
+static uint32_t mpsc_read(struct k_msgq *msgq, char *data, uint32_t max_msgs, bool *resched)
+{
+	uint32_t tail = (uint32_t)atomic_get(&msgq->tail);
+	uint32_t num_msgs = mpsc_num_readable(msgq, max_msgs);
+	struct k_thread *pending_thread;
+
+	if (num_msgs == 0U) {
+		return 0U;
+	}
+
+	for (uint32_t i = 0; i < num_msgs; i++, tail++) {
+		if (data != NULL) {
+			(void)memcpy(data + (i * msgq->msg_size), mpsc_slot(msgq, tail),
+				     msgq->msg_size);
+		}
+		atomic_set(mpsc_seq(msgq, tail),
+			   (atomic_val_t)(mpsc_lap(msgq, tail) + msgq->max_msgs));
+
+		/* let a waiting writer retry */
+		pending_thread = z_unpend_first_thread(&msgq->put_wait_q);
+		if (pending_thread != NULL) {
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			*resched = true;
+		}
+	}
+	atomic_set(&msgq->tail, (atomic_val_t)tail);
+
+	/* The producer of the next message may have seen the previous tail */
+	if (mpsc_state(msgq, tail) == 1) {
+		*resched = mpsc_wake_reader(msgq) || *resched;
+	}
+
+	return num_msgs;
+}
+
+static int mpsc_get(struct k_msgq *msgq, char *data, uint32_t max_msgs, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	uint32_t num_msgs;
+	bool resched = false;
+	bool waited = false;
+	int result;
+
+	while (true) {
+		key = k_spin_lock(&msgq->lock);
+
+		num_msgs = mpsc_read(msgq, data, max_msgs, &resched);
+		if (!waited) {
+			stats_access(msgq, (num_msgs == 0U) && (max_msgs > 0U));
+		}
+
+		if ((num_msgs > 0U) || (max_msgs == 0U)) {
+			result = (int)num_msgs;
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			result = waited ? -EAGAIN : -ENOMSG;
+			break;
+		}
+
+		uint32_t wait_start = stats_now();
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		stats_waited(msgq, wait_start, result);
+		if (result != 0) {
+			return result;
+		}
+
+		waited = true;
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+void k_msgq_mpsc_init(struct k_msgq *msgq, char *buffer, atomic_t *seqs, size_t msg_size,
+		      uint32_t max_msgs)
+{
+	__ASSERT(IS_POWER_OF_TWO(max_msgs) && (max_msgs >= 2U),
+		 "lock-free message queue length must be a power of 2");
+
+	k_msgq_init(msgq, buffer, msg_size, max_msgs);
+
+	(void)memset(seqs, 0, max_msgs * sizeof(atomic_t));
+	msgq->seqs = seqs;
+	atomic_clear(&msgq->head);
+	atomic_clear(&msgq->tail);
+	z_waitq_init(&msgq->put_wait_q);
+	msgq->flags = K_MSGQ_FLAG_MPSC;
+}
+#endif /* CONFIG_MSGQ_MPSC */
+
+#ifdef CONFIG_POLL
+bool z_msgq_has_data(struct k_msgq *msgq)
+{
+#ifdef CONFIG_MSGQ_MPSC
+	if (is_mpsc(msgq)) {
+		return mpsc_state(msgq, (uint32_t)atomic_get(&msgq->tail)) == 1;
+	}
+#endif /* CONFIG_MSGQ_MPSC */
+
+	return msgq->used_msgs > 0U;
+}
+#endif /* CONFIG_POLL */
+
 static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 			k_timeout_t timeout, bool put_at_back)
 {
@@ -141,7 +569,9 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put_front, msgq, timeout);
 	}
 
-	if (msgq->used_msgs < msgq->max_msgs) {
+	stats_access(msgq, num_free_msgs(msgq) == 0U);
+
+	if (num_free_msgs(msgq) > 0U) {
 		/* message queue isn't full */
 		pending_thread = z_unpend_first_thread(&msgq->wait_q);
 		if (unlikely(pending_thread != NULL)) {
@@ -165,6 +595,8 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 				if (msgq->write_ptr == msgq->buffer_end) {
 					msgq->write_ptr = msgq->buffer_start;
 				}
+				msgq->used_msgs++;
+				resched = handle_poll_events(msgq);
 			} else {
 				/*
 				 * to write a message to the head of the queue,
@@ -177,9 +609,9 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 				}
 				msgq->read_ptr -= msgq->msg_size;
 				(void)memcpy(msgq->read_ptr, (char *)data, msgq->msg_size);
+				msgq->used_msgs++;
+				resched = handle_poll_events(msgq);
 			}
-			msgq->used_msgs++;
-			resched = handle_poll_events(msgq);
 		}
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -195,7 +627,10 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 		/* wait for put message success, failure, or timeout */
 		_current->base.swap_data = (void *) data;
 
+		uint32_t wait_start = stats_now();
+
 		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		stats_waited(msgq, wait_start, result);
 
 		if (put_at_back) {
 			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
@@ -224,14 +659,129 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 
 int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout)
 {
+#ifdef CONFIG_MSGQ_MPSC
+	if (is_mpsc(msgq)) {
+		__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+		int result;
+
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
+		result = mpsc_put(msgq, data, 1U, timeout);
+		result = (result > 0) ? 0 : result;
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_MPSC */
+
 	return put_msg_in_queue(msgq, data, timeout, true);
 }
 
 int z_impl_k_msgq_put_front(struct k_msgq *msgq, const void *data)
 {
+#ifdef CONFIG_MSGQ_MPSC
+	if (is_mpsc(msgq)) {
+		/* Only the back of a lock-free queue is written */
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put_front, msgq, K_NO_WAIT);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_front, msgq, K_NO_WAIT, -ENOTSUP);
+
+		return -ENOTSUP;
+	}
+#endif /* CONFIG_MSGQ_MPSC */
+
 	return put_msg_in_queue(msgq, data, K_NO_WAIT, false);
 }
 
+int z_impl_k_msgq_put_many(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+			   k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	const char *src = data;
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	uint32_t num_sent = 0U;
+	uint32_t num_queued;
+	int result;
+	bool resched = false;
+
+#ifdef CONFIG_MSGQ_MPSC
+	if (is_mpsc(msgq)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put_many, msgq, timeout);
+		result = mpsc_put(msgq, data, num_msgs, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_many, msgq, timeout, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_MPSC */
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put_many, msgq, timeout);
+
+	/* give messages to waiting threads, which only wait on an empty queue */
+	while ((num_sent < num_msgs) && (num_free_msgs(msgq) > 0U)) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		(void)memcpy(pending_thread->base.swap_data, src, msgq->msg_size);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		src += msgq->msg_size;
+		num_sent++;
+		resched = true;
+	}
+
+	/* then queue as many of the others as fit */
+	num_queued = MIN(num_msgs - num_sent, num_free_msgs(msgq));
+	if (num_queued > 0U) {
+		__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+				msgq->write_ptr < msgq->buffer_end);
+		write_msgs(msgq, src, num_queued);
+		num_sent += num_queued;
+		msgq->used_msgs += num_queued;
+		resched = handle_poll_events(msgq) || resched;
+	}
+
+	stats_access(msgq, (num_sent == 0U) && (num_msgs > 0U));
+
+	if ((num_sent > 0U) || (num_msgs == 0U)) {
+		result = (int)num_sent;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for message space to become available */
+		result = -ENOMSG;
+	} else {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put_many, msgq, timeout);
+
+		/* wait until the first message is put, or failure, or timeout */
+		_current->base.swap_data = (void *)data;
+
+		uint32_t wait_start = stats_now();
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		stats_waited(msgq, wait_start, result);
+		if (result == 0) {
+			result = 1;
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_many, msgq, timeout, result);
+
+		return result;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_many, msgq, timeout, result);
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
 #ifdef CONFIG_USERSPACE
 static inline int z_vrfy_k_msgq_put(struct k_msgq *msgq, const void *data,
 				    k_timeout_t timeout)
@@ -251,13 +801,23 @@ static inline int z_vrfy_k_msgq_put_front(struct k_msgq *msgq, const void *data)
 	return z_impl_k_msgq_put_front(msgq, data);
 }
 #include <zephyr/syscalls/k_msgq_put_front_mrsh.c>
+
+static inline int z_vrfy_k_msgq_put_many(struct k_msgq *msgq, const void *data,
+					 uint32_t num_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_READ(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_put_many(msgq, data, num_msgs, timeout);
+}
+#include <zephyr/syscalls/k_msgq_put_many_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
 void z_impl_k_msgq_get_attrs(struct k_msgq *msgq, struct k_msgq_attrs *attrs)
 {
 	attrs->msg_size = msgq->msg_size;
 	attrs->max_msgs = msgq->max_msgs;
-	attrs->used_msgs = msgq->used_msgs;
+	attrs->used_msgs = z_msgq_used_msgs(msgq);
 }
 
 #ifdef CONFIG_USERSPACE
@@ -280,10 +840,23 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	int result;
 	bool resched = false;
 
+#ifdef CONFIG_MSGQ_MPSC
+	if (is_mpsc(msgq)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
+		result = mpsc_get(msgq, data, 1U, timeout);
+		result = (result > 0) ? 0 : result;
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_MPSC */
+
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
 
+	stats_access(msgq, msgq->used_msgs == 0U);
+
 	if (msgq->used_msgs > 0U) {
 		/* take first available message from queue */
 		(void)memcpy((char *)data, msgq->read_ptr, msgq->msg_size);
@@ -324,7 +897,10 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 		/* wait for get message success or timeout */
 		_current->base.swap_data = data;
 
+		uint32_t wait_start = stats_now();
+
 		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		stats_waited(msgq, wait_start, result);
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
 		return result;
 	}
@@ -352,6 +928,115 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <zephyr/syscalls/k_msgq_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+/* Take messages from the queue and refill the space they free with the
+ * messages of waiting writers, called with the lock held. Returns whether a
+ * writer was woken up.
+ */
+static bool get_msgs_locked(struct k_msgq *msgq, char *data, uint32_t num_msgs)
+{
+	struct k_thread *pending_thread;
+	bool resched = false;
+
+	read_msgs(msgq, data, num_msgs);
+	msgq->used_msgs -= num_msgs;
+
+	for (uint32_t i = 0; i < num_msgs; i++) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		/* add thread's message to queue */
+		write_msgs(msgq, pending_thread->base.swap_data, 1U);
+		msgq->used_msgs++;
+
+		/* wake up waiting thread */
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		resched = true;
+	}
+
+	return resched;
+}
+
+int z_impl_k_msgq_get_many(struct k_msgq *msgq, void *data, uint32_t max_msgs,
+			   k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	uint32_t num_msgs;
+	int result;
+	bool resched = false;
+
+#ifdef CONFIG_MSGQ_MPSC
+	if (is_mpsc(msgq)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get_many, msgq, timeout);
+		result = mpsc_get(msgq, data, max_msgs, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_many, msgq, timeout, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_MPSC */
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get_many, msgq, timeout);
+
+	num_msgs = MIN(max_msgs, msgq->used_msgs);
+	stats_access(msgq, (num_msgs == 0U) && (max_msgs > 0U));
+
+	if ((num_msgs > 0U) || (max_msgs == 0U)) {
+		resched = get_msgs_locked(msgq, data, num_msgs);
+		result = (int)num_msgs;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for a message to become available */
+		result = -ENOMSG;
+	} else {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get_many, msgq, timeout);
+
+		/* wait for the first message or timeout */
+		_current->base.swap_data = data;
+
+		uint32_t wait_start = stats_now();
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		stats_waited(msgq, wait_start, result);
+		if (result != 0) {
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_many, msgq, timeout, result);
+			return result;
+		}
+
+		/* take the messages queued since the first one was handed over */
+		key = k_spin_lock(&msgq->lock);
+		num_msgs = MIN(max_msgs - 1U, msgq->used_msgs);
+		resched = get_msgs_locked(msgq, (char *)data + msgq->msg_size, num_msgs);
+		result = (int)num_msgs + 1;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_many, msgq, timeout, result);
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_get_many(struct k_msgq *msgq, void *data,
+					 uint32_t max_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(data, max_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_get_many(msgq, data, max_msgs, timeout);
+}
+#include <zephyr/syscalls/k_msgq_get_many_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
@@ -359,6 +1044,17 @@ int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 
 	key = k_spin_lock(&msgq->lock);
 
+#ifdef CONFIG_MSGQ_MPSC
+	if (is_mpsc(msgq)) {
+		if (mpsc_num_readable(msgq, 1U) > 0U) {
+			(void)memcpy(data, mpsc_slot(msgq, (uint32_t)atomic_get(&msgq->tail)),
+				     msgq->msg_size);
+			result = 0;
+		} else {
+			result = -ENOMSG;
+		}
+	} else
+#endif /* CONFIG_MSGQ_MPSC */
 	if (msgq->used_msgs > 0U) {
 		/* take first available message from queue */
 		(void)memcpy((char *)data, msgq->read_ptr, msgq->msg_size);
@@ -396,6 +1092,18 @@ int z_impl_k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx)
 
 	key = k_spin_lock(&msgq->lock);
 
+#ifdef CONFIG_MSGQ_MPSC
+	if (is_mpsc(msgq)) {
+		if ((idx < msgq->max_msgs) && (mpsc_num_readable(msgq, idx + 1U) > idx)) {
+			(void)memcpy(data,
+				     mpsc_slot(msgq, (uint32_t)atomic_get(&msgq->tail) + idx),
+				     msgq->msg_size);
+			result = 0;
+		} else {
+			result = -ENOMSG;
+		}
+	} else
+#endif /* CONFIG_MSGQ_MPSC */
 	if (msgq->used_msgs > idx) {
 		bytes_to_end = (msgq->buffer_end - msgq->read_ptr);
 		byte_offset = idx * msgq->msg_size;
@@ -436,21 +1144,35 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 {
 	k_spinlock_key_t key;
 	struct k_thread *pending_thread;
+	_wait_q_t *writers = &msgq->wait_q;
 	bool resched = false;
 
+#ifdef CONFIG_MSGQ_MPSC
+	if (is_mpsc(msgq)) {
+		writers = &msgq->put_wait_q;
+	}
+#endif /* CONFIG_MSGQ_MPSC */
+
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_msgq, purge, msgq);
 
 	/* wake up any threads that are waiting to write */
-	for (pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	for (pending_thread = z_unpend_first_thread(writers);
 	     pending_thread != NULL;
-	     pending_thread = z_unpend_first_thread(&msgq->wait_q)) {
+	     pending_thread = z_unpend_first_thread(writers)) {
 		arch_thread_return_value_set(pending_thread, -ENOMSG);
 		z_ready_thread(pending_thread);
 		resched = true;
 	}
 
+#ifdef CONFIG_MSGQ_MPSC
+	if (is_mpsc(msgq)) {
+		/* The messages being copied are put after the purge */
+		(void)mpsc_read(msgq, NULL, msgq->max_msgs, &resched);
+	}
+#endif /* CONFIG_MSGQ_MPSC */
+
 	msgq->used_msgs = 0;
 	msgq->read_ptr = msgq->write_ptr;
 
@@ -492,11 +1214,18 @@ static int init_msgq_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_msgq, K_OBJ_TYPE_MSGQ_ID,
 			offsetof(struct k_msgq, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+	k_obj_type_stats_init(&obj_type_msgq, &msgq_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_MSGQ */
 
 	/* Initialize and link statically defined message queues */
 
 	STRUCT_SECTION_FOREACH(k_msgq, msgq) {
 		k_obj_core_init_and_link(K_OBJ_CORE(msgq), &obj_type_msgq);
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+		k_obj_core_stats_register(K_OBJ_CORE(msgq), &msgq->contention,
+					  sizeof(msgq->contention));
+#endif /* CONFIG_OBJ_CORE_STATS_MSGQ */
 	}
 
 	return 0;
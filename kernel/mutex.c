@@ -37,8 +37,10 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <string.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/llext/symbol.h>
+#include <zephyr/sys/mutex.h>
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 
 /* We use a global spinlock here because some of the synchronization
@@ -52,6 +54,111 @@ static struct k_spinlock lock;
 static struct k_obj_type obj_type_mutex;
 #endif /* CONFIG_OBJ_CORE_MUTEX */
 
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+static int k_mutex_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_mutex *mutex = CONTAINER_OF(obj_core, struct k_mutex, obj_core);
+
+	K_SPINLOCK(&lock) {
+		memcpy(stats, &mutex->contention, sizeof(mutex->contention));
+	}
+
+	return 0;
+}
+
+static int k_mutex_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_mutex *mutex = CONTAINER_OF(obj_core, struct k_mutex, obj_core);
+
+	K_SPINLOCK(&lock) {
+		memset(&mutex->contention, 0, sizeof(mutex->contention));
+	}
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc mutex_stats_desc = {
+	.raw_size = sizeof(struct k_obj_contention_stats),
+	.query_size = sizeof(struct k_obj_contention_stats),
+	.raw   = k_mutex_stats_raw,
+	.query = k_mutex_stats_raw,
+	.reset = k_mutex_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+
+/* The statistics are updated with the global lock held */
+
+static inline uint32_t stats_now(void)
+{
+	return k_cycle_get_32();
+}
+
+static inline void stats_locked(struct k_mutex *mutex)
+{
+	mutex->contention.acquisitions++;
+	if (mutex->lock_count == 1U) {
+		mutex->hold_start = k_cycle_get_32();
+	}
+}
+
+static inline void stats_contended(struct k_mutex *mutex)
+{
+	mutex->contention.contended++;
+}
+
+static inline void stats_waited(struct k_mutex *mutex, uint32_t start, bool acquired)
+{
+	z_contention_wait_add(&mutex->contention, k_cycle_get_32() - start);
+	if (acquired) {
+		/* hold_start was set when the mutex was handed over */
+		mutex->contention.acquisitions++;
+	}
+}
+
+static inline void stats_unlocked(struct k_mutex *mutex, struct k_thread *new_owner)
+{
+	uint32_t now = k_cycle_get_32();
+
+	z_contention_hold_add(&mutex->contention, now - mutex->hold_start);
+	if (new_owner != NULL) {
+		mutex->hold_start = now;
+	}
+}
+#else
+static inline uint32_t stats_now(void)
+{
+	return 0;
+}
+
+static inline void stats_locked(struct k_mutex *mutex)
+{
+	ARG_UNUSED(mutex);
+}
+
+static inline void stats_contended(struct k_mutex *mutex)
+{
+	ARG_UNUSED(mutex);
+}
+
+static inline void stats_waited(struct k_mutex *mutex, uint32_t start, bool acquired)
+{
+	ARG_UNUSED(mutex);
+	ARG_UNUSED(start);
+	ARG_UNUSED(acquired);
+}
+
+static inline void stats_unlocked(struct k_mutex *mutex, struct k_thread *new_owner)
+{
+	ARG_UNUSED(mutex);
+	ARG_UNUSED(new_owner);
+}
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+
 int z_impl_k_mutex_init(struct k_mutex *mutex)
 {
 	mutex->owner = NULL;
@@ -65,6 +172,12 @@ int z_impl_k_mutex_init(struct k_mutex *mutex)
 	k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
 #endif /* CONFIG_OBJ_CORE_MUTEX */
 
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	memset(&mutex->contention, 0, sizeof(mutex->contention));
+	k_obj_core_stats_register(K_OBJ_CORE(mutex), &mutex->contention,
+				  sizeof(mutex->contention));
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+
 	SYS_PORT_TRACING_OBJ_INIT(k_mutex, mutex, 0);
 
 	return 0;
@@ -122,6 +235,7 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 		mutex->lock_count++;
 		mutex->owner = _current;
+		stats_locked(mutex);
 
 		LOG_DBG("%p took mutex %p, count: %d, orig prio: %d",
 			_current, mutex, mutex->lock_count,
@@ -134,6 +248,8 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		return 0;
 	}
 
+	stats_contended(mutex);
+
 	if (unlikely(K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
 		k_spin_unlock(&lock, key);
 
@@ -153,6 +269,7 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		resched = adjust_owner_prio(mutex, new_prio);
 	}
 
+	uint32_t wait_start = stats_now();
 	int got_mutex = z_pend_curr(&lock, key, &mutex->wait_q, timeout);
 
 	LOG_DBG("on mutex %p got_mutex value: %d", mutex, got_mutex);
@@ -161,6 +278,11 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		got_mutex ? 'y' : 'n');
 
 	if (got_mutex == 0) {
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+		K_SPINLOCK(&lock) {
+			stats_waited(mutex, wait_start, true);
+		}
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
 		return 0;
 	}
@@ -171,6 +293,8 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
+	stats_waited(mutex, wait_start, false);
+
 	/*
 	 * Check if mutex was unlocked after this thread was unpended.
 	 * If so, skip adjusting owner's priority down.
@@ -257,6 +381,7 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 	new_owner = z_unpend_first_thread(&mutex->wait_q);
 
 	mutex->owner = new_owner;
+	stats_unlocked(mutex, new_owner);
 
 	LOG_DBG("new owner of mutex %p: %p (prio: %d)",
 		mutex, new_owner, new_owner ? new_owner->base.prio : -1000);
@@ -292,6 +417,156 @@ static inline int z_vrfy_k_mutex_unlock(struct k_mutex *mutex)
 #include <zephyr/syscalls/k_mutex_unlock_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+/*
+ * Contended paths of sys_mutex. The sys_mutex word holds its owner thread,
+ * set and cleared with atomic operations in user memory, with
+ * Z_SYS_MUTEX_WAITERS set while @a mutex tracks that owner so that other
+ * threads can wait on it with priority inheritance. The owner then has to
+ * unlock through z_sys_mutex_unlock_slow(). The word is only changed here
+ * with the lock held, but can be changed concurrently by the atomic
+ * operations of the threads locking and unlocking it in user mode, and
+ * may have been corrupted by them.
+ */
+
+/* The owner is adopted and inherits the priority of the caller, which thus
+ * needs the same permission on it as to act on it through any other syscall
+ */
+static bool owner_is_valid(struct k_thread *owner)
+{
+	return k_object_validate(k_object_find(owner), K_OBJ_THREAD, _OBJ_INIT_TRUE) == 0;
+}
+
+int z_sys_mutex_lock_slow(struct k_mutex *mutex, atomic_t *word, k_timeout_t timeout)
+{
+	struct k_thread *owner;
+	k_spinlock_key_t key;
+	atomic_val_t val;
+	int new_prio;
+	bool resched = false;
+
+	key = k_spin_lock(&lock);
+
+	for (;;) {
+		val = atomic_get(word);
+		if (val == 0) {
+			if (atomic_cas(word, 0, (atomic_val_t)_current)) {
+				k_spin_unlock(&lock, key);
+				return 0;
+			}
+			continue;
+		}
+
+		owner = (struct k_thread *)(val & ~Z_SYS_MUTEX_WAITERS);
+		if ((owner == _current) || !owner_is_valid(owner) ||
+		    ((mutex->owner != NULL) && (mutex->owner != owner))) {
+			k_spin_unlock(&lock, key);
+			return -EINVAL;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EBUSY;
+		}
+
+		/* Make the owner unlock through the kernel */
+		if (((val & Z_SYS_MUTEX_WAITERS) != 0) ||
+		    atomic_cas(word, val, val | Z_SYS_MUTEX_WAITERS)) {
+			break;
+		}
+	}
+
+	if (mutex->owner == NULL) {
+		/* The priority the owner gets back when unlocking is the one
+		 * it has now, rather than when it locked the mutex
+		 */
+		mutex->owner = owner;
+		mutex->lock_count = 1U;
+		mutex->owner_orig_prio = owner->base.prio;
+	}
+
+	new_prio = new_prio_for_inheritance(_current->base.prio, owner->base.prio);
+	if (z_is_prio_higher(new_prio, owner->base.prio)) {
+		resched = adjust_owner_prio(mutex, new_prio);
+	}
+
+	/* The unlocking thread sets the word when handing the mutex over */
+	if (z_pend_curr(&lock, key, &mutex->wait_q, timeout) == 0) {
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+
+	if (likely(mutex->owner != NULL)) {
+		struct k_thread *waiter = z_waitq_head(&mutex->wait_q);
+
+		new_prio = (waiter != NULL) ?
+			new_prio_for_inheritance(waiter->base.prio, mutex->owner_orig_prio) :
+			mutex->owner_orig_prio;
+
+		resched = adjust_owner_prio(mutex, new_prio) || resched;
+	}
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return -EAGAIN;
+}
+
+int z_sys_mutex_unlock_slow(struct k_mutex *mutex, atomic_t *word)
+{
+	struct k_thread *new_owner;
+	k_spinlock_key_t key;
+	atomic_val_t val;
+
+	key = k_spin_lock(&lock);
+
+	val = atomic_get(word);
+	if ((val & ~Z_SYS_MUTEX_WAITERS) != (atomic_val_t)_current) {
+		k_spin_unlock(&lock, key);
+		return (val == 0) ? -EINVAL : -EPERM;
+	}
+
+	if (mutex->owner != _current) {
+		/* Not tracked by the kernel, nobody can be waiting */
+		atomic_set(word, 0);
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	adjust_owner_prio(mutex, mutex->owner_orig_prio);
+
+	new_owner = z_unpend_first_thread(&mutex->wait_q);
+	if (new_owner == NULL) {
+		mutex->owner = NULL;
+		mutex->lock_count = 0U;
+		atomic_set(word, 0);
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	if (z_waitq_head(&mutex->wait_q) != NULL) {
+		mutex->owner = new_owner;
+		mutex->owner_orig_prio = new_owner->base.prio;
+		atomic_set(word, (atomic_val_t)new_owner | Z_SYS_MUTEX_WAITERS);
+	} else {
+		/* Let the new owner unlock in user mode */
+		mutex->owner = NULL;
+		mutex->lock_count = 0U;
+		atomic_set(word, (atomic_val_t)new_owner);
+	}
+
+	arch_thread_return_value_set(new_owner, 0);
+	z_ready_thread(new_owner);
+	z_reschedule(&lock, key);
+
+	return 0;
+}
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
+
 #ifdef CONFIG_OBJ_CORE_MUTEX
 static int init_mutex_obj_core_list(void)
 {
@@ -299,11 +574,18 @@ static int init_mutex_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_mutex, K_OBJ_TYPE_MUTEX_ID,
 			offsetof(struct k_mutex, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	k_obj_type_stats_init(&obj_type_mutex, &mutex_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 
 	/* Initialize and link statically defined mutexes */
 
 	STRUCT_SECTION_FOREACH(k_mutex, mutex) {
 		k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+		k_obj_core_stats_register(K_OBJ_CORE(mutex), &mutex->contention,
+					  sizeof(mutex->contention));
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
 	}
 
 	return 0;
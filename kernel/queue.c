@@ -369,6 +369,64 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 	return (ret != 0) ? NULL : _current->base.swap_data;
 }
 
+/* Take up to max_items data items from the head of the queue, called with the
+ * lock held.
+ */
+static uint32_t queue_get_items(struct k_queue *queue, void **data, uint32_t max_items)
+{
+	uint32_t num_items = 0U;
+
+	while ((num_items < max_items) && !sys_sflist_is_empty(&queue->data_q)) {
+		sys_sfnode_t *node = sys_sflist_get_not_empty(&queue->data_q);
+
+		data[num_items] = z_queue_node_peek(node, true);
+		num_items++;
+	}
+
+	return num_items;
+}
+
+int z_impl_k_queue_get_many(struct k_queue *queue, void **data, uint32_t max_items,
+			    k_timeout_t timeout)
+{
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	uint32_t num_items;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, get_many, queue, timeout);
+
+	num_items = queue_get_items(queue, data, max_items);
+
+	if ((num_items > 0U) || (max_items == 0U) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&queue->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get_many, queue, timeout, num_items);
+
+		return (int)num_items;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_queue, get_many, queue, timeout);
+
+	int ret = z_pend_curr(&queue->lock, key, &queue->wait_q, timeout);
+
+	/* A cancelled wait hands over no data item */
+	if ((ret != 0) || (_current->base.swap_data == NULL)) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get_many, queue, timeout, 0);
+
+		return 0;
+	}
+
+	/* Take the data items queued since the first one was handed over */
+	data[0] = _current->base.swap_data;
+
+	key = k_spin_lock(&queue->lock);
+	num_items = 1U + queue_get_items(queue, &data[1], max_items - 1U);
+	k_spin_unlock(&queue->lock, key);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get_many, queue, timeout, num_items);
+
+	return (int)num_items;
+}
+
 bool k_queue_remove(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, remove, queue);
@@ -428,6 +486,16 @@ static inline void *z_vrfy_k_queue_get(struct k_queue *queue,
 }
 #include <zephyr/syscalls/k_queue_get_mrsh.c>
 
+static inline int z_vrfy_k_queue_get_many(struct k_queue *queue, void **data,
+					  uint32_t max_items, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(queue, K_OBJ_QUEUE));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(data, max_items, sizeof(void *)));
+
+	return z_impl_k_queue_get_many(queue, data, max_items, timeout);
+}
+#include <zephyr/syscalls/k_queue_get_many_mrsh.c>
+
 static inline int z_vrfy_k_queue_is_empty(struct k_queue *queue)
 {
 	K_OOPS(K_SYSCALL_OBJ(queue, K_OBJ_QUEUE));
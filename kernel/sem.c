@@ -28,6 +28,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <string.h>
 
 /* We use a system-wide lock to synchronize semaphores, which has
  * unfortunate performance impact vs. using a per-object lock
@@ -42,6 +43,89 @@ static struct k_spinlock lock;
 static struct k_obj_type obj_type_sem;
 #endif /* CONFIG_OBJ_CORE_SEM */
 
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+static int k_sem_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	__ASSERT((obj_core != NULL) && (stats != NULL), "NULL parameter");
+
+	struct k_sem *sem = CONTAINER_OF(obj_core, struct k_sem, obj_core);
+
+	K_SPINLOCK(&lock) {
+		memcpy(stats, &sem->contention, sizeof(sem->contention));
+	}
+
+	return 0;
+}
+
+static int k_sem_stats_reset(struct k_obj_core *obj_core)
+{
+	__ASSERT(obj_core != NULL, "NULL parameter");
+
+	struct k_sem *sem = CONTAINER_OF(obj_core, struct k_sem, obj_core);
+
+	K_SPINLOCK(&lock) {
+		memset(&sem->contention, 0, sizeof(sem->contention));
+	}
+
+	return 0;
+}
+
+static struct k_obj_core_stats_desc sem_stats_desc = {
+	.raw_size = sizeof(struct k_obj_contention_stats),
+	.query_size = sizeof(struct k_obj_contention_stats),
+	.raw   = k_sem_stats_raw,
+	.query = k_sem_stats_raw,
+	.reset = k_sem_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+
+/* Called with the lock held */
+static inline void stats_taken(struct k_sem *sem, bool contended)
+{
+	if (contended) {
+		sem->contention.contended++;
+	} else {
+		sem->contention.acquisitions++;
+	}
+}
+
+static inline uint32_t stats_now(void)
+{
+	return k_cycle_get_32();
+}
+
+static void stats_waited(struct k_sem *sem, uint32_t start, int ret)
+{
+	uint32_t cycles = k_cycle_get_32() - start;
+
+	K_SPINLOCK(&lock) {
+		z_contention_wait_add(&sem->contention, cycles);
+		if (ret == 0) {
+			sem->contention.acquisitions++;
+		}
+	}
+}
+#else
+static inline void stats_taken(struct k_sem *sem, bool contended)
+{
+	ARG_UNUSED(sem);
+	ARG_UNUSED(contended);
+}
+
+static inline uint32_t stats_now(void)
+{
+	return 0;
+}
+
+static inline void stats_waited(struct k_sem *sem, uint32_t start, int ret)
+{
+	ARG_UNUSED(sem);
+	ARG_UNUSED(start);
+	ARG_UNUSED(ret);
+}
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
+
 int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 		      unsigned int limit)
 {
@@ -69,6 +153,12 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 	k_obj_core_init_and_link(K_OBJ_CORE(sem), &obj_type_sem);
 #endif /* CONFIG_OBJ_CORE_SEM */
 
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	memset(&sem->contention, 0, sizeof(sem->contention));
+	k_obj_core_stats_register(K_OBJ_CORE(sem), &sem->contention,
+				  sizeof(sem->contention));
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
+
 	return 0;
 }
 
@@ -142,11 +232,14 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 
 	if (likely(sem->count > 0U)) {
 		sem->count--;
+		stats_taken(sem, false);
 		k_spin_unlock(&lock, key);
 		ret = 0;
 		goto out;
 	}
 
+	stats_taken(sem, true);
+
 	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 		k_spin_unlock(&lock, key);
 		ret = -EBUSY;
@@ -155,7 +248,10 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_sem, take, sem, timeout);
 
+	uint32_t wait_start = stats_now();
+
 	ret = z_pend_curr(&lock, key, &sem->wait_q, timeout);
+	stats_waited(sem, wait_start, ret);
 
 out:
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, take, sem, timeout, ret);
@@ -222,11 +318,18 @@ static int init_sem_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_sem, K_OBJ_TYPE_SEM_ID,
 			offsetof(struct k_sem, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	k_obj_type_stats_init(&obj_type_sem, &sem_stats_desc);
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 
 	/* Initialize and link statically defined semaphores */
 
 	STRUCT_SECTION_FOREACH(k_sem, sem) {
 		k_obj_core_init_and_link(K_OBJ_CORE(sem), &obj_type_sem);
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+		k_obj_core_stats_register(K_OBJ_CORE(sem), &sem->contention,
+					  sizeof(sem->contention));
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
 	}
 
 	return 0;
@@ -43,6 +43,26 @@ void z_spin_lock_set_owner(struct k_spinlock *l)
 }
 EXPORT_SYMBOL(z_spin_lock_set_owner);
 
+#ifdef CONFIG_SPIN_LOCK_STATS
+void k_spin_stats_get(struct k_spinlock *l, struct k_obj_contention_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(l);
+
+	*stats = l->stats;
+	k_spin_unlock(l, key);
+}
+EXPORT_SYMBOL(k_spin_stats_get);
+
+void k_spin_stats_reset(struct k_spinlock *l)
+{
+	k_spinlock_key_t key = k_spin_lock(l);
+
+	l->stats = (struct k_obj_contention_stats){0};
+	k_spin_unlock(l, key);
+}
+EXPORT_SYMBOL(k_spin_stats_reset);
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
 #ifdef CONFIG_KERNEL_COHERENCE
 bool z_spin_lock_mem_coherent(struct k_spinlock *l)
 {
@@ -12,9 +12,11 @@
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
 
-static uint64_t curr_tick;
+#ifdef CONFIG_TIMEOUT_WHEEL
+#include <timeout_wheel.h>
+#endif /* CONFIG_TIMEOUT_WHEEL */
 
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+static uint64_t curr_tick;
 
 /*
  * The timeout code shall take no locks other than its own (timeout_lock), nor
@@ -37,6 +39,72 @@ static inline unsigned int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_WHEEL
+
+static struct z_timeout_wheel timeout_wheel;
+
+/* Ticks from curr_tick to the first timeout, false without timeouts */
+static bool first_dticks(k_ticks_t *dticks)
+{
+	uint64_t expiry = z_timeout_wheel_first(&timeout_wheel);
+
+	*dticks = (k_ticks_t)(expiry - curr_tick);
+
+	return expiry != UINT64_MAX;
+}
+
+/* Queue a timeout, returns true if it may be the first to expire */
+static bool insert_timeout(struct _timeout *to, k_ticks_t dticks)
+{
+	return z_timeout_wheel_add(&timeout_wheel, to, curr_tick + dticks);
+}
+
+/* Dequeue an aborted timeout, returns true if the system timer must be reprogrammed */
+static bool abort_timeout(struct _timeout *to)
+{
+	z_timeout_wheel_remove(&timeout_wheel, to);
+
+	/* Finding the next timeout is left to the next announcement, which
+	 * happens early, so aborting stays constant time.
+	 */
+	return false;
+}
+
+/* Dequeue the first timeout if it expires within the announced ticks, and
+ * advance curr_tick to its expiry.
+ */
+static struct _timeout *pop_expired(int *dt)
+{
+	struct _timeout *t = z_timeout_wheel_expired(&timeout_wheel,
+						     curr_tick + announce_remaining);
+
+	if (t != NULL) {
+		*dt = (int)(t->dticks - curr_tick);
+		curr_tick += *dt;
+		z_timeout_wheel_remove(&timeout_wheel, t);
+		t->dticks = 0;
+	}
+
+	return t;
+}
+
+/* Advance curr_tick by ticks in which no timeout expires */
+static void advance(int32_t ticks)
+{
+	curr_tick += ticks;
+	z_timeout_wheel_advance(&timeout_wheel, curr_tick);
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	return (k_ticks_t)(timeout->dticks - curr_tick);
+}
+
+#else
+
+static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -60,6 +128,94 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+static bool first_dticks(k_ticks_t *dticks)
+{
+	struct _timeout *to = first();
+
+	if (to == NULL) {
+		return false;
+	}
+
+	*dticks = to->dticks;
+
+	return true;
+}
+
+static bool insert_timeout(struct _timeout *to, k_ticks_t dticks)
+{
+	struct _timeout *t;
+
+	to->dticks = dticks;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+
+	return to == first();
+}
+
+static bool abort_timeout(struct _timeout *to)
+{
+	bool is_first = (to == first());
+
+	remove_timeout(to);
+
+	return is_first;
+}
+
+static struct _timeout *pop_expired(int *dt)
+{
+	struct _timeout *t = first();
+
+	if ((t == NULL) || (t->dticks > announce_remaining)) {
+		return NULL;
+	}
+
+	*dt = t->dticks;
+	curr_tick += *dt;
+	t->dticks = 0;
+	remove_timeout(t);
+
+	return t;
+}
+
+static void advance(int32_t ticks)
+{
+	struct _timeout *t = first();
+
+	if (t != NULL) {
+		t->dticks -= ticks;
+	}
+
+	curr_tick += ticks;
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+#endif /* CONFIG_TIMEOUT_WHEEL */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -83,14 +239,14 @@ static int32_t elapsed(void)
 
 static int32_t next_timeout(int32_t ticks_elapsed)
 {
-	struct _timeout *to = first();
+	k_ticks_t dticks;
 	int32_t ret;
 
-	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	if (!first_dticks(&dticks) ||
+	    ((int64_t)(dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = SYS_CLOCK_MAX_WAIT;
 	} else {
-		ret = max(0, to->dticks - ticks_elapsed);
+		ret = max(0, dticks - ticks_elapsed);
 	}
 
 	return ret;
@@ -112,36 +268,22 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
+		k_ticks_t dticks;
 		int32_t ticks_elapsed;
 		bool has_elapsed = false;
 
 		if (Z_IS_TIMEOUT_RELATIVE(timeout)) {
 			ticks_elapsed = elapsed();
 			has_elapsed = true;
-			to->dticks = timeout.ticks + 1 + ticks_elapsed;
-			ticks = curr_tick + to->dticks;
+			dticks = timeout.ticks + 1 + ticks_elapsed;
+			ticks = curr_tick + dticks;
 		} else {
-			k_ticks_t dticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
-
-			to->dticks = max(1, dticks);
+			dticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
+			dticks = max(1, dticks);
 			ticks = timeout.ticks;
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
-
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
-
-		if (to == first() && announce_remaining == 0) {
+		if (insert_timeout(to, dticks) && announce_remaining == 0) {
 			if (!has_elapsed) {
 				/* In case of absolute timeout that is first to expire
 				 * elapsed need to be read from the system clock.
@@ -161,9 +303,8 @@ int z_abort_timeout(struct _timeout *to)
 
 	K_SPINLOCK(&timeout_lock) {
 		if (sys_dnode_is_linked(&to->node)) {
-			bool is_first = (to == first());
+			bool is_first = abort_timeout(to);
 
-			remove_timeout(to);
 			to->dticks = TIMEOUT_DTICKS_ABORTED;
 			ret = 0;
 			if (is_first) {
@@ -175,21 +316,6 @@ int z_abort_timeout(struct _timeout *to)
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
-
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks;
-}
-
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
@@ -246,27 +372,16 @@ void sys_clock_announce(int32_t ticks)
 	announce_remaining = ticks;
 
 	struct _timeout *t;
+	int dt;
 
-	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
-	     t = first()) {
-		int dt = t->dticks;
-
-		curr_tick += dt;
-		t->dticks = 0;
-		remove_timeout(t);
-
+	for (t = pop_expired(&dt); t != NULL; t = pop_expired(&dt)) {
 		k_spin_unlock(&timeout_lock, key);
 		t->fn(t);
 		key = k_spin_lock(&timeout_lock);
 		announce_remaining -= dt;
 	}
 
-	if (t != NULL) {
-		t->dticks -= announce_remaining;
-	}
-
-	curr_tick += announce_remaining;
+	advance(announce_remaining);
 	announce_remaining = 0;
 
 	sys_clock_set_timeout(next_timeout(0), false);
@@ -350,7 +465,14 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_WHEEL
+	K_SPINLOCK(&timeout_lock) {
+		z_timeout_wheel_rebase(&timeout_wheel, tick);
+		curr_tick = tick;
+	}
+#else
 	curr_tick = tick;
+#endif /* CONFIG_TIMEOUT_WHEEL */
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/math_extras.h>
+#include <timeout_wheel.h>
+
+#define SLOT_MASK (Z_TIMEOUT_WHEEL_SLOTS - 1U)
+#define LEVELS    CONFIG_TIMEOUT_WHEEL_LEVELS
+
+static struct _timeout *to_timeout(sys_dnode_t *node)
+{
+	return CONTAINER_OF(node, struct _timeout, node);
+}
+
+static unsigned int level_of(uint64_t expiry, uint64_t now)
+{
+	uint64_t diff = expiry ^ now;
+
+	if (diff < Z_TIMEOUT_WHEEL_SLOTS) {
+		return 0;
+	}
+
+	return (63U - u64_count_leading_zeros(diff)) / Z_TIMEOUT_WHEEL_SLOT_BITS;
+}
+
+static unsigned int slot_of(uint64_t expiry, unsigned int level)
+{
+	return (expiry >> (level * Z_TIMEOUT_WHEEL_SLOT_BITS)) & SLOT_MASK;
+}
+
+/* List a timeout with the given expiry is queued in, NULL for the overflow list */
+static sys_dlist_t *list_of(struct z_timeout_wheel *wheel, uint64_t expiry, unsigned int *level,
+			    unsigned int *slot)
+{
+	*level = level_of(expiry, wheel->now);
+	if (*level >= LEVELS) {
+		return NULL;
+	}
+
+	*slot = slot_of(expiry, *level);
+
+	return &wheel->slots[*level][*slot];
+}
+
+static void place(struct z_timeout_wheel *wheel, struct _timeout *to)
+{
+	uint64_t expiry = (uint64_t)to->dticks;
+	unsigned int level, slot;
+	sys_dlist_t *list = list_of(wheel, expiry, &level, &slot);
+
+	if (list == NULL) {
+		if (!wheel->has_overflow) {
+			sys_dlist_init(&wheel->overflow);
+			wheel->has_overflow = true;
+		}
+		sys_dlist_append(&wheel->overflow, &to->node);
+		return;
+	}
+
+	if ((wheel->occupied[level] & BIT64(slot)) == 0U) {
+		sys_dlist_init(list);
+		wheel->occupied[level] |= BIT64(slot);
+	}
+	sys_dlist_append(list, &to->node);
+}
+
+/* Move the timeouts of a slot, or the overflow list, to where they belong at the current tick */
+static void cascade(struct z_timeout_wheel *wheel, sys_dlist_t *list)
+{
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+
+	/* Timeouts from the overflow list may go back to it */
+	sys_dlist_init(&pending);
+	while ((node = sys_dlist_get(list)) != NULL) {
+		sys_dlist_append(&pending, node);
+	}
+
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		place(wheel, to_timeout(node));
+	}
+}
+
+static uint64_t min_expiry(sys_dlist_t *list)
+{
+	uint64_t expiry = UINT64_MAX;
+	sys_dnode_t *node;
+
+	SYS_DLIST_FOR_EACH_NODE(list, node) {
+		expiry = MIN(expiry, (uint64_t)to_timeout(node)->dticks);
+	}
+
+	return expiry;
+}
+
+bool z_timeout_wheel_add(struct z_timeout_wheel *wheel, struct _timeout *to, uint64_t expiry)
+{
+	__ASSERT(expiry >= wheel->now, "timeout expires in the past");
+
+	to->dticks = (int64_t)expiry;
+	place(wheel, to);
+
+	if (!wheel->first_valid) {
+		return true;
+	}
+
+	if (expiry < wheel->first) {
+		wheel->first = expiry;
+		return true;
+	}
+
+	return false;
+}
+
+void z_timeout_wheel_remove(struct z_timeout_wheel *wheel, struct _timeout *to)
+{
+	uint64_t expiry = (uint64_t)to->dticks;
+	unsigned int level, slot;
+	sys_dlist_t *list = list_of(wheel, expiry, &level, &slot);
+
+	sys_dlist_remove(&to->node);
+
+	if (list == NULL) {
+		wheel->has_overflow = !sys_dlist_is_empty(&wheel->overflow);
+	} else if (sys_dlist_is_empty(list)) {
+		wheel->occupied[level] &= ~BIT64(slot);
+	}
+
+	if (expiry == wheel->first) {
+		wheel->first_valid = false;
+	}
+}
+
+uint64_t z_timeout_wheel_first(struct z_timeout_wheel *wheel)
+{
+	if (wheel->first_valid) {
+		return wheel->first;
+	}
+
+	wheel->first = UINT64_MAX;
+	for (unsigned int level = 0; level < LEVELS; level++) {
+		unsigned int slot;
+
+		if (wheel->occupied[level] == 0U) {
+			continue;
+		}
+
+		/* No timeout of a level expires before one of a lower level,
+		 * and the slots of a level that are behind the current tick
+		 * are empty.
+		 */
+		slot = u64_count_trailing_zeros(wheel->occupied[level]);
+		if (level == 0) {
+			wheel->first = (wheel->now & ~(uint64_t)SLOT_MASK) | slot;
+		} else {
+			wheel->first = min_expiry(&wheel->slots[level][slot]);
+		}
+		break;
+	}
+
+	if (wheel->first == UINT64_MAX && wheel->has_overflow) {
+		wheel->first = min_expiry(&wheel->overflow);
+	}
+
+	wheel->first_valid = true;
+
+	return wheel->first;
+}
+
+struct _timeout *z_timeout_wheel_expired(struct z_timeout_wheel *wheel, uint64_t limit)
+{
+	uint64_t expiry = z_timeout_wheel_first(wheel);
+
+	if (expiry > limit) {
+		return NULL;
+	}
+
+	z_timeout_wheel_advance(wheel, expiry);
+
+	return to_timeout(sys_dlist_peek_head(&wheel->slots[0][slot_of(expiry, 0)]));
+}
+
+void z_timeout_wheel_advance(struct z_timeout_wheel *wheel, uint64_t tick)
+{
+	uint64_t changed = wheel->now ^ tick;
+
+	__ASSERT(tick >= wheel->now, "timing wheel can't go back in time");
+
+	wheel->now = tick;
+
+	if (wheel->has_overflow && (changed >> (LEVELS * Z_TIMEOUT_WHEEL_SLOT_BITS)) != 0U) {
+		wheel->has_overflow = false;
+		cascade(wheel, &wheel->overflow);
+	}
+
+	/* Slots the wheel moved past are empty, as no timeout expires before
+	 * the new tick: only the slot it moved into needs to be cascaded, from
+	 * the highest level down.
+	 */
+	for (unsigned int level = LEVELS - 1U; level > 0U; level--) {
+		unsigned int slot = slot_of(tick, level);
+
+		if ((changed >> (level * Z_TIMEOUT_WHEEL_SLOT_BITS)) == 0U ||
+		    (wheel->occupied[level] & BIT64(slot)) == 0U) {
+			continue;
+		}
+
+		wheel->occupied[level] &= ~BIT64(slot);
+		cascade(wheel, &wheel->slots[level][slot]);
+	}
+}
+
+void z_timeout_wheel_rebase(struct z_timeout_wheel *wheel, uint64_t tick)
+{
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+
+	sys_dlist_init(&pending);
+
+	for (unsigned int level = 0; level < LEVELS; level++) {
+		for (unsigned int slot = 0; slot < Z_TIMEOUT_WHEEL_SLOTS; slot++) {
+			if ((wheel->occupied[level] & BIT64(slot)) == 0U) {
+				continue;
+			}
+			while ((node = sys_dlist_get(&wheel->slots[level][slot])) != NULL) {
+				sys_dlist_append(&pending, node);
+			}
+		}
+		wheel->occupied[level] = 0U;
+	}
+
+	if (wheel->has_overflow) {
+		while ((node = sys_dlist_get(&wheel->overflow)) != NULL) {
+			sys_dlist_append(&pending, node);
+		}
+		wheel->has_overflow = false;
+	}
+
+	/* Keep the remaining time, and the order of timeouts expiring together */
+	SYS_DLIST_FOR_EACH_NODE(&pending, node) {
+		struct _timeout *to = to_timeout(node);
+
+		to->dticks = (int64_t)(tick + ((uint64_t)to->dticks - wheel->now));
+	}
+
+	wheel->now = tick;
+	wheel->first_valid = false;
+
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		place(wheel, to_timeout(node));
+	}
+}
@@ -192,6 +192,9 @@ static void queue_flusher_locked(struct k_work_q *queue,
 				 struct z_work_flusher *flusher)
 {
 	init_flusher(flusher);
+#if defined(CONFIG_WORKQUEUE_POOL)
+	flusher->target = work;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 
 	if ((flags_get(&work->flags) & K_WORK_QUEUED) != 0U) {
 		sys_slist_insert(&queue->pending, &work->node,
@@ -216,6 +219,94 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 	}
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+/* Test whether a thread of a pool may process a work item.
+ *
+ * Invoked with work lock held.
+ *
+ * @param work a work item on the queue of a pool
+ *
+ * @retval false if the item is running on another thread of the pool, or
+ * is the flusher of an item that is.  The thread running the item takes it
+ * once the item completes.
+ * @retval true otherwise
+ */
+static inline bool pool_work_ready_locked(struct k_work *work)
+{
+	if (flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+		return false;
+	}
+
+	if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
+		struct z_work_flusher *flusher
+			= CONTAINER_OF(work, struct z_work_flusher, work);
+
+		return !flag_test(&flusher->target->flags, K_WORK_RUNNING_BIT);
+	}
+
+	return true;
+}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+/* Take the next work item to be processed from a queue.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue to take the work from
+ *
+ * @return the node of the work item, or null if there is none the calling
+ * queue thread may process.
+ */
+static inline sys_snode_t *queue_get_locked(struct k_work_q *queue)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue->pool_threads != NULL) {
+		struct k_work *work;
+		sys_snode_t *prev = NULL;
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&queue->pending, work, node) {
+			if (pool_work_ready_locked(work)) {
+				sys_slist_remove(&queue->pending, prev, &work->node);
+				return &work->node;
+			}
+			prev = &work->node;
+		}
+
+		return NULL;
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	return sys_slist_get(&queue->pending);
+}
+
+/* Test whether a thread animates a queue.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue
+ * @param thread the thread
+ *
+ * @return true if and only if @p thread is the queue thread, or one of the
+ * threads of a pool.
+ */
+static inline bool queue_has_thread_locked(const struct k_work_q *queue,
+					   const struct k_thread *thread)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue->pool_threads != NULL) {
+		for (size_t i = 0; i < queue->pool_size; i++) {
+			if (thread == &queue->pool_threads[i]) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	return thread == queue->thread_id;
+}
+
 /* Potentially notify a queue that it needs to look for pending work.
  *
  * This may make the work queue thread ready, but as the lock is held it
@@ -265,7 +356,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret;
-	bool chained = (_current == queue->thread_id) && !k_is_in_isr();
+	bool chained = queue_has_thread_locked(queue, _current) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -667,12 +758,15 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		bool yield;
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
+		node = queue_get_locked(queue);
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
 			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#if defined(CONFIG_WORKQUEUE_POOL)
+			queue->pool_busy++;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 			work = CONTAINER_OF(node, struct k_work, node);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
@@ -690,8 +784,10 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * This means that if node is not NULL, then work will not be NULL.
 			 */
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
-					       K_WORK_QUEUE_DRAIN_BIT)) {
+		} else if (!flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT)
+			   && sys_slist_is_empty(&queue->pending)
+			   && flag_test_and_clear(&queue->flags,
+						  K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
 			 * immediate reschedule; released threads get their
@@ -705,6 +801,16 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		} else if (flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
 			/* User has requested that the queue stop. Clear the status flags and exit.
 			 */
+#if defined(CONFIG_WORKQUEUE_POOL)
+			/* The last thread of a pool to exit does, after waking
+			 * up the next one.
+			 */
+			if ((queue->pool_threads != NULL) && (--queue->pool_live > 0U)) {
+				(void)notify_queue_locked(queue);
+				k_spin_unlock(&lock, key);
+				return;
+			}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 			flags_set(&queue->flags, 0);
 			k_spin_unlock(&lock, key);
 			return;
@@ -755,7 +861,14 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+		/* Other threads of a pool may still be busy */
+		if (--queue->pool_busy == 0U) {
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
+#else
 		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -804,6 +917,9 @@ void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+#if defined(CONFIG_WORKQUEUE_POOL)
+	queue->pool_threads = NULL;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 	queue->thread_id = _current;
 	flags_set(&queue->flags, flags);
 	work_queue_main(queue, NULL, NULL);
@@ -826,6 +942,9 @@ void k_work_queue_start(struct k_work_q *queue,
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+#if defined(CONFIG_WORKQUEUE_POOL)
+	queue->pool_threads = NULL;
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
 
 	if ((cfg != NULL) && cfg->no_yield) {
 		flags |= K_WORK_QUEUE_NO_YIELD;
@@ -863,6 +982,67 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#if defined(CONFIG_WORKQUEUE_POOL)
+void k_work_queue_pool_start(struct k_work_q *queue, struct k_thread *threads,
+			     k_thread_stack_t *stacks, size_t num_threads, size_t stack_size,
+			     int prio, const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(threads);
+	__ASSERT_NO_MSG(stacks);
+	__ASSERT_NO_MSG((num_threads > 0U) && (num_threads <= UINT16_MAX));
+	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+
+	uint32_t flags = K_WORK_QUEUE_STARTED;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+	sys_slist_init(&queue->pending);
+	z_waitq_init(&queue->notifyq);
+	z_waitq_init(&queue->drainq);
+	queue->pool_threads = threads;
+	queue->pool_size = num_threads;
+	queue->pool_busy = 0U;
+	queue->pool_live = num_threads;
+
+	if ((cfg != NULL) && cfg->no_yield) {
+		flags |= K_WORK_QUEUE_NO_YIELD;
+	}
+
+#if defined(CONFIG_WORKQUEUE_WORK_TIMEOUT)
+	/* A single timeout record can't monitor the threads of a pool */
+	queue->work_timeout = K_FOREVER;
+#endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
+
+	flags_set(&queue->flags, flags);
+
+	for (size_t i = 0; i < num_threads; i++) {
+		/* Stride of K_THREAD_STACK_ARRAY_DEFINE() */
+		k_thread_stack_t *stack = stacks + (i * K_THREAD_STACK_LEN(stack_size));
+
+		(void)k_thread_create(&threads[i], stack, stack_size,
+				      work_queue_main, queue, NULL, NULL,
+				      prio, 0, K_FOREVER);
+
+		if ((cfg != NULL) && (cfg->name != NULL)) {
+			k_thread_name_set(&threads[i], cfg->name);
+		}
+
+		if ((cfg != NULL) && (cfg->essential)) {
+			threads[i].base.user_options |= K_ESSENTIAL;
+		}
+	}
+
+	queue->thread_id = &threads[0];
+
+	for (size_t i = 0; i < num_threads; i++) {
+		k_thread_start(&threads[i]);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
+}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -915,13 +1095,55 @@ int k_work_queue_unplug(struct k_work_q *queue)
 	return ret;
 }
 
+/* The thread whose options tell whether a queue is essential. */
+static inline struct k_thread *queue_essential_thread(struct k_work_q *queue)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue->pool_threads != NULL) {
+		return &queue->pool_threads[0];
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	return &queue->thread;
+}
+
+/* Wait for the threads animating a queue to exit.
+ *
+ * On timeout, the threads of a pool that exited already are not restarted:
+ * the pool continues with the remaining ones.
+ *
+ * @retval 0 if all threads exited
+ * @retval negative as returned by k_thread_join() otherwise
+ */
+static int queue_join(struct k_work_q *queue, k_timeout_t timeout)
+{
+#if defined(CONFIG_WORKQUEUE_POOL)
+	if (queue->pool_threads != NULL) {
+		k_timepoint_t end = sys_timepoint_calc(timeout);
+
+		for (size_t i = 0; i < queue->pool_size; i++) {
+			int ret = k_thread_join(&queue->pool_threads[i],
+						sys_timepoint_timeout(end));
+
+			if (ret != 0) {
+				return ret;
+			}
+		}
+
+		return 0;
+	}
+#endif /* defined(CONFIG_WORKQUEUE_POOL) */
+
+	return k_thread_join(queue->thread_id, timeout);
+}
+
 int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 {
 	__ASSERT_NO_MSG(queue);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, stop, queue, timeout);
 
-	if (z_is_thread_essential(&queue->thread)) {
+	if (z_is_thread_essential(queue_essential_thread(queue))) {
 		return -ENOTSUP;
 	}
 
@@ -943,7 +1165,7 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 	notify_queue_locked(queue);
 	k_spin_unlock(&lock, key);
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work_queue, stop, queue, timeout);
-	if (k_thread_join(queue->thread_id, timeout)) {
+	if (queue_join(queue, timeout)) {
 		key = k_spin_lock(&lock);
 		flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
 		k_spin_unlock(&lock, key);
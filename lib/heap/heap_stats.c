@@ -19,6 +19,10 @@ int sys_heap_runtime_stats_get(struct sys_heap *heap,
 	stats->allocated_bytes = heap->heap->allocated_bytes;
 	stats->max_allocated_bytes = heap->heap->max_allocated_bytes;
 
+#ifdef CONFIG_HEAP_MEM_POOL_SLABS
+	z_malloc_slab_runtime_stats_add(heap, stats);
+#endif /* CONFIG_HEAP_MEM_POOL_SLABS */
+
 	return 0;
 }
 
@@ -30,5 +34,9 @@ int sys_heap_runtime_stats_reset_max(struct sys_heap *heap)
 
 	heap->heap->max_allocated_bytes = heap->heap->allocated_bytes;
 
+#ifdef CONFIG_HEAP_MEM_POOL_SLABS
+	z_malloc_slab_runtime_stats_reset_max(heap);
+#endif /* CONFIG_HEAP_MEM_POOL_SLABS */
+
 	return 0;
 }
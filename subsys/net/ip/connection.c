@@ -113,6 +113,136 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#if defined(CONFIG_NET_CONN_HASH)
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_NET_CONN_HASH_BUCKETS),
+	     "CONFIG_NET_CONN_HASH_BUCKETS must be a power of two");
+
+/** Remote and local address and port specified, the highest rank */
+#define NET_CONN_EXACT (NET_CONN_REMOTE_PORT_SPEC | NET_CONN_LOCAL_PORT_SPEC | \
+			NET_CONN_REMOTE_ADDR_SPEC | NET_CONN_LOCAL_ADDR_SPEC)
+
+#define NET_CONN_HASH_MULT 0x9e3779b1U
+
+/* The lists below are protected by conn_lock, like conn_used. Each is kept in
+ * the conn_used order, by decreasing registration sequence number, also when
+ * net_conn_update() moves a connection, so that the first of equally ranked
+ * matches is the same as in a linear scan.
+ */
+
+/* Sequence number of the last registered connection */
+static uint32_t conn_hash_seq;
+
+/* Fully specified connections, by remote address and both ports */
+static sys_slist_t conn_hash_exact[CONFIG_NET_CONN_HASH_BUCKETS];
+
+/* Other connections bound to a local port, by that port */
+static sys_slist_t conn_hash_port[CONFIG_NET_CONN_HASH_BUCKETS];
+
+/* The remaining UDP and TCP connections */
+static sys_slist_t conn_wildcard;
+
+static uint32_t conn_hash_mix(uint32_t key)
+{
+	key *= NET_CONN_HASH_MULT;
+
+	return (key ^ (key >> 16)) & (CONFIG_NET_CONN_HASH_BUCKETS - 1);
+}
+
+/* Ports are in network byte order, as in the packet headers */
+static uint32_t conn_hash_addr(const uint8_t *addr, size_t len,
+			       uint16_t remote_port, uint16_t local_port)
+{
+	uint32_t key = ((uint32_t)remote_port << 16) | local_port;
+
+	for (size_t i = 0; i < len; i += sizeof(uint32_t)) {
+		key = (key ^ UNALIGNED_GET((const uint32_t *)&addr[i])) *
+		      NET_CONN_HASH_MULT;
+	}
+
+	return conn_hash_mix(key);
+}
+
+static sys_slist_t *conn_hash_bucket(struct net_conn *conn)
+{
+	struct sockaddr *remote = &conn->remote_addr;
+	uint16_t local_port = net_sin(&conn->local_addr)->sin_port;
+
+	if (conn->family != AF_INET && conn->family != AF_INET6 &&
+	    conn->family != AF_UNSPEC) {
+		/* Never matched by net_conn_input() */
+		return NULL;
+	}
+
+	if ((conn->flags & NET_CONN_EXACT) == NET_CONN_EXACT) {
+		if (IS_ENABLED(CONFIG_NET_IPV6) && remote->sa_family == AF_INET6) {
+			return &conn_hash_exact[conn_hash_addr(
+				net_sin6(remote)->sin6_addr.s6_addr,
+				sizeof(struct in6_addr),
+				net_sin(remote)->sin_port, local_port)];
+		}
+
+		if (IS_ENABLED(CONFIG_NET_IPV4) && remote->sa_family == AF_INET) {
+			return &conn_hash_exact[conn_hash_addr(
+				net_sin(remote)->sin_addr.s4_addr,
+				sizeof(struct in_addr),
+				net_sin(remote)->sin_port, local_port)];
+		}
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0) {
+		return &conn_hash_port[conn_hash_mix(local_port)];
+	}
+
+	return &conn_wildcard;
+}
+
+/* Called with conn_lock held, whenever the addresses or ports change. New
+ * connections go first, updated ones after the newer ones.
+ */
+static void conn_hash_add(struct net_conn *conn)
+{
+	sys_snode_t *prev = NULL;
+	struct net_conn *other;
+
+	conn->bucket = conn_hash_bucket(conn);
+	if (conn->bucket == NULL) {
+		return;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(conn->bucket, other, hash_node) {
+		if ((int32_t)(other->seq - conn->seq) < 0) {
+			break;
+		}
+
+		prev = &other->hash_node;
+	}
+
+	sys_slist_insert(conn->bucket, prev, &conn->hash_node);
+}
+
+static void conn_hash_del(struct net_conn *conn)
+{
+	if (conn->bucket != NULL) {
+		sys_slist_find_and_remove(conn->bucket, &conn->hash_node);
+		conn->bucket = NULL;
+	}
+}
+
+static void conn_hash_init(void)
+{
+	ARRAY_FOR_EACH(conn_hash_exact, i) {
+		sys_slist_init(&conn_hash_exact[i]);
+		sys_slist_init(&conn_hash_port[i]);
+	}
+
+	sys_slist_init(&conn_wildcard);
+}
+#else
+#define conn_hash_add(...)
+#define conn_hash_del(...)
+#define conn_hash_init(...)
+#endif /* CONFIG_NET_CONN_HASH */
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -138,6 +268,10 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+#if defined(CONFIG_NET_CONN_HASH)
+	conn->seq = ++conn_hash_seq;
+#endif
+	conn_hash_add(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -463,6 +597,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+	conn_hash_del(conn);
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -489,15 +624,25 @@ int net_conn_update(struct net_conn_handle *handle,
 		return -ENOENT;
 	}
 
+	/* Move the connection to the bucket of its new addresses and ports
+	 * without a lookup seeing it half updated.
+	 */
+	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn_hash_del(conn);
+
 	net_conn_change_callback(conn, cb, user_data);
 
 	ret = net_conn_change_local(conn, local_addr, local_port);
 	if (ret < 0) {
-		return ret;
+		goto out;
 	}
 
 	ret = net_conn_change_remote(conn, remote_addr, remote_port);
 
+out:
+	conn_hash_add(conn);
+	k_mutex_unlock(&conn_lock);
+
 	return ret;
 }
 
@@ -844,6 +989,155 @@ enum net_verdict net_conn_can_input(struct net_pkt *pkt, uint8_t proto)
 }
 #endif /* defined(CONFIG_NET_SOCKETS_CAN) */
 
+/* Is the candidate connection matching the packet's addresses and ports? */
+static bool conn_is_matching(struct net_conn *conn, struct net_pkt *pkt,
+			     union net_ip_header *ip_hdr, uint8_t proto,
+			     uint16_t src_port, uint16_t dst_port)
+{
+	uint8_t pkt_family = net_pkt_family(pkt);
+
+	/* Is the candidate connection matching the packet's interface? */
+	if (!is_iface_matching(conn, pkt)) {
+		return false; /* wrong interface */
+	}
+
+	/* Is the candidate connection matching the packet's protocol family? */
+	if (conn->family != AF_UNSPEC && conn->family != pkt_family) {
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+			      !conn->v6only && conn->type != SOCK_RAW)) {
+				return false;
+			}
+		} else {
+			return false; /* wrong protocol family */
+		}
+
+		/* We might have a match for v4-to-v6 mapping, check more */
+	}
+
+	/* Is the candidate connection matching the packet's protocol within the family? */
+	if (conn->proto != proto) {
+		return false; /* wrong protocol */
+	}
+
+	/* Apply protocol-specific matching criteria... */
+	uint8_t conn_family = conn->family;
+
+	if (!((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
+	      (conn_family == AF_INET || conn_family == AF_INET6 ||
+	       conn_family == AF_UNSPEC))) {
+		return false;
+	}
+
+	/* Is the candidate connection matching the packet's TCP/UDP
+	 * address and port?
+	 */
+	if ((conn->flags & NET_CONN_REMOTE_PORT_SPEC) != 0 &&
+	    net_sin(&conn->remote_addr)->sin_port != src_port) {
+		return false; /* wrong remote port */
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0 &&
+	    net_sin(&conn->local_addr)->sin_port != dst_port) {
+		return false; /* wrong local port */
+	}
+
+	if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) != 0 &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+		return false; /* wrong remote address */
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) != 0 &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+
+		/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
+		 * has no IPV6_V6ONLY option set and if the local IPV6 address
+		 * is unspecified, then we could accept a connection from IPv4
+		 * address by mapping it to IPv6 address.
+		 */
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+			      !conn->v6only &&
+			      net_ipv6_is_addr_unspecified(
+				      &net_sin6(&conn->local_addr)->sin6_addr))) {
+				return false; /* wrong local address */
+			}
+		} else {
+			return false; /* wrong local address */
+		}
+
+		/* We might have a match for v4-to-v6 mapping,
+		 * continue with rank checking.
+		 */
+	}
+
+	return true;
+}
+
+#if defined(CONFIG_NET_CONN_HASH)
+static struct net_conn *conn_hash_best(sys_slist_t *list, struct net_conn *best_match,
+				       struct net_pkt *pkt, union net_ip_header *ip_hdr,
+				       uint8_t proto, uint16_t src_port, uint16_t dst_port)
+{
+	struct net_conn *conn;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(list, conn, hash_node) {
+		if ((best_match == NULL ||
+		     NET_CONN_RANK(best_match->flags) < NET_CONN_RANK(conn->flags)) &&
+		    conn_is_matching(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+			best_match = conn;
+		}
+	}
+
+	return best_match;
+}
+
+/* Find the best ranked unicast match among the connections that can match
+ * the packet, with the same result as a scan of conn_used. Called with
+ * conn_lock held.
+ */
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt, union net_ip_header *ip_hdr,
+					 uint8_t proto, uint16_t src_port, uint16_t dst_port)
+{
+	struct net_conn *best_match;
+	const uint8_t *src;
+	size_t len;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		src = ip_hdr->ipv6->src;
+		len = sizeof(struct in6_addr);
+	} else {
+		src = ip_hdr->ipv4->src;
+		len = sizeof(struct in_addr);
+	}
+
+	/* Nothing outranks a fully specified connection */
+	best_match = conn_hash_best(&conn_hash_exact[conn_hash_addr(src, len, src_port,
+								    dst_port)],
+				    NULL, pkt, ip_hdr, proto, src_port, dst_port);
+	if (best_match != NULL) {
+		return best_match;
+	}
+
+	/* The ranks of the two lists differ in NET_CONN_LOCAL_PORT_SPEC, so
+	 * there are no ties between them.
+	 */
+	best_match = conn_hash_best(&conn_hash_port[conn_hash_mix(dst_port)], NULL,
+				    pkt, ip_hdr, proto, src_port, dst_port);
+
+	return conn_hash_best(&conn_wildcard, best_match, pkt, ip_hdr, proto,
+			      src_port, dst_port);
+}
+#else
+static inline struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+						union net_ip_header *ip_hdr,
+						uint8_t proto, uint16_t src_port,
+						uint16_t dst_port)
+{
+	return NULL;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 enum net_verdict net_conn_input(struct net_pkt *pkt,
 				union net_ip_header *ip_hdr,
 				uint8_t proto,
@@ -909,77 +1203,15 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
-		/* Is the candidate connection matching the packet's interface? */
-		if (!is_iface_matching(conn, pkt)) {
-			continue; /* wrong interface */
-		}
-
-		/* Is the candidate connection matching the packet's protocol family? */
-		if (conn->family != AF_UNSPEC && conn->family != pkt_family) {
-			if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-				if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-				      !conn->v6only && conn->type != SOCK_RAW)) {
-					continue;
-				}
-			} else {
-				continue; /* wrong protocol family */
-			}
-
-			/* We might have a match for v4-to-v6 mapping, check more */
-		}
-
-		/* Is the candidate connection matching the packet's protocol within the family? */
-		if (conn->proto != proto) {
-			continue; /* wrong protocol */
-		}
-
-		/* Apply protocol-specific matching criteria... */
-		uint8_t conn_family = conn->family;
-
-		if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
-		    (conn_family == AF_INET || conn_family == AF_INET6 ||
-		     conn_family == AF_UNSPEC)) {
-			/* Is the candidate connection matching the packet's TCP/UDP
-			 * address and port?
-			 */
-			if ((conn->flags & NET_CONN_REMOTE_PORT_SPEC) != 0 &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
-
-			if ((conn->flags & NET_CONN_LOCAL_PORT_SPEC) != 0 &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
-			}
-
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) != 0 &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
-			}
-
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) != 0 &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
-
-				/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
-				 * has no IPV6_V6ONLY option set and if the local IPV6 address
-				 * is unspecified, then we could accept a connection from IPv4
-				 * address by mapping it to IPv6 address.
-				 */
-				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-					if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-					      !conn->v6only &&
-					      net_ipv6_is_addr_unspecified(
-						      &net_sin6(&conn->local_addr)->sin6_addr))) {
-						continue; /* wrong local address */
-					}
-				} else {
-					continue; /* wrong local address */
-				}
-
-				/* We might have a match for v4-to-v6 mapping,
-				 * continue with rank checking.
-				 */
+	/* A multicast packet goes to every matching connection, which still
+	 * takes a scan of all of them.
+	 */
+	if (IS_ENABLED(CONFIG_NET_CONN_HASH) && !is_mcast_pkt) {
+		best_match = conn_hash_lookup(pkt, ip_hdr, proto, src_port, dst_port);
+	} else {
+		SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
+			if (!conn_is_matching(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+				continue;
 			}
 
 			if (best_rank < NET_CONN_RANK(conn->flags)) {
@@ -1019,8 +1251,8 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 				mcast_pkt_delivered = true;
 			}
-		}
-	} /* loop end */
+		} /* loop end */
+	}
 
 	if (best_match != NULL) {
 		cb = best_match->cb;
@@ -1090,6 +1322,7 @@ void net_conn_init(void)
 
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
+	conn_hash_init();
 
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
@@ -85,6 +85,17 @@ struct net_conn {
 
 	/** Is v4-mapping-to-v6 enabled for this connection */
 	uint8_t v6only : 1;
+
+#if defined(CONFIG_NET_CONN_HASH)
+	/** Node in the hash bucket or wildcard list */
+	sys_snode_t hash_node;
+
+	/** The hash bucket or wildcard list the connection is in */
+	sys_slist_t *bucket;
+
+	/** Registration sequence number, orders the bucket like conn_used */
+	uint32_t seq;
+#endif /* CONFIG_NET_CONN_HASH */
 };
 
 /**
@@ -32,7 +32,7 @@ LOG_MODULE_REGISTER(net_route, CONFIG_NET_ROUTE_LOG_LEVEL);
 /* We keep track of the routes in a separate list so that we can remove
  * the oldest routes (at tail) if needed.
  */
-static sys_slist_t routes;
+static sys_dlist_t routes = SYS_DLIST_STATIC_INIT(&routes);
 
 /* Track currently active route lifetime timers */
 static sys_slist_t active_route_lifetime_timers;
@@ -263,19 +263,246 @@ static int nbr_nexthop_put(struct net_nbr *nbr)
 /* Route was accessed, so place it in front of the routes list */
 static inline void update_route_access(struct net_route_entry *route)
 {
-	sys_slist_find_and_remove(&routes, &route->node);
-	sys_slist_prepend(&routes, &route->node);
+	sys_dlist_remove(&route->node);
+	sys_dlist_prepend(&routes, &route->node);
 }
 
-struct net_route_entry *net_route_lookup(struct net_if *iface,
-					 struct in6_addr *dst)
+static inline void route_list_remove(struct net_route_entry *route)
+{
+	if (sys_dnode_is_linked(&route->node)) {
+		sys_dlist_remove(&route->node);
+	}
+}
+
+#if defined(CONFIG_NET_ROUTE_TRIE)
+/* A path compressed binary trie of the route prefixes. A node holds the
+ * routes whose prefix is the node prefix, on any interface, and the nodes
+ * without routes branch into two children. With one node per prefix and
+ * fewer branch nodes than that, the pool cannot run out.
+ */
+struct net_route_trie_node {
+	/** Prefix, with the bits after prefix_len cleared */
+	struct in6_addr prefix;
+
+	struct net_route_trie_node *parent;
+	struct net_route_trie_node *child[2];
+
+	/** Routes with this prefix, the newest first */
+	sys_slist_t routes;
+
+	uint8_t prefix_len;
+};
+
+static struct net_route_trie_node route_trie_pool[2 * CONFIG_NET_MAX_ROUTES];
+static struct net_route_trie_node *route_trie_free;
+static struct net_route_trie_node *route_trie_root;
+
+static inline uint8_t route_trie_bit(const struct in6_addr *addr, uint8_t bit)
+{
+	return (addr->s6_addr[bit / 8U] >> (7U - (bit % 8U))) & 1U;
+}
+
+/* Number of leading bits two addresses have in common, up to max_len */
+static uint8_t route_trie_common_len(const struct in6_addr *a,
+				     const struct in6_addr *b,
+				     uint8_t max_len)
+{
+	uint8_t len = 0U;
+
+	for (int i = 0; i < sizeof(struct in6_addr) && len < max_len; i++) {
+		uint8_t diff = a->s6_addr[i] ^ b->s6_addr[i];
+
+		if (diff != 0U) {
+			len += 8U - find_msb_set(diff);
+			break;
+		}
+
+		len += 8U;
+	}
+
+	return MIN(len, max_len);
+}
+
+static struct net_route_trie_node *route_trie_node_new(const struct in6_addr *addr,
+							uint8_t prefix_len)
+{
+	struct net_route_trie_node *node = route_trie_free;
+
+	NET_ASSERT(node != NULL, "Route trie pool exhausted");
+
+	route_trie_free = node->parent;
+
+	memset(node, 0, sizeof(*node));
+	net_ipv6_addr_prefix_mask(addr->s6_addr, node->prefix.s6_addr, prefix_len);
+	node->prefix_len = prefix_len;
+
+	return node;
+}
+
+/* The free nodes are chained through their parent pointer */
+static void route_trie_node_free(struct net_route_trie_node *node)
+{
+	node->parent = route_trie_free;
+	route_trie_free = node;
+}
+
+static void route_trie_set_child(struct net_route_trie_node *parent,
+				 struct net_route_trie_node *child)
+{
+	if (parent == NULL) {
+		route_trie_root = child;
+	} else {
+		parent->child[route_trie_bit(&child->prefix, parent->prefix_len)] = child;
+	}
+
+	child->parent = parent;
+}
+
+static void route_trie_add(struct net_route_entry *route)
+{
+	struct net_route_trie_node *parent = NULL;
+	struct net_route_trie_node *node = route_trie_root;
+	struct net_route_trie_node *branch;
+	uint8_t prefix_len = route->prefix_len;
+	uint8_t common;
+
+	if (prefix_len > 128U) {
+		/* Cannot match any destination */
+		return;
+	}
+
+	/* Walk down while the node prefixes are prefixes of the route */
+	while (node != NULL) {
+		common = route_trie_common_len(&node->prefix, &route->addr,
+					       MIN(node->prefix_len, prefix_len));
+		if (common < node->prefix_len) {
+			break;
+		}
+
+		if (node->prefix_len == prefix_len) {
+			goto found;
+		}
+
+		parent = node;
+		node = node->child[route_trie_bit(&route->addr, node->prefix_len)];
+	}
+
+	if (node == NULL) {
+		node = route_trie_node_new(&route->addr, prefix_len);
+		route_trie_set_child(parent, node);
+		goto found;
+	}
+
+	/* The route prefix and the node part after common bits. Either the
+	 * route prefix ends there and gets the node as child, or a branch
+	 * node gets both.
+	 */
+	branch = route_trie_node_new(&route->addr, common);
+	route_trie_set_child(parent, branch);
+	route_trie_set_child(branch, node);
+
+	if (common == prefix_len) {
+		node = branch;
+	} else {
+		node = route_trie_node_new(&route->addr, prefix_len);
+		route_trie_set_child(branch, node);
+	}
+
+found:
+	sys_slist_prepend(&node->routes, &route->trie_entry);
+	route->trie_node = node;
+}
+
+static void route_trie_del(struct net_route_entry *route)
+{
+	struct net_route_trie_node *node = route->trie_node;
+	struct net_route_trie_node *parent;
+	struct net_route_trie_node *child;
+
+	if (node == NULL) {
+		return;
+	}
+
+	sys_slist_find_and_remove(&node->routes, &route->trie_entry);
+	route->trie_node = NULL;
+
+	/* Remove the nodes that neither hold routes nor branch anymore. A
+	 * node replaced by its only child leaves its parent unchanged, a
+	 * removed leaf can leave its parent with a single child.
+	 */
+	while (node != NULL && sys_slist_is_empty(&node->routes) &&
+	       (node->child[0] == NULL || node->child[1] == NULL)) {
+		parent = node->parent;
+		child = node->child[0] != NULL ? node->child[0] : node->child[1];
+
+		if (child != NULL) {
+			route_trie_set_child(parent, child);
+			route_trie_node_free(node);
+			break;
+		}
+
+		if (parent == NULL) {
+			route_trie_root = NULL;
+		} else {
+			parent->child[parent->child[1] == node] = NULL;
+		}
+
+		route_trie_node_free(node);
+		node = parent;
+	}
+}
+
+/* The nodes on the path to the destination have ever longer prefixes, so
+ * the last one holding a route for the interface is the longest match.
+ */
+static struct net_route_entry *route_find(struct net_if *iface,
+					  struct in6_addr *dst)
+{
+	struct net_route_trie_node *node = route_trie_root;
+	struct net_route_entry *found = NULL;
+	struct net_route_entry *route;
+
+	while (node != NULL &&
+	       net_ipv6_is_prefix(dst->s6_addr, node->prefix.s6_addr,
+				  node->prefix_len)) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&node->routes, route, trie_entry) {
+			if (iface == NULL || route->iface == iface) {
+				found = route;
+				break;
+			}
+		}
+
+		if (node->prefix_len == 128U) {
+			break;
+		}
+
+		node = node->child[route_trie_bit(dst, node->prefix_len)];
+	}
+
+	return found;
+}
+
+static void route_trie_init(void)
+{
+	route_trie_root = NULL;
+	route_trie_free = NULL;
+
+	ARRAY_FOR_EACH_PTR(route_trie_pool, node) {
+		route_trie_node_free(node);
+	}
+}
+#else
+#define route_trie_add(...)
+#define route_trie_del(...)
+#define route_trie_init(...)
+
+static struct net_route_entry *route_find(struct net_if *iface,
+					  struct in6_addr *dst)
 {
 	struct net_route_entry *route, *found = NULL;
 	uint8_t longest_match = 0U;
 	int i;
 
-	net_ipv6_nbr_lock();
-
 	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
 		struct net_nbr *nbr = get_nbr(i);
 
@@ -298,6 +525,86 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 		}
 	}
 
+	return found;
+}
+#endif /* CONFIG_NET_ROUTE_TRIE */
+
+#if CONFIG_NET_ROUTE_CACHE_SIZE > 0
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_NET_ROUTE_CACHE_SIZE),
+	     "CONFIG_NET_ROUTE_CACHE_SIZE must be a power of two");
+
+/* Recent lookups, by destination and the interface they were limited to.
+ * Emptied whenever a route is added or deleted, as that can change the
+ * longest match of any destination.
+ */
+struct route_cache_entry {
+	struct in6_addr dst;
+	struct net_if *iface;
+	struct net_route_entry *route;
+};
+
+static struct route_cache_entry route_cache[CONFIG_NET_ROUTE_CACHE_SIZE];
+
+static struct route_cache_entry *route_cache_slot(struct net_if *iface,
+						  struct in6_addr *dst)
+{
+	uint32_t key = UNALIGNED_GET(&dst->s6_addr32[2]) ^
+		       UNALIGNED_GET(&dst->s6_addr32[3]) ^
+		       (uint32_t)POINTER_TO_UINT(iface);
+
+	key *= 0x9e3779b1U;
+
+	return &route_cache[(key >> 16) & (CONFIG_NET_ROUTE_CACHE_SIZE - 1)];
+}
+
+static struct net_route_entry *route_cache_lookup(struct net_if *iface,
+						  struct in6_addr *dst)
+{
+	struct route_cache_entry *entry = route_cache_slot(iface, dst);
+
+	if (entry->route != NULL && entry->iface == iface &&
+	    net_ipv6_addr_cmp(&entry->dst, dst)) {
+		return entry->route;
+	}
+
+	return NULL;
+}
+
+static void route_cache_add(struct net_if *iface, struct in6_addr *dst,
+			    struct net_route_entry *route)
+{
+	struct route_cache_entry *entry = route_cache_slot(iface, dst);
+
+	net_ipaddr_copy(&entry->dst, dst);
+	entry->iface = iface;
+	entry->route = route;
+}
+
+static inline void route_cache_flush(void)
+{
+	memset(route_cache, 0, sizeof(route_cache));
+}
+#else
+#define route_cache_lookup(...) NULL
+#define route_cache_add(...)
+#define route_cache_flush(...)
+#endif /* CONFIG_NET_ROUTE_CACHE_SIZE > 0 */
+
+struct net_route_entry *net_route_lookup(struct net_if *iface,
+					 struct in6_addr *dst)
+{
+	struct net_route_entry *found;
+
+	net_ipv6_nbr_lock();
+
+	found = route_cache_lookup(iface, dst);
+	if (found == NULL) {
+		found = route_find(iface, dst);
+		if (found) {
+			route_cache_add(iface, dst, found);
+		}
+	}
+
 	if (found) {
 		net_route_info("Found", found, dst);
 
@@ -393,9 +700,9 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 	nbr = nbr_new(iface, addr, prefix_len);
 	if (!nbr) {
 		/* Remove the oldest route and try again */
-		sys_snode_t *last = sys_slist_peek_tail(&routes);
+		sys_dnode_t *last = sys_dlist_peek_tail(&routes);
 
-		sys_slist_find_and_remove(&routes, last);
+		sys_dlist_remove(last);
 
 		route = CONTAINER_OF(last,
 				     struct net_route_entry,
@@ -444,7 +751,9 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 
 	net_route_update_lifetime(route, lifetime);
 
-	sys_slist_prepend(&routes, &route->node);
+	sys_dlist_prepend(&routes, &route->node);
+	route_trie_add(route);
+	route_cache_flush();
 
 	tmp = nbr_nexthop_get(iface, nexthop);
 
@@ -586,7 +895,9 @@ int net_route_del(struct net_route_entry *route)
 		}
 	}
 
-	sys_slist_find_and_remove(&routes, &route->node);
+	route_list_remove(route);
+	route_trie_del(route);
+	route_cache_flush();
 
 	nbr = net_route_get_nbr(route);
 	if (!nbr) {
@@ -1155,5 +1466,6 @@ void net_route_init(void)
 #if defined(CONFIG_NET_ROUTE_MCAST)
 	memset(route_mcast_entries, 0, sizeof(route_mcast_entries));
 #endif
+	route_trie_init();
 	k_work_init_delayable(&route_lifetime_timer, route_lifetime_timeout);
 }
@@ -18,6 +18,7 @@ LOG_MODULE_REGISTER(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
 #endif
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_context.h>
+#include <zephyr/net/socket.h>
 #include <zephyr/net/udp.h>
 #include "ipv4.h"
 #include "ipv6.h"
@@ -65,10 +66,6 @@ static int tcp_tx_window =
 #define TCP_RTO_MS (tcp_rto)
 #endif
 
-/* Define the number of MSS sections the congestion window is initialized at */
-#define TCP_CONGESTION_INITIAL_WIN 1
-#define TCP_CONGESTION_INITIAL_SSTHRESH 3
-
 static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
 static K_MUTEX_DEFINE(tcp_lock);
@@ -494,19 +491,32 @@ static void tcp_derive_rto(struct tcp *conn)
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
+/* Initial window according to RFC6928 */
+static uint16_t tcp_ca_initial_win(struct tcp *conn)
+{
+	uint32_t mss = conn_mss(conn);
+	uint32_t win = MIN(CONFIG_NET_TCP_CONGESTION_INITIAL_WIN * mss,
+			   MAX(2 * mss, CONFIG_NET_TCP_CONGESTION_INITIAL_WIN * 1460U));
+
+	return MIN(win, UINT16_MAX);
+}
+
 /* Implementation according to RFC6582 */
 
 static void tcp_new_reno_log(struct tcp *conn, char *step)
 {
-	NET_DBG("[%p] ca %s, cwnd=%d, ssthres=%d, fast_pend=%i",
-		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
+	NET_DBG("[%p] ca %s %s, cwnd=%d, ssthres=%d, fast_pend=%i",
+		conn, conn->ca_ops->name, step, conn->ca.cwnd, conn->ca.ssthresh,
 		conn->ca.pending_fast_retransmit_bytes);
 }
 
 static void tcp_new_reno_init(struct tcp *conn)
 {
-	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
-	conn->ca.ssthresh = conn_mss(conn) * TCP_CONGESTION_INITIAL_SSTHRESH;
+	conn->ca.cwnd = tcp_ca_initial_win(conn);
+	/* Slow start until the first loss, the window is limited by the
+	 * receiver anyway.
+	 */
+	conn->ca.ssthresh = UINT16_MAX;
 	conn->ca.pending_fast_retransmit_bytes = 0;
 	tcp_new_reno_log(conn, "init");
 }
@@ -565,29 +575,233 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 	tcp_new_reno_log(conn, "pkts_acked");
 }
 
-static void tcp_ca_init(struct tcp *conn)
+static const struct tcp_ca_ops tcp_ca_new_reno = {
+	.name = "reno",
+	.init = tcp_new_reno_init,
+	.fast_retransmit = tcp_new_reno_fast_retransmit,
+	.timeout = tcp_new_reno_timeout,
+	.dup_ack = tcp_new_reno_dup_ack,
+	.pkts_acked = tcp_new_reno_pkts_acked,
+};
+
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+
+/* Implementation according to RFC9438, with C = 0.4 and beta = 0.7. The
+ * duplicate ACKs, the fast recovery and the slow start are handled like
+ * NewReno does.
+ */
+#define CUBIC_BETA 7 /* tenths */
+#define CUBIC_C 4 /* tenths */
+/* Limit the time in the cubic function to keep it within 64 bits */
+#define CUBIC_MAX_T_MS 100000
+
+static uint32_t tcp_cubic_cbrt(uint64_t x)
 {
+	uint64_t y = 0;
+
+	for (int s = 63; s >= 0; s -= 3) {
+		uint64_t b;
+
+		y <<= 1;
+		b = 3 * y * (y + 1) + 1;
+		if ((x >> s) >= b) {
+			x -= b << s;
+			y++;
+		}
+	}
+
+	return (uint32_t)y;
+}
+
+static void tcp_cubic_init(struct tcp *conn)
+{
+	conn->ca.w_max = 0;
+	conn->ca.epoch_start = 0;
 	tcp_new_reno_init(conn);
 }
 
+/* Remember the window at which the loss happened and reduce it */
+static void tcp_cubic_loss(struct tcp *conn)
+{
+	uint32_t cwnd = conn->ca.cwnd;
+
+	/* Fast convergence, leave bandwidth to new flows */
+	if (cwnd < conn->ca.w_max) {
+		conn->ca.w_max = (cwnd * (10 + CUBIC_BETA)) / 20;
+	} else {
+		conn->ca.w_max = cwnd;
+	}
+
+	conn->ca.epoch_start = 0;
+	conn->ca.ssthresh = MAX(conn_mss(conn) * 2,
+				(conn->unacked_len * CUBIC_BETA) / 10);
+}
+
+static void tcp_cubic_fast_retransmit(struct tcp *conn)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		tcp_cubic_loss(conn);
+		/* Account for the lost segments */
+		conn->ca.cwnd = MIN(conn_mss(conn) * 3 + conn->ca.ssthresh, UINT16_MAX);
+		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+		tcp_new_reno_log(conn, "fast_retransmit");
+	}
+}
+
+static void tcp_cubic_timeout(struct tcp *conn)
+{
+	tcp_cubic_loss(conn);
+	conn->ca.cwnd = conn_mss(conn);
+	tcp_new_reno_log(conn, "timeout");
+}
+
+static void tcp_cubic_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	uint32_t now = k_uptime_get_32();
+	uint32_t mss = conn_mss(conn);
+	uint32_t cwnd = conn->ca.cwnd;
+	uint32_t alpha;
+	uint32_t w_inc;
+	int64_t t;
+	int64_t target;
+
+	if ((conn->ca.pending_fast_retransmit_bytes != 0) ||
+	    (conn->ca.cwnd < conn->ca.ssthresh)) {
+		tcp_new_reno_pkts_acked(conn, acked_len);
+		return;
+	}
+
+	if (conn->ca.epoch_start == 0) {
+		conn->ca.epoch_start = MAX(now, 1U);
+		conn->ca.w_est = cwnd;
+
+		if (cwnd < conn->ca.w_max) {
+			/* K = cbrt((w_max - cwnd) / C) in seconds, with the
+			 * windows in segments
+			 */
+			conn->ca.k = tcp_cubic_cbrt(((uint64_t)(conn->ca.w_max - cwnd) *
+						     10U * NSEC_PER_SEC) / (CUBIC_C * mss));
+			conn->ca.origin = conn->ca.w_max;
+		} else {
+			conn->ca.k = 0;
+			conn->ca.origin = cwnd;
+		}
+	}
+
+	/* W_cubic(t) = C * (t - K)^3 + origin */
+	t = (int64_t)(now - conn->ca.epoch_start) - conn->ca.k;
+	t = CLAMP(t, -CUBIC_MAX_T_MS, CUBIC_MAX_T_MS);
+	target = conn->ca.origin +
+		 ((t * t * t / MSEC_PER_SEC) * CUBIC_C * mss) / (10 * USEC_PER_SEC);
+
+	/* Reno-friendly region, alpha = 3 * (1 - beta) / (1 + beta) */
+	alpha = (conn->ca.w_est < conn->ca.w_max) ? 9 : 17;
+	w_inc = DIV_ROUND_UP((uint64_t)alpha * mss * acked_len, 17U * cwnd);
+	conn->ca.w_est = MIN(conn->ca.w_est + w_inc, UINT16_MAX);
+	target = MAX(target, (int64_t)conn->ca.w_est);
+
+	/* Do not grow by more than half the window per round-trip time */
+	target = MIN(target, (int64_t)cwnd * 3 / 2);
+
+	if (target > cwnd) {
+		cwnd += DIV_ROUND_UP((target - cwnd) * acked_len, cwnd);
+		conn->ca.cwnd = MIN(cwnd, UINT16_MAX);
+	}
+
+	tcp_new_reno_log(conn, "pkts_acked");
+}
+
+static const struct tcp_ca_ops tcp_ca_cubic = {
+	.name = "cubic",
+	.init = tcp_cubic_init,
+	.fast_retransmit = tcp_cubic_fast_retransmit,
+	.timeout = tcp_cubic_timeout,
+	.dup_ack = tcp_new_reno_dup_ack,
+	.pkts_acked = tcp_cubic_pkts_acked,
+};
+#endif /* CONFIG_NET_TCP_CONGESTION_CUBIC */
+
+static const struct tcp_ca_ops *const tcp_ca_algos[] = {
+	&tcp_ca_new_reno,
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+	&tcp_ca_cubic,
+#endif
+};
+
+#ifdef CONFIG_NET_TCP_CONGESTION_DEFAULT_CUBIC
+#define TCP_CA_DEFAULT (&tcp_ca_cubic)
+#else
+#define TCP_CA_DEFAULT (&tcp_ca_new_reno)
+#endif
+
+static void tcp_ca_init(struct tcp *conn)
+{
+	conn->ca_ops->init(conn);
+}
+
 static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
-	tcp_new_reno_fast_retransmit(conn);
+	conn->ca_ops->fast_retransmit(conn);
 }
 
 static void tcp_ca_timeout(struct tcp *conn)
 {
-	tcp_new_reno_timeout(conn);
+	conn->ca_ops->timeout(conn);
 }
 
 static void tcp_ca_dup_ack(struct tcp *conn)
 {
-	tcp_new_reno_dup_ack(conn);
+	conn->ca_ops->dup_ack(conn);
 }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	conn->ca_ops->pkts_acked(conn, acked_len);
+}
+
+static int set_tcp_congestion(struct tcp *conn, const void *value, uint32_t len)
+{
+	char name[TCP_CA_NAME_MAX];
+
+	if (len == 0U) {
+		return -EINVAL;
+	}
+
+	len = MIN(len, sizeof(name) - 1);
+	memcpy(name, value, len);
+	name[len] = '\0';
+
+	ARRAY_FOR_EACH(tcp_ca_algos, i) {
+		if (strcmp(name, tcp_ca_algos[i]->name) != 0) {
+			continue;
+		}
+
+		conn->ca_ops = tcp_ca_algos[i];
+
+		/* Otherwise initialized when the connection is established */
+		if ((conn->state == TCP_ESTABLISHED) || (conn->state == TCP_CLOSE_WAIT)) {
+			tcp_ca_init(conn);
+		}
+
+		return 0;
+	}
+
+	return -ENOENT;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, uint32_t *len)
+{
+	size_t name_len = strlen(conn->ca_ops->name) + 1;
+
+	if (len == NULL) {
+		return -EINVAL;
+	}
+
+	name_len = MIN(name_len, *len);
+	memcpy(value, conn->ca_ops->name, name_len);
+	*len = name_len;
+
+	return 0;
 }
 #else
 
@@ -601,6 +815,9 @@ static void tcp_ca_dup_ack(struct tcp *conn) { }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len) { }
 
+#define set_tcp_congestion(...) (-ENOPROTOOPT)
+#define get_tcp_congestion(...) (-ENOPROTOOPT)
+
 #endif
 
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
@@ -900,6 +1117,9 @@ static void tcp_conn_release(struct k_work *work)
 	(void)k_work_cancel_delayable(&conn->ack_timer);
 	(void)k_work_cancel_delayable(&conn->send_timer);
 	(void)k_work_cancel_delayable(&conn->recv_queue_timer);
+#ifdef CONFIG_NET_TCP_PACING
+	(void)k_work_cancel_delayable(&conn->pacing_timer);
+#endif
 	keep_alive_timer_stop(conn);
 
 	k_mutex_unlock(&conn->lock);
@@ -1108,6 +1328,7 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	recv_options->mss_found = false;
 	recv_options->wnd_found = false;
+	recv_options->sack_found = false;
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1156,6 +1377,23 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_found = true;
+			break;
+		case NET_TCP_SACK_OPT:
+			if ((opt_len < 2 + NET_TCP_SACK_BLOCK_SIZE) ||
+			    ((opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE) != 0) {
+				result = false;
+				goto end;
+			}
+
+			/* The blocks are read with the ACK, see tcp_sack_update() */
+			break;
 		default:
 			continue;
 		}
@@ -1234,55 +1472,52 @@ static size_t tcp_check_pending_data(struct tcp *conn, struct net_pkt *pkt,
 	size_t pending_len = 0;
 
 	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT && conn->queue_recv_data != NULL) {
-		/* Some potentential cases:
+		/* Append the queued data following the packet, up to the
+		 * first hole. The queue is sorted by sequence number and the
+		 * queued buffers do not overlap, but the head of the queue
+		 * can overlap the end of the packet:
 		 * Note: MI = MAX_INT
-		 * Packet | Queued| End off   | Gap size | Required handling
-		 * Seq|Len|Seq|Len|           |          |
-		 *  3 | 3 | 6 | 4 | 3+3-6=  0 | 6-3-3=0  | Append
-		 *  3 | 4 | 6 | 4 | 3+4-6 = 1 | 6-3-4=-1 | Append, pull from queue
-		 *  3 | 7 | 6 | 4 | 3+7-6 = 4 | 6-3-7=-4 | Drop queued data
-		 *  3 | 8 | 6 | 4 | 3+8-6 = 5 | 6-3-8=-5 | Drop queued data
-		 *  6 | 5 | 6 | 4 | 6+5-6 = 5 | 6-6-5=-5 | Drop queued data
-		 *  6 | 4 | 6 | 4 | 6+4-6 = 4 | 6-6-4=-4 | Drop queued data / packet
-		 * 10 | 2 | 6 | 4 | 10+2-6= 6 | 6-10-2=-6| Should not happen, dropping queue
-		 *  7 | 4 | 6 | 4 | 7+4-6 = 5 | 6-7-4=-5 | Should not happen, dropping queue
-		 * 11 | 2 | 6 | 4 | 11+2-6= 7 | 6-11-2=-7| Should not happen, dropping queue
-		 *  2 | 3 | 6 | 4 | 2+3-6= MI | 6-2-3=1  | Keep queued data
+		 * Packet | Queued| Overlap   | Required handling
+		 * Seq|Len|Seq|Len|           |
+		 *  3 | 3 | 6 | 4 | 3+3-6 = 0 | Append
+		 *  3 | 4 | 6 | 4 | 3+4-6 = 1 | Append, pull from queued data
+		 *  3 | 7 | 6 | 4 | 3+7-6 = 4 | Drop queued data
+		 *  2 | 3 | 6 | 4 | 2+3-6 = MI| Keep queued data
 		 */
 		struct tcphdr *th = th_get(pkt);
 		uint32_t expected_seq = th_seq(th) + len;
-		uint32_t pending_seq;
-		int32_t gap_size;
-		uint32_t end_offset;
-
-		pending_seq = tcp_get_seq(conn->queue_recv_data);
-		end_offset = expected_seq - pending_seq;
-		gap_size = (int32_t)(pending_seq - th_seq(th) - ((uint32_t)len));
-		pending_len = net_buf_frags_len(conn->queue_recv_data);
-		if (end_offset < pending_len) {
-			if (end_offset) {
-				net_pkt_remove_tail(pkt, end_offset);
-				pending_len -= end_offset;
-			}
+		struct net_buf *buf;
+		uint32_t overlap;
 
-			NET_DBG("[%p] Found pending data seq %u len %zd", conn,
-				expected_seq, pending_len);
+		while (conn->queue_recv_data != NULL) {
+			buf = conn->queue_recv_data;
+			if (net_tcp_seq_cmp(tcp_get_seq(buf), expected_seq) > 0) {
+				break;
+			}
 
-			net_buf_frag_add(pkt->buffer,
-					 conn->queue_recv_data);
-			conn->queue_recv_data = NULL;
+			overlap = expected_seq - tcp_get_seq(buf);
+			if (overlap >= buf->len) {
+				conn->queue_recv_data = net_buf_frag_del(NULL, buf);
+				continue;
+			}
 
-			k_work_cancel_delayable(&conn->recv_queue_timer);
-		} else {
-			/* Check if the queued data is just a section of the incoming data */
-			if (gap_size <= 0) {
-				net_buf_unref(conn->queue_recv_data);
-				conn->queue_recv_data = NULL;
+			conn->queue_recv_data = buf->frags;
+			buf->frags = NULL;
 
-				k_work_cancel_delayable(&conn->recv_queue_timer);
+			if (overlap) {
+				net_buf_pull(buf, overlap);
 			}
 
-			pending_len = 0;
+			NET_DBG("[%p] Found pending data seq %u len %u", conn,
+				expected_seq, buf->len);
+
+			net_buf_frag_add(pkt->buffer, buf);
+			expected_seq += buf->len;
+			pending_len += buf->len;
+		}
+
+		if (conn->queue_recv_data == NULL) {
+			k_work_cancel_delayable(&conn->recv_queue_timer);
 		}
 	}
 
@@ -1346,7 +1581,7 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 }
 
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
-			  uint32_t seq)
+			  uint32_t seq, size_t opts_len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
@@ -1360,11 +1595,7 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, UNALIGNED_MEMBER_ADDR(th, th_sport));
 	UNALIGNED_PUT(conn->dst.sin.sin_port, UNALIGNED_MEMBER_ADDR(th, th_dport));
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + opts_len / 4;
 
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(htons(conn->recv_win), UNALIGNED_MEMBER_ADDR(th, th_win));
@@ -1444,6 +1675,79 @@ static int net_tcp_set_mss_opt(struct tcp *conn, struct net_pkt *pkt)
 	return net_pkt_set_data(pkt, &mss_opt_access);
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+/* Collect the blocks of out-of-order data to report to the peer. As
+ * required by RFC 2018, the first block holds the latest data received.
+ */
+static int tcp_sack_blocks_get(struct tcp *conn, struct tcp_sack_block *blocks)
+{
+	struct net_buf *tmp = conn->queue_recv_data;
+	struct tcp_sack_block block;
+	bool found = false;
+	int count = 1;
+
+	if (!conn->sack_ok || tmp == NULL) {
+		return 0;
+	}
+
+	while (tmp != NULL) {
+		block.start = tcp_get_seq(tmp);
+		block.end = block.start + tmp->len;
+		tmp = tmp->frags;
+
+		while (tmp != NULL && tcp_get_seq(tmp) == block.end) {
+			block.end += tmp->len;
+			tmp = tmp->frags;
+		}
+
+		if (net_tcp_seq_cmp(block.end, conn->ack) <= 0) {
+			continue;
+		}
+
+		if (!found && net_tcp_seq_cmp(conn->sack_recv_seq, block.start) >= 0 &&
+		    net_tcp_seq_cmp(conn->sack_recv_seq, block.end) < 0) {
+			blocks[0] = block;
+			found = true;
+		} else if (count < NET_TCP_SACK_MAX_BLOCKS) {
+			blocks[count++] = block;
+		}
+	}
+
+	if (!found) {
+		count--;
+		memmove(&blocks[0], &blocks[1], count * sizeof(blocks[0]));
+	}
+
+	return count;
+}
+
+static int tcp_sack_opt_add(struct net_pkt *pkt, const struct tcp_sack_block *blocks,
+			    int count)
+{
+	uint8_t opt[4 + NET_TCP_SACK_MAX_BLOCKS * NET_TCP_SACK_BLOCK_SIZE];
+	uint8_t *ptr = opt;
+
+	*ptr++ = NET_TCP_NOP_OPT;
+	*ptr++ = NET_TCP_NOP_OPT;
+
+	if (count == 0) {
+		*ptr++ = NET_TCP_SACK_PERM_OPT;
+		*ptr++ = NET_TCP_SACK_PERM_SIZE;
+	} else {
+		*ptr++ = NET_TCP_SACK_OPT;
+		*ptr++ = 2 + count * NET_TCP_SACK_BLOCK_SIZE;
+	}
+
+	for (int i = 0; i < count; i++) {
+		sys_put_be32(blocks[i].start, ptr);
+		sys_put_be32(blocks[i].end, ptr + sizeof(uint32_t));
+		ptr += NET_TCP_SACK_BLOCK_SIZE;
+	}
+
+	return net_pkt_write(pkt, opt, ptr - opt);
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
 static bool is_destination_local(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
@@ -1557,12 +1861,35 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
 	size_t alloc_len = sizeof(struct tcphdr);
+	size_t opts_len = 0;
 	struct net_pkt *pkt;
 	int ret = 0;
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block blocks[NET_TCP_SACK_MAX_BLOCKS];
+	bool sack_perm = false;
+	int sack_count = 0;
+#endif
 
 	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
+		opts_len += sizeof(uint32_t);
+	}
+
+#ifdef CONFIG_NET_TCP_SACK
+	if (flags & SYN) {
+		/* Offer SACK in SYN, and accept it in SYN-ACK if offered */
+		sack_perm = !(flags & ACK) || conn->sack_ok;
+		if (sack_perm) {
+			opts_len += 2 + NET_TCP_SACK_PERM_SIZE;
+		}
+	} else if (flags & ACK) {
+		sack_count = tcp_sack_blocks_get(conn, blocks);
+		if (sack_count > 0) {
+			opts_len += 4 + sack_count * NET_TCP_SACK_BLOCK_SIZE;
+		}
 	}
+#endif
+
+	alloc_len += opts_len;
 
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
@@ -1582,7 +1909,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
-	ret = tcp_header_add(conn, pkt, flags, seq);
+	ret = tcp_header_add(conn, pkt, flags, seq, opts_len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
@@ -1596,6 +1923,16 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+#ifdef CONFIG_NET_TCP_SACK
+	if (sack_perm || sack_count > 0) {
+		ret = tcp_sack_opt_add(pkt, blocks, sack_count);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+#endif
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1804,6 +2141,34 @@ static int tcp_unsent_len(struct tcp *conn)
 	return unsent_len;
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+/* Skip the data the peer already holds when (re)sending, and return how
+ * much can be sent before the next data it holds.
+ */
+static int tcp_sack_skip(struct tcp *conn)
+{
+	uint32_t seq;
+
+	for (int i = 0; i < conn->sacked_cnt; i++) {
+		seq = conn->seq + conn->unacked_len;
+
+		if (net_tcp_seq_cmp(conn->sacked[i].end, seq) <= 0) {
+			continue;
+		}
+
+		if (net_tcp_seq_cmp(conn->sacked[i].start, seq) > 0) {
+			return conn->sacked[i].start - seq;
+		}
+
+		conn->unacked_len = conn->sacked[i].end - conn->seq;
+	}
+
+	return INT_MAX;
+}
+#else
+static int tcp_sack_skip(struct tcp *conn) { return INT_MAX; }
+#endif /* CONFIG_NET_TCP_SACK */
+
 /* A helper function to reduce code repeat. It should already be protected by mutex
  * and the 'conn' parameter is not NULL.
  */
@@ -1817,9 +2182,13 @@ static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
 	int len;
+	int sack_len;
 	struct net_pkt *pkt;
 
+	sack_len = tcp_sack_skip(conn);
+
 	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
+	len = MIN(len, sack_len);
 	if (len < 0) {
 		ret = len;
 		goto out;
@@ -1869,6 +2238,106 @@ static int tcp_send_data(struct tcp *conn)
 	return ret;
 }
 
+#ifdef CONFIG_NET_TCP_PACING
+static uint32_t tcp_pacing_now(void)
+{
+	return (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks());
+}
+
+/* Time one segment per round trip, which is not retransmitted, according
+ * to Karn's algorithm.
+ */
+static void tcp_rtt_start(struct tcp *conn, uint32_t now)
+{
+	if (!conn->rtt_timing) {
+		conn->rtt_timing = true;
+		conn->rtt_seq = conn->seq + conn->unacked_len;
+		conn->rtt_start = now;
+	}
+}
+
+static void tcp_rtt_stop(struct tcp *conn)
+{
+	conn->rtt_timing = false;
+}
+
+static void tcp_rtt_update(struct tcp *conn, uint32_t ack)
+{
+	uint32_t rtt;
+
+	if (!conn->rtt_timing || (net_tcp_seq_cmp(ack, conn->rtt_seq) < 0)) {
+		return;
+	}
+
+	rtt = MAX(tcp_pacing_now() - conn->rtt_start, 1U);
+	conn->rtt_timing = false;
+
+	/* Smoothed according to RFC6298 */
+	if (conn->srtt == 0U) {
+		conn->srtt = rtt;
+	} else {
+		conn->srtt = conn->srtt - (conn->srtt / 8U) + (rtt / 8U);
+	}
+
+	NET_DBG("[%p] rtt=%u us, srtt=%u us", conn, rtt, conn->srtt);
+}
+
+/* Check if the next segment has to wait, in which case it is sent later
+ * from the work queue.
+ */
+static bool tcp_pacing_wait(struct tcp *conn)
+{
+	int32_t wait;
+
+	if (conn->srtt == 0U) {
+		return false;
+	}
+
+	wait = (int32_t)(conn->pacing_next - tcp_pacing_now());
+	if (wait <= 0) {
+		return false;
+	}
+
+	(void)k_work_schedule_for_queue(&tcp_work_q, &conn->pacing_timer, K_USEC(wait));
+
+	return true;
+}
+
+/* Send the congestion window over a round trip, faster in slow start so
+ * that the window can still double.
+ */
+static void tcp_pacing_sent(struct tcp *conn, uint32_t len)
+{
+	uint32_t now = tcp_pacing_now();
+	uint32_t gain_pct = (conn->ca.cwnd < conn->ca.ssthresh) ? 200U : 120U;
+
+	tcp_rtt_start(conn, now);
+
+	if (conn->srtt == 0U) {
+		return;
+	}
+
+	/* Do not save up the idle time for a burst */
+	if ((int32_t)(conn->pacing_next - now) < 0) {
+		conn->pacing_next = now;
+	}
+
+	conn->pacing_next += (uint32_t)(((uint64_t)len * conn->srtt * 100U) /
+					((uint64_t)conn->ca.cwnd * gain_pct));
+}
+#else
+static void tcp_rtt_stop(struct tcp *conn) { }
+
+static void tcp_rtt_update(struct tcp *conn, uint32_t ack) { }
+
+static bool tcp_pacing_wait(struct tcp *conn)
+{
+	return false;
+}
+
+static void tcp_pacing_sent(struct tcp *conn, uint32_t len) { }
+#endif
+
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
 static int tcp_send_queued_data(struct tcp *conn)
@@ -1881,6 +2350,8 @@ static int tcp_send_queued_data(struct tcp *conn)
 	}
 
 	while (tcp_unsent_len(conn) > 0) {
+		int unacked_len = conn->unacked_len;
+
 		/* Implement Nagle's algorithm */
 		if ((conn->tcp_nodelay == false) && (conn->unacked_len > 0)) {
 			/* If there is already pending data */
@@ -1894,10 +2365,16 @@ static int tcp_send_queued_data(struct tcp *conn)
 			}
 		}
 
+		if (tcp_pacing_wait(conn)) {
+			break;
+		}
+
 		ret = tcp_send_data(conn);
 		if (ret < 0) {
 			break;
 		}
+
+		tcp_pacing_sent(conn, conn->unacked_len - unacked_len);
 	}
 
 	if (conn->send_data_total) {
@@ -1915,6 +2392,229 @@ static int tcp_send_queued_data(struct tcp *conn)
 	return ret;
 }
 
+#ifdef CONFIG_NET_TCP_PACING
+static void tcp_pacing_send(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct tcp *conn = CONTAINER_OF(dwork, struct tcp, pacing_timer);
+
+	k_mutex_lock(&conn->lock, K_FOREVER);
+
+	if ((conn->state == TCP_ESTABLISHED) || (conn->state == TCP_CLOSE_WAIT)) {
+		(void)tcp_send_queued_data(conn);
+	}
+
+	k_mutex_unlock(&conn->lock);
+}
+#endif
+
+#ifdef CONFIG_NET_TCP_SACK
+/* Merge a block reported by the peer into the scoreboard, which is sorted
+ * and has no overlapping blocks. When it is full, the highest block is
+ * forgotten.
+ */
+static void tcp_sack_add(struct tcp *conn, struct tcp_sack_block block)
+{
+	struct tcp_sack_block *sacked = conn->sacked;
+	int i = 0;
+	int j;
+
+	while (i < conn->sacked_cnt && net_tcp_seq_cmp(sacked[i].end, block.start) < 0) {
+		i++;
+	}
+
+	for (j = i; j < conn->sacked_cnt; j++) {
+		if (net_tcp_seq_cmp(sacked[j].start, block.end) > 0) {
+			break;
+		}
+
+		if (net_tcp_seq_cmp(sacked[j].start, block.start) < 0) {
+			block.start = sacked[j].start;
+		}
+
+		if (net_tcp_seq_cmp(sacked[j].end, block.end) > 0) {
+			block.end = sacked[j].end;
+		}
+	}
+
+	if (i == j) {
+		if (i == NET_TCP_SACK_MAX_BLOCKS) {
+			return;
+		}
+
+		if (conn->sacked_cnt == NET_TCP_SACK_MAX_BLOCKS) {
+			conn->sacked_cnt--;
+		}
+
+		memmove(&sacked[i + 1], &sacked[i], (conn->sacked_cnt - i) * sizeof(*sacked));
+		conn->sacked_cnt++;
+	} else {
+		memmove(&sacked[i + 1], &sacked[j], (conn->sacked_cnt - j) * sizeof(*sacked));
+		conn->sacked_cnt -= j - i - 1;
+	}
+
+	sacked[i] = block;
+}
+
+/* Update the scoreboard from an ACK: forget the data acknowledged, and
+ * merge in the blocks reported within the data sent. The options were
+ * already validated by tcp_options_check().
+ */
+static void tcp_sack_update(struct tcp *conn, struct net_pkt *pkt, uint32_t ack,
+			    size_t opts_len)
+{
+	uint8_t options_buf[40]; /* TCP header max options size is 40 */
+	uint32_t snd_max = conn->seq + conn->send_data_total;
+	struct tcp_sack_block block;
+	uint8_t *options;
+	size_t opt_len;
+	int i, j;
+
+	for (i = 0, j = 0; i < conn->sacked_cnt; i++) {
+		if (net_tcp_seq_cmp(conn->sacked[i].end, ack) > 0) {
+			conn->sacked[j] = conn->sacked[i];
+			if (net_tcp_seq_cmp(conn->sacked[j].start, ack) < 0) {
+				conn->sacked[j].start = ack;
+			}
+			j++;
+		}
+	}
+
+	conn->sacked_cnt = j;
+
+	if (!conn->sack_ok || opts_len == 0) {
+		return;
+	}
+
+	options = tcp_options_get(pkt, opts_len, options_buf, sizeof(options_buf));
+	if (options == NULL) {
+		return;
+	}
+
+	for (size_t pos = 0; pos + 1 < opts_len; pos += opt_len) {
+		if (options[pos] == NET_TCP_END_OPT) {
+			break;
+		} else if (options[pos] == NET_TCP_NOP_OPT) {
+			opt_len = 1;
+			continue;
+		}
+
+		opt_len = options[pos + 1];
+		if (opt_len < 2) {
+			break;
+		}
+
+		if (options[pos] != NET_TCP_SACK_OPT) {
+			continue;
+		}
+
+		for (size_t k = pos + 2; k < pos + opt_len; k += NET_TCP_SACK_BLOCK_SIZE) {
+			block.start = sys_get_be32(&options[k]);
+			block.end = sys_get_be32(&options[k + sizeof(uint32_t)]);
+
+			/* Ignore duplicate (RFC 2883) and invalid blocks */
+			if (net_tcp_seq_cmp(block.start, ack) < 0 ||
+			    net_tcp_seq_cmp(block.end, block.start) <= 0 ||
+			    net_tcp_seq_cmp(block.end, snd_max) > 0) {
+				continue;
+			}
+
+			tcp_sack_add(conn, block);
+		}
+	}
+}
+
+/* Retransmit the next hole below data held by the peer, during a fast
+ * recovery. The data it holds between the holes is not retransmitted.
+ */
+static void tcp_sack_retransmit(struct tcp *conn)
+{
+	int unacked_len = conn->unacked_len;
+	uint32_t seq;
+	int i;
+
+	if (!conn->in_sack_recovery) {
+		return;
+	}
+
+	if (net_tcp_seq_cmp(conn->sack_rexmit, conn->seq) < 0) {
+		conn->sack_rexmit = conn->seq;
+	}
+
+	seq = conn->sack_rexmit;
+
+	for (i = 0; i < conn->sacked_cnt; i++) {
+		if (net_tcp_seq_cmp(seq, conn->sacked[i].start) < 0) {
+			break;
+		}
+
+		if (net_tcp_seq_cmp(seq, conn->sacked[i].end) < 0) {
+			seq = conn->sacked[i].end;
+		}
+	}
+
+	/* Nothing held by the peer above, so no data is known to be lost */
+	if (i == conn->sacked_cnt) {
+		return;
+	}
+
+	conn->unacked_len = seq - conn->seq;
+
+	if (tcp_send_data(conn) == 0) {
+		conn->sack_rexmit = conn->seq + conn->unacked_len;
+	}
+
+	conn->unacked_len = unacked_len;
+}
+
+/* Start a fast recovery after the retransmission of the first hole, which
+ * ends when all the data sent so far is acknowledged.
+ */
+static void tcp_sack_recovery_start(struct tcp *conn, uint32_t recover)
+{
+	if (conn->sack_ok) {
+		conn->in_sack_recovery = true;
+		conn->sack_recover = recover;
+		conn->sack_rexmit = conn->seq + conn->unacked_len;
+	}
+}
+
+/* On a partial ACK during the recovery, retransmit the next hole */
+static void tcp_sack_acked(struct tcp *conn)
+{
+	if (!conn->in_sack_recovery) {
+		return;
+	}
+
+	if (net_tcp_seq_cmp(conn->seq, conn->sack_recover) >= 0) {
+		conn->in_sack_recovery = false;
+		return;
+	}
+
+	tcp_sack_retransmit(conn);
+}
+
+/* After a retransmission timeout, the peer might have dropped the data it
+ * reported, so the scoreboard is cleared as required by RFC 2018.
+ */
+static void tcp_sack_reset(struct tcp *conn)
+{
+	conn->sacked_cnt = 0;
+	conn->in_sack_recovery = false;
+}
+#else
+static void tcp_sack_update(struct tcp *conn, struct net_pkt *pkt, uint32_t ack,
+			    size_t opts_len) { }
+
+static void tcp_sack_retransmit(struct tcp *conn) { }
+
+static void tcp_sack_recovery_start(struct tcp *conn, uint32_t recover) { }
+
+static void tcp_sack_acked(struct tcp *conn) { }
+
+static void tcp_sack_reset(struct tcp *conn) { }
+#endif /* CONFIG_NET_TCP_SACK */
+
 static void tcp_cleanup_recv_queue(struct k_work *work)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
@@ -1970,6 +2670,8 @@ static void tcp_resend_data(struct k_work *work)
 
 		conn->data_mode = TCP_DATA_MODE_RESEND;
 		conn->unacked_len = 0;
+		tcp_sack_reset(conn);
+		tcp_rtt_stop(conn);
 
 		ret = tcp_send_data(conn);
 		if (ret == -ENODATA) {
@@ -2203,6 +2905,7 @@ static struct tcp *tcp_conn_alloc(void)
 	 * is available as soon as the connection is established
 	 */
 	conn->ca.cwnd = UINT16_MAX;
+	conn->ca_ops = TCP_CA_DEFAULT;
 #endif
 
 	/* The ISN value will be set when we get the connection attempt or
@@ -2219,6 +2922,9 @@ static struct tcp *tcp_conn_alloc(void)
 	k_work_init_delayable(&conn->recv_queue_timer, tcp_cleanup_recv_queue);
 	k_work_init_delayable(&conn->persist_timer, tcp_send_zwp);
 	k_work_init_delayable(&conn->ack_timer, tcp_send_ack);
+#ifdef CONFIG_NET_TCP_PACING
+	k_work_init_delayable(&conn->pacing_timer, tcp_pacing_send);
+#endif
 	k_work_init(&conn->conn_release, tcp_conn_release);
 	keep_alive_timer_init(conn);
 
@@ -2640,167 +3346,116 @@ static enum tcp_state tcp_enter_time_wait(struct tcp *conn)
 	return TCP_TIME_WAIT;
 }
 
-static bool check_seq_list(struct net_buf *buf)
+/* Insert a buffer into the out-of-order queue, sorted by sequence number.
+ * The data already queued is kept, so only the bytes of the buffer that
+ * are not queued yet are added, and queued buffers entirely covered by it
+ * are replaced.
+ *
+ * Some potentential cases:
+ * Buffer | Queued| Required handling
+ * Seq|Len|Seq|Len|
+ *  3 | 3 | 6 | 4 | Insert before
+ *  3 | 4 | 6 | 4 | Insert before, pull from buffer tail
+ *  3 | 7 | 6 | 4 | Drop queued data, continue with next queued
+ *  6 | 4 | 6 | 4 | Drop buffer
+ *  7 | 2 | 6 | 4 | Drop buffer
+ *  7 | 4 | 6 | 4 | Pull from buffer head, continue with next queued
+ * 10 | 2 | 6 | 4 | Continue with next queued
+ */
+static void tcp_queue_recv_buf(struct tcp *conn, struct net_buf *buf)
 {
-	struct net_buf *last = NULL;
-	struct net_buf *tmp = buf;
-	uint32_t seq;
-	uint32_t next_seq = 0;
-	bool result = true;
+	struct net_buf *prev = NULL;
+	struct net_buf *tmp = conn->queue_recv_data;
+	uint32_t seq = tcp_get_seq(buf);
 
-	while (tmp) {
-		seq = tcp_get_seq(tmp);
+	while (tmp != NULL && buf->len > 0) {
+		uint32_t tmp_seq = tcp_get_seq(tmp);
+		uint32_t tmp_end = tmp_seq + tmp->len;
+		uint32_t end = seq + buf->len;
 
-		NET_DBG("buf %p seq %u len %d", tmp, seq, tmp->len);
+		if (net_tcp_seq_cmp(end, tmp_seq) <= 0) {
+			break;
+		}
 
-		if (last != NULL) {
-			if (next_seq != seq) {
-				result = false;
+		if (net_tcp_seq_cmp(seq, tmp_end) >= 0) {
+			prev = tmp;
+			tmp = tmp->frags;
+			continue;
+		}
+
+		if (net_tcp_seq_cmp(seq, tmp_seq) >= 0) {
+			net_buf_pull(buf, MIN(tmp_end - seq, buf->len));
+			seq = tmp_end;
+			tcp_set_seq(buf, seq);
+			prev = tmp;
+			tmp = tmp->frags;
+		} else if (net_tcp_seq_cmp(end, tmp_end) >= 0) {
+			tmp = net_buf_frag_del(prev, tmp);
+			if (prev == NULL) {
+				conn->queue_recv_data = tmp;
 			}
+		} else {
+			buf->len -= end - tmp_seq;
+			break;
 		}
+	}
 
-		next_seq = seq + tmp->len;
-		last = tmp;
-		tmp = tmp->frags;
+	if (buf->len == 0) {
+		net_buf_unref(buf);
+		return;
+	}
+
+	buf->frags = tmp;
+	if (prev != NULL) {
+		prev->frags = buf;
+	} else {
+		conn->queue_recv_data = buf;
 	}
-	return result;
 }
 
 static void tcp_queue_recv_data(struct tcp *conn, struct net_pkt *pkt,
 				size_t len, uint32_t seq)
 {
-	uint32_t seq_start = seq;
-	bool inserted = false;
+	uint32_t win_end = conn->ack + conn->recv_win;
 	struct net_buf *tmp;
+	struct net_buf *next;
 
 	NET_DBG("[%p] len %zd seq %u ack %u", conn, len, seq, conn->ack);
 
-	tmp = pkt->buffer;
-
-	tcp_set_seq(tmp, seq);
-	seq += tmp->len;
-	tmp = tmp->frags;
-
-	while (tmp) {
-		tcp_set_seq(tmp, seq);
-		seq += tmp->len;
-		tmp = tmp->frags;
-	}
-
 	if (IS_ENABLED(CONFIG_NET_TCP_LOG_LEVEL_DBG)) {
 		NET_DBG("[%p] Queuing data", conn);
 	}
 
-	if (conn->queue_recv_data != NULL) {
-		/* Place the data to correct place in the list. If the data
-		 * would not be sequential, then drop this packet.
-		 *
-		 * Only work with subtractions between sequence numbers in uint32_t format
-		 * to proper handle cases that are around the wrapping point.
-		 */
-
-		/* Some potentential cases:
-		 * Note: MI = MAX_INT
-		 * Packet | Queued| End off1  | Start off| End off2    | Required handling
-		 * Seq|Len|Seq|Len|           |          |             |
-		 *  3 | 3 | 6 | 4 | 3+3-6=  0 | NA       | NA          | Prepend
-		 *  3 | 4 | 6 | 4 | 3+4-6 = 1 | NA       | NA          | Prepend, pull from buffer
-		 *  3 | 7 | 6 | 4 | 3+7-6 = 4 | 6-3=3    | 6+4-3=7     | Drop queued data
-		 *  3 | 8 | 6 | 4 | 3+8-6 = 5 | 6-3=3    | 6+4-3=7     | Drop queued data
-		 *  6 | 5 | 6 | 4 | 6+5-6 = 5 | 6-6=0    | 6+4-6=4     | Drop queued data
-		 *  6 | 4 | 6 | 4 | 6+4-6 = 4 | 6-6=0    | 6+4-6=4     | Drop queued data / packet
-		 *  7 | 2 | 6 | 4 | 7+2-6 = 3 | 6-7=MI   | 6+4-7=3     | Drop packet
-		 * 10 | 2 | 6 | 4 | 10+2-6= 6 | 6-10=MI-3| 6+4-10=0    | Append
-		 *  7 | 4 | 6 | 4 | 7+4-6 = 5 | 6-7 =MI  | 6+4-7 =3    | Append, pull from packet
-		 * 11 | 2 | 6 | 4 | 11+2-6= 7 | 6-11=MI-6| 6+4-11=MI-1 | Drop incoming packet
-		 *  2 | 3 | 6 | 4 | 2+3-6= MI | 6-2=4    | 6+4-2=8     | Drop incoming packet
-		 */
-
-		uint32_t pending_seq;
-		uint32_t start_offset;
-		uint32_t end_offset;
-		size_t pending_len;
-
-		pending_seq = tcp_get_seq(conn->queue_recv_data);
-		end_offset = seq - pending_seq;
-		pending_len = net_buf_frags_len(conn->queue_recv_data);
-		if (end_offset < pending_len) {
-			if (end_offset < len) {
-				if (end_offset) {
-					net_pkt_remove_tail(pkt, end_offset);
-				}
+#ifdef CONFIG_NET_TCP_SACK
+	conn->sack_recv_seq = seq;
+#endif
 
-				/* Put new data before the pending data */
-				net_buf_frag_add(pkt->buffer,
-						 conn->queue_recv_data);
-				NET_DBG("[%p] Adding at before queue, "
-					"end_offset %i, pending_len %zu",
-					conn, end_offset, pending_len);
-				conn->queue_recv_data = pkt->buffer;
-				inserted = true;
-			}
-		} else {
-			struct net_buf *last;
+	/* Queue the buffers one by one, dropping the data outside of the
+	 * receive window so that the queue stays bounded by it.
+	 */
+	tmp = pkt->buffer;
+	pkt->buffer = NULL;
 
-			last = net_buf_frag_last(conn->queue_recv_data);
-			pending_seq = tcp_get_seq(last);
+	while (tmp != NULL) {
+		next = tmp->frags;
+		tmp->frags = NULL;
 
-			start_offset = pending_seq - seq_start;
-			/* Compute the offset w.r.t. the start point of the new packet */
-			end_offset = (pending_seq + last->len) - seq_start;
+		tcp_set_seq(tmp, seq);
+		seq += tmp->len;
 
-			/* Check if queue start with within the within the new packet */
-			if ((start_offset < len) && (end_offset <= len)) {
-				/* The queued data is irrelevant since the new packet overlaps the
-				 * new packet, take the new packet as contents
-				 */
-				net_buf_unref(conn->queue_recv_data);
-				conn->queue_recv_data = pkt->buffer;
-				inserted = true;
-			} else {
-				if (end_offset < len) {
-					if (end_offset) {
-						net_buf_remove_mem(conn->queue_recv_data,
-								   end_offset);
-					}
-
-					/* Put new data after pending data */
-					NET_DBG("[%p] Adding at end of queue, "
-						"start %i, end %i, len %zu",
-						conn, start_offset, end_offset, len);
-					net_buf_frag_add(conn->queue_recv_data,
-							 pkt->buffer);
-					inserted = true;
-				}
-			}
+		if (net_tcp_seq_cmp(seq, win_end) > 0) {
+			tmp->len -= MIN(seq - win_end, tmp->len);
 		}
 
-		if (inserted) {
-			NET_DBG("[%p] All pending data", conn);
-			if (check_seq_list(conn->queue_recv_data) == false) {
-				NET_ERR("Incorrect order in out of order sequence for conn %p",
-					conn);
-				/* error in sequence list, drop it */
-				net_buf_unref(conn->queue_recv_data);
-				conn->queue_recv_data = NULL;
-			}
-		} else {
-			NET_DBG("[%p] Cannot add new data to queue", conn);
-		}
-	} else {
-		conn->queue_recv_data = pkt->buffer;
-		inserted = true;
+		tcp_queue_recv_buf(conn, tmp);
+		tmp = next;
 	}
 
-	if (inserted) {
-		/* We need to keep the received data but free the pkt */
-		pkt->buffer = NULL;
-
-		if (!k_work_delayable_is_pending(&conn->recv_queue_timer)) {
-			k_work_reschedule_for_queue(
-				&tcp_work_q, &conn->recv_queue_timer,
-				K_MSEC(CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT));
-		}
+	if ((conn->queue_recv_data != NULL) &&
+	    !k_work_delayable_is_pending(&conn->recv_queue_timer)) {
+		k_work_reschedule_for_queue(
+			&tcp_work_q, &conn->recv_queue_timer,
+			K_MSEC(CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT));
 	}
 }
 
@@ -3091,6 +3746,9 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				tcp_backlog_dec(conn->accepted_conn);
 			}
 
+#ifdef CONFIG_NET_TCP_SACK
+			conn->sack_ok = conn->recv_options.sack_found;
+#endif
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
 			conn->isn_peer = th_seq(th);
@@ -3122,6 +3780,9 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				accept_cb = conn->accepted_conn->accept_cb;
 				context = conn->accepted_conn->context;
 				keep_alive_param_copy(conn, conn->accepted_conn);
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+				conn->ca_ops = conn->accepted_conn->ca_ops;
+#endif
 			}
 
 			k_work_cancel_delayable(&conn->establish_timer);
@@ -3206,6 +3867,9 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			k_work_cancel_delayable(&conn->send_data_timer);
+#ifdef CONFIG_NET_TCP_SACK
+			conn->sack_ok = conn->recv_options.sack_found;
+#endif
 			conn->isn_peer = th_seq(th);
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
@@ -3251,6 +3915,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		 */
 		keep_alive_timer_restart(conn);
 
+		tcp_sack_update(conn, pkt, th_ack(th), tcp_options_len);
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3277,6 +3943,9 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				conn->unacked_len = 0;
 
 				(void)tcp_send_data(conn);
+				tcp_rtt_stop(conn);
+
+				tcp_sack_recovery_start(conn, conn->seq + temp_unacked_len);
 
 				/* Restore the current transmission */
 				conn->unacked_len = temp_unacked_len;
@@ -3285,6 +3954,12 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				if (tcp_window_full(conn)) {
 					(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 				}
+			} else if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
+				   (conn->dup_ack_cnt > DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) &&
+				   (len == 0)) {
+				/* Each further duplicate ACK retransmits the next hole */
+				tcp_sack_retransmit(conn);
+				tcp_rtt_stop(conn);
 			}
 		}
 #endif
@@ -3316,6 +3991,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			conn->dup_ack_cnt = 0;
 #endif
 			tcp_ca_pkts_acked(conn, len_acked);
+			tcp_rtt_update(conn, th_ack(th));
 
 			conn->send_data_total -= len_acked;
 			if (conn->unacked_len < len_acked) {
@@ -3348,6 +4024,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				tcp_setup_retransmission(conn);
 			}
 
+			tcp_sack_acked(conn);
+
 			/* We are closing the connection, send a FIN to peer */
 			if (conn->in_close && conn->send_data_total == 0) {
 				if (fin) {
@@ -4682,6 +5360,9 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = set_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = set_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4719,6 +5400,9 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = get_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = get_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
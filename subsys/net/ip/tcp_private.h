@@ -229,32 +229,67 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* Without timestamps, four SACK blocks fit in the option space */
+#define NET_TCP_SACK_MAX_BLOCKS   4
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
 	bool mss_found : 1;
 	bool wnd_found : 1;
+	bool sack_found : 1;
+};
+
+#ifdef CONFIG_NET_TCP_SACK
+/* Data [start, end) held by the peer, above the cumulative ACK */
+struct tcp_sack_block {
+	uint32_t start;
+	uint32_t end;
 };
+#endif
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
-struct tcp_collision_avoidance_reno {
+struct tcp_congestion_avoidance {
 	uint16_t cwnd;
 	uint16_t ssthresh;
 	uint16_t pending_fast_retransmit_bytes;
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+	uint16_t w_max; /* Window before the last reduction */
+	uint16_t origin; /* Window the cubic function grows back to */
+	uint16_t w_est; /* Window Reno would have reached */
+	uint32_t epoch_start; /* Start of congestion avoidance (ms), 0 if none */
+	uint32_t k; /* Time to reach the origin from the epoch start (ms) */
+#endif
 };
 #endif
 
 struct tcp;
 typedef void (*net_tcp_closed_cb_t)(struct tcp *conn, void *user_data);
 
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+/* Congestion control algorithm, selected per connection */
+struct tcp_ca_ops {
+	const char *name;
+	void (*init)(struct tcp *conn);
+	void (*fast_retransmit)(struct tcp *conn);
+	void (*timeout)(struct tcp *conn);
+	void (*dup_ack)(struct tcp *conn);
+	void (*pkts_acked)(struct tcp *conn, uint32_t acked_len);
+};
+#endif
+
 struct tcp { /* TCP connection */
 	sys_snode_t next;
 	struct net_context *context;
@@ -295,6 +330,9 @@ struct tcp { /* TCP connection */
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
 	struct k_work_delayable keepalive_timer;
 #endif /* CONFIG_NET_TCP_KEEPALIVE */
+#if defined(CONFIG_NET_TCP_PACING)
+	struct k_work_delayable pacing_timer;
+#endif /* CONFIG_NET_TCP_PACING */
 	struct k_work conn_release;
 
 	union {
@@ -335,7 +373,21 @@ struct tcp { /* TCP connection */
 	uint16_t rto;
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
-	struct tcp_collision_avoidance_reno ca;
+	const struct tcp_ca_ops *ca_ops;
+	struct tcp_congestion_avoidance ca;
+#endif
+#ifdef CONFIG_NET_TCP_PACING
+	uint32_t pacing_next; /* Time the next segment may be sent (us) */
+	uint32_t rtt_seq; /* Sequence whose ACK ends the RTT measurement */
+	uint32_t rtt_start; /* Start of the RTT measurement (us) */
+	uint32_t srtt; /* Smoothed round-trip time (us), 0 until measured */
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_block sacked[NET_TCP_SACK_MAX_BLOCKS]; /* SACK scoreboard */
+	uint32_t sack_recv_seq; /* Latest out-of-order data received */
+	uint32_t sack_recover; /* Recovery ends when this is acknowledged */
+	uint32_t sack_rexmit; /* Next sequence to retransmit in recovery */
+	uint8_t sacked_cnt;
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
@@ -350,6 +402,13 @@ struct tcp { /* TCP connection */
 	bool tcp_nodelay : 1;
 	bool addr_ref_done : 1;
 	bool rst_received : 1;
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_ok : 1;
+	bool in_sack_recovery : 1;
+#endif
+#ifdef CONFIG_NET_TCP_PACING
+	bool rtt_timing : 1;
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
@@ -710,6 +710,168 @@ fail:
 #include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+/* The batch looks the socket up and takes its lock only once */
+int z_impl_zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int count;
+	ssize_t bytes_sent;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->sendmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	vlen = MIN(vlen, INT_MAX);
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (count = 0U; count < vlen; count++) {
+		struct msghdr *msg = &msgvec[count].msg_hdr;
+
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, sendmsg, sock, msg, flags);
+
+		bytes_sent = vtable->sendmsg(obj, msg, flags);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, sendmsg, sock,
+					       bytes_sent < 0 ? -errno : bytes_sent);
+
+		sock_obj_core_update_send_stats(sock, bytes_sent);
+
+		if (bytes_sent < 0) {
+			break;
+		}
+
+		msgvec[count].msg_len = bytes_sent;
+	}
+
+	k_mutex_unlock(lock);
+
+	return (count == 0U && vlen > 0U) ? -1 : (int)count;
+}
+
+#ifdef CONFIG_USERSPACE
+/* Each message is copied in and out, and the socket locked, as by
+ * zsock_sendmsg(). The batch only saves the system call per message.
+ */
+static inline int z_vrfy_zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	unsigned int count;
+	unsigned int len;
+	ssize_t ret;
+
+	vlen = MIN(vlen, INT_MAX);
+
+	for (count = 0U; count < vlen; count++) {
+		ret = z_vrfy_zsock_sendmsg(sock, &msgvec[count].msg_hdr, flags);
+		if (ret < 0) {
+			break;
+		}
+
+		len = ret;
+		K_OOPS(k_usermode_to_copy(&msgvec[count].msg_len, &len, sizeof(len)));
+	}
+
+	return (count == 0U && vlen > 0U) ? -1 : (int)count;
+}
+#include <zephyr/syscalls/zsock_sendmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	const struct socket_op_vtable *vtable;
+	bool wait_for_one = (flags & ZSOCK_MSG_WAITFORONE) != 0;
+	ssize_t bytes_received;
+	struct k_mutex *lock;
+	unsigned int count;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->recvmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	vlen = MIN(vlen, INT_MAX);
+	flags &= ~ZSOCK_MSG_WAITFORONE;
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (count = 0U; count < vlen; count++) {
+		struct msghdr *msg = &msgvec[count].msg_hdr;
+
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, recvmsg, sock, msg, flags);
+
+		bytes_received = vtable->recvmsg(obj, msg, flags);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, recvmsg, sock, msg,
+					       bytes_received < 0 ? -errno : bytes_received);
+
+		sock_obj_core_update_recv_stats(sock, bytes_received);
+
+		if (bytes_received < 0) {
+			break;
+		}
+
+		msgvec[count].msg_len = bytes_received;
+
+		if (wait_for_one) {
+			flags |= ZSOCK_MSG_DONTWAIT;
+		}
+	}
+
+	k_mutex_unlock(lock);
+
+	return (count == 0U && vlen > 0U) ? -1 : (int)count;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	bool wait_for_one = (flags & ZSOCK_MSG_WAITFORONE) != 0;
+	unsigned int count;
+	unsigned int len;
+	ssize_t ret;
+
+	vlen = MIN(vlen, INT_MAX);
+	flags &= ~ZSOCK_MSG_WAITFORONE;
+
+	for (count = 0U; count < vlen; count++) {
+		ret = z_vrfy_zsock_recvmsg(sock, &msgvec[count].msg_hdr, flags);
+		if (ret < 0) {
+			break;
+		}
+
+		len = ret;
+		K_OOPS(k_usermode_to_copy(&msgvec[count].msg_len, &len, sizeof(len)));
+
+		if (wait_for_one) {
+			flags |= ZSOCK_MSG_DONTWAIT;
+		}
+	}
+
+	return (count == 0U && vlen > 0U) ? -1 : (int)count;
+}
+#include <zephyr/syscalls/zsock_recvmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "kernel_shell.h"
+
+#include <inttypes.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/obj_core.h>
+
+#ifdef CONFIG_SPIN_LOCK_STATS
+#include <ksched.h>
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
+#ifdef CONFIG_OBJ_CORE_STATS
+struct contention_type {
+	uint32_t id;
+	const char *name;
+};
+
+static const struct contention_type contention_types[] = {
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	{ K_OBJ_TYPE_MUTEX_ID, "mutex" },
+#endif /* CONFIG_OBJ_CORE_STATS_MUTEX */
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	{ K_OBJ_TYPE_SEM_ID, "sem" },
+#endif /* CONFIG_OBJ_CORE_STATS_SEM */
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+	{ K_OBJ_TYPE_MSGQ_ID, "msgq" },
+#endif /* CONFIG_OBJ_CORE_STATS_MSGQ */
+};
+
+struct contention_walk {
+	const struct shell *sh;
+	const char *name;
+};
+#endif /* CONFIG_OBJ_CORE_STATS */
+
+static uint32_t cyc_to_us(uint64_t cycles)
+{
+	return (uint32_t)k_cyc_to_us_floor64(cycles);
+}
+
+static void print_stats(const struct shell *sh, const char *name, const void *obj,
+			const struct k_obj_contention_stats *stats)
+{
+	uint64_t waits = MAX(stats->contended, 1U);
+	uint64_t holds = MAX(stats->acquisitions, 1U);
+
+	shell_print(sh, "%-6s %-10p %10" PRIu64 " %10" PRIu64 " %10u %10u %10u %10u", name, obj,
+		    stats->acquisitions, stats->contended, cyc_to_us(stats->wait_total / waits),
+		    cyc_to_us(stats->wait_max), cyc_to_us(stats->hold_total / holds),
+		    cyc_to_us(stats->hold_max));
+}
+
+#ifdef CONFIG_OBJ_CORE_STATS
+static int print_obj_core(struct k_obj_core *obj_core, void *data)
+{
+	struct contention_walk *walk = data;
+	struct k_obj_contention_stats stats;
+
+	if (k_obj_core_stats_query(obj_core, &stats, sizeof(stats)) != 0) {
+		return 0;
+	}
+
+	/* Skip the objects that were never used */
+	if ((stats.acquisitions != 0U) || (stats.contended != 0U)) {
+		print_stats(walk->sh, walk->name,
+			    (char *)obj_core - obj_core->type->obj_core_offset, &stats);
+	}
+
+	return 0;
+}
+
+static int reset_obj_core(struct k_obj_core *obj_core, void *data)
+{
+	ARG_UNUSED(data);
+
+	(void)k_obj_core_stats_reset(obj_core);
+
+	return 0;
+}
+#endif /* CONFIG_OBJ_CORE_STATS */
+
+static int cmd_kernel_contention(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "Times in us, wait averaged over contended and hold over all acquisitions");
+	shell_print(sh, "%-6s %-10s %10s %10s %10s %10s %10s %10s", "type", "object", "acquired",
+		    "contended", "wait avg", "wait max", "hold avg", "hold max");
+
+#ifdef CONFIG_SPIN_LOCK_STATS
+	/* Spin locks are not registered anywhere, only the scheduler lock
+	 * is known here.
+	 */
+	struct k_obj_contention_stats stats;
+
+	k_spin_stats_get(&_sched_spinlock, &stats);
+	print_stats(sh, "sched", &_sched_spinlock, &stats);
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
+#ifdef CONFIG_OBJ_CORE_STATS
+	struct contention_walk walk = { .sh = sh };
+
+	for (size_t i = 0; i < ARRAY_SIZE(contention_types); i++) {
+		struct k_obj_type *type = k_obj_type_find(contention_types[i].id);
+
+		if (type != NULL) {
+			walk.name = contention_types[i].name;
+			(void)k_obj_type_walk_unlocked(type, print_obj_core, &walk);
+		}
+	}
+#endif /* CONFIG_OBJ_CORE_STATS */
+
+	return 0;
+}
+
+static int cmd_kernel_contention_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+#ifdef CONFIG_SPIN_LOCK_STATS
+	k_spin_stats_reset(&_sched_spinlock);
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
+#ifdef CONFIG_OBJ_CORE_STATS
+	for (size_t i = 0; i < ARRAY_SIZE(contention_types); i++) {
+		struct k_obj_type *type = k_obj_type_find(contention_types[i].id);
+
+		if (type != NULL) {
+			(void)k_obj_type_walk_unlocked(type, reset_obj_core, NULL);
+		}
+	}
+#endif /* CONFIG_OBJ_CORE_STATS */
+
+	shell_print(sh, "Contention statistics reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_contention,
+	SHELL_CMD(reset, NULL, "Reset the contention statistics.", cmd_kernel_contention_reset),
+	SHELL_SUBCMD_SET_END
+);
+
+KERNEL_CMD_ADD(contention, &sub_kernel_contention,
+	       "Acquisitions, contention, wait and hold times of kernel objects. "
+	       "Of the spin locks, only the scheduler lock is reported.",
+	       cmd_kernel_contention);
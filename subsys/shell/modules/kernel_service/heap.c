@@ -30,6 +30,18 @@ static int cmd_kernel_heap(const struct shell *sh, size_t argc, char **argv)
 	shell_print(sh, "allocated:      %zu", stats.allocated_bytes);
 	shell_print(sh, "max. allocated: %zu", stats.max_allocated_bytes);
 
+#ifdef CONFIG_HEAP_MEM_POOL_SLABS
+	struct k_mem_slab *const *slabs;
+	int num = k_malloc_slab_array_get(&slabs);
+
+	for (int i = 0; i < num; i++) {
+		(void)k_mem_slab_runtime_stats_get(slabs[i], &stats);
+		shell_print(sh, "slab %4zu B:    %zu free, %zu allocated, %zu max. allocated",
+			    slabs[i]->info.block_size, stats.free_bytes, stats.allocated_bytes,
+			    stats.max_allocated_bytes);
+	}
+#endif /* CONFIG_HEAP_MEM_POOL_SLABS */
+
 	return 0;
 }
 
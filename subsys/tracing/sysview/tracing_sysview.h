@@ -406,6 +406,10 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_queue_get_exit(queue, timeout, data)                                      \
 	SEGGER_SYSVIEW_RecordEndCall(TID_QUEUE_GET)
 
+#define sys_port_trace_k_queue_get_many_enter(queue, timeout)
+#define sys_port_trace_k_queue_get_many_blocking(queue, timeout)
+#define sys_port_trace_k_queue_get_many_exit(queue, timeout, ret)
+
 #define sys_port_trace_k_queue_remove_enter(queue)                                                 \
 	SEGGER_SYSVIEW_RecordU32(TID_QUEUE_REMOVE, (uint32_t)(uintptr_t)queue)
 
@@ -461,6 +465,9 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_fifo_get_exit(fifo, timeout, ret)                                         \
 	SEGGER_SYSVIEW_RecordEndCall(TID_FIFO_GET)
 
+#define sys_port_trace_k_fifo_get_many_enter(fifo, timeout)
+#define sys_port_trace_k_fifo_get_many_exit(fifo, timeout, ret)
+
 #define sys_port_trace_k_fifo_peek_head_enter(fifo)                                                \
 	SEGGER_SYSVIEW_RecordU32(TID_FIFO_PEAK_HEAD, (uint32_t)(uintptr_t)fifo)
 
@@ -556,6 +563,10 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_msgq_put_front_exit(msgq, timeout, ret)                                   \
 	SEGGER_SYSVIEW_RecordEndCall(TID_MSGQ_PUT_FRONT)
 
+#define sys_port_trace_k_msgq_put_many_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_put_many_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_put_many_exit(msgq, timeout, ret)
+
 #define sys_port_trace_k_msgq_get_enter(msgq, timeout)                                             \
 	SEGGER_SYSVIEW_RecordU32x2(TID_MSGQ_GET, (uint32_t)(uintptr_t)msgq, (uint32_t)timeout.ticks)
 
@@ -564,6 +575,10 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)                                         \
 	SEGGER_SYSVIEW_RecordEndCall(TID_MSGQ_GET)
 
+#define sys_port_trace_k_msgq_get_many_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_get_many_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_get_many_exit(msgq, timeout, ret)
+
 #define sys_port_trace_k_msgq_peek(msgq, ret)                                                      \
 	SEGGER_SYSVIEW_RecordU32(TID_MSGQ_PEEK, (uint32_t)(uintptr_t)msgq)
 
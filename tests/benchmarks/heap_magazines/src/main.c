@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains the main testing module that invokes all the tests.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/tc_util.h>
+
+#define HEAP_SIZE   CONFIG_BENCHMARK_HEAP_SIZE
+#define NUM_BLOCKS  CONFIG_BENCHMARK_BLOCKS_PER_THREAD
+#define NUM_THREADS CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIO 5
+
+struct worker {
+	struct k_thread thread;
+	uint32_t rand;
+	void *blocks[NUM_BLOCKS];
+	/* Updated by the worker only */
+	uint32_t count;
+	uint32_t failed;
+};
+
+static struct k_heap heap;
+static uint8_t heap_mem[HEAP_SIZE] __aligned(8);
+static uint8_t scratch_mem[HEAP_SIZE / 2] __aligned(8);
+
+static struct worker workers[NUM_THREADS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static atomic_t stop;
+
+static uint32_t next_rand(uint32_t *state)
+{
+	/* xorshift32, every thread has its own state */
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+
+	return x;
+}
+
+/* Mostly small blocks, from 8 to 256 bytes, and a few large ones */
+static size_t random_size(uint32_t *state)
+{
+	uint32_t r = next_rand(state);
+
+	if ((r & 0xf) == 0U) {
+		return 1024;
+	}
+
+	return (8U << ((r >> 4) % 5)) + ((r >> 8) & 0x1f);
+}
+
+static void worker_entry(void *p1, void *p2, void *p3)
+{
+	struct worker *w = p1;
+	unsigned int slot;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (atomic_get(&stop) == 0) {
+		slot = next_rand(&w->rand) % NUM_BLOCKS;
+
+		if (w->blocks[slot] != NULL) {
+			k_heap_free(&heap, w->blocks[slot]);
+			w->blocks[slot] = NULL;
+		} else {
+			w->blocks[slot] = k_heap_alloc(&heap, random_size(&w->rand), K_NO_WAIT);
+			if (w->blocks[slot] == NULL) {
+				w->failed++;
+			}
+		}
+		w->count++;
+	}
+
+	for (unsigned int i = 0; i < NUM_BLOCKS; i++) {
+		k_heap_free(&heap, w->blocks[i]);
+	}
+}
+
+static void run_throughput(void)
+{
+	unsigned int num_threads = arch_num_cpus();
+	uint32_t count = 0;
+	uint32_t failed = 0;
+
+	k_heap_init(&heap, heap_mem, sizeof(heap_mem));
+	atomic_clear(&stop);
+
+	for (unsigned int i = 0; i < num_threads; i++) {
+		struct worker *w = &workers[i];
+
+		(void)memset(w->blocks, 0, sizeof(w->blocks));
+		w->rand = 0x9e3779b9U * (i + 1);
+		w->count = 0;
+		w->failed = 0;
+		k_thread_create(&w->thread, stacks[i], STACK_SIZE, worker_entry, w, NULL, NULL,
+				WORKER_PRIO, 0, K_NO_WAIT);
+	}
+
+	k_sleep(K_SECONDS(CONFIG_BENCHMARK_INTERVAL_SECONDS));
+
+	atomic_set(&stop, 1);
+	for (unsigned int i = 0; i < num_threads; i++) {
+		k_thread_join(&workers[i].thread, K_FOREVER);
+		count += workers[i].count;
+		failed += workers[i].failed;
+	}
+
+	printk("Alloc/free operations: %10u (%u/s), %u failed allocations, %u threads\n", count,
+	       count / CONFIG_BENCHMARK_INTERVAL_SECONDS, failed, num_threads);
+}
+
+static void *stress_alloc(void *arg, size_t bytes)
+{
+	return k_heap_alloc(arg, bytes, K_NO_WAIT);
+}
+
+static void stress_free(void *arg, void *p)
+{
+	k_heap_free(arg, p);
+}
+
+static void run_fragmentation(void)
+{
+	struct z_heap_stress_result r;
+	uint32_t tot;
+	uint32_t avg;
+
+	k_heap_init(&heap, heap_mem, sizeof(heap_mem));
+
+	sys_heap_stress(stress_alloc, stress_free, &heap, HEAP_SIZE, CONFIG_BENCHMARK_STRESS_OPS,
+			scratch_mem, sizeof(scratch_mem), 50, &r);
+
+	tot = r.total_allocs + r.total_frees;
+	avg = (uint32_t)((r.accumulated_in_use_bytes + tot / 2) / tot);
+
+	printk("Stress: successful allocs: %u/%u (%u%%), frees: %u, avg usage: %u/%u (%u%%)\n",
+	       r.successful_allocs, r.total_allocs,
+	       (uint32_t)((100ULL * r.successful_allocs + r.total_allocs / 2) / r.total_allocs),
+	       r.total_frees, avg, HEAP_SIZE, (uint32_t)((100ULL * avg + HEAP_SIZE / 2) / HEAP_SIZE));
+}
+
+int main(void)
+{
+	printk("Heap measurements %s magazines, %u bytes heap, %u CPUs\n",
+	       IS_ENABLED(CONFIG_HEAP_MAGAZINES) ? "with" : "without", HEAP_SIZE,
+	       arch_num_cpus());
+
+	/* Report from above the workers */
+	k_thread_priority_set(k_current_get(), WORKER_PRIO - 1);
+
+	run_throughput();
+	run_fragmentation();
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains the main testing module that invokes all the tests.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/tc_util.h>
+
+#define BLOCK_SIZE  CONFIG_BENCHMARK_BLOCK_SIZE
+#define NUM_BLOCKS  CONFIG_BENCHMARK_BLOCKS_PER_THREAD
+#define NUM_THREADS CONFIG_MP_MAX_NUM_CPUS
+#define SLAB_BLOCKS (2 * NUM_THREADS * NUM_BLOCKS)
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIO 5
+
+struct worker {
+	struct k_thread thread;
+	uint32_t rand;
+	void *blocks[NUM_BLOCKS];
+	/* Updated by the worker only */
+	uint32_t count;
+	uint32_t failed;
+};
+
+static struct k_mem_slab slab;
+static char slab_mem[SLAB_BLOCKS * BLOCK_SIZE] __aligned(8);
+
+static struct worker workers[NUM_THREADS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static atomic_t stop;
+
+static uint32_t next_rand(uint32_t *state)
+{
+	/* xorshift32, every thread has its own state */
+	uint32_t x = *state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+
+	return x;
+}
+
+static void worker_entry(void *p1, void *p2, void *p3)
+{
+	struct worker *w = p1;
+	unsigned int slot;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (atomic_get(&stop) == 0) {
+		slot = next_rand(&w->rand) % NUM_BLOCKS;
+
+		if (w->blocks[slot] != NULL) {
+			k_mem_slab_free(&slab, w->blocks[slot]);
+			w->blocks[slot] = NULL;
+		} else if (k_mem_slab_alloc(&slab, &w->blocks[slot], K_NO_WAIT) != 0) {
+			w->blocks[slot] = NULL;
+			w->failed++;
+		}
+		w->count++;
+	}
+
+	for (unsigned int i = 0; i < NUM_BLOCKS; i++) {
+		if (w->blocks[i] != NULL) {
+			k_mem_slab_free(&slab, w->blocks[i]);
+		}
+	}
+}
+
+static void run_throughput(const char *name, uint32_t num_blocks)
+{
+	unsigned int num_threads = arch_num_cpus();
+	uint32_t count = 0;
+	uint32_t failed = 0;
+
+	(void)k_mem_slab_init(&slab, slab_mem, BLOCK_SIZE, num_blocks);
+	atomic_clear(&stop);
+
+	for (unsigned int i = 0; i < num_threads; i++) {
+		struct worker *w = &workers[i];
+
+		(void)memset(w->blocks, 0, sizeof(w->blocks));
+		w->rand = 0x9e3779b9U * (i + 1);
+		w->count = 0;
+		w->failed = 0;
+		k_thread_create(&w->thread, stacks[i], STACK_SIZE, worker_entry, w, NULL, NULL,
+				WORKER_PRIO, 0, K_NO_WAIT);
+	}
+
+	k_sleep(K_SECONDS(CONFIG_BENCHMARK_INTERVAL_SECONDS));
+
+	atomic_set(&stop, 1);
+	for (unsigned int i = 0; i < num_threads; i++) {
+		k_thread_join(&workers[i].thread, K_FOREVER);
+		count += workers[i].count;
+		failed += workers[i].failed;
+	}
+
+	printk("%s slab: alloc/free operations: %10u (%u/s), %u failed allocations, "
+	       "max. used %u/%u, %u threads\n",
+	       name, count, count / CONFIG_BENCHMARK_INTERVAL_SECONDS, failed,
+	       k_mem_slab_max_used_get(&slab), num_blocks, num_threads);
+}
+
+int main(void)
+{
+	printk("Memory slab measurements %s CPU caches, %u byte blocks, %u CPUs\n",
+	       IS_ENABLED(CONFIG_MEM_SLAB_CPU_CACHE) ? "with" : "without", BLOCK_SIZE,
+	       arch_num_cpus());
+
+	/* Report from above the workers */
+	k_thread_priority_set(k_current_get(), WORKER_PRIO - 1);
+
+	run_throughput("Ample", SLAB_BLOCKS);
+	run_throughput("Tight", SLAB_BLOCKS / 2);
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains the main testing module that invokes all the tests.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/tc_util.h>
+
+#define BATCH_SIZE CONFIG_BENCHMARK_BATCH_SIZE
+#define NUM_ELEMS  CONFIG_BENCHMARK_MAX_MSGS
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* The consumer preempts the producer as soon as a message is available */
+#define CONSUMER_PRIO K_PRIO_PREEMPT(1)
+#define PRODUCER_PRIO K_PRIO_PREEMPT(2)
+
+struct message {
+	uint32_t seq;
+	uint8_t payload[CONFIG_BENCHMARK_MSG_SIZE - sizeof(uint32_t)];
+};
+
+struct element {
+	void *fifo_reserved;
+	uint32_t seq;
+};
+
+K_MSGQ_DEFINE(msgq, sizeof(struct message), NUM_ELEMS, 4);
+
+/* The elements are passed through data_fifo and recycled through free_fifo */
+K_FIFO_DEFINE(data_fifo);
+K_FIFO_DEFINE(free_fifo);
+static struct element elements[NUM_ELEMS];
+
+static struct k_thread producer_thread;
+static K_THREAD_STACK_DEFINE(producer_stack, STACK_SIZE);
+static struct k_thread consumer_thread;
+static K_THREAD_STACK_DEFINE(consumer_stack, STACK_SIZE);
+
+static uint32_t num_received;
+static bool out_of_order;
+
+static void receive(uint32_t seq)
+{
+	/* A single producer, so every message is received in order */
+	if (seq != num_received) {
+		out_of_order = true;
+	}
+	num_received++;
+}
+
+static void msgq_put_entry(void *p1, void *p2, void *p3)
+{
+	struct message msg = {0};
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_msgq_put(&msgq, &msg, K_FOREVER);
+		msg.seq++;
+	}
+}
+
+static void msgq_get_entry(void *p1, void *p2, void *p3)
+{
+	struct message msg;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_msgq_get(&msgq, &msg, K_FOREVER);
+		receive(msg.seq);
+	}
+}
+
+static void msgq_put_many_entry(void *p1, void *p2, void *p3)
+{
+	static struct message msgs[BATCH_SIZE];
+	uint32_t seq = 0;
+	int ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		/* The messages that were not sent are sent again */
+		for (unsigned int i = 0; i < BATCH_SIZE; i++) {
+			msgs[i].seq = seq + i;
+		}
+
+		ret = k_msgq_put_many(&msgq, msgs, BATCH_SIZE, K_FOREVER);
+		if (ret > 0) {
+			seq += ret;
+		}
+	}
+}
+
+static void msgq_get_many_entry(void *p1, void *p2, void *p3)
+{
+	static struct message msgs[BATCH_SIZE];
+	int ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		ret = k_msgq_get_many(&msgq, msgs, BATCH_SIZE, K_FOREVER);
+		for (int i = 0; i < ret; i++) {
+			receive(msgs[i].seq);
+		}
+	}
+}
+
+static void fifo_put_entry(void *p1, void *p2, void *p3)
+{
+	struct element *e;
+	uint32_t seq = 0;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		e = k_fifo_get(&free_fifo, K_FOREVER);
+		e->seq = seq++;
+		k_fifo_put(&data_fifo, e);
+	}
+}
+
+static void fifo_get_entry(void *p1, void *p2, void *p3)
+{
+	struct element *e;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		e = k_fifo_get(&data_fifo, K_FOREVER);
+		receive(e->seq);
+		k_fifo_put(&free_fifo, e);
+	}
+}
+
+/* Link the elements of a batch, to put them with k_fifo_put_list() */
+static void link_batch(struct element **batch, int num)
+{
+	for (int i = 0; i < num - 1; i++) {
+		batch[i]->fifo_reserved = batch[i + 1];
+	}
+	batch[num - 1]->fifo_reserved = NULL;
+}
+
+static void fifo_put_list_entry(void *p1, void *p2, void *p3)
+{
+	struct element *batch[BATCH_SIZE];
+	uint32_t seq = 0;
+	int num;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		num = k_fifo_get_many(&free_fifo, (void **)batch, BATCH_SIZE, K_FOREVER);
+		if (num == 0) {
+			continue;
+		}
+
+		for (int i = 0; i < num; i++) {
+			batch[i]->seq = seq++;
+		}
+		link_batch(batch, num);
+		k_fifo_put_list(&data_fifo, batch[0], batch[num - 1]);
+	}
+}
+
+static void fifo_get_many_entry(void *p1, void *p2, void *p3)
+{
+	struct element *batch[BATCH_SIZE];
+	int num;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		num = k_fifo_get_many(&data_fifo, (void **)batch, BATCH_SIZE, K_FOREVER);
+		if (num == 0) {
+			continue;
+		}
+
+		for (int i = 0; i < num; i++) {
+			receive(batch[i]->seq);
+		}
+		link_batch(batch, num);
+		k_fifo_put_list(&free_fifo, batch[0], batch[num - 1]);
+	}
+}
+
+static void reset_queues(void)
+{
+	k_msgq_purge(&msgq);
+
+	while (k_fifo_get(&data_fifo, K_NO_WAIT) != NULL) {
+	}
+	while (k_fifo_get(&free_fifo, K_NO_WAIT) != NULL) {
+	}
+	for (unsigned int i = 0; i < NUM_ELEMS; i++) {
+		k_fifo_put(&free_fifo, &elements[i]);
+	}
+
+	num_received = 0;
+	out_of_order = false;
+}
+
+static int run_test(const char *str, k_thread_entry_t producer, k_thread_entry_t consumer)
+{
+	reset_queues();
+
+	k_thread_create(&consumer_thread, consumer_stack, STACK_SIZE, consumer, NULL, NULL,
+			NULL, CONSUMER_PRIO, 0, K_NO_WAIT);
+	k_thread_create(&producer_thread, producer_stack, STACK_SIZE, producer, NULL, NULL,
+			NULL, PRODUCER_PRIO, 0, K_NO_WAIT);
+
+	k_sleep(K_SECONDS(CONFIG_BENCHMARK_INTERVAL_SECONDS));
+
+	k_thread_abort(&producer_thread);
+	k_thread_abort(&consumer_thread);
+
+	printk("%-28s %10u (%u/s)\n", str, num_received,
+	       num_received / CONFIG_BENCHMARK_INTERVAL_SECONDS);
+
+	if (out_of_order) {
+		printk("Messages received out of order\n");
+		return TC_FAIL;
+	}
+
+	return TC_PASS;
+}
+
+int main(void)
+{
+	int status = TC_PASS;
+
+	printk("Message queue and FIFO measurements with batches of %u messages, "
+	       "%u bytes messages\n",
+	       BATCH_SIZE, CONFIG_BENCHMARK_MSG_SIZE);
+
+	/* Report from above the consumer and producer */
+	k_thread_priority_set(k_current_get(), CONSUMER_PRIO - 1);
+
+	if (run_test("k_msgq_put/get:", msgq_put_entry, msgq_get_entry) != TC_PASS) {
+		status = TC_FAIL;
+	}
+	if (run_test("k_msgq_put_many/get_many:", msgq_put_many_entry,
+		     msgq_get_many_entry) != TC_PASS) {
+		status = TC_FAIL;
+	}
+	if (run_test("k_fifo_put/get:", fifo_put_entry, fifo_get_entry) != TC_PASS) {
+		status = TC_FAIL;
+	}
+	if (run_test("k_fifo_put_list/get_many:", fifo_put_list_entry,
+		     fifo_get_many_entry) != TC_PASS) {
+		status = TC_FAIL;
+	}
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
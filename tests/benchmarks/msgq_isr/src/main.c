@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains the main testing module that invokes all the tests.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/irq_offload.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+
+#define NUM_PRODUCERS CONFIG_BENCHMARK_NUM_PRODUCERS
+#define STACK_SIZE    (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+/* The consumer preempts the producers as soon as a message is available */
+#define CONSUMER_PRIO K_PRIO_PREEMPT(1)
+#define PRODUCER_PRIO K_PRIO_PREEMPT(2)
+
+struct message {
+	uint32_t producer;
+	uint32_t seq;
+	uint8_t payload[CONFIG_BENCHMARK_MSG_SIZE - (2 * sizeof(uint32_t))];
+};
+
+struct producer {
+	struct k_thread thread;
+	struct message msg;
+	/* Updated by the producer only */
+	uint32_t sent;
+	uint32_t dropped;
+	uint64_t put_cycles;
+	uint64_t put_cycles_max;
+	/* Updated by the consumer only */
+	uint32_t last_seq;
+};
+
+#ifdef CONFIG_MSGQ_MPSC
+K_MSGQ_MPSC_DEFINE(msgq, sizeof(struct message), CONFIG_BENCHMARK_MAX_MSGS, 4);
+#else
+K_MSGQ_DEFINE(msgq, sizeof(struct message), CONFIG_BENCHMARK_MAX_MSGS, 4);
+#endif /* CONFIG_MSGQ_MPSC */
+
+static struct producer producers[NUM_PRODUCERS];
+static K_THREAD_STACK_ARRAY_DEFINE(producer_stacks, NUM_PRODUCERS, STACK_SIZE);
+
+static struct k_thread consumer_thread;
+static K_THREAD_STACK_DEFINE(consumer_stack, STACK_SIZE);
+
+static uint32_t num_received;
+static uint32_t num_out_of_order;
+
+static void produce_isr(const void *arg)
+{
+	struct producer *p = (struct producer *)arg;
+	timing_t start;
+	timing_t finish;
+	uint64_t cycles;
+	int ret;
+
+	start = timing_counter_get();
+	ret = k_msgq_put(&msgq, &p->msg, K_NO_WAIT);
+	finish = timing_counter_get();
+
+	if (ret != 0) {
+		p->dropped++;
+		return;
+	}
+
+	cycles = timing_cycles_get(&start, &finish);
+	p->put_cycles += cycles;
+	p->put_cycles_max = MAX(p->put_cycles_max, cycles);
+	p->sent++;
+	p->msg.seq++;
+}
+
+static void producer_entry(void *p1, void *p2, void *p3)
+{
+	struct producer *p = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		irq_offload(produce_isr, p);
+	}
+}
+
+static void consumer_entry(void *p1, void *p2, void *p3)
+{
+	struct message msg;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		(void)k_msgq_get(&msgq, &msg, K_FOREVER);
+
+		/* The messages of a producer are received in order, dropped
+		 * ones leave gaps.
+		 */
+		if (msg.seq < producers[msg.producer].last_seq) {
+			num_out_of_order++;
+		}
+		producers[msg.producer].last_seq = msg.seq;
+		num_received++;
+	}
+}
+
+int main(void)
+{
+	uint64_t put_cycles = 0;
+	uint64_t put_cycles_max = 0;
+	uint32_t num_sent = 0;
+	uint32_t num_dropped = 0;
+	int status = TC_PASS;
+
+	timing_init();
+	timing_start();
+
+	printk("Message queue measurements with %s puts, %u bytes messages, "
+	       "%u producers, %u CPUs\n",
+	       IS_ENABLED(CONFIG_MSGQ_MPSC) ? "lock-free" : "locked",
+	       CONFIG_BENCHMARK_MSG_SIZE, NUM_PRODUCERS, arch_num_cpus());
+	printk("Timing results: Clock frequency: %u MHz\n", timing_freq_get_mhz());
+
+	/* Report from above the consumer and producers */
+	k_thread_priority_set(k_current_get(), CONSUMER_PRIO - 1);
+
+	k_thread_create(&consumer_thread, consumer_stack, STACK_SIZE, consumer_entry, NULL, NULL,
+			NULL, CONSUMER_PRIO, 0, K_NO_WAIT);
+
+	for (unsigned int i = 0; i < NUM_PRODUCERS; i++) {
+		producers[i].msg.producer = i;
+		k_thread_create(&producers[i].thread, producer_stacks[i], STACK_SIZE,
+				producer_entry, &producers[i], NULL, NULL, PRODUCER_PRIO, 0,
+				K_NO_WAIT);
+	}
+
+	k_sleep(K_SECONDS(CONFIG_BENCHMARK_INTERVAL_SECONDS));
+
+	for (unsigned int i = 0; i < NUM_PRODUCERS; i++) {
+		k_thread_abort(&producers[i].thread);
+	}
+	k_thread_abort(&consumer_thread);
+
+	timing_stop();
+
+	for (unsigned int i = 0; i < NUM_PRODUCERS; i++) {
+		num_sent += producers[i].sent;
+		num_dropped += producers[i].dropped;
+		put_cycles += producers[i].put_cycles;
+		put_cycles_max = MAX(put_cycles_max, producers[i].put_cycles_max);
+	}
+
+	printk("Messages: %10u (%u/s), %u dropped on a full queue\n", num_received,
+	       num_received / CONFIG_BENCHMARK_INTERVAL_SECONDS, num_dropped);
+	printk("Put from ISR: %7llu cycles (%7u nsec) on average, %7llu cycles (%7u nsec) worst "
+	       "case\n",
+	       num_sent == 0 ? 0 : put_cycles / num_sent,
+	       num_sent == 0 ? 0 : (uint32_t)timing_cycles_to_ns(put_cycles / num_sent),
+	       put_cycles_max, (uint32_t)timing_cycles_to_ns(put_cycles_max));
+
+	if (num_out_of_order != 0U) {
+		printk("%u messages received out of order\n", num_out_of_order);
+		status = TC_FAIL;
+	}
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
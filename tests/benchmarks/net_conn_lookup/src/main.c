@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure how the lookup of the connection an incoming UDP packet belongs to
+ * scales with the number of open connections.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/dummy.h>
+
+#include "connection.h"
+
+#define NUM_ITERATIONS CONFIG_BENCHMARK_NUM_ITERATIONS
+#define MAX_CONNS      256
+#define LISTEN_PORT    7
+#define LOCAL_PORT     5000
+#define REMOTE_PORT    40000
+
+static const uint16_t num_conns[] = { 4, 16, 64, 256 };
+
+static struct net_conn_handle *handles[MAX_CONNS];
+static struct net_conn_handle *listener;
+static uint32_t num_errors;
+
+static struct net_ipv4_hdr ipv4_hdr;
+static struct net_udp_hdr udp_hdr;
+
+/* 00-00-5E-00-53-xx Documentation RFC 7042 */
+static uint8_t mac_addr[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+
+static void dummy_iface_init(struct net_if *iface)
+{
+	net_if_set_link_addr(iface, mac_addr, sizeof(mac_addr), NET_LINK_ETHERNET);
+}
+
+static int dummy_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static struct dummy_api dummy_api = {
+	.iface_api.init = dummy_iface_init,
+	.send = dummy_send,
+};
+
+NET_DEVICE_INIT(net_conn_lookup, "net_conn_lookup", NULL, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &dummy_api, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), 127);
+
+/* Leave the packet to the benchmark, which reuses it for every lookup */
+static enum net_verdict recv_cb(struct net_conn *conn, struct net_pkt *pkt,
+				union net_ip_header *ip_hdr,
+				union net_proto_header *proto_hdr,
+				void *user_data)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(ip_hdr);
+
+	if (POINTER_TO_UINT(user_data) != ntohs(proto_hdr->udp->dst_port)) {
+		num_errors++;
+	}
+
+	return NET_OK;
+}
+
+/* Remote 198.51.100.x and 203.0.113.x, local 192.0.2.1 */
+static void set_addr(uint8_t *addr, uint8_t net, uint8_t host)
+{
+	addr[0] = net == 0U ? 198 : 203;
+	addr[1] = net == 0U ? 51 : 0;
+	addr[2] = net == 0U ? 100 : 113;
+	addr[3] = host;
+}
+
+static int register_conns(uint16_t count)
+{
+	struct sockaddr_in local = {
+		.sin_family = AF_INET,
+		.sin_addr.s4_addr = { 192, 0, 2, 1 },
+	};
+	struct sockaddr_in remote = {
+		.sin_family = AF_INET,
+	};
+	int ret;
+
+	for (uint16_t i = 0; i < count; i++) {
+		set_addr(remote.sin_addr.s4_addr, 0, i);
+
+		ret = net_conn_register(IPPROTO_UDP, SOCK_DGRAM, AF_INET,
+					(struct sockaddr *)&remote,
+					(struct sockaddr *)&local, REMOTE_PORT + i,
+					LOCAL_PORT + i, NULL, recv_cb,
+					UINT_TO_POINTER(LOCAL_PORT + i), &handles[i]);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static void unregister_conns(uint16_t count)
+{
+	for (uint16_t i = 0; i < count; i++) {
+		(void)net_conn_unregister(handles[i]);
+	}
+}
+
+/* Look up the packets of all the connections in turn, or packets from
+ * unknown remotes to the listener, and return the cycles per lookup.
+ */
+static uint32_t run_test(struct net_pkt *pkt, uint16_t count, bool to_listener)
+{
+	union net_ip_header ip_hdr = { .ipv4 = &ipv4_hdr };
+	union net_proto_header proto_hdr = { .udp = &udp_hdr };
+	uint32_t start;
+	uint32_t cycles;
+	uint16_t i = 0;
+
+	start = k_cycle_get_32();
+
+	for (uint32_t n = 0; n < NUM_ITERATIONS; n++) {
+		set_addr(ipv4_hdr.src, to_listener ? 1 : 0, i);
+		udp_hdr.src_port = htons(REMOTE_PORT + i);
+		udp_hdr.dst_port = htons(to_listener ? LISTEN_PORT : LOCAL_PORT + i);
+
+		if (net_conn_input(pkt, &ip_hdr, IPPROTO_UDP, &proto_hdr) != NET_OK) {
+			num_errors++;
+		}
+
+		if (++i == count) {
+			i = 0;
+		}
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	return cycles / NUM_ITERATIONS;
+}
+
+static uint32_t pkts_per_sec(uint32_t cycles)
+{
+	return (uint32_t)(NSEC_PER_SEC / MAX(k_cyc_to_ns_floor64(cycles), 1U));
+}
+
+int main(void)
+{
+	struct net_pkt *pkt;
+	int status = TC_PASS;
+
+	printk("Connection lookup measurements, %u packets, hash %s\n",
+	       NUM_ITERATIONS, IS_ENABLED(CONFIG_NET_CONN_HASH) ? "enabled" : "disabled");
+
+	pkt = net_pkt_alloc_on_iface(net_if_get_default(), K_FOREVER);
+	net_pkt_set_family(pkt, AF_INET);
+	ipv4_hdr.dst[0] = 192;
+	ipv4_hdr.dst[2] = 2;
+	ipv4_hdr.dst[3] = 1;
+
+	if (net_conn_register(IPPROTO_UDP, SOCK_DGRAM, AF_INET, NULL, NULL, 0,
+			      LISTEN_PORT, NULL, recv_cb, UINT_TO_POINTER(LISTEN_PORT),
+			      &listener) < 0) {
+		printk("Failed to register the listener\n");
+		status = TC_FAIL;
+		goto out;
+	}
+
+	ARRAY_FOR_EACH(num_conns, i) {
+		uint32_t connected;
+		uint32_t listening;
+
+		if (register_conns(num_conns[i]) < 0) {
+			printk("Failed to register %u connections\n", num_conns[i]);
+			status = TC_FAIL;
+			break;
+		}
+
+		connected = run_test(pkt, num_conns[i], false);
+		listening = run_test(pkt, num_conns[i], true);
+
+		printk("connections: %3u connected %6u cycles %8u pkts/s, "
+		       "listener %6u cycles %8u pkts/s\n", num_conns[i], connected,
+		       pkts_per_sec(connected), listening, pkts_per_sec(listening));
+
+		unregister_conns(num_conns[i]);
+	}
+
+	(void)net_conn_unregister(listener);
+
+	if (num_errors != 0U) {
+		printk("%u packets delivered to the wrong connection\n", num_errors);
+		status = TC_FAIL;
+	}
+
+out:
+	net_pkt_unref(pkt);
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
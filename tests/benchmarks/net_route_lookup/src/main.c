@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure how the forwarding decision for an IPv6 packet scales with the
+ * number of routes.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/dummy.h>
+
+#include "ipv6.h"
+#include "route.h"
+
+#define NUM_ITERATIONS CONFIG_BENCHMARK_NUM_ITERATIONS
+#define MAX_ROUTES     1024
+#define NUM_NEXTHOPS   8
+#define NUM_HOT        4
+
+/* Co-prime with all the route counts, to visit the routes out of order */
+#define ROUTE_STRIDE   389
+
+static const uint16_t num_routes[] = { 16, 128, 1024 };
+
+static struct net_route_entry *routes[MAX_ROUTES];
+static struct in6_addr dsts[MAX_ROUTES];
+static struct net_if *bench_iface;
+static uint32_t num_errors;
+
+/* 00-00-5E-00-53-xx Documentation RFC 7042 */
+static uint8_t mac_addr[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+
+static void dummy_iface_init(struct net_if *iface)
+{
+	net_if_set_link_addr(iface, mac_addr, sizeof(mac_addr), NET_LINK_ETHERNET);
+}
+
+static int dummy_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static struct dummy_api dummy_api = {
+	.iface_api.init = dummy_iface_init,
+	.send = dummy_send,
+};
+
+NET_DEVICE_INIT(net_route_lookup, "net_route_lookup", NULL, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &dummy_api, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), 127);
+
+/* Next hops 2001:db8:ffff::1 to 2001:db8:ffff::8 */
+static void nexthop_addr(struct in6_addr *addr, uint8_t idx)
+{
+	*addr = (struct in6_addr){ { { 0x20, 0x01, 0x0d, 0xb8, 0xff, 0xff, 0, 0,
+				      0, 0, 0, 0, 0, 0, 0, idx + 1 } } };
+}
+
+static int add_nexthops(void)
+{
+	struct net_linkaddr lladdr = {
+		.type = NET_LINK_ETHERNET,
+		.len = sizeof(mac_addr),
+	};
+	struct in6_addr addr;
+
+	memcpy(lladdr.addr, mac_addr, sizeof(mac_addr));
+
+	for (uint8_t i = 0; i < NUM_NEXTHOPS; i++) {
+		nexthop_addr(&addr, i);
+		lladdr.addr[5] = 0x10 + i;
+
+		if (net_ipv6_nbr_add(bench_iface, &addr, &lladdr, false,
+				     NET_IPV6_NBR_STATE_REACHABLE) == NULL) {
+			return -ENOMEM;
+		}
+	}
+
+	return 0;
+}
+
+/* Even routes are 2001:db8:<i>::/48, odd ones 2001:db9:0:<i>::/64. The
+ * destination of a route is its host ::1234.
+ */
+static int add_routes(uint16_t from, uint16_t to)
+{
+	struct in6_addr nexthop;
+
+	for (uint16_t i = from; i < to; i++) {
+		struct in6_addr *dst = &dsts[i];
+		uint8_t prefix_len = (i % 2U) == 0U ? 48 : 64;
+
+		*dst = (struct in6_addr){ { { 0x20, 0x01, 0x0d, 0xb8 + (i % 2U) } } };
+		UNALIGNED_PUT(htons(i), (uint16_t *)&dst->s6_addr[prefix_len / 8U - 2U]);
+
+		nexthop_addr(&nexthop, i % NUM_NEXTHOPS);
+		routes[i] = net_route_add(bench_iface, dst, prefix_len, &nexthop,
+					  NET_IPV6_ND_INFINITE_LIFETIME,
+					  NET_ROUTE_PREFERENCE_MEDIUM);
+		if (routes[i] == NULL) {
+			return -ENOMEM;
+		}
+
+		dst->s6_addr[14] = 0x12;
+		dst->s6_addr[15] = 0x34;
+	}
+
+	return 0;
+}
+
+static void del_routes(uint16_t count)
+{
+	for (uint16_t i = 0; i < count; i++) {
+		(void)net_route_del(routes[i]);
+	}
+}
+
+/* Take the forwarding decision of packets to the destinations of all the
+ * routes, or of only a few of them, and return the cycles per packet.
+ */
+static uint32_t run_test(uint16_t count, bool hot)
+{
+	struct net_route_entry *route;
+	struct in6_addr *nexthop;
+	uint32_t start;
+	uint32_t cycles;
+	uint16_t i = 0;
+
+	start = k_cycle_get_32();
+
+	for (uint32_t n = 0; n < NUM_ITERATIONS; n++) {
+		if (!net_route_get_info(NULL, &dsts[i], &route, &nexthop) ||
+		    route != routes[i]) {
+			num_errors++;
+		}
+
+		i = (i + ROUTE_STRIDE) % (hot ? NUM_HOT : count);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	return cycles / NUM_ITERATIONS;
+}
+
+static uint32_t pkts_per_sec(uint32_t cycles)
+{
+	return (uint32_t)(NSEC_PER_SEC / MAX(k_cyc_to_ns_floor64(cycles), 1U));
+}
+
+int main(void)
+{
+	int status = TC_PASS;
+	uint16_t count = 0;
+
+	printk("Route lookup measurements, %u packets, trie %s, cache size %u\n",
+	       NUM_ITERATIONS, IS_ENABLED(CONFIG_NET_ROUTE_TRIE) ? "enabled" : "disabled",
+	       CONFIG_NET_ROUTE_CACHE_SIZE);
+
+	bench_iface = net_if_get_default();
+
+	if (add_nexthops() < 0) {
+		printk("Failed to add the next hop neighbors\n");
+		status = TC_FAIL;
+		goto out;
+	}
+
+	ARRAY_FOR_EACH(num_routes, i) {
+		uint32_t spread;
+		uint32_t hot;
+
+		if (add_routes(count, num_routes[i]) < 0) {
+			printk("Failed to add %u routes\n", num_routes[i]);
+			status = TC_FAIL;
+			break;
+		}
+
+		count = num_routes[i];
+
+		spread = run_test(count, false);
+		hot = run_test(count, true);
+
+		printk("routes: %4u spread %6u cycles %8u pkts/s, "
+		       "hot %6u cycles %8u pkts/s\n", count, spread,
+		       pkts_per_sec(spread), hot, pkts_per_sec(hot));
+	}
+
+	del_routes(count);
+
+	if (num_errors != 0U) {
+		printk("%u packets routed the wrong way\n", num_errors);
+		status = TC_FAIL;
+	}
+
+out:
+	TC_END_REPORT(status);
+
+	return 0;
+}
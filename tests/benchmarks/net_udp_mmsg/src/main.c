@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure the datagrams per second a UDP socket pair moves over the loopback
+ * interface with per-datagram and with batched socket calls.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/app_memory/app_memdomain.h>
+#include <zephyr/net/socket.h>
+
+#define NUM_ITERATIONS CONFIG_BENCHMARK_NUM_ITERATIONS
+#define STACK_SIZE     (2048 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define USER_PRIO      K_PRIO_PREEMPT(1)
+#define MAX_BATCH      32
+#define PAYLOAD_SIZE   32
+#define SERVER_PORT    4242
+
+static const uint8_t batch_sizes[] = { 1, 8, 32 };
+
+K_APPMEM_PARTITION_DEFINE(bench_partition);
+
+K_APP_BMEM(bench_partition) static uint8_t tx_data[PAYLOAD_SIZE];
+K_APP_BMEM(bench_partition) static uint8_t rx_data[MAX_BATCH][PAYLOAD_SIZE];
+K_APP_BMEM(bench_partition) static struct iovec tx_iov;
+K_APP_BMEM(bench_partition) static struct iovec rx_iov[MAX_BATCH];
+K_APP_BMEM(bench_partition) static struct mmsghdr tx_msgs[MAX_BATCH];
+K_APP_BMEM(bench_partition) static struct mmsghdr rx_msgs[MAX_BATCH];
+K_APP_BMEM(bench_partition) static uint32_t num_errors;
+
+static struct k_thread user_thread;
+static K_THREAD_STACK_DEFINE(user_stack, STACK_SIZE);
+
+static int open_sockets(int *client, int *server)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT),
+		.sin_addr.s4_addr = { 127, 0, 0, 1 },
+	};
+
+	*server = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	*client = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (*server < 0 || *client < 0) {
+		return -1;
+	}
+
+	if (zsock_bind(*server, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+	    zsock_connect(*client, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		return -1;
+	}
+
+	return 0;
+}
+
+static int send_batch(int sock, unsigned int batch, bool mmsg)
+{
+	unsigned int sent = 0;
+	int ret;
+
+	while (sent < batch) {
+		if (mmsg) {
+			ret = zsock_sendmmsg(sock, &tx_msgs[sent], batch - sent, 0);
+		} else {
+			ret = zsock_sendmsg(sock, &tx_msgs[sent].msg_hdr, 0) < 0 ? -1 : 1;
+		}
+
+		if (ret < 0) {
+			return -1;
+		}
+
+		sent += ret;
+	}
+
+	return 0;
+}
+
+/* Receiving sets the buffer lengths to the received ones, restore them */
+static int recv_batch(int sock, unsigned int batch, bool mmsg)
+{
+	unsigned int received = 0;
+	ssize_t len;
+	int ret;
+
+	for (unsigned int i = 0; i < batch; i++) {
+		rx_iov[i].iov_len = PAYLOAD_SIZE;
+		rx_msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	while (received < batch) {
+		if (mmsg) {
+			ret = zsock_recvmmsg(sock, &rx_msgs[received], batch - received,
+					     ZSOCK_MSG_WAITFORONE);
+		} else {
+			len = zsock_recvmsg(sock, &rx_msgs[received].msg_hdr, 0);
+			rx_msgs[received].msg_len = len;
+			ret = len < 0 ? -1 : 1;
+		}
+
+		if (ret < 0) {
+			return -1;
+		}
+
+		for (int i = 0; i < ret; i++) {
+			if (rx_msgs[received + i].msg_len != PAYLOAD_SIZE) {
+				num_errors++;
+			}
+		}
+
+		received += ret;
+	}
+
+	return 0;
+}
+
+/* The sockets are opened by the user thread, so that it owns them. This is
+ * negligible next to the datagrams of a measurement.
+ */
+static void udp_entry(void *p1, void *p2, void *p3)
+{
+	unsigned int batch = POINTER_TO_UINT(p1);
+	bool mmsg = POINTER_TO_UINT(p2) != 0U;
+	int client = -1;
+	int server = -1;
+
+	ARG_UNUSED(p3);
+
+	if (open_sockets(&client, &server) < 0) {
+		num_errors++;
+		goto out;
+	}
+
+	for (uint32_t n = 0; n < NUM_ITERATIONS; n += batch) {
+		if (send_batch(client, batch, mmsg) < 0 ||
+		    recv_batch(server, batch, mmsg) < 0) {
+			num_errors++;
+			break;
+		}
+	}
+
+out:
+	if (client >= 0) {
+		(void)zsock_close(client);
+	}
+
+	if (server >= 0) {
+		(void)zsock_close(server);
+	}
+}
+
+/* The user thread is timed from supervisor mode, where the cycle counter can
+ * be read, and the result is in datagrams per second.
+ */
+static uint32_t run_test(unsigned int batch, bool mmsg)
+{
+	uint32_t start;
+	uint32_t cycles;
+
+	k_thread_create(&user_thread, user_stack, STACK_SIZE, udp_entry,
+			UINT_TO_POINTER(batch), UINT_TO_POINTER(mmsg), NULL,
+			USER_PRIO, K_USER, K_FOREVER);
+	k_thread_system_pool_assign(&user_thread);
+
+	start = k_cycle_get_32();
+	k_thread_start(&user_thread);
+	k_thread_join(&user_thread, K_FOREVER);
+	cycles = k_cycle_get_32() - start;
+
+	return (uint32_t)((uint64_t)NUM_ITERATIONS * NSEC_PER_SEC /
+			  MAX(k_cyc_to_ns_floor64(cycles), 1U));
+}
+
+static void init_msgs(void)
+{
+	tx_iov.iov_base = tx_data;
+	tx_iov.iov_len = sizeof(tx_data);
+
+	for (int i = 0; i < MAX_BATCH; i++) {
+		tx_msgs[i].msg_hdr.msg_iov = &tx_iov;
+		tx_msgs[i].msg_hdr.msg_iovlen = 1;
+
+		rx_iov[i].iov_base = rx_data[i];
+		rx_msgs[i].msg_hdr.msg_iov = &rx_iov[i];
+	}
+}
+
+int main(void)
+{
+	int status = TC_PASS;
+
+	printk("UDP socket measurements, %u datagrams of %u bytes, %s mode\n",
+	       NUM_ITERATIONS, PAYLOAD_SIZE,
+	       IS_ENABLED(CONFIG_USERSPACE) ? "user" : "supervisor");
+
+#if defined(CONFIG_USERSPACE)
+	if (k_mem_domain_add_partition(&k_mem_domain_default, &bench_partition) != 0) {
+		printk("Failed to add the benchmark partition\n");
+		TC_END_REPORT(TC_FAIL);
+		return 0;
+	}
+#endif
+
+	init_msgs();
+
+	ARRAY_FOR_EACH(batch_sizes, i) {
+		uint32_t single;
+		uint32_t batched;
+
+		single = run_test(batch_sizes[i], false);
+		batched = run_test(batch_sizes[i], true);
+
+		printk("batch: %2u sendmsg/recvmsg %8u pkts/s, "
+		       "sendmmsg/recvmmsg %8u pkts/s\n", batch_sizes[i], single, batched);
+	}
+
+	if (num_errors != 0U) {
+		printk("%u datagrams lost or corrupted\n", num_errors);
+		status = TC_FAIL;
+	}
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
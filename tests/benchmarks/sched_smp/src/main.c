@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains the main testing module that invokes all the tests.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/tc_util.h>
+
+#define NUM_PAIRS    (CONFIG_MP_MAX_NUM_CPUS * CONFIG_BENCHMARK_THREADS_PER_CPU)
+#define NUM_THREADS  (NUM_PAIRS * 2)
+#define STACK_SIZE   (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIO  5
+
+struct worker {
+	struct k_thread thread;
+	struct k_sem sem;
+	struct worker *peer;
+	unsigned int last_cpu;
+	/* Updated by the worker only */
+	uint32_t count;
+	uint32_t migrations;
+};
+
+static struct worker workers[NUM_THREADS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+
+static void track_cpu(struct worker *w)
+{
+	unsigned int cpu = k_current_get()->base.cpu;
+
+	if (cpu != w->last_cpu) {
+		w->migrations++;
+		w->last_cpu = cpu;
+	}
+}
+
+static void ping_pong_entry(void *p1, void *p2, void *p3)
+{
+	struct worker *w = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	w->last_cpu = k_current_get()->base.cpu;
+
+	/* Every pass wakes up the peer and blocks until it is woken up in turn */
+	while (true) {
+		k_sem_take(&w->sem, K_FOREVER);
+		track_cpu(w);
+		w->count++;
+		k_sem_give(&w->peer->sem);
+	}
+}
+
+static void yield_entry(void *p1, void *p2, void *p3)
+{
+	struct worker *w = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	w->last_cpu = k_current_get()->base.cpu;
+
+	while (true) {
+		k_yield();
+		track_cpu(w);
+		w->count++;
+	}
+}
+
+static void start_workers(k_thread_entry_t entry)
+{
+	for (unsigned int i = 0; i < NUM_THREADS; i++) {
+		struct worker *w = &workers[i];
+
+		k_sem_init(&w->sem, 0, 1);
+		w->peer = &workers[i ^ 1U];
+		w->count = 0;
+		w->migrations = 0;
+
+		k_thread_create(&w->thread, stacks[i], STACK_SIZE, entry, w, NULL, NULL,
+				WORKER_PRIO, 0, K_FOREVER);
+	}
+
+	for (unsigned int i = 0; i < NUM_THREADS; i++) {
+		k_thread_start(&workers[i].thread);
+	}
+}
+
+static void stop_workers(uint64_t *count, uint64_t *migrations)
+{
+	*count = 0;
+	*migrations = 0;
+
+	for (unsigned int i = 0; i < NUM_THREADS; i++) {
+		k_thread_abort(&workers[i].thread);
+	}
+
+	for (unsigned int i = 0; i < NUM_THREADS; i++) {
+		*count += workers[i].count;
+		*migrations += workers[i].migrations;
+	}
+}
+
+static void report(const char *str, uint64_t count, uint64_t migrations)
+{
+	uint64_t per_sec = count / CONFIG_BENCHMARK_INTERVAL_SECONDS;
+
+	printk("%-24s %10llu (%llu/s)\n", str, count, per_sec);
+	printk("%-24s %10llu (%llu per 1000)\n", "  Migrations:", migrations,
+	       count == 0 ? 0 : (migrations * 1000U) / count);
+}
+
+static void test_ping_pong(void)
+{
+	uint64_t count, migrations;
+
+	start_workers(ping_pong_entry);
+
+	/* Serve the first ball of every pair */
+	for (unsigned int i = 0; i < NUM_THREADS; i += 2) {
+		k_sem_give(&workers[i].sem);
+	}
+
+	k_sleep(K_SECONDS(CONFIG_BENCHMARK_INTERVAL_SECONDS));
+	stop_workers(&count, &migrations);
+
+	/* Both threads of a pair count one round trip */
+	report("Ping-pong round trips:", count / 2, migrations);
+}
+
+static void test_yield(void)
+{
+	uint64_t count, migrations;
+
+	start_workers(yield_entry);
+
+	k_sleep(K_SECONDS(CONFIG_BENCHMARK_INTERVAL_SECONDS));
+	stop_workers(&count, &migrations);
+
+	report("Yields:", count, migrations);
+}
+
+int main(void)
+{
+	/* Preempt the workers whenever the interval is over */
+	k_thread_priority_set(k_current_get(), WORKER_PRIO - 1);
+
+	printk("SMP scheduler measurements with %u CPUs, %u thread pairs\n", arch_num_cpus(),
+	       NUM_PAIRS);
+
+	test_ping_pong();
+	test_yield();
+
+	TC_END_REPORT(TC_PASS);
+
+	return 0;
+}
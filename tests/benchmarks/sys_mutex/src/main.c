@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains the main testing module that invokes all the tests.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/tc_util.h>
+#include <zephyr/app_memory/app_memdomain.h>
+#include <zephyr/sys/mutex.h>
+
+#define NUM_ITERATIONS CONFIG_BENCHMARK_NUM_ITERATIONS
+#define STACK_SIZE     (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define USER_PRIO      K_PRIO_PREEMPT(1)
+
+K_APPMEM_PARTITION_DEFINE(bench_partition);
+
+K_APP_BMEM(bench_partition) SYS_MUTEX_DEFINE(sys_mutex);
+K_APP_BMEM(bench_partition) static uint32_t num_errors;
+
+K_MUTEX_DEFINE(kernel_mutex);
+
+static struct k_thread user_thread;
+static K_THREAD_STACK_DEFINE(user_stack, STACK_SIZE);
+
+static void sys_mutex_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < NUM_ITERATIONS; i++) {
+		if ((sys_mutex_lock(&sys_mutex, K_FOREVER) != 0) ||
+		    (sys_mutex_unlock(&sys_mutex) != 0)) {
+			num_errors++;
+		}
+	}
+}
+
+static void sys_mutex_recursive_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	if (sys_mutex_lock(&sys_mutex, K_FOREVER) != 0) {
+		num_errors++;
+		return;
+	}
+
+	for (uint32_t i = 0; i < NUM_ITERATIONS; i++) {
+		if ((sys_mutex_lock(&sys_mutex, K_FOREVER) != 0) ||
+		    (sys_mutex_unlock(&sys_mutex) != 0)) {
+			num_errors++;
+		}
+	}
+
+	if (sys_mutex_unlock(&sys_mutex) != 0) {
+		num_errors++;
+	}
+}
+
+static void k_mutex_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < NUM_ITERATIONS; i++) {
+		if ((k_mutex_lock(&kernel_mutex, K_FOREVER) != 0) ||
+		    (k_mutex_unlock(&kernel_mutex) != 0)) {
+			num_errors++;
+		}
+	}
+}
+
+/* The user thread is timed from supervisor mode, where the cycle counter can
+ * be read. Starting and joining it is negligible next to the iterations.
+ */
+static int run_test(const char *str, k_thread_entry_t entry)
+{
+	uint32_t start;
+	uint32_t cycles;
+
+	num_errors = 0;
+
+	k_thread_create(&user_thread, user_stack, STACK_SIZE, entry, NULL, NULL, NULL,
+			USER_PRIO, K_USER, K_FOREVER);
+	k_thread_access_grant(&user_thread, &kernel_mutex);
+
+	start = k_cycle_get_32();
+	k_thread_start(&user_thread);
+	k_thread_join(&user_thread, K_FOREVER);
+	cycles = k_cycle_get_32() - start;
+
+	printk("%-24s %8u cycles, %8u ns per pair\n", str, cycles / NUM_ITERATIONS,
+	       (uint32_t)(k_cyc_to_ns_floor64(cycles) / NUM_ITERATIONS));
+
+	if (num_errors != 0U) {
+		printk("%u lock/unlock errors\n", num_errors);
+		return TC_FAIL;
+	}
+
+	return TC_PASS;
+}
+
+int main(void)
+{
+	int status = TC_PASS;
+
+	printk("User mode mutex measurements, %u lock/unlock pairs, fast path %s\n",
+	       NUM_ITERATIONS, IS_ENABLED(CONFIG_SYS_MUTEX_FAST_PATH) ? "enabled" : "disabled");
+
+	if (k_mem_domain_add_partition(&k_mem_domain_default, &bench_partition) != 0) {
+		printk("Failed to add the benchmark partition\n");
+		status = TC_FAIL;
+	} else {
+		if (run_test("sys_mutex lock/unlock:", sys_mutex_entry) != TC_PASS) {
+			status = TC_FAIL;
+		}
+		if (run_test("sys_mutex recursive:", sys_mutex_recursive_entry) != TC_PASS) {
+			status = TC_FAIL;
+		}
+		if (run_test("k_mutex lock/unlock:", k_mutex_entry) != TC_PASS) {
+			status = TC_FAIL;
+		}
+	}
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains the main testing module that invokes all the tests.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/timer/system_timer.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/tc_util.h>
+#include <timeout_q.h>
+
+struct bench_timeout {
+	struct _timeout to;
+	k_ticks_t expires;
+};
+
+static const unsigned int num_timeouts[] = {10, 1000, 10000};
+
+/* The pending timeouts, followed by the one that is added and cancelled */
+static struct bench_timeout timeouts[CONFIG_BENCHMARK_MAX_TIMEOUTS + 1];
+
+static uint32_t rand_state = 0x2545F491;
+
+static unsigned int num_expired;
+static k_ticks_t last_expired;
+static bool expired_out_of_order;
+
+static uint32_t rand_delay(void)
+{
+	/* xorshift32, reproducible across runs and platforms */
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+
+	return 1 + (rand_state % CONFIG_BENCHMARK_TIMEOUT_SPAN);
+}
+
+static void timeout_handler(struct _timeout *to)
+{
+	struct bench_timeout *t = CONTAINER_OF(to, struct bench_timeout, to);
+	k_ticks_t now = sys_clock_tick_get();
+
+	/* Handlers run with the current tick at the expiry of their timeout */
+	if ((now != t->expires) || (now < last_expired)) {
+		expired_out_of_order = true;
+	}
+
+	last_expired = now;
+	num_expired++;
+}
+
+static void add_timeout(struct bench_timeout *t)
+{
+	z_init_timeout(&t->to);
+	t->expires = z_add_timeout(&t->to, timeout_handler, K_TICKS(rand_delay()));
+}
+
+static void report(const char *tag, const char *stat, const char *str, unsigned int num_pending,
+		   uint64_t cycles)
+{
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: timeout.%s.%05u.pending.%s - %s (%u pending), %s. : %7llu cycles , %7u ns :\n",
+	       tag, num_pending, stat, str, num_pending, stat, cycles,
+	       (uint32_t)timing_cycles_to_ns(cycles));
+#else
+	ARG_UNUSED(tag);
+
+	printk("    %-40s %5u pending, %s : %7llu cycles (%7u nsec)\n", str, num_pending, stat,
+	       cycles, (uint32_t)timing_cycles_to_ns(cycles));
+#endif
+}
+
+static void test_add_cancel(unsigned int num_pending)
+{
+	struct bench_timeout *probe = &timeouts[CONFIG_BENCHMARK_MAX_TIMEOUTS];
+	uint64_t add_total = 0;
+	uint64_t add_max = 0;
+	uint64_t cancel_total = 0;
+	uint64_t cancel_max = 0;
+	timing_t start;
+	timing_t mid;
+	timing_t finish;
+	uint64_t cycles;
+
+	for (unsigned int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		z_init_timeout(&probe->to);
+
+		start = timing_counter_get();
+		z_add_timeout(&probe->to, timeout_handler, K_TICKS(rand_delay()));
+		mid = timing_counter_get();
+		z_abort_timeout(&probe->to);
+		finish = timing_counter_get();
+
+		cycles = timing_cycles_get(&start, &mid);
+		add_total += cycles;
+		add_max = MAX(add_max, cycles);
+
+		cycles = timing_cycles_get(&mid, &finish);
+		cancel_total += cycles;
+		cancel_max = MAX(cancel_max, cycles);
+	}
+
+	report("add", "avg", "Add a timeout", num_pending,
+	       add_total / CONFIG_BENCHMARK_NUM_ITERATIONS);
+	report("add", "max", "Add a timeout", num_pending, add_max);
+	report("cancel", "avg", "Cancel a timeout", num_pending,
+	       cancel_total / CONFIG_BENCHMARK_NUM_ITERATIONS);
+	report("cancel", "max", "Cancel a timeout", num_pending, cancel_max);
+}
+
+static int test_expire(unsigned int num_pending)
+{
+	timing_t start;
+	timing_t finish;
+	uint64_t cycles;
+	unsigned int key;
+
+	/* Stand in for the timer driver: announce the ticks of the whole span
+	 * at once, so every pending timeout expires in a single call.
+	 */
+	key = irq_lock();
+	start = timing_counter_get();
+	while (num_expired < num_pending) {
+		sys_clock_announce(CONFIG_BENCHMARK_TIMEOUT_SPAN + 1);
+	}
+	finish = timing_counter_get();
+	irq_unlock(key);
+
+	cycles = timing_cycles_get(&start, &finish);
+	report("expire", "avg", "Expire a timeout", num_pending, cycles / num_pending);
+	report("expire", "all", "Expire all timeouts", num_pending, cycles);
+
+	if (expired_out_of_order || (num_expired != num_pending)) {
+		printk("Timeouts expired out of order\n");
+		return TC_FAIL;
+	}
+
+	return TC_PASS;
+}
+
+int main(void)
+{
+	unsigned int freq;
+	int status = TC_PASS;
+
+	timing_init();
+
+	freq = timing_freq_get_mhz();
+
+	printk("Time Measurements for %s timeout queue\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_WHEEL) ? "wheel" : "list");
+	printk("Timing results: Clock frequency: %u MHz\n", freq);
+
+	timing_start();
+
+	for (size_t n = 0; n < ARRAY_SIZE(num_timeouts); n++) {
+		unsigned int num_pending = num_timeouts[n];
+
+		if (num_pending > CONFIG_BENCHMARK_MAX_TIMEOUTS) {
+			break;
+		}
+
+		/* A slow platform may see some of them expire before test_expire() */
+		num_expired = 0;
+		last_expired = 0;
+		expired_out_of_order = false;
+
+		for (unsigned int i = 0; i < num_pending; i++) {
+			add_timeout(&timeouts[i]);
+		}
+
+		test_add_cancel(num_pending);
+
+		if (test_expire(num_pending) != TC_PASS) {
+			status = TC_FAIL;
+		}
+	}
+
+	timing_stop();
+
+	TC_END_REPORT(status);
+
+	return 0;
+}
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/drivers/sensor/sensirion_batch.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "sensirion_emul.h"
+
+#define TEST_TEMPERATURE_MC  25000
+#define TEST_VOC_RAW         30000
+#define TEST_TOLERANCE_MILLI 10
+#define TEST_BUF_SIZE        64
+
+/* Conversion times of the sensors in the overlay: SHT4x, SHT3xD, STS4x, SGP40 */
+#define TEST_MAX_CONVERSION_US 30000
+#define TEST_SUM_CONVERSION_US (8300 + 15000 + 8300 + 30000)
+
+struct test_sensor {
+	const struct device *dev;
+	const struct emul *emul;
+	enum sensor_channel chan;
+	int64_t expected_milli;
+};
+
+#define TEST_SENSOR(label, channel, milli)                                                         \
+	{                                                                                          \
+		.dev = DEVICE_DT_GET(DT_NODELABEL(label)),                                         \
+		.emul = EMUL_DT_GET(DT_NODELABEL(label)),                                          \
+		.chan = channel,                                                                   \
+		.expected_milli = milli,                                                           \
+	}
+
+/* In the order of the batch */
+static const struct test_sensor sensors[] = {
+	TEST_SENSOR(sht4x, SENSOR_CHAN_AMBIENT_TEMP, TEST_TEMPERATURE_MC),
+	TEST_SENSOR(sht3xd, SENSOR_CHAN_AMBIENT_TEMP, TEST_TEMPERATURE_MC),
+	TEST_SENSOR(sts4x, SENSOR_CHAN_AMBIENT_TEMP, TEST_TEMPERATURE_MC),
+	TEST_SENSOR(sgp40, SENSOR_CHAN_GAS_RES, TEST_VOC_RAW * 1000LL),
+};
+
+#define NUM_SENSORS ARRAY_SIZE(sensors)
+
+SENSIRION_BATCH_DEFINE(test_batch, DEVICE_DT_GET(DT_NODELABEL(sht4x)),
+		       DEVICE_DT_GET(DT_NODELABEL(sht3xd)), DEVICE_DT_GET(DT_NODELABEL(sts4x)),
+		       DEVICE_DT_GET(DT_NODELABEL(sgp40)));
+
+/* The SCD41 runs a periodic measurement and does not take part in batches */
+SENSIRION_BATCH_DEFINE(test_mixed_batch, DEVICE_DT_GET(DT_NODELABEL(sht4x)),
+		       DEVICE_DT_GET(DT_NODELABEL(scd41)));
+
+static uint8_t test_storage[NUM_SENSORS][TEST_BUF_SIZE];
+static uint8_t *const test_bufs[NUM_SENSORS] = {
+	test_storage[0],
+	test_storage[1],
+	test_storage[2],
+	test_storage[3],
+};
+
+static int64_t test_decode(const struct test_sensor *sensor, const uint8_t *buf)
+{
+	const struct sensor_decoder_api *decoder;
+	struct sensor_q31_data q31;
+	uint32_t fit = 0;
+
+	zassert_ok(sensor_get_decoder(sensor->dev, &decoder));
+	zassert_equal(decoder->decode(buf, (struct sensor_chan_spec){sensor->chan, 0}, &fit, 1,
+				      &q31),
+		      1, "%s: nothing decoded", sensor->dev->name);
+
+	return ((int64_t)q31.readings[0].value * 1000 * (1LL << q31.shift)) >> 31;
+}
+
+static void test_check_values(const int results[])
+{
+	for (size_t i = 0; i < NUM_SENSORS; i++) {
+		const struct test_sensor *sensor = &sensors[i];
+		int64_t milli;
+
+		zassert_ok(results[i], "%s: read failed", sensor->dev->name);
+		milli = test_decode(sensor, test_bufs[i]);
+		zassert_within(milli, sensor->expected_milli, TEST_TOLERANCE_MILLI,
+			       "%s: unexpected value %lld", sensor->dev->name, milli);
+	}
+}
+
+ZTEST(sensirion_batch, test_read)
+{
+	uint32_t commands[NUM_SENSORS];
+	int results[NUM_SENSORS];
+	int64_t elapsed_us;
+	int64_t start;
+
+	for (size_t i = 0; i < NUM_SENSORS; i++) {
+		commands[i] = sensirion_emul_get_num_commands(sensors[i].emul);
+	}
+
+	start = k_uptime_ticks();
+	zassert_ok(sensirion_batch_read(&test_batch, test_bufs, TEST_BUF_SIZE, results));
+	elapsed_us = k_ticks_to_us_floor64(k_uptime_ticks() - start);
+
+	test_check_values(results);
+
+	/* One measure command per sensor, nothing read before the conversion was done */
+	for (size_t i = 0; i < NUM_SENSORS; i++) {
+		zassert_equal(sensirion_emul_get_num_commands(sensors[i].emul) - commands[i], 1,
+			      "%s: unexpected bus traffic", sensors[i].dev->name);
+	}
+
+	/* The conversions overlap */
+	zassert_true(elapsed_us >= TEST_MAX_CONVERSION_US, "read took %lld us", elapsed_us);
+	zassert_true(elapsed_us < TEST_SUM_CONVERSION_US, "read took %lld us", elapsed_us);
+}
+
+ZTEST(sensirion_batch, test_read_without_results)
+{
+	zassert_ok(sensirion_batch_read(&test_batch, test_bufs, TEST_BUF_SIZE, NULL));
+	zassert_within(test_decode(&sensors[0], test_bufs[0]), TEST_TEMPERATURE_MC,
+		       TEST_TOLERANCE_MILLI);
+}
+
+ZTEST(sensirion_batch, test_nack)
+{
+	int results[NUM_SENSORS];
+
+	/* A sensor that does not respond does not affect the others */
+	sensirion_emul_set_nack(sensors[1].emul, true);
+
+	zassert_equal(sensirion_batch_read(&test_batch, test_bufs, TEST_BUF_SIZE, results), -EIO);
+	zassert_equal(results[1], -EIO);
+	zassert_ok(results[0]);
+	zassert_ok(results[2]);
+	zassert_ok(results[3]);
+	zassert_within(test_decode(&sensors[3], test_bufs[3]), sensors[3].expected_milli,
+		       TEST_TOLERANCE_MILLI);
+
+	sensirion_emul_set_nack(sensors[1].emul, false);
+	zassert_ok(sensirion_batch_read(&test_batch, test_bufs, TEST_BUF_SIZE, results));
+	test_check_values(results);
+}
+
+static void test_nack_expiry(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	sensirion_emul_set_nack(sensors[1].emul, true);
+}
+
+ZTEST(sensirion_batch, test_nack_during_conversion)
+{
+	struct k_timer nack_timer;
+	int results[NUM_SENSORS];
+
+	/*
+	 * The measure command is acknowledged but the read is not, which
+	 * cancels the reads chained behind it. Those are issued again.
+	 */
+	k_timer_init(&nack_timer, test_nack_expiry, NULL);
+	k_timer_start(&nack_timer, K_USEC(TEST_MAX_CONVERSION_US / 2), K_NO_WAIT);
+
+	zassert_equal(sensirion_batch_read(&test_batch, test_bufs, TEST_BUF_SIZE, results), -EIO);
+	k_timer_stop(&nack_timer);
+	zassert_ok(results[0]);
+	zassert_equal(results[1], -EIO);
+	zassert_ok(results[2]);
+	zassert_ok(results[3]);
+	for (size_t i = 2; i < NUM_SENSORS; i++) {
+		zassert_within(test_decode(&sensors[i], test_bufs[i]), sensors[i].expected_milli,
+			       TEST_TOLERANCE_MILLI, "%s: unexpected value", sensors[i].dev->name);
+	}
+}
+
+ZTEST(sensirion_batch, test_crc_error)
+{
+	int results[NUM_SENSORS];
+
+	sensirion_emul_set_crc_error(sensors[3].emul, true);
+
+	zassert_equal(sensirion_batch_read(&test_batch, test_bufs, TEST_BUF_SIZE, results), -EIO);
+	zassert_ok(results[0]);
+	zassert_ok(results[1]);
+	zassert_ok(results[2]);
+	zassert_equal(results[3], -EIO);
+}
+
+ZTEST(sensirion_batch, test_unsupported)
+{
+	int results[2];
+
+	zassert_equal(sensirion_batch_read(&test_mixed_batch, test_bufs, TEST_BUF_SIZE, results),
+		      -ENOTSUP);
+	zassert_ok(results[0]);
+	zassert_equal(results[1], -ENOTSUP);
+	zassert_within(test_decode(&sensors[0], test_bufs[0]), TEST_TEMPERATURE_MC,
+		       TEST_TOLERANCE_MILLI);
+}
+
+ZTEST(sensirion_batch, test_small_buffer)
+{
+	int results[NUM_SENSORS];
+
+	zassert_equal(sensirion_batch_read(&test_batch, test_bufs, 1, results), -ENOMEM);
+	for (size_t i = 0; i < NUM_SENSORS; i++) {
+		zassert_equal(results[i], -ENOMEM);
+	}
+}
+
+static void sensirion_batch_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Back to 25 °C, 50 %RH and the default VOC ticks, without bus errors */
+	ARRAY_FOR_EACH_PTR(sensors, sensor) {
+		sensirion_emul_reset(sensor->emul);
+	}
+}
+
+ZTEST_SUITE(sensirion_batch, NULL, NULL, sensirion_batch_before, NULL, NULL);
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/drivers/sensor/sht4x.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/ztest.h>
+
+#include "sensirion_emul.h"
+#include "../stcc4/stcc4.h"
+
+#define SGP40_CMD_MEASURE_RAW          0x260F
+#define STCC4_CMD_SET_RHT_COMPENSATION 0xE000
+
+/* Compensation the SGP40 driver applies without a source: 25 °C, 50 %RH */
+#define SGP40_DEFAULT_T_TICKS  26214
+#define SGP40_DEFAULT_RH_TICKS 32768
+
+#define TEST_BUF_SIZE 64
+
+/* A sample of the SHT4x and the humidity word the SGP40 expects for it */
+struct test_sample {
+	uint16_t t_ticks;
+	uint16_t rh_ticks;
+	uint16_t sgp40_rh_ticks;
+};
+
+/* 31.56 °C, 64.31 %RH */
+static const struct test_sample sample_a = {0x7000, 0x9000, 42147};
+/* 18.48 °C, 22.41 %RH */
+static const struct test_sample sample_b = {0x5CDC, 0x3A2F, 14686};
+/* 60.00 °C, 2.00 %RH: what the SHT4x measures with its heater on */
+static const struct test_sample sample_hot = {0x9999, 0x1062, 1310};
+/* Below 0 %RH after the conversion, clamped by the SGP40 */
+static const struct test_sample sample_dry = {0x6666, 0x0800, 0};
+
+static const struct device *const sht4x = DEVICE_DT_GET(DT_NODELABEL(sht4x));
+static const struct device *const sgp40 = DEVICE_DT_GET(DT_NODELABEL(sgp40));
+static const struct device *const sgp40_manual = DEVICE_DT_GET(DT_NODELABEL(sgp40_manual));
+static const struct device *const stcc4 = DEVICE_DT_GET(DT_NODELABEL(stcc4));
+static const struct emul *const sht4x_emul = EMUL_DT_GET(DT_NODELABEL(sht4x));
+static const struct emul *const sgp40_emul = EMUL_DT_GET(DT_NODELABEL(sgp40));
+static const struct emul *const sgp40_manual_emul = EMUL_DT_GET(DT_NODELABEL(sgp40_manual));
+static const struct emul *const stcc4_emul = EMUL_DT_GET(DT_NODELABEL(stcc4));
+
+SENSOR_DT_READ_IODEV(sht4x_iodev, DT_NODELABEL(sht4x), {SENSOR_CHAN_ALL, 0});
+SENSOR_DT_READ_IODEV(sgp40_iodev, DT_NODELABEL(sgp40), {SENSOR_CHAN_GAS_RES, 0});
+SENSOR_DT_READ_IODEV(stcc4_iodev, DT_NODELABEL(stcc4), {SENSOR_CHAN_CO2, 0});
+RTIO_DEFINE(test_rtio, 1, 1);
+
+static void test_set_sample(const struct test_sample *sample)
+{
+	sensirion_emul_set_signal(sht4x_emul, SENSIRION_EMUL_TEMPERATURE, sample->t_ticks);
+	sensirion_emul_set_signal(sht4x_emul, SENSIRION_EMUL_HUMIDITY, sample->rh_ticks);
+}
+
+static void test_read(const struct rtio_iodev *iodev)
+{
+	uint8_t buf[TEST_BUF_SIZE];
+
+	zassert_ok(sensor_read(iodev, &test_rtio, buf, sizeof(buf)));
+}
+
+static void test_check_args(const struct emul *target, uint16_t expected_cmd, uint16_t arg0,
+			    uint16_t arg1)
+{
+	uint16_t args[SENSIRION_EMUL_MAX_ARGS];
+	uint16_t cmd;
+
+	zassert_equal(sensirion_emul_get_last_args(target, &cmd, args), 2);
+	zassert_equal(cmd, expected_cmd, "unexpected command 0x%04x", cmd);
+	zassert_equal(args[0], arg0, "first argument 0x%04x, expected 0x%04x", args[0], arg0);
+	zassert_equal(args[1], arg1, "second argument 0x%04x, expected 0x%04x", args[1], arg1);
+}
+
+static void test_check_sgp40(const struct test_sample *sample)
+{
+	/* RH first, then T */
+	test_check_args(sgp40_emul, SGP40_CMD_MEASURE_RAW, sample->sgp40_rh_ticks,
+			sample->t_ticks);
+}
+
+static void test_check_stcc4(const struct test_sample *sample)
+{
+	/* T first, then RH, both in SHT4x ticks */
+	test_check_args(stcc4_emul, STCC4_CMD_SET_RHT_COMPENSATION, sample->t_ticks,
+			sample->rh_ticks);
+}
+
+ZTEST(sensirion_comp, test_fetch)
+{
+	test_set_sample(&sample_a);
+	zassert_ok(sensor_sample_fetch(sht4x));
+
+	/* The gas sensors measure with the latest sample, no application round trip */
+	zassert_ok(sensor_sample_fetch(sgp40));
+	test_check_sgp40(&sample_a);
+	zassert_ok(sensor_sample_fetch(stcc4));
+	test_check_stcc4(&sample_a);
+
+	/* The compensation and the measurement */
+	zassert_equal(sensirion_emul_get_num_commands(stcc4_emul), 2);
+}
+
+ZTEST(sensirion_comp, test_read)
+{
+	test_set_sample(&sample_b);
+	test_read(&sht4x_iodev);
+
+	test_read(&sgp40_iodev);
+	test_check_sgp40(&sample_b);
+	test_read(&stcc4_iodev);
+	test_check_stcc4(&sample_b);
+	zassert_equal(sensirion_emul_get_num_commands(stcc4_emul), 2);
+}
+
+ZTEST(sensirion_comp, test_stcc4_unchanged_sample)
+{
+	uint32_t commands;
+
+	test_set_sample(&sample_a);
+	zassert_ok(sensor_sample_fetch(sht4x));
+	zassert_ok(sensor_sample_fetch(stcc4));
+
+	/* Without a new sample only the measurement is read, in both paths */
+	commands = sensirion_emul_get_num_commands(stcc4_emul);
+	zassert_ok(sensor_sample_fetch(stcc4));
+	test_read(&stcc4_iodev);
+	zassert_equal(sensirion_emul_get_num_commands(stcc4_emul) - commands, 2);
+
+	/* A new one is sent once */
+	test_set_sample(&sample_b);
+	zassert_ok(sensor_sample_fetch(sht4x));
+	commands = sensirion_emul_get_num_commands(stcc4_emul);
+	test_read(&stcc4_iodev);
+	zassert_ok(sensor_sample_fetch(stcc4));
+	zassert_equal(sensirion_emul_get_num_commands(stcc4_emul) - commands, 3);
+	test_check_stcc4(&sample_b);
+}
+
+ZTEST(sensirion_comp, test_heater)
+{
+	test_set_sample(&sample_a);
+	zassert_ok(sensor_sample_fetch(sht4x));
+
+	/* A sample taken with the heater on is not used */
+	test_set_sample(&sample_hot);
+	zassert_ok(sht4x_fetch_with_heater(sht4x));
+
+	zassert_ok(sensor_sample_fetch(sgp40));
+	test_check_sgp40(&sample_a);
+	zassert_ok(sensor_sample_fetch(stcc4));
+	test_check_stcc4(&sample_a);
+}
+
+ZTEST(sensirion_comp, test_clamp)
+{
+	test_set_sample(&sample_dry);
+	zassert_ok(sensor_sample_fetch(sht4x));
+
+	zassert_ok(sensor_sample_fetch(sgp40));
+	test_check_sgp40(&sample_dry);
+}
+
+ZTEST(sensirion_comp, test_unlinked)
+{
+	test_set_sample(&sample_a);
+	zassert_ok(sensor_sample_fetch(sht4x));
+
+	zassert_ok(sensor_sample_fetch(sgp40_manual));
+	test_check_args(sgp40_manual_emul, SGP40_CMD_MEASURE_RAW, SGP40_DEFAULT_RH_TICKS,
+			SGP40_DEFAULT_T_TICKS);
+}
+
+static void sensirion_comp_before(void *fixture)
+{
+	struct stcc4_data *stcc4_data = stcc4->data;
+
+	ARG_UNUSED(fixture);
+
+	sensirion_emul_reset(sht4x_emul);
+	sensirion_emul_reset(sgp40_emul);
+	sensirion_emul_reset(sgp40_manual_emul);
+	sensirion_emul_reset(stcc4_emul);
+
+	/* Make the STCC4 send the next sample, whatever it was given before */
+	atomic_clear(&stcc4_data->comp_sample);
+}
+
+static void *sensirion_comp_setup(void)
+{
+	struct stcc4_data *stcc4_data = stcc4->data;
+
+	/* The STCC4 runs its self test in the background after boot */
+	while (sensirion_job_busy(&stcc4_data->job)) {
+		k_msleep(100);
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(sensirion_comp, NULL, sensirion_comp_setup, sensirion_comp_before, NULL, NULL);
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/ztest.h>
+
+#include "sensirion_common.h"
+#include "sensirion_i2c.h"
+
+#define TEST_WORD_SIZE     (SENSIRION_WORD_SIZE + CRC8_LEN)
+#define BENCH_WORDS        SENSIRION_MAX_BUFFER_WORDS
+#define BENCH_ITERATIONS   1000
+
+static uint8_t frame[BENCH_WORDS * TEST_WORD_SIZE];
+
+/* Per-word bit-serial check, as the drivers did before */
+static int8_t check_frame_bitwise(const uint8_t *buf, uint16_t num_words)
+{
+	for (uint16_t i = 0; i < num_words; i++, buf += TEST_WORD_SIZE) {
+		if (crc8(buf, SENSIRION_WORD_SIZE, 0x31, CRC8_INIT, false) !=
+		    buf[SENSIRION_WORD_SIZE]) {
+			return CRC_ERROR;
+		}
+	}
+
+	return NO_ERROR;
+}
+
+/* Per-word check walking the byte table, as sensirion_i2c did before */
+static int8_t check_frame_bytewise(const uint8_t *buf, uint16_t num_words)
+{
+	for (uint16_t i = 0; i < num_words; i++, buf += TEST_WORD_SIZE) {
+		uint8_t crc = CRC8_INIT;
+
+		for (int j = 0; j < SENSIRION_WORD_SIZE; j++) {
+			crc = crc8_poly31_table[crc ^ buf[j]];
+		}
+		if (crc != buf[SENSIRION_WORD_SIZE]) {
+			return CRC_ERROR;
+		}
+	}
+
+	return NO_ERROR;
+}
+
+static void fill_frame(uint16_t num_words)
+{
+	for (uint16_t i = 0; i < num_words; i++) {
+		uint16_t word = (uint16_t)(i * 0x9E37 + 0x6666);
+
+		sys_put_be16(word, &frame[i * TEST_WORD_SIZE]);
+		frame[i * TEST_WORD_SIZE + SENSIRION_WORD_SIZE] = sensirion_i2c_word_crc(word);
+	}
+}
+
+/* Time per validated word in ns */
+static uint32_t bench_ns_per_word(int8_t (*check)(const uint8_t *, uint16_t))
+{
+	timing_t start, end;
+	uint64_t ns;
+
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		zassert_equal(check(frame, BENCH_WORDS), NO_ERROR);
+	}
+	end = timing_counter_get();
+
+	ns = timing_cycles_to_ns(timing_cycles_get(&start, &end));
+
+	return (uint32_t)(ns / (BENCH_ITERATIONS * BENCH_WORDS));
+}
+
+ZTEST(sensirion_crc, test_datasheet_example)
+{
+	const uint8_t word[] = {0xBE, 0xEF};
+
+	zassert_equal(sensirion_i2c_word_crc(0xBEEF), 0x92);
+	zassert_equal(sensirion_i2c_generate_crc(word, sizeof(word)), 0x92);
+}
+
+ZTEST(sensirion_crc, test_word_crc)
+{
+	uint8_t buf[SENSIRION_WORD_SIZE];
+
+	for (uint32_t word = 0; word <= UINT16_MAX; word++) {
+		uint8_t expected;
+
+		sys_put_be16(word, buf);
+		expected = crc8(buf, sizeof(buf), 0x31, CRC8_INIT, false);
+
+		zassert_equal(sensirion_i2c_word_crc(word), expected, "word 0x%04x", word);
+		zassert_equal(sensirion_i2c_generate_crc(buf, sizeof(buf)), expected,
+			      "word 0x%04x", word);
+	}
+}
+
+ZTEST(sensirion_crc, test_generate_crc)
+{
+	const uint8_t data[] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD};
+
+	/* Also odd lengths, where the last byte goes through the byte table */
+	for (uint16_t len = 0; len <= sizeof(data); len++) {
+		zassert_equal(sensirion_i2c_generate_crc(data, len),
+			      crc8(data, len, 0x31, CRC8_INIT, false), "length %u", len);
+	}
+}
+
+ZTEST(sensirion_crc, test_check_frame)
+{
+	fill_frame(BENCH_WORDS);
+
+	zassert_equal(sensirion_i2c_check_frame(frame, BENCH_WORDS), NO_ERROR);
+	zassert_equal(sensirion_i2c_check_frame(frame, 0), NO_ERROR);
+
+	/* Every single bit error is detected, in the data and in the checksums */
+	for (size_t i = 0; i < sizeof(frame); i++) {
+		for (int bit = 0; bit < BITS_PER_BYTE; bit++) {
+			frame[i] ^= BIT(bit);
+			zassert_equal(sensirion_i2c_check_frame(frame, BENCH_WORDS), CRC_ERROR,
+				      "byte %zu bit %d", i, bit);
+			frame[i] ^= BIT(bit);
+		}
+	}
+}
+
+ZTEST(sensirion_crc, test_benchmark)
+{
+	uint32_t bitwise_ns;
+	uint32_t bytewise_ns;
+	uint32_t frame_ns;
+
+	fill_frame(BENCH_WORDS);
+
+	timing_init();
+	timing_start();
+
+	bitwise_ns = bench_ns_per_word(check_frame_bitwise);
+	bytewise_ns = bench_ns_per_word(check_frame_bytewise);
+	frame_ns = bench_ns_per_word(sensirion_i2c_check_frame);
+
+	timing_stop();
+
+	TC_PRINT("%d word frame, ns per word: bit-serial %u, byte table %u, check_frame %u\n",
+		 BENCH_WORDS, bitwise_ns, bytewise_ns, frame_ns);
+}
+
+ZTEST_SUITE(sensirion_crc, NULL, NULL, NULL, NULL, NULL);
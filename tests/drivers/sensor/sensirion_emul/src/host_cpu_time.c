@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Built in the native simulator runner context, with the host libC */
+
+#include <time.h>
+
+#include "host_cpu_time.h"
+
+uint64_t host_cpu_time_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
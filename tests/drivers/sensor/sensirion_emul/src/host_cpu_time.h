@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HOST_CPU_TIME_H
+#define HOST_CPU_TIME_H
+
+#include <stdint.h>
+
+/**
+ * @brief Get the CPU time consumed by the native_sim process
+ *
+ * Code running on native_sim takes no simulated time, so the CPU cost of a
+ * code path can only be measured on the host.
+ *
+ * @return CPU time of the host process in nanoseconds
+ */
+uint64_t host_cpu_time_ns(void);
+
+#endif /* HOST_CPU_TIME_H */
@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/drivers/sensor/scd4x.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/ztest.h>
+
+#include "host_cpu_time.h"
+#include "sensirion_emul.h"
+
+#define TEST_TEMPERATURE_MC  25000
+#define TEST_CO2_PPM         800
+#define TEST_VOC_RAW         30000
+#define TEST_TOLERANCE_MILLI 10
+#define TEST_SCD4X_PERIOD_MS 5000
+/* Default temperature offset of the SCD4x emulator in °C */
+#define TEST_SCD4X_OFFSET    4
+#define TEST_SCD4X_ALTITUDE  420
+#define BENCH_ROUNDS         20
+
+struct test_sensor {
+	const struct device *dev;
+	const struct emul *emul;
+	const struct rtio_iodev *iodev;
+	enum sensor_channel chan;
+	int64_t expected_milli;
+	int result;
+};
+
+#define TEST_READ_IODEV(label, channel)                                                            \
+	SENSOR_DT_READ_IODEV(label##_iodev, DT_NODELABEL(label), {channel, 0})
+
+TEST_READ_IODEV(sht4x, SENSOR_CHAN_AMBIENT_TEMP);
+TEST_READ_IODEV(sts4x, SENSOR_CHAN_AMBIENT_TEMP);
+TEST_READ_IODEV(shtc3, SENSOR_CHAN_AMBIENT_TEMP);
+TEST_READ_IODEV(sht3xd, SENSOR_CHAN_AMBIENT_TEMP);
+TEST_READ_IODEV(sgp40, SENSOR_CHAN_GAS_RES);
+TEST_READ_IODEV(stcc4, SENSOR_CHAN_CO2);
+
+#define TEST_SENSOR(label, channel, milli)                                                         \
+	{                                                                                          \
+		.dev = DEVICE_DT_GET(DT_NODELABEL(label)),                                         \
+		.emul = EMUL_DT_GET(DT_NODELABEL(label)),                                          \
+		.iodev = &label##_iodev,                                                           \
+		.chan = channel,                                                                   \
+		.expected_milli = milli,                                                           \
+	}
+
+/* Sensors that run a complete conversion on every fetch */
+static struct test_sensor sensors[] = {
+	TEST_SENSOR(sht4x, SENSOR_CHAN_AMBIENT_TEMP, TEST_TEMPERATURE_MC),
+	TEST_SENSOR(sts4x, SENSOR_CHAN_AMBIENT_TEMP, TEST_TEMPERATURE_MC),
+	TEST_SENSOR(shtc3, SENSOR_CHAN_AMBIENT_TEMP, TEST_TEMPERATURE_MC),
+	TEST_SENSOR(sht3xd, SENSOR_CHAN_AMBIENT_TEMP, TEST_TEMPERATURE_MC),
+	TEST_SENSOR(sgp40, SENSOR_CHAN_GAS_RES, TEST_VOC_RAW * 1000LL),
+	TEST_SENSOR(stcc4, SENSOR_CHAN_CO2, TEST_CO2_PPM * 1000LL),
+};
+
+#define NUM_SENSORS ARRAY_SIZE(sensors)
+
+RTIO_DEFINE_WITH_MEMPOOL(test_rtio, NUM_SENSORS, NUM_SENSORS, 2 * NUM_SENSORS, 64, 4);
+
+static K_SEM_DEFINE(job_done, 0, 1);
+static int job_result;
+
+struct bench_result {
+	uint32_t samples_per_s;
+	uint32_t cpu_ns_per_sample;
+};
+
+static void test_fetch(struct test_sensor *sensor, int64_t *milli)
+{
+	struct sensor_value val;
+
+	sensor->result = sensor_sample_fetch(sensor->dev);
+	if (sensor->result == 0) {
+		zassert_ok(sensor_channel_get(sensor->dev, sensor->chan, &val));
+		*milli = sensor_value_to_milli(&val);
+	}
+}
+
+static void test_submit(struct test_sensor *sensor)
+{
+	zassert_ok(sensor_read_async_mempool(sensor->iodev, &test_rtio, sensor));
+}
+
+static struct test_sensor *test_consume(int64_t *milli)
+{
+	struct rtio_cqe *cqe = rtio_cqe_consume_block(&test_rtio);
+	struct test_sensor *sensor = cqe->userdata;
+	const struct sensor_decoder_api *decoder;
+	struct sensor_q31_data q31;
+	uint32_t fit = 0;
+	uint32_t buf_len;
+	uint8_t *buf;
+	int rc;
+
+	sensor->result = cqe->result;
+	rc = rtio_cqe_get_mempool_buffer(&test_rtio, cqe, &buf, &buf_len);
+	rtio_cqe_release(&test_rtio, cqe);
+
+	if (rc != 0) {
+		return sensor;
+	}
+
+	if (sensor->result == 0) {
+		zassert_ok(sensor_get_decoder(sensor->dev, &decoder));
+		zassert_equal(decoder->decode(buf, (struct sensor_chan_spec){sensor->chan, 0},
+					      &fit, 1, &q31),
+			      1);
+		*milli = ((int64_t)q31.readings[0].value * 1000 * (1LL << q31.shift)) >> 31;
+	}
+
+	rtio_release_buffer(&test_rtio, buf, buf_len);
+
+	return sensor;
+}
+
+static void test_check_value(const struct test_sensor *sensor, int64_t milli)
+{
+	zassert_ok(sensor->result, "%s: read failed", sensor->dev->name);
+	zassert_within(milli, sensor->expected_milli, TEST_TOLERANCE_MILLI,
+		       "%s: unexpected value %lld", sensor->dev->name, milli);
+}
+
+static void bench_finish(struct bench_result *res, uint32_t samples, int64_t ticks,
+			 uint64_t cpu_ns)
+{
+	uint64_t elapsed_us = k_ticks_to_us_floor64(ticks);
+
+	zassert_true(elapsed_us > 0, "No time elapsed");
+
+	res->samples_per_s = (uint32_t)((uint64_t)samples * USEC_PER_SEC / elapsed_us);
+	res->cpu_ns_per_sample = (uint32_t)(cpu_ns / samples);
+}
+
+ZTEST(sensirion_emul, test_fetch)
+{
+	int64_t milli = 0;
+
+	ARRAY_FOR_EACH_PTR(sensors, sensor) {
+		uint32_t commands = sensirion_emul_get_num_commands(sensor->emul);
+
+		test_fetch(sensor, &milli);
+		test_check_value(sensor, milli);
+		zassert_true(sensirion_emul_get_num_commands(sensor->emul) > commands,
+			     "%s: no command reached the emulator", sensor->dev->name);
+	}
+}
+
+ZTEST(sensirion_emul, test_read_async)
+{
+	int64_t milli = 0;
+
+	ARRAY_FOR_EACH_PTR(sensors, sensor) {
+		test_submit(sensor);
+	}
+
+	for (int i = 0; i < NUM_SENSORS; i++) {
+		struct test_sensor *sensor = test_consume(&milli);
+
+		test_check_value(sensor, milli);
+	}
+}
+
+ZTEST(sensirion_emul, test_read_async_busy)
+{
+	int64_t milli = 0;
+
+	ARRAY_FOR_EACH_PTR(sensors, sensor) {
+		int results = 0;
+
+		/* The second read is rejected while the first one is waiting for its result */
+		test_submit(sensor);
+		test_submit(sensor);
+
+		for (int i = 0; i < 2; i++) {
+			zassert_equal_ptr(test_consume(&milli), sensor);
+			if (sensor->result == -EBUSY) {
+				results |= BIT(0);
+			} else {
+				test_check_value(sensor, milli);
+				results |= BIT(1);
+			}
+		}
+
+		zassert_equal(results, BIT(0) | BIT(1), "%s: reads overlapped", sensor->dev->name);
+	}
+}
+
+ZTEST(sensirion_emul, test_scd4x_periodic)
+{
+	const struct device *dev = DEVICE_DT_GET(DT_NODELABEL(scd41));
+	const struct emul *emul = EMUL_DT_GET(DT_NODELABEL(scd41));
+	struct sensor_value val;
+
+	sensirion_emul_set_signal(emul, SENSIRION_EMUL_CO2, TEST_CO2_PPM);
+
+	/* A new measurement is available once per period */
+	k_msleep(TEST_SCD4X_PERIOD_MS);
+
+	zassert_ok(sensor_sample_fetch(dev));
+	zassert_ok(sensor_channel_get(dev, SENSOR_CHAN_CO2, &val));
+	zassert_equal(val.val1, TEST_CO2_PPM);
+	zassert_ok(sensor_channel_get(dev, SENSOR_CHAN_AMBIENT_TEMP, &val));
+	zassert_within(sensor_value_to_milli(&val), TEST_TEMPERATURE_MC, TEST_TOLERANCE_MILLI);
+}
+
+static void test_job_cb(const struct device *dev, int result, void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+
+	job_result = result;
+	k_sem_give(&job_done);
+}
+
+ZTEST(sensirion_emul, test_scd4x_attr)
+{
+	const struct device *dev = DEVICE_DT_GET(DT_NODELABEL(scd41));
+	struct sensor_value altitude = {.val1 = TEST_SCD4X_ALTITUDE};
+	struct sensor_value val;
+
+	zassert_ok(sensor_attr_get(dev, SENSOR_CHAN_ALL,
+				   (enum sensor_attribute)SENSOR_ATTR_SCD4X_TEMPERATURE_OFFSET, &val));
+	zassert_equal(val.val1, TEST_SCD4X_OFFSET);
+
+	zassert_ok(scd4x_attr_set_async(dev, (enum sensor_attribute)SENSOR_ATTR_SCD4X_SENSOR_ALTITUDE,
+					&altitude, test_job_cb, NULL));
+
+	/* Blocking requests are rejected while the job runs instead of interleaving with it */
+	zassert_equal(sensor_attr_get(dev, SENSOR_CHAN_ALL,
+				      (enum sensor_attribute)SENSOR_ATTR_SCD4X_SENSOR_ALTITUDE, &val),
+		      -EBUSY);
+	zassert_equal(sensor_sample_fetch(dev), -EBUSY);
+	zassert_equal(scd4x_persist_settings(dev), -EBUSY);
+
+	zassert_ok(k_sem_take(&job_done, K_SECONDS(2)));
+	zassert_ok(job_result);
+
+	zassert_ok(sensor_attr_get(dev, SENSOR_CHAN_ALL,
+				   (enum sensor_attribute)SENSOR_ATTR_SCD4X_SENSOR_ALTITUDE, &val));
+	zassert_equal(val.val1, TEST_SCD4X_ALTITUDE);
+}
+
+ZTEST(sensirion_emul, test_crc_error)
+{
+	int64_t milli = 0;
+
+	ARRAY_FOR_EACH_PTR(sensors, sensor) {
+		sensirion_emul_set_crc_error(sensor->emul, true);
+
+		test_fetch(sensor, &milli);
+		zassert_equal(sensor->result, -EIO, "%s: CRC error not detected",
+			      sensor->dev->name);
+
+		test_submit(sensor);
+		zassert_equal_ptr(test_consume(&milli), sensor);
+		zassert_equal(sensor->result, -EIO, "%s: CRC error not detected",
+			      sensor->dev->name);
+
+		/* The sensor recovers once the fault is gone */
+		sensirion_emul_set_crc_error(sensor->emul, false);
+		test_fetch(sensor, &milli);
+		test_check_value(sensor, milli);
+	}
+}
+
+ZTEST(sensirion_emul, test_nack)
+{
+	int64_t milli = 0;
+
+	ARRAY_FOR_EACH_PTR(sensors, sensor) {
+		sensirion_emul_set_nack(sensor->emul, true);
+
+		test_fetch(sensor, &milli);
+		zassert_true(sensor->result < 0, "%s: NACK not reported", sensor->dev->name);
+
+		test_submit(sensor);
+		zassert_equal_ptr(test_consume(&milli), sensor);
+		zassert_true(sensor->result < 0, "%s: NACK not reported", sensor->dev->name);
+
+		sensirion_emul_set_nack(sensor->emul, false);
+		test_fetch(sensor, &milli);
+		test_check_value(sensor, milli);
+	}
+}
+
+ZTEST(sensirion_emul, test_throughput)
+{
+	const uint32_t samples = BENCH_ROUNDS * NUM_SENSORS;
+	struct bench_result blocking;
+	struct bench_result async;
+	int64_t milli = 0;
+	uint64_t cpu_ns;
+	int64_t start;
+
+	/* Baseline: fetch one sensor after the other, sleeping through every conversion */
+	start = k_uptime_ticks();
+	cpu_ns = host_cpu_time_ns();
+	for (int i = 0; i < BENCH_ROUNDS; i++) {
+		ARRAY_FOR_EACH_PTR(sensors, sensor) {
+			test_fetch(sensor, &milli);
+			test_check_value(sensor, milli);
+		}
+	}
+	bench_finish(&blocking, samples, k_uptime_ticks() - start, host_cpu_time_ns() - cpu_ns);
+
+	/* All sensors of the bus convert at the same time */
+	start = k_uptime_ticks();
+	cpu_ns = host_cpu_time_ns();
+	for (int i = 0; i < BENCH_ROUNDS; i++) {
+		ARRAY_FOR_EACH_PTR(sensors, sensor) {
+			test_submit(sensor);
+		}
+		for (int j = 0; j < NUM_SENSORS; j++) {
+			test_check_value(test_consume(&milli), milli);
+		}
+	}
+	bench_finish(&async, samples, k_uptime_ticks() - start, host_cpu_time_ns() - cpu_ns);
+
+	TC_PRINT("%zu sensors: blocking %u samples/s, %u ns CPU/sample; "
+		 "async %u samples/s, %u ns CPU/sample\n",
+		 NUM_SENSORS, blocking.samples_per_s, blocking.cpu_ns_per_sample,
+		 async.samples_per_s, async.cpu_ns_per_sample);
+
+	zassert_true(async.samples_per_s > blocking.samples_per_s,
+		     "Asynchronous reads did not overlap their conversion times");
+}
+
+static void *sensirion_emul_setup(void)
+{
+	const struct device *stcc4 = DEVICE_DT_GET(DT_NODELABEL(stcc4));
+
+	/* The STCC4 runs its self test in the background after boot */
+	while (sensor_sample_fetch(stcc4) == -EBUSY) {
+		k_msleep(100);
+	}
+
+	return NULL;
+}
+
+static void sensirion_emul_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	ARRAY_FOR_EACH_PTR(sensors, sensor) {
+		sensirion_emul_reset(sensor->emul);
+		sensirion_emul_set_signal(sensor->emul, SENSIRION_EMUL_CO2, TEST_CO2_PPM);
+	}
+}
+
+ZTEST_SUITE(sensirion_emul, NULL, sensirion_emul_setup, sensirion_emul_before, NULL, NULL);
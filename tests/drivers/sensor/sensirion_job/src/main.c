@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "sensirion_job.h"
+
+#define TEST_STEP_MS   50
+#define TEST_NUM_STEPS 3
+
+static struct sensirion_job job;
+static struct k_poll_signal done_signal;
+static int step_calls;
+static int fail_state;
+static int restarts;
+
+/* Waits TEST_STEP_MS between steps and completes after TEST_NUM_STEPS */
+static int test_step(struct sensirion_job *j)
+{
+	uint16_t *out = j->out;
+
+	step_calls++;
+
+	if (j->state == fail_state) {
+		return -EIO;
+	}
+
+	if (++j->state < TEST_NUM_STEPS) {
+		return TEST_STEP_MS;
+	}
+
+	*out = j->arg;
+	return SENSIRION_JOB_DONE;
+}
+
+static int test_wait(void)
+{
+	struct k_poll_event event =
+		K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &done_signal);
+	unsigned int signaled;
+	int result;
+
+	zassert_ok(k_poll(&event, 1, K_SECONDS(1)), "Job did not complete");
+	k_poll_signal_check(&done_signal, &signaled, &result);
+	zassert_true(signaled);
+
+	return result;
+}
+
+ZTEST(sensirion_job, test_non_blocking)
+{
+	uint16_t out = 0;
+	int64_t start = k_uptime_get();
+
+	zassert_ok(sensirion_job_start(&job, test_step, 0x1234, &out, sensirion_job_signal_cb,
+				       &done_signal));
+	zassert_true(k_uptime_get() - start < TEST_STEP_MS, "Start blocked the caller");
+	zassert_true(sensirion_job_busy(&job));
+
+	zassert_ok(test_wait());
+	zassert_true(k_uptime_get() - start >= (TEST_NUM_STEPS - 1) * TEST_STEP_MS,
+		     "Steps did not wait for the command execution time");
+	zassert_equal(step_calls, TEST_NUM_STEPS);
+	zassert_equal(out, 0x1234);
+	zassert_false(sensirion_job_busy(&job));
+}
+
+ZTEST(sensirion_job, test_busy)
+{
+	uint16_t out;
+
+	zassert_ok(sensirion_job_start(&job, test_step, 0, &out, sensirion_job_signal_cb,
+				       &done_signal));
+	zassert_equal(sensirion_job_start(&job, test_step, 0, &out, NULL, NULL), -EBUSY);
+
+	zassert_ok(test_wait());
+	zassert_equal(step_calls, TEST_NUM_STEPS, "Rejected job ran anyway");
+}
+
+ZTEST(sensirion_job, test_error)
+{
+	uint16_t out;
+
+	fail_state = 1;
+
+	zassert_ok(sensirion_job_start(&job, test_step, 0, &out, sensirion_job_signal_cb,
+				       &done_signal));
+	zassert_equal(test_wait(), -EIO);
+	zassert_equal(step_calls, 2, "Job continued after a failed step");
+	zassert_false(sensirion_job_busy(&job));
+}
+
+ZTEST(sensirion_job, test_run)
+{
+	uint16_t out = 0;
+	int64_t start = k_uptime_get();
+
+	zassert_ok(sensirion_job_run(&job, test_step, 0x1234, &out));
+	zassert_true(k_uptime_get() - start >= (TEST_NUM_STEPS - 1) * TEST_STEP_MS,
+		     "Steps did not wait for the command execution time");
+	zassert_equal(step_calls, TEST_NUM_STEPS);
+	zassert_equal(out, 0x1234);
+	zassert_false(sensirion_job_busy(&job));
+
+	fail_state = 1;
+	zassert_equal(sensirion_job_run(&job, test_step, 0, &out), -EIO);
+	zassert_false(sensirion_job_busy(&job));
+}
+
+ZTEST(sensirion_job, test_claim)
+{
+	uint16_t out;
+
+	/* A command issued directly and a job never run at the same time */
+	zassert_ok(sensirion_job_claim(&job));
+	zassert_equal(sensirion_job_start(&job, test_step, 0, &out, NULL, NULL), -EBUSY);
+	zassert_equal(sensirion_job_run(&job, test_step, 0, &out), -EBUSY);
+	sensirion_job_release(&job);
+
+	zassert_ok(sensirion_job_start(&job, test_step, 0, &out, sensirion_job_signal_cb,
+				       &done_signal));
+	zassert_equal(sensirion_job_claim(&job), -EBUSY);
+	zassert_equal(sensirion_job_run(&job, test_step, 0, &out), -EBUSY);
+
+	zassert_ok(test_wait());
+	zassert_equal(step_calls, TEST_NUM_STEPS, "Rejected job ran anyway");
+}
+
+static void test_restart_cb(const struct device *dev, int result, void *user_data)
+{
+	static uint16_t out;
+
+	zassert_ok(result);
+
+	if (restarts++ == 0) {
+		/* The slot is free again by the time the callback runs */
+		zassert_ok(sensirion_job_start(&job, test_step, 0, &out, test_restart_cb,
+					       user_data));
+		return;
+	}
+
+	sensirion_job_signal_cb(dev, result, user_data);
+}
+
+ZTEST(sensirion_job, test_restart_from_callback)
+{
+	uint16_t out;
+
+	zassert_ok(sensirion_job_start(&job, test_step, 0, &out, test_restart_cb, &done_signal));
+	zassert_ok(test_wait());
+	zassert_equal(restarts, 2);
+	zassert_equal(step_calls, 2 * TEST_NUM_STEPS);
+}
+
+static void sensirion_job_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	sensirion_job_init(&job, NULL);
+	k_poll_signal_init(&done_signal);
+	step_calls = 0;
+	fail_state = -1;
+	restarts = 0;
+}
+
+ZTEST_SUITE(sensirion_job, NULL, NULL, sensirion_job_before, NULL, NULL);
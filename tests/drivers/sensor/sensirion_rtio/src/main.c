@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT vnd_sensirion_word_emul
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+
+#include "sensirion_rtio.h"
+#include "sensirion_word_emul.h"
+
+#define TEST_CMD             0x2C06
+#define TEST_DELAY_US        1000
+#define TEST_NUM_WORDS       3
+#define TEST_SQ_SIZE         8
+#define NUM_SENSORS          DT_NUM_INST_STATUS_OKAY(DT_DRV_COMPAT)
+
+static const uint16_t test_words[TEST_NUM_WORDS] = {0x6666, 0xBEEF, 0x0102};
+
+struct test_sensor {
+	struct rtio *ctx;
+	struct rtio_iodev *iodev;
+	const struct emul *emul;
+	uint8_t frame[SENSIRION_RTIO_FRAME_SIZE(TEST_NUM_WORDS)];
+	int result;
+};
+
+#define TEST_SENSOR_DEFINE(n)                                                                      \
+	RTIO_DEFINE(test_rtio_##n, TEST_SQ_SIZE, TEST_SQ_SIZE);                                    \
+	I2C_DT_IODEV_DEFINE(test_iodev_##n, DT_DRV_INST(n));
+
+DT_INST_FOREACH_STATUS_OKAY(TEST_SENSOR_DEFINE)
+
+#define TEST_SENSOR_INIT(n)                                                                        \
+	{                                                                                          \
+		.ctx = &test_rtio_##n,                                                             \
+		.iodev = &test_iodev_##n,                                                          \
+		.emul = EMUL_DT_GET(DT_DRV_INST(n)),                                               \
+	},
+
+static struct test_sensor sensors[] = {DT_INST_FOREACH_STATUS_OKAY(TEST_SENSOR_INIT)};
+
+K_MSGQ_DEFINE(done_msgq, sizeof(struct test_sensor *), NUM_SENSORS, sizeof(void *));
+
+static void test_read_done(struct rtio *ctx, const struct rtio_sqe *sqe, int result, void *arg)
+{
+	struct test_sensor *sensor = arg;
+
+	ARG_UNUSED(sqe);
+	ARG_UNUSED(result);
+
+	sensor->result = sensirion_rtio_finish(ctx, sensor->frame, TEST_NUM_WORDS);
+	k_msgq_put(&done_msgq, &sensor, K_NO_WAIT);
+}
+
+static int test_submit_read(struct test_sensor *sensor, uint32_t delay_us)
+{
+	int ret;
+
+	ret = sensirion_rtio_prep_read_cmd(sensor->ctx, sensor->iodev, TEST_CMD, delay_us,
+					   sensor->frame, TEST_NUM_WORDS);
+	if (ret == 0) {
+		ret = sensirion_rtio_submit(sensor->ctx, test_read_done, sensor, NULL);
+	}
+
+	return ret;
+}
+
+static struct test_sensor *test_wait_read(void)
+{
+	struct test_sensor *sensor = NULL;
+
+	zassert_ok(k_msgq_get(&done_msgq, &sensor, K_SECONDS(1)), "Transaction did not complete");
+
+	return sensor;
+}
+
+static void test_check_frame(const struct test_sensor *sensor)
+{
+	for (int i = 0; i < TEST_NUM_WORDS; i++) {
+		zassert_equal(sys_get_be16(&sensor->frame[SENSIRION_RTIO_FRAME_SIZE(i)]),
+			      test_words[i], "Unexpected word %d", i);
+	}
+}
+
+ZTEST(sensirion_rtio, test_delayed_read)
+{
+	struct test_sensor *sensor = &sensors[0];
+	uint8_t write[SENSIRION_WORD_EMUL_MAX_WRITE];
+	int64_t start = k_uptime_ticks();
+
+	zassert_ok(test_submit_read(sensor, TEST_DELAY_US));
+	zassert_equal_ptr(test_wait_read(), sensor);
+	zassert_true(k_ticks_to_us_floor64(k_uptime_ticks() - start) >= TEST_DELAY_US,
+		     "Read was issued before the command delay elapsed");
+
+	zassert_ok(sensor->result);
+	test_check_frame(sensor);
+
+	/* Command and read are separate transfers with the delay in between */
+	zassert_equal(sensirion_word_emul_get_last_write(sensor->emul, write),
+		      SENSIRION_COMMAND_SIZE);
+	zassert_equal(sys_get_be16(write), TEST_CMD);
+	zassert_equal(sensirion_word_emul_get_last_num_msgs(sensor->emul), 1);
+}
+
+ZTEST(sensirion_rtio, test_transaction_read)
+{
+	struct test_sensor *sensor = &sensors[0];
+	uint8_t write[SENSIRION_WORD_EMUL_MAX_WRITE];
+
+	zassert_ok(test_submit_read(sensor, 0));
+	zassert_equal_ptr(test_wait_read(), sensor);
+
+	zassert_ok(sensor->result);
+	test_check_frame(sensor);
+
+	/* Without a delay the command and the read form a single write-read */
+	zassert_equal(sensirion_word_emul_get_last_write(sensor->emul, write),
+		      SENSIRION_COMMAND_SIZE);
+	zassert_equal(sys_get_be16(write), TEST_CMD);
+	zassert_equal(sensirion_word_emul_get_last_num_msgs(sensor->emul), 2);
+}
+
+ZTEST(sensirion_rtio, test_long_write)
+{
+	struct test_sensor *sensor = &sensors[0];
+	const uint16_t args[] = {0x8000, 0x6666};
+	uint8_t cmd[SENSIRION_COMMAND_SIZE + 2 * (SENSIRION_WORD_SIZE + CRC8_LEN)];
+	uint8_t write[SENSIRION_WORD_EMUL_MAX_WRITE];
+
+	zassert_equal(sensirion_i2c_fill_cmd_send_buf(cmd, TEST_CMD, args, ARRAY_SIZE(args)),
+		      sizeof(cmd));
+
+	/* Longer than a tiny write, so the SQE references cmd instead of copying it */
+	zassert_ok(sensirion_rtio_prep_write(sensor->ctx, sensor->iodev, cmd, sizeof(cmd),
+					     TEST_DELAY_US, 0));
+	zassert_ok(sensirion_rtio_prep_read(sensor->ctx, sensor->iodev, sensor->frame,
+					    TEST_NUM_WORDS));
+	zassert_ok(sensirion_rtio_submit(sensor->ctx, test_read_done, sensor, NULL));
+	zassert_equal_ptr(test_wait_read(), sensor);
+
+	zassert_ok(sensor->result);
+	test_check_frame(sensor);
+	zassert_equal(sensirion_word_emul_get_last_write(sensor->emul, write), sizeof(cmd));
+	zassert_mem_equal(write, cmd, sizeof(cmd));
+}
+
+ZTEST(sensirion_rtio, test_crc_error)
+{
+	struct test_sensor *sensor = &sensors[0];
+
+	sensirion_word_emul_set_crc_error(sensor->emul, true);
+
+	zassert_ok(test_submit_read(sensor, TEST_DELAY_US));
+	zassert_equal_ptr(test_wait_read(), sensor);
+	zassert_equal(sensor->result, -EIO);
+}
+
+ZTEST(sensirion_rtio, test_nack)
+{
+	struct test_sensor *sensor = &sensors[0];
+
+	sensirion_word_emul_set_nack(sensor->emul, true);
+
+	/* The completion callback still runs and reports the bus error */
+	zassert_ok(test_submit_read(sensor, TEST_DELAY_US));
+	zassert_equal_ptr(test_wait_read(), sensor);
+	zassert_true(sensor->result < 0);
+
+	/* The context is usable again afterwards */
+	sensirion_word_emul_set_nack(sensor->emul, false);
+	zassert_ok(test_submit_read(sensor, TEST_DELAY_US));
+	zassert_equal_ptr(test_wait_read(), sensor);
+	zassert_ok(sensor->result);
+}
+
+ZTEST(sensirion_rtio, test_sqe_exhaustion)
+{
+	struct test_sensor *sensor = &sensors[0];
+	int queued = 0;
+	int ret;
+
+	while ((ret = sensirion_rtio_prep_cmd(sensor->ctx, sensor->iodev, TEST_CMD, 0, 0)) == 0) {
+		zassert_true(++queued <= TEST_SQ_SIZE, "More SQEs acquired than the pool holds");
+	}
+
+	zassert_equal(ret, -ENOMEM);
+	zassert_equal(queued, TEST_SQ_SIZE);
+
+	/* Everything queued so far was dropped, a full chain fits again */
+	zassert_ok(test_submit_read(sensor, TEST_DELAY_US));
+	zassert_equal_ptr(test_wait_read(), sensor);
+	zassert_ok(sensor->result);
+}
+
+ZTEST(sensirion_rtio, test_concurrent_reads)
+{
+	/* Every sensor of the bus has a chain in flight at the same time */
+	for (int i = 0; i < NUM_SENSORS; i++) {
+		zassert_ok(test_submit_read(&sensors[i], TEST_DELAY_US));
+	}
+
+	for (int i = 0; i < NUM_SENSORS; i++) {
+		struct test_sensor *sensor = test_wait_read();
+
+		zassert_ok(sensor->result);
+		test_check_frame(sensor);
+	}
+
+	zassert_equal(k_msgq_num_used_get(&done_msgq), 0, "Unexpected extra completion");
+}
+
+static void sensirion_rtio_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_msgq_purge(&done_msgq);
+
+	for (int i = 0; i < NUM_SENSORS; i++) {
+		sensirion_word_emul_reset(sensors[i].emul);
+		sensirion_word_emul_set_words(sensors[i].emul, test_words, TEST_NUM_WORDS);
+	}
+}
+
+ZTEST_SUITE(sensirion_rtio, NULL, NULL, sensirion_rtio_before, NULL, NULL);
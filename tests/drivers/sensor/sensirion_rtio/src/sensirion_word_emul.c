@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT vnd_sensirion_word_emul
+
+#include <string.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+
+#include "sensirion_word_emul.h"
+
+LOG_MODULE_REGISTER(sensirion_word_emul, LOG_LEVEL_INF);
+
+#define WORD_FRAME_SIZE 3
+
+struct sensirion_word_emul_data {
+	struct k_spinlock lock;
+	uint16_t words[SENSIRION_WORD_EMUL_MAX_WORDS];
+	size_t num_words;
+	uint8_t last_write[SENSIRION_WORD_EMUL_MAX_WRITE];
+	size_t last_write_len;
+	int last_num_msgs;
+	bool crc_error;
+	bool nack;
+};
+
+void sensirion_word_emul_set_words(const struct emul *target, const uint16_t *words,
+				   size_t num_words)
+{
+	struct sensirion_word_emul_data *data = target->data;
+	k_spinlock_key_t key;
+
+	__ASSERT_NO_MSG(num_words > 0 && num_words <= SENSIRION_WORD_EMUL_MAX_WORDS);
+
+	key = k_spin_lock(&data->lock);
+	memcpy(data->words, words, num_words * sizeof(words[0]));
+	data->num_words = num_words;
+	k_spin_unlock(&data->lock, key);
+}
+
+void sensirion_word_emul_set_crc_error(const struct emul *target, bool enable)
+{
+	struct sensirion_word_emul_data *data = target->data;
+
+	data->crc_error = enable;
+}
+
+void sensirion_word_emul_set_nack(const struct emul *target, bool enable)
+{
+	struct sensirion_word_emul_data *data = target->data;
+
+	data->nack = enable;
+}
+
+size_t sensirion_word_emul_get_last_write(const struct emul *target, uint8_t *buf)
+{
+	struct sensirion_word_emul_data *data = target->data;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+	size_t len = data->last_write_len;
+
+	memcpy(buf, data->last_write, len);
+	k_spin_unlock(&data->lock, key);
+
+	return len;
+}
+
+int sensirion_word_emul_get_last_num_msgs(const struct emul *target)
+{
+	struct sensirion_word_emul_data *data = target->data;
+
+	return data->last_num_msgs;
+}
+
+void sensirion_word_emul_reset(const struct emul *target)
+{
+	struct sensirion_word_emul_data *data = target->data;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	memset(data->words, 0, sizeof(data->words));
+	data->num_words = 1;
+	data->last_write_len = 0;
+	data->last_num_msgs = 0;
+	data->crc_error = false;
+	data->nack = false;
+	k_spin_unlock(&data->lock, key);
+}
+
+static int sensirion_word_emul_read(struct sensirion_word_emul_data *data, struct i2c_msg *msg)
+{
+	if (msg->len % WORD_FRAME_SIZE != 0) {
+		LOG_ERR("Read of %u bytes is not a whole number of words", msg->len);
+		return -EIO;
+	}
+
+	for (size_t i = 0; i < msg->len; i += WORD_FRAME_SIZE) {
+		uint16_t word = data->words[(i / WORD_FRAME_SIZE) % data->num_words];
+
+		sys_put_be16(word, &msg->buf[i]);
+		msg->buf[i + 2] = crc8(&msg->buf[i], 2, 0x31, 0xFF, false);
+	}
+
+	if (data->crc_error && msg->len > 0) {
+		msg->buf[msg->len - 1] ^= 0xFF;
+	}
+
+	return 0;
+}
+
+static int sensirion_word_emul_transfer_i2c(const struct emul *target, struct i2c_msg *msgs,
+					    int num_msgs, int addr)
+{
+	struct sensirion_word_emul_data *data = target->data;
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	ARG_UNUSED(addr);
+
+	if (data->nack) {
+		return -EIO;
+	}
+
+	key = k_spin_lock(&data->lock);
+	data->last_num_msgs = num_msgs;
+
+	for (int i = 0; i < num_msgs && ret == 0; i++) {
+		if (msgs[i].flags & I2C_MSG_READ) {
+			ret = sensirion_word_emul_read(data, &msgs[i]);
+		} else {
+			data->last_write_len = MIN(msgs[i].len, sizeof(data->last_write));
+			memcpy(data->last_write, msgs[i].buf, data->last_write_len);
+		}
+	}
+	k_spin_unlock(&data->lock, key);
+
+	return ret;
+}
+
+static int sensirion_word_emul_init(const struct emul *target, const struct device *parent)
+{
+	ARG_UNUSED(parent);
+
+	sensirion_word_emul_reset(target);
+
+	return 0;
+}
+
+static const struct i2c_emul_api sensirion_word_emul_api_i2c = {
+	.transfer = sensirion_word_emul_transfer_i2c,
+};
+
+#define SENSIRION_WORD_EMUL(n)                                                                     \
+	static struct sensirion_word_emul_data sensirion_word_emul_data_##n;                       \
+	EMUL_DT_INST_DEFINE(n, sensirion_word_emul_init, &sensirion_word_emul_data_##n, NULL,      \
+			    &sensirion_word_emul_api_i2c, NULL)
+
+DT_INST_FOREACH_STATUS_OKAY(SENSIRION_WORD_EMUL)
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SENSIRION_WORD_EMUL_H
+#define SENSIRION_WORD_EMUL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <zephyr/drivers/emul.h>
+
+#define SENSIRION_WORD_EMUL_MAX_WORDS 8
+#define SENSIRION_WORD_EMUL_MAX_WRITE 16
+
+/**
+ * @brief Set the data words returned by reads
+ *
+ * Reads longer than @p num_words repeat the words from the start.
+ *
+ * @param target The target emulator to modify
+ * @param words Data words in host byte order
+ * @param num_words Number of words, at most SENSIRION_WORD_EMUL_MAX_WORDS
+ */
+void sensirion_word_emul_set_words(const struct emul *target, const uint16_t *words,
+				   size_t num_words);
+
+/**
+ * @brief Corrupt the CRC of the last word of every read
+ *
+ * @param target The target emulator to modify
+ * @param enable true to inject CRC errors
+ */
+void sensirion_word_emul_set_crc_error(const struct emul *target, bool enable);
+
+/**
+ * @brief NACK every transfer
+ *
+ * @param target The target emulator to modify
+ * @param enable true to fail all transfers with -EIO
+ */
+void sensirion_word_emul_set_nack(const struct emul *target, bool enable);
+
+/**
+ * @brief Get the bytes of the last write
+ *
+ * @param target The target emulator to read
+ * @param buf Buffer of at least SENSIRION_WORD_EMUL_MAX_WRITE bytes
+ *
+ * @return Number of bytes written by the last write
+ */
+size_t sensirion_word_emul_get_last_write(const struct emul *target, uint8_t *buf);
+
+/**
+ * @brief Get the number of messages in the last transfer
+ *
+ * @param target The target emulator to read
+ */
+int sensirion_word_emul_get_last_num_msgs(const struct emul *target);
+
+/**
+ * @brief Reset the emulator
+ *
+ * @param target The target emulator to reset
+ */
+void sensirion_word_emul_reset(const struct emul *target);
+
+#endif /* SENSIRION_WORD_EMUL_H */
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/drivers/sensor/scd4x.h>
+#include <zephyr/drivers/sensor_clock.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/ztest.h>
+
+#include "sensirion_emul.h"
+
+#define TEST_TEMPERATURE_RAW 0x6666
+#define TEST_TEMPERATURE_MC  25000
+#define TEST_HUMIDITY_RAW    0x8000
+#define TEST_CO2_PPM         800
+#define TEST_TOLERANCE_MILLI 10
+#define TEST_SAMPLES         4
+
+/* Measurement intervals of the sensors in the overlay */
+#define TEST_SHT3XD_INTERVAL_MS       100
+#define TEST_SCD4X_INTERVAL_MS        5000
+#define TEST_SCD4X_LOW_POWER_INTERVAL 30000
+#define TEST_SCD4X_SELF_TEST_MS       10000
+
+#define TEST_DATA_READY(opt) {SENSOR_TRIG_DATA_READY, SENSOR_STREAM_DATA_##opt}
+
+SENSOR_DT_STREAM_IODEV(sht3xd_stream, DT_NODELABEL(sht3xd), TEST_DATA_READY(INCLUDE));
+SENSOR_DT_STREAM_IODEV(sht3xd_drop_stream, DT_NODELABEL(sht3xd), TEST_DATA_READY(DROP));
+SENSOR_DT_STREAM_IODEV(sht3xd_threshold_stream, DT_NODELABEL(sht3xd),
+		       {SENSOR_TRIG_THRESHOLD, SENSOR_STREAM_DATA_INCLUDE});
+SENSOR_DT_STREAM_IODEV(scd41_stream, DT_NODELABEL(scd41), TEST_DATA_READY(INCLUDE));
+SENSOR_DT_STREAM_IODEV(scd41_lp_stream, DT_NODELABEL(scd41_lp), TEST_DATA_READY(INCLUDE));
+SENSOR_DT_READ_IODEV(sht3xd_read, DT_NODELABEL(sht3xd), {SENSOR_CHAN_AMBIENT_TEMP, 0});
+
+RTIO_DEFINE_WITH_MEMPOOL(test_rtio, 4, 4, 8, 64, 4);
+
+static const struct device *const sht3xd = DEVICE_DT_GET(DT_NODELABEL(sht3xd));
+static const struct emul *const sht3xd_emul = EMUL_DT_GET(DT_NODELABEL(sht3xd));
+
+static K_SEM_DEFINE(job_done, 0, 1);
+static int job_result;
+
+static struct rtio_sqe *test_start(const struct rtio_iodev *iodev)
+{
+	struct rtio_sqe *handle;
+
+	zassert_ok(sensor_stream(iodev, &test_rtio, NULL, &handle));
+
+	return handle;
+}
+
+/* Wait for the next result of a stream, returns its result or -ENODATA if it carries no data */
+static int test_next(const struct device *dev, enum sensor_channel chan, int64_t *milli,
+		     uint64_t *timestamp_ns)
+{
+	struct rtio_cqe *cqe = rtio_cqe_consume_block(&test_rtio);
+	const struct sensor_decoder_api *decoder;
+	struct sensor_q31_data q31;
+	uint32_t fit = 0;
+	uint32_t buf_len;
+	uint8_t *buf;
+	int result = cqe->result;
+	int rc;
+
+	/* A failed shot releases its buffer itself */
+	if (result == 0) {
+		zassert_ok(rtio_cqe_get_mempool_buffer(&test_rtio, cqe, &buf, &buf_len));
+	}
+	rtio_cqe_release(&test_rtio, cqe);
+
+	if (result != 0) {
+		return result;
+	}
+
+	zassert_ok(sensor_get_decoder(dev, &decoder));
+	zassert_true(decoder->has_trigger(buf, SENSOR_TRIG_DATA_READY), "%s: no trigger",
+		     dev->name);
+
+	rc = decoder->decode(buf, (struct sensor_chan_spec){chan, 0}, &fit, 1, &q31);
+	if (rc == 1) {
+		*milli = ((int64_t)q31.readings[0].value * 1000 * (1LL << q31.shift)) >> 31;
+		*timestamp_ns = q31.header.base_timestamp_ns;
+	}
+
+	rtio_release_buffer(&test_rtio, buf, buf_len);
+
+	return rc == 1 ? 0 : rc;
+}
+
+static void test_stop(const struct device *dev, struct rtio_sqe *handle)
+{
+	int64_t milli;
+	uint64_t timestamp_ns;
+
+	rtio_sqe_cancel(handle);
+
+	/* The stream ends when its timer expires next */
+	zassert_equal(test_next(dev, SENSOR_CHAN_ALL, &milli, &timestamp_ns), -ECANCELED);
+}
+
+static void test_stream(const struct rtio_iodev *iodev, const struct device *dev,
+			const struct emul *emul, enum sensor_channel chan, int64_t expected_milli,
+			uint32_t interval_ms)
+{
+	uint64_t timestamp_ns[TEST_SAMPLES];
+	struct rtio_sqe *handle;
+	uint32_t commands;
+	int64_t milli = 0;
+
+	handle = test_start(iodev);
+
+	/* The first result may have been waiting since before the stream was started */
+	zassert_ok(test_next(dev, chan, &milli, &timestamp_ns[0]));
+	commands = sensirion_emul_get_num_commands(emul);
+
+	for (int i = 1; i < TEST_SAMPLES; i++) {
+		zassert_ok(test_next(dev, chan, &milli, &timestamp_ns[i]), "%s: sample %d failed",
+			   dev->name, i);
+		zassert_within(milli, expected_milli, TEST_TOLERANCE_MILLI,
+			       "%s: unexpected value %lld", dev->name, milli);
+		zassert_within(timestamp_ns[i] - timestamp_ns[i - 1],
+			       (uint64_t)interval_ms * NSEC_PER_MSEC,
+			       (uint64_t)interval_ms * NSEC_PER_MSEC / 100,
+			       "%s: results not one interval apart", dev->name);
+	}
+
+	/* Exactly one read per result: no data-ready polls and no reads that came too early */
+	zassert_equal(sensirion_emul_get_num_commands(emul) - commands, TEST_SAMPLES - 1,
+		      "%s: unexpected bus traffic", dev->name);
+
+	test_stop(dev, handle);
+}
+
+ZTEST(sensirion_stream, test_sht3xd)
+{
+	test_stream(&sht3xd_stream, sht3xd, sht3xd_emul, SENSOR_CHAN_AMBIENT_TEMP,
+		    TEST_TEMPERATURE_MC, TEST_SHT3XD_INTERVAL_MS);
+}
+
+ZTEST(sensirion_stream, test_scd4x)
+{
+	test_stream(&scd41_stream, DEVICE_DT_GET(DT_NODELABEL(scd41)),
+		    EMUL_DT_GET(DT_NODELABEL(scd41)), SENSOR_CHAN_CO2, TEST_CO2_PPM * 1000LL,
+		    TEST_SCD4X_INTERVAL_MS);
+}
+
+ZTEST(sensirion_stream, test_scd4x_low_power)
+{
+	test_stream(&scd41_lp_stream, DEVICE_DT_GET(DT_NODELABEL(scd41_lp)),
+		    EMUL_DT_GET(DT_NODELABEL(scd41_lp)), SENSOR_CHAN_CO2, TEST_CO2_PPM * 1000LL,
+		    TEST_SCD4X_LOW_POWER_INTERVAL);
+}
+
+static void test_job_cb(const struct device *dev, int result, void *user_data)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+
+	job_result = result;
+	k_sem_give(&job_done);
+}
+
+ZTEST(sensirion_stream, test_scd4x_job)
+{
+	const struct device *scd41 = DEVICE_DT_GET(DT_NODELABEL(scd41));
+	struct rtio_sqe *handle = test_start(&scd41_stream);
+	uint64_t timestamp_ns;
+	uint64_t cycles;
+	int64_t milli;
+
+	zassert_ok(test_next(scd41, SENSOR_CHAN_CO2, &milli, &timestamp_ns));
+
+	/* The periodic measurement is stopped for longer than the retries of a result last */
+	zassert_ok(scd4x_self_test_async(scd41, test_job_cb, NULL));
+	zassert_equal(scd4x_persist_settings(scd41), -EBUSY);
+	zassert_ok(k_sem_take(&job_done, K_MSEC(2 * TEST_SCD4X_SELF_TEST_MS)));
+	zassert_ok(job_result);
+	zassert_ok(sensor_clock_get_cycles(&cycles));
+
+	/* The stream waited for the first result of the restarted measurement */
+	zassert_ok(test_next(scd41, SENSOR_CHAN_CO2, &milli, &timestamp_ns));
+	zassert_within(milli, TEST_CO2_PPM * 1000LL, TEST_TOLERANCE_MILLI);
+	zassert_within(timestamp_ns - sensor_clock_cycles_to_ns(cycles),
+		       (uint64_t)TEST_SCD4X_INTERVAL_MS * NSEC_PER_MSEC,
+		       (uint64_t)TEST_SCD4X_INTERVAL_MS * NSEC_PER_MSEC / 100,
+		       "result not one interval after the restart");
+
+	test_stop(scd41, handle);
+}
+
+ZTEST(sensirion_stream, test_drop)
+{
+	uint32_t commands = sensirion_emul_get_num_commands(sht3xd_emul);
+	struct rtio_sqe *handle = test_start(&sht3xd_drop_stream);
+	uint64_t timestamp_ns;
+	int64_t milli;
+
+	/* The result is still read once, so the next one can be detected */
+	zassert_equal(test_next(sht3xd, SENSOR_CHAN_AMBIENT_TEMP, &milli, &timestamp_ns),
+		      -ENODATA);
+	zassert_equal(sensirion_emul_get_num_commands(sht3xd_emul) - commands, 1);
+
+	test_stop(sht3xd, handle);
+}
+
+ZTEST(sensirion_stream, test_busy)
+{
+	struct rtio_sqe *handle = test_start(&sht3xd_stream);
+	uint64_t timestamp_ns;
+	int64_t milli;
+
+	zassert_ok(test_next(sht3xd, SENSOR_CHAN_AMBIENT_TEMP, &milli, &timestamp_ns));
+
+	/* Rejected requests complete right away, before the next result of the stream */
+	zassert_ok(sensor_read_async_mempool(&sht3xd_read, &test_rtio, NULL));
+	zassert_equal(test_next(sht3xd, SENSOR_CHAN_AMBIENT_TEMP, &milli, &timestamp_ns), -EBUSY);
+
+	test_start(&sht3xd_stream);
+	zassert_equal(test_next(sht3xd, SENSOR_CHAN_AMBIENT_TEMP, &milli, &timestamp_ns), -EBUSY);
+
+	test_stop(sht3xd, handle);
+}
+
+ZTEST(sensirion_stream, test_unsupported_trigger)
+{
+	uint64_t timestamp_ns;
+	int64_t milli;
+
+	test_start(&sht3xd_threshold_stream);
+	zassert_equal(test_next(sht3xd, SENSOR_CHAN_AMBIENT_TEMP, &milli, &timestamp_ns),
+		      -ENOTSUP);
+}
+
+ZTEST(sensirion_stream, test_nack)
+{
+	struct rtio_sqe *handle;
+	uint64_t timestamp_ns;
+	int64_t milli;
+
+	/* A sensor that stops responding ends the stream after one interval of retries */
+	sensirion_emul_set_nack(sht3xd_emul, true);
+	test_start(&sht3xd_stream);
+	zassert_equal(test_next(sht3xd, SENSOR_CHAN_AMBIENT_TEMP, &milli, &timestamp_ns), -EIO);
+
+	/* The stream can be restarted once the sensor responds again */
+	sensirion_emul_set_nack(sht3xd_emul, false);
+	handle = test_start(&sht3xd_stream);
+	zassert_ok(test_next(sht3xd, SENSOR_CHAN_AMBIENT_TEMP, &milli, &timestamp_ns));
+	zassert_within(milli, TEST_TEMPERATURE_MC, TEST_TOLERANCE_MILLI);
+
+	test_stop(sht3xd, handle);
+}
+
+static void *sensirion_stream_setup(void)
+{
+	const struct emul *const emuls[] = {
+		sht3xd_emul,
+		EMUL_DT_GET(DT_NODELABEL(scd41)),
+		EMUL_DT_GET(DT_NODELABEL(scd41_lp)),
+	};
+
+	ARRAY_FOR_EACH(emuls, i) {
+		sensirion_emul_set_signal(emuls[i], SENSIRION_EMUL_TEMPERATURE,
+					  TEST_TEMPERATURE_RAW);
+		sensirion_emul_set_signal(emuls[i], SENSIRION_EMUL_HUMIDITY, TEST_HUMIDITY_RAW);
+		sensirion_emul_set_signal(emuls[i], SENSIRION_EMUL_CO2, TEST_CO2_PPM);
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(sensirion_stream, NULL, sensirion_stream_setup, NULL, NULL, NULL);
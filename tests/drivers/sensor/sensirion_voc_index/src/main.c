@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/drivers/sensor/sensirion_batch.h>
+#include <zephyr/drivers/sensor/sgp40.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/ztest.h>
+
+#include "sensirion_emul.h"
+#include "sensirion_voc_index.h"
+#include "voc_index_float.h"
+
+#define TEST_INTERVAL_MS     1000
+#define TEST_BLACKOUT        45
+#define TEST_SRAW_BASELINE   30000
+/* Six hours at one sample per second */
+#define TEST_NUM_SAMPLES     (6 * 3600)
+#define TEST_MAX_DEVIATION   3
+#define TEST_BATCH_SIZE      600
+#define TEST_BUF_SIZE        64
+#define BENCH_SAMPLES        3600
+
+static const struct device *const sgp40 = DEVICE_DT_GET(DT_NODELABEL(sgp40));
+static const struct emul *const sgp40_emul = EMUL_DT_GET(DT_NODELABEL(sgp40));
+
+SENSOR_DT_READ_IODEV(sgp40_iodev, DT_NODELABEL(sgp40), {SENSOR_CHAN_GAS_RES, 0},
+		     {SENSOR_CHAN_VOC, 0});
+RTIO_DEFINE(test_rtio, 1, 1);
+SENSIRION_BATCH_DEFINE(test_batch, DEVICE_DT_GET(DT_NODELABEL(sgp40)));
+
+static uint16_t samples[TEST_NUM_SAMPLES];
+static uint32_t test_seed;
+
+static uint32_t test_rand(void)
+{
+	/* Deterministic across platforms and C libraries */
+	test_seed = test_seed * 1103515245U + 12345U;
+
+	return test_seed >> 16;
+}
+
+/*
+ * Noisy baseline with a VOC event every two hours, ramping the raw signal
+ * down (more VOCs) and back up, and a period of cleaner than usual air.
+ */
+static void test_fill_samples(void)
+{
+	test_seed = 1;
+
+	for (int i = 0; i < TEST_NUM_SAMPLES; i++) {
+		int t = i % 7200;
+		int sraw = TEST_SRAW_BASELINE + (int)(test_rand() % 41) - 20;
+
+		if (t > 3000 && t < 3600) {
+			sraw -= (t - 3000) * 5;
+		} else if (t >= 3600 && t < 4200) {
+			sraw -= (4200 - t) * 5;
+		}
+		if (i > 20000) {
+			sraw += 1500;
+		}
+
+		samples[i] = (uint16_t)sraw;
+	}
+}
+
+ZTEST(sensirion_voc_index, test_blackout)
+{
+	struct sensirion_voc_index voc;
+	int32_t index;
+
+	sensirion_voc_index_init(&voc, TEST_INTERVAL_MS);
+
+	for (int i = 0; i <= TEST_BLACKOUT; i++) {
+		zassert_equal(sensirion_voc_index_process(&voc, TEST_SRAW_BASELINE), 0,
+			      "index reported during the blackout at %d s", i);
+	}
+
+	/* The index settles at 100 once the mean has been learned */
+	for (int i = 0; i < 600; i++) {
+		index = sensirion_voc_index_process(&voc, TEST_SRAW_BASELINE + i % 3);
+		zassert_true(index >= 1 && index <= 500, "index %d out of range", index);
+	}
+	zassert_equal(index, 100);
+}
+
+ZTEST(sensirion_voc_index, test_range)
+{
+	struct sensirion_voc_index voc;
+	int32_t index;
+
+	sensirion_voc_index_init(&voc, TEST_INTERVAL_MS);
+	/* Up to the first VOC event */
+	zassert_equal(sensirion_voc_index_process_batch(&voc, samples, 3000, NULL), 100);
+
+	/* A strong VOC event saturates towards 500, invalid samples are ignored */
+	for (int i = 0; i < 300; i++) {
+		index = sensirion_voc_index_process(&voc, i % 2 ? 0 : TEST_SRAW_BASELINE - 10000);
+		zassert_true(index >= 1 && index <= 500, "index %d out of range", index);
+	}
+	zassert_true(index > 400, "index %d did not follow the VOC event", index);
+
+	/* Cleaner air than the average drives the index below 100 */
+	for (int i = 0; i < 600; i++) {
+		index = sensirion_voc_index_process(&voc, TEST_SRAW_BASELINE + 2000);
+		zassert_true(index >= 1 && index <= 500, "index %d out of range", index);
+	}
+	zassert_true(index < 100, "index %d did not follow the clean air", index);
+}
+
+ZTEST(sensirion_voc_index, test_float_reference)
+{
+	struct sensirion_voc_index voc;
+	struct voc_index_float ref;
+	uint32_t sum_deviation = 0;
+	int max_deviation = 0;
+
+	sensirion_voc_index_init(&voc, TEST_INTERVAL_MS);
+	voc_index_float_init(&ref, TEST_INTERVAL_MS / 1000.f);
+
+	for (int i = 0; i < TEST_NUM_SAMPLES; i++) {
+		int32_t index = sensirion_voc_index_process(&voc, samples[i]);
+		int32_t expected = voc_index_float_process(&ref, samples[i]);
+		int deviation = abs(index - expected);
+
+		zassert_true(deviation <= TEST_MAX_DEVIATION, "sample %d: index %d, reference %d",
+			     i, index, expected);
+		max_deviation = MAX(max_deviation, deviation);
+		sum_deviation += deviation;
+	}
+
+	TC_PRINT("%d samples: max deviation %d, mean deviation %u/1000\n", TEST_NUM_SAMPLES,
+		 max_deviation, sum_deviation * 1000 / TEST_NUM_SAMPLES);
+
+	/* Off by one only around the rounding boundaries */
+	zassert_true(sum_deviation * 4 < TEST_NUM_SAMPLES, "mean deviation too large");
+}
+
+ZTEST(sensirion_voc_index, test_batch)
+{
+	static int32_t indices[TEST_BATCH_SIZE];
+	struct sensirion_voc_index incremental;
+	struct sensirion_voc_index batch;
+
+	sensirion_voc_index_init(&incremental, TEST_INTERVAL_MS);
+	sensirion_voc_index_init(&batch, TEST_INTERVAL_MS);
+
+	for (int i = 0; i < TEST_NUM_SAMPLES; i += TEST_BATCH_SIZE) {
+		int32_t last = sensirion_voc_index_process_batch(&batch, &samples[i],
+								  TEST_BATCH_SIZE, indices);
+
+		for (int j = 0; j < TEST_BATCH_SIZE; j++) {
+			zassert_equal(indices[j],
+				      sensirion_voc_index_process(&incremental, samples[i + j]),
+				      "sample %d", i + j);
+		}
+		zassert_equal(last, indices[TEST_BATCH_SIZE - 1]);
+	}
+
+	zassert_mem_equal(&batch, &incremental, sizeof(batch));
+}
+
+ZTEST(sensirion_voc_index, test_driver)
+{
+	const struct sensor_decoder_api *decoder;
+	struct sensirion_voc_index voc;
+	uint8_t buf[TEST_BUF_SIZE];
+	uint8_t *const bufs[] = {buf};
+	struct sensor_q31_data q31;
+	struct sensor_value val;
+	uint32_t fit = 0;
+	int32_t expected;
+
+	/* The driver instance started with the same state */
+	sensirion_voc_index_init(&voc, CONFIG_SGP40_VOC_INDEX_SAMPLING_INTERVAL_MS);
+	(void)sensirion_voc_index_process_batch(&voc, samples, TEST_BLACKOUT + 1, NULL);
+	(void)sgp40_voc_index_feed(sgp40, samples, TEST_BLACKOUT + 1, NULL);
+
+	/* Fetched samples update the index */
+	sensirion_emul_set_signal(sgp40_emul, SENSIRION_EMUL_VOC, samples[TEST_BLACKOUT + 1]);
+	expected = sensirion_voc_index_process(&voc, samples[TEST_BLACKOUT + 1]);
+	zassert_ok(sensor_sample_fetch_chan(sgp40, SENSOR_CHAN_VOC));
+	zassert_ok(sensor_channel_get(sgp40, SENSOR_CHAN_VOC, &val));
+	zassert_equal(val.val1, expected);
+	zassert_equal(val.val2, 0);
+
+	/* So do samples that are read */
+	sensirion_emul_set_signal(sgp40_emul, SENSIRION_EMUL_VOC, samples[TEST_BLACKOUT + 2]);
+	expected = sensirion_voc_index_process(&voc, samples[TEST_BLACKOUT + 2]);
+	zassert_ok(sensor_read(&sgp40_iodev, &test_rtio, buf, sizeof(buf)));
+	zassert_ok(sensor_get_decoder(sgp40, &decoder));
+	zassert_equal(decoder->decode(buf, (struct sensor_chan_spec){SENSOR_CHAN_VOC, 0}, &fit, 1,
+				      &q31),
+		      1);
+	zassert_equal(((int64_t)q31.readings[0].value * (1LL << q31.shift)) >> 31, expected);
+
+	/* Recorded samples are fed in one go */
+	expected = sensirion_voc_index_process_batch(&voc, &samples[TEST_BLACKOUT + 3],
+						     TEST_BATCH_SIZE, NULL);
+	zassert_equal(sgp40_voc_index_feed(sgp40, &samples[TEST_BLACKOUT + 3], TEST_BATCH_SIZE,
+					   NULL),
+		      expected);
+	zassert_ok(sensor_channel_get(sgp40, SENSOR_CHAN_VOC, &val));
+	zassert_equal(val.val1, expected);
+
+	/* Batched samples would be missing from the index the driver keeps */
+	zassert_equal(sensirion_batch_read(&test_batch, bufs, sizeof(buf), NULL), -EBUSY);
+}
+
+ZTEST(sensirion_voc_index, test_benchmark)
+{
+	struct sensirion_voc_index voc;
+	struct voc_index_float ref;
+	timing_t start, end;
+	uint64_t fixed_ns;
+	uint64_t float_ns;
+
+	timing_init();
+	timing_start();
+
+	/* Past the initial learning phase, where the algorithm does the most work */
+	sensirion_voc_index_init(&voc, TEST_INTERVAL_MS);
+	start = timing_counter_get();
+	(void)sensirion_voc_index_process_batch(&voc, samples, BENCH_SAMPLES, NULL);
+	end = timing_counter_get();
+	fixed_ns = timing_cycles_to_ns(timing_cycles_get(&start, &end));
+
+	voc_index_float_init(&ref, TEST_INTERVAL_MS / 1000.f);
+	start = timing_counter_get();
+	for (int i = 0; i < BENCH_SAMPLES; i++) {
+		(void)voc_index_float_process(&ref, samples[i]);
+	}
+	end = timing_counter_get();
+	float_ns = timing_cycles_to_ns(timing_cycles_get(&start, &end));
+
+	timing_stop();
+
+	TC_PRINT("ns per sample: fixed point %u, floating point %u, state %zu bytes\n",
+		 (uint32_t)(fixed_ns / BENCH_SAMPLES), (uint32_t)(float_ns / BENCH_SAMPLES),
+		 sizeof(voc));
+
+	zassert_true(fixed_ns > 0, "No time elapsed");
+}
+
+static void *sensirion_voc_index_setup(void)
+{
+	test_fill_samples();
+
+	return NULL;
+}
+
+ZTEST_SUITE(sensirion_voc_index, NULL, sensirion_voc_index_setup, NULL, NULL, NULL);
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <math.h>
+
+#include "voc_index_float.h"
+
+#define INITIAL_BLACKOUT                 45.f
+#define INDEX_GAIN                       230.f
+#define SRAW_STD_INITIAL                 50.f
+#define SRAW_STD_BONUS                   220.f
+#define TAU_MEAN_HOURS                   12.f
+#define TAU_VARIANCE_HOURS               12.f
+#define TAU_INITIAL_MEAN                 20.f
+#define TAU_INITIAL_VARIANCE             2500.f
+#define INIT_DURATION_MEAN               (3600.f * 0.75f)
+#define INIT_DURATION_VARIANCE           (3600.f * 1.45f)
+#define INIT_TRANSITION                  0.01f
+#define GATING_THRESHOLD                 340.f
+#define GATING_THRESHOLD_INITIAL         510.f
+#define GATING_THRESHOLD_TRANSITION      0.09f
+#define GATING_MAX_DURATION_MINUTES      (60.f * 3.f)
+#define GATING_MAX_RATIO                 0.3f
+#define SIGMOID_L                        500.f
+#define SIGMOID_K                        -0.0065f
+#define SIGMOID_X0                       213.f
+#define LP_TAU_FAST                      20.f
+#define LP_TAU_SLOW                      500.f
+#define LP_ALPHA                         -0.2f
+#define SRAW_MINIMUM                     20000
+#define GAMMA_SCALING                    64.f
+#define ADDITIONAL_GAMMA_MEAN_SCALING    8.f
+#define FIX16_MAX                        32767.f
+
+static float sigmoid(float sample, float x0, float k)
+{
+	float x = k * (sample - x0);
+
+	if (x < -50.f) {
+		return 1.f;
+	} else if (x > 50.f) {
+		return 0.f;
+	}
+
+	return 1.f / (1.f + expf(x));
+}
+
+static void calculate_gamma(struct voc_index_float *voc)
+{
+	float uptime_limit = FIX16_MAX - voc->sampling_interval;
+	float sigmoid_gamma_mean;
+	float sigmoid_gamma_variance;
+	float sigmoid_gating_mean;
+	float sigmoid_gating_variance;
+	float gamma_mean;
+	float gamma_variance;
+	float threshold;
+
+	if (voc->uptime_gamma < uptime_limit) {
+		voc->uptime_gamma += voc->sampling_interval;
+	}
+	if (voc->uptime_gating < uptime_limit) {
+		voc->uptime_gating += voc->sampling_interval;
+	}
+
+	sigmoid_gamma_mean = sigmoid(voc->uptime_gamma, INIT_DURATION_MEAN, INIT_TRANSITION);
+	gamma_mean = voc->gamma_mean +
+		     (voc->gamma_initial_mean - voc->gamma_mean) * sigmoid_gamma_mean;
+	threshold = GATING_THRESHOLD + (GATING_THRESHOLD_INITIAL - GATING_THRESHOLD) *
+					       sigmoid(voc->uptime_gating, INIT_DURATION_MEAN,
+						       INIT_TRANSITION);
+	sigmoid_gating_mean = sigmoid(voc->gas_index, threshold, GATING_THRESHOLD_TRANSITION);
+	voc->cur_gamma_mean = sigmoid_gating_mean * gamma_mean;
+
+	sigmoid_gamma_variance =
+		sigmoid(voc->uptime_gamma, INIT_DURATION_VARIANCE, INIT_TRANSITION);
+	gamma_variance = voc->gamma_variance + (voc->gamma_initial_variance - voc->gamma_variance) *
+						       (sigmoid_gamma_variance - sigmoid_gamma_mean);
+	threshold = GATING_THRESHOLD + (GATING_THRESHOLD_INITIAL - GATING_THRESHOLD) *
+					       sigmoid(voc->uptime_gating, INIT_DURATION_VARIANCE,
+						       INIT_TRANSITION);
+	sigmoid_gating_variance = sigmoid(voc->gas_index, threshold, GATING_THRESHOLD_TRANSITION);
+	voc->cur_gamma_variance = sigmoid_gating_variance * gamma_variance;
+
+	voc->gating_duration_minutes +=
+		(voc->sampling_interval / 60.f) *
+		((1.f - sigmoid_gating_mean) * (1.f + GATING_MAX_RATIO) - GATING_MAX_RATIO);
+	if (voc->gating_duration_minutes < 0.f) {
+		voc->gating_duration_minutes = 0.f;
+	}
+	if (voc->gating_duration_minutes > GATING_MAX_DURATION_MINUTES) {
+		voc->uptime_gating = 0.f;
+	}
+}
+
+static void estimate(struct voc_index_float *voc, float sraw)
+{
+	float additional_scaling = 1.f;
+	float delta;
+	float c;
+
+	if (!voc->estimator_initialized) {
+		voc->estimator_initialized = true;
+		voc->sraw_offset = sraw;
+		voc->mean = 0.f;
+		return;
+	}
+
+	if (voc->mean >= 100.f || voc->mean <= -100.f) {
+		voc->sraw_offset += voc->mean;
+		voc->mean = 0.f;
+	}
+	sraw -= voc->sraw_offset;
+
+	calculate_gamma(voc);
+
+	delta = (sraw - voc->mean) / GAMMA_SCALING;
+	c = voc->std + fabsf(delta);
+	if (c > 1440.f) {
+		additional_scaling = (c / 1440.f) * (c / 1440.f);
+	}
+
+	voc->std = sqrtf(additional_scaling * (GAMMA_SCALING - voc->cur_gamma_variance)) *
+		   sqrtf(voc->std * (voc->std / (GAMMA_SCALING * additional_scaling)) +
+			 ((voc->cur_gamma_variance * delta) / additional_scaling) * delta);
+	voc->mean += (voc->cur_gamma_mean * delta) / ADDITIONAL_GAMMA_MEAN_SCALING;
+}
+
+static float sigmoid_scaled(float sample)
+{
+	float x = SIGMOID_K * (sample - SIGMOID_X0);
+
+	if (x < -50.f) {
+		return SIGMOID_L;
+	} else if (x > 50.f) {
+		return 0.f;
+	}
+
+	/* The shift of the upper half is 0 with the default index offset */
+	return SIGMOID_L / (1.f + expf(x));
+}
+
+static float adaptive_lowpass(struct voc_index_float *voc, float sample)
+{
+	float abs_delta;
+	float tau;
+	float a3;
+
+	if (!voc->lp_initialized) {
+		voc->lp_x1 = sample;
+		voc->lp_x2 = sample;
+		voc->lp_x3 = sample;
+		voc->lp_initialized = true;
+	}
+
+	voc->lp_x1 = (1.f - voc->lp_a1) * voc->lp_x1 + voc->lp_a1 * sample;
+	voc->lp_x2 = (1.f - voc->lp_a2) * voc->lp_x2 + voc->lp_a2 * sample;
+	abs_delta = fabsf(voc->lp_x1 - voc->lp_x2);
+	tau = (LP_TAU_SLOW - LP_TAU_FAST) * expf(LP_ALPHA * abs_delta) + LP_TAU_FAST;
+	a3 = voc->sampling_interval / (voc->sampling_interval + tau);
+	voc->lp_x3 = (1.f - a3) * voc->lp_x3 + a3 * sample;
+
+	return voc->lp_x3;
+}
+
+void voc_index_float_init(struct voc_index_float *voc, float sampling_interval)
+{
+	float dt_hours = sampling_interval / 3600.f;
+
+	*voc = (struct voc_index_float){0};
+
+	voc->sampling_interval = sampling_interval;
+	voc->std = SRAW_STD_INITIAL;
+	voc->gamma_mean = ADDITIONAL_GAMMA_MEAN_SCALING * GAMMA_SCALING * dt_hours /
+			  (TAU_MEAN_HOURS + dt_hours);
+	voc->gamma_variance = GAMMA_SCALING * dt_hours / (TAU_VARIANCE_HOURS + dt_hours);
+	voc->gamma_initial_mean = ADDITIONAL_GAMMA_MEAN_SCALING * GAMMA_SCALING *
+				  sampling_interval / (TAU_INITIAL_MEAN + sampling_interval);
+	voc->gamma_initial_variance =
+		GAMMA_SCALING * sampling_interval / (TAU_INITIAL_VARIANCE + sampling_interval);
+	voc->mox_std = voc->std;
+	voc->mox_mean = 0.f;
+	voc->lp_a1 = sampling_interval / (LP_TAU_FAST + sampling_interval);
+	voc->lp_a2 = sampling_interval / (LP_TAU_SLOW + sampling_interval);
+}
+
+int32_t voc_index_float_process(struct voc_index_float *voc, int32_t sraw)
+{
+	if (voc->uptime <= INITIAL_BLACKOUT) {
+		voc->uptime += voc->sampling_interval;
+	} else {
+		if (sraw > 0 && sraw < 65000) {
+			if (sraw < SRAW_MINIMUM + 1) {
+				sraw = SRAW_MINIMUM + 1;
+			} else if (sraw > SRAW_MINIMUM + 32767) {
+				sraw = SRAW_MINIMUM + 32767;
+			}
+			voc->sraw = (float)(sraw - SRAW_MINIMUM);
+		}
+
+		voc->gas_index = (voc->sraw - voc->mox_mean) /
+				 (-1.f * (voc->mox_std + SRAW_STD_BONUS)) * INDEX_GAIN;
+		voc->gas_index = sigmoid_scaled(voc->gas_index);
+		voc->gas_index = adaptive_lowpass(voc, voc->gas_index);
+		if (voc->gas_index < 0.5f) {
+			voc->gas_index = 0.5f;
+		}
+
+		if (voc->sraw > 0.f) {
+			estimate(voc, voc->sraw);
+			voc->mox_std = voc->std;
+			voc->mox_mean = voc->mean + voc->sraw_offset;
+		}
+	}
+
+	return (int32_t)(voc->gas_index + 0.5f);
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef VOC_INDEX_FLOAT_H
+#define VOC_INDEX_FLOAT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Floating point implementation of the Sensirion gas index algorithm for VOC,
+ * as shipped by applications before the fixed point engine existed. It serves
+ * as the reference for accuracy and speed.
+ */
+struct voc_index_float {
+	float sampling_interval;
+	float uptime;
+	float sraw;
+	float gas_index;
+	bool estimator_initialized;
+	float mean;
+	float sraw_offset;
+	float std;
+	float gamma_mean;
+	float gamma_variance;
+	float gamma_initial_mean;
+	float gamma_initial_variance;
+	float cur_gamma_mean;
+	float cur_gamma_variance;
+	float uptime_gamma;
+	float uptime_gating;
+	float gating_duration_minutes;
+	float mox_std;
+	float mox_mean;
+	float lp_a1;
+	float lp_a2;
+	bool lp_initialized;
+	float lp_x1;
+	float lp_x2;
+	float lp_x3;
+};
+
+void voc_index_float_init(struct voc_index_float *voc, float sampling_interval);
+
+int32_t voc_index_float_process(struct voc_index_float *voc, int32_t sraw);
+
+#endif /* VOC_INDEX_FLOAT_H */
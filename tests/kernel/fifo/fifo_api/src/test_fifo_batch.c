@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_fifo.h"
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define LIST_LEN 4
+
+static fdata_t data[LIST_LEN];
+static void *rx_data[LIST_LEN + 1];
+static K_FIFO_DEFINE(fifo_b);
+
+static K_THREAD_STACK_DEFINE(tstack_batch, STACK_SIZE);
+static struct k_thread tdata_batch;
+static int thread_ret;
+
+static void tfifo_put(struct k_fifo *pfifo, int num)
+{
+	for (int i = 0; i < num; i++) {
+		k_fifo_put(pfifo, (void *)&data[i]);
+	}
+}
+
+static void check_rx(int first, int num)
+{
+	for (int i = 0; i < num; i++) {
+		zassert_equal(rx_data[i], (void *)&data[first + i]);
+	}
+}
+
+static void tIsr_entry(const void *p)
+{
+	int *ret = (int *)p;
+
+	*ret = k_fifo_get_many(&fifo_b, rx_data, ARRAY_SIZE(rx_data), K_NO_WAIT);
+}
+
+static void tThread_entry(void *p1, void *p2, void *p3)
+{
+	thread_ret = k_fifo_get_many(&fifo_b, rx_data, ARRAY_SIZE(rx_data), K_FOREVER);
+}
+
+/**
+ * @addtogroup kernel_fifo_tests
+ * @{
+ */
+
+/**
+ * @brief Test getting several elements from a FIFO at once
+ * @see k_fifo_put(), k_fifo_get_many()
+ */
+ZTEST(fifo_api, test_fifo_get_many)
+{
+	int ret;
+
+	tfifo_put(&fifo_b, LIST_LEN);
+
+	/**TESTPOINT: fifo get many, up to the requested number*/
+	zassert_equal(k_fifo_get_many(&fifo_b, rx_data, 3, K_NO_WAIT), 3);
+	check_rx(0, 3);
+	zassert_equal(k_fifo_get_many(&fifo_b, rx_data, ARRAY_SIZE(rx_data), K_NO_WAIT), 1);
+	check_rx(3, 1);
+
+	zassert_equal(k_fifo_get_many(&fifo_b, rx_data, ARRAY_SIZE(rx_data), K_NO_WAIT), 0);
+	zassert_equal(k_fifo_get_many(&fifo_b, rx_data, ARRAY_SIZE(rx_data), K_MSEC(10)), 0);
+
+	/**TESTPOINT: fifo get many from an ISR*/
+	tfifo_put(&fifo_b, LIST_LEN);
+	irq_offload(tIsr_entry, &ret);
+	zassert_equal(ret, LIST_LEN);
+	check_rx(0, LIST_LEN);
+	zassert_true(k_fifo_is_empty(&fifo_b));
+}
+
+/**
+ * @brief Test a thread waiting on an empty FIFO gets the elements put meanwhile
+ * @see k_fifo_put_list(), k_fifo_get_many()
+ */
+ZTEST(fifo_api_1cpu, test_fifo_get_many_wait)
+{
+	k_tid_t tid = k_thread_create(&tdata_batch, tstack_batch, STACK_SIZE, tThread_entry,
+				      NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	k_msleep(50);
+
+	/* The first element is handed to the waiting thread, which then takes
+	 * the others put along with it.
+	 */
+	for (int i = 0; i < LIST_LEN - 1; i++) {
+		data[i].snode.next = &data[i + 1].snode;
+	}
+	data[LIST_LEN - 1].snode.next = NULL;
+	k_fifo_put_list(&fifo_b, &data[0], &data[LIST_LEN - 1]);
+
+	k_thread_join(tid, K_FOREVER);
+	zassert_equal(thread_ret, LIST_LEN);
+	check_rx(0, LIST_LEN);
+	zassert_true(k_fifo_is_empty(&fifo_b));
+}
+
+/**
+ * @}
+ */
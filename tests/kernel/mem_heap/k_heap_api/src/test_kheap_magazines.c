@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include "test_kheap.h"
+
+#define SMALL_SIZE 32
+#define LARGE_SIZE (HEAP_SIZE / 2)
+#define MAX_BLOCKS (HEAP_SIZE / SMALL_SIZE)
+
+K_HEAP_DEFINE(mag_heap, HEAP_SIZE);
+
+static K_THREAD_STACK_DEFINE(mag_stack, 512 + CONFIG_TEST_EXTRA_STACK_SIZE);
+static struct k_thread mag_thread;
+
+static void *blocks[MAX_BLOCKS];
+
+/* Allocate small blocks until the heap is exhausted */
+static int fill_heap(void)
+{
+	int num = 0;
+
+	while (num < MAX_BLOCKS) {
+		blocks[num] = k_heap_alloc(&mag_heap, SMALL_SIZE, K_NO_WAIT);
+		if (blocks[num] == NULL) {
+			break;
+		}
+		num++;
+	}
+
+	zassert_true(num > 0, "no block allocated");
+	zassert_true(num < MAX_BLOCKS, "heap not exhausted");
+
+	return num;
+}
+
+static void free_blocks(int num)
+{
+	for (int i = 0; i < num; i++) {
+		k_heap_free(&mag_heap, blocks[i]);
+	}
+}
+
+static void thread_alloc_large(void *p1, void *p2, void *p3)
+{
+	void **p = p1;
+
+	*p = k_heap_alloc(&mag_heap, LARGE_SIZE, K_MSEC(200));
+}
+
+/**
+ * @brief Test a freed small block is reused by the next allocation
+ *
+ * @ingroup k_heap_api_tests
+ *
+ * @see k_heap_alloc(), k_heap_free()
+ */
+ZTEST(k_heap_api, test_k_heap_magazine_reuse)
+{
+	void *p;
+	void *q;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_HEAP_MAGAZINES);
+
+	/* Stay on the same CPU, whose cache serves both allocations */
+	k_sched_lock();
+	p = k_heap_alloc(&mag_heap, SMALL_SIZE, K_NO_WAIT);
+	zassert_not_null(p, "k_heap_alloc operation failed");
+	k_heap_free(&mag_heap, p);
+	q = k_heap_alloc(&mag_heap, SMALL_SIZE, K_NO_WAIT);
+	k_sched_unlock();
+
+	zassert_equal_ptr(q, p, "freed block was not reused");
+	k_heap_free(&mag_heap, q);
+}
+
+/**
+ * @brief Test freed small blocks can be merged into a large allocation
+ *
+ * @ingroup k_heap_api_tests
+ *
+ * @details The heap is exhausted with small blocks, which are all freed.
+ * With CONFIG_HEAP_MAGAZINES, some stay cached until the large allocation
+ * fails, and returns them to the heap.
+ *
+ * @see k_heap_alloc(), k_heap_free()
+ */
+ZTEST(k_heap_api, test_k_heap_magazine_flush)
+{
+	void *p;
+
+	free_blocks(fill_heap());
+
+	p = k_heap_alloc(&mag_heap, LARGE_SIZE, K_NO_WAIT);
+	zassert_not_null(p, "cached blocks were not returned to the heap");
+	k_heap_free(&mag_heap, p);
+}
+
+/**
+ * @brief Test small blocks freed while a thread waits for memory wake it up
+ *
+ * @ingroup k_heap_api_tests
+ *
+ * @see k_heap_alloc(), k_heap_free()
+ */
+ZTEST(k_heap_api, test_k_heap_magazine_pending)
+{
+	void *p = NULL;
+	int num = fill_heap();
+
+	k_tid_t tid = k_thread_create(&mag_thread, mag_stack, K_THREAD_STACK_SIZEOF(mag_stack),
+				      thread_alloc_large, &p, NULL, NULL, K_PRIO_PREEMPT(5), 0,
+				      K_NO_WAIT);
+
+	/* Sleep long enough for child thread to go into pending */
+	k_msleep(5);
+
+	/* The blocks are not cached while the thread waits */
+	free_blocks(num);
+
+	k_thread_join(tid, K_FOREVER);
+	zassert_not_null(p, "waiting thread did not get the freed memory");
+	k_heap_free(&mag_heap, p);
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#ifdef CONFIG_HEAP_MEM_POOL_SLABS
+
+#define LARGE_SIZE 512
+#define MAX_BLOCKS 64
+
+static void *blocks[MAX_BLOCKS];
+static struct k_mem_slab *const *slabs;
+static int num_slabs;
+
+static uint32_t slabs_used(void)
+{
+	uint32_t used = 0;
+
+	for (int i = 0; i < num_slabs; i++) {
+		used += k_mem_slab_num_used_get(slabs[i]);
+	}
+
+	return used;
+}
+
+static bool in_slab(struct k_mem_slab *slab, void *ptr)
+{
+	char *p = ptr;
+
+	return (p >= slab->buffer) &&
+	       (p < (slab->buffer + (slab->info.num_blocks * slab->info.block_size)));
+}
+
+static void *malloc_slabs_setup(void)
+{
+	num_slabs = k_malloc_slab_array_get(&slabs);
+
+	return NULL;
+}
+
+/**
+ * @brief Test small allocations are served by the slab of their size class
+ *
+ * @ingroup k_heap_api_tests
+ *
+ * @see k_malloc(), k_free(), k_malloc_slab_array_get()
+ */
+ZTEST(k_malloc_slabs, test_k_malloc_slab_classes)
+{
+	uint32_t used;
+	void *p;
+
+	zassert_true(num_slabs > 0, "no slab");
+
+	for (int i = 0; i < num_slabs; i++) {
+		struct k_mem_slab *slab = slabs[i];
+
+		used = k_mem_slab_num_used_get(slab);
+
+		p = k_malloc(slab->info.block_size);
+		zassert_not_null(p, "k_malloc operation failed");
+		zassert_true(in_slab(slab, p), "not allocated from the %zu bytes slab",
+			     slab->info.block_size);
+		zassert_equal(k_mem_slab_num_used_get(slab), used + 1);
+
+		k_free(p);
+		zassert_equal(k_mem_slab_num_used_get(slab), used);
+	}
+
+	/* Too large for any slab */
+	used = slabs_used();
+	p = k_malloc(LARGE_SIZE);
+	zassert_not_null(p, "k_malloc operation failed");
+	zassert_equal(slabs_used(), used);
+	k_free(p);
+}
+
+/**
+ * @brief Test allocations move to a larger class when theirs is full
+ *
+ * @ingroup k_heap_api_tests
+ *
+ * @see k_malloc(), k_free()
+ */
+ZTEST(k_malloc_slabs, test_k_malloc_slab_full)
+{
+	struct k_mem_slab *slab = slabs[0];
+	uint32_t num = k_mem_slab_num_free_get(slab);
+	void *p;
+
+	zassert_true(num <= MAX_BLOCKS, "too many blocks to exhaust the slab");
+
+	for (uint32_t i = 0; i < num; i++) {
+		blocks[i] = k_malloc(slab->info.block_size);
+		zassert_true(in_slab(slab, blocks[i]), "not allocated from the smallest slab");
+	}
+
+	/* Served by the next class, or the heap */
+	p = k_malloc(slab->info.block_size);
+	zassert_not_null(p, "k_malloc operation failed");
+	zassert_false(in_slab(slab, p), "allocated from a full slab");
+	k_free(p);
+
+	for (uint32_t i = 0; i < num; i++) {
+		k_free(blocks[i]);
+	}
+	zassert_equal(k_mem_slab_num_free_get(slab), num);
+}
+
+/**
+ * @brief Test reallocating and aligning blocks of the slabs
+ *
+ * @ingroup k_heap_api_tests
+ *
+ * @see k_realloc(), k_aligned_alloc()
+ */
+ZTEST(k_malloc_slabs, test_k_malloc_slab_realloc)
+{
+	uint32_t used = slabs_used();
+	uint8_t *p;
+	uint8_t *q;
+
+	p = k_malloc(10);
+	zassert_not_null(p, "k_malloc operation failed");
+	for (int i = 0; i < 10; i++) {
+		p[i] = i;
+	}
+
+	/* Still fits in the block */
+	zassert_equal_ptr(k_realloc(p, 12), p);
+
+	q = k_realloc(p, LARGE_SIZE);
+	zassert_not_null(q, "k_realloc operation failed");
+	for (int i = 0; i < 10; i++) {
+		zassert_equal(q[i], i, "data not preserved");
+	}
+	zassert_equal(slabs_used(), used);
+	k_free(q);
+
+	p = k_aligned_alloc(16, 8);
+	zassert_not_null(p, "k_aligned_alloc operation failed");
+	zassert_true(IS_ALIGNED(p, 16), "misaligned memory");
+	k_free(p);
+	zassert_equal(slabs_used(), used);
+}
+
+ZTEST_SUITE(k_malloc_slabs, NULL, malloc_slabs_setup, NULL, NULL, NULL);
+
+#endif /* CONFIG_HEAP_MEM_POOL_SLABS */
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#define NUM_THREADS       CONFIG_MP_MAX_NUM_CPUS
+#define BLOCKS_PER_THREAD 4
+#define BLK_SIZE          32
+#define BLK_ALIGN         8
+#define SLAB_BLOCKS       (NUM_THREADS * BLOCKS_PER_THREAD)
+#define STACK_SIZE        (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define THREAD_PRIO       K_PRIO_PREEMPT(5)
+#define TIMEOUT           K_MSEC(500)
+#define INTERVAL_MS       1000
+
+struct worker {
+	struct k_thread thread;
+	void *blocks[BLOCKS_PER_THREAD];
+	uint32_t count;
+	bool failed;
+};
+
+K_MEM_SLAB_DEFINE_STATIC(cache_mslab, BLK_SIZE, SLAB_BLOCKS, BLK_ALIGN);
+
+static struct worker workers[NUM_THREADS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static void *blocks[SLAB_BLOCKS];
+static atomic_t stop;
+
+static void start_workers(k_thread_entry_t entry)
+{
+	atomic_clear(&stop);
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		struct worker *w = &workers[i];
+
+		w->count = 0;
+		w->failed = false;
+		k_thread_create(&w->thread, stacks[i], STACK_SIZE, entry, w, NULL, NULL,
+				THREAD_PRIO, 0, K_NO_WAIT);
+	}
+}
+
+static void join_workers(void)
+{
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		k_thread_join(&workers[i].thread, K_FOREVER);
+		zassert_false(workers[i].failed, "worker %u failed", i);
+	}
+}
+
+/* Leave some blocks in the cache of the CPU the worker runs on */
+static void alloc_free_entry(void *p1, void *p2, void *p3)
+{
+	struct worker *w = p1;
+
+	for (int i = 0; i < BLOCKS_PER_THREAD; i++) {
+		if (k_mem_slab_alloc(&cache_mslab, &w->blocks[i], K_NO_WAIT) != 0) {
+			w->failed = true;
+			return;
+		}
+	}
+
+	for (int i = 0; i < BLOCKS_PER_THREAD; i++) {
+		k_mem_slab_free(&cache_mslab, w->blocks[i]);
+	}
+}
+
+/* Every block carries the address of the worker holding it, so that a
+ * block allocated twice is noticed.
+ */
+static void contention_entry(void *p1, void *p2, void *p3)
+{
+	struct worker *w = p1;
+
+	while (atomic_get(&stop) == 0) {
+		for (int i = 0; i < BLOCKS_PER_THREAD; i++) {
+			if (k_mem_slab_alloc(&cache_mslab, &w->blocks[i], TIMEOUT) != 0) {
+				w->failed = true;
+				return;
+			}
+			*(struct worker **)w->blocks[i] = w;
+		}
+
+		for (int i = 0; i < BLOCKS_PER_THREAD; i++) {
+			if (*(struct worker **)w->blocks[i] != w) {
+				w->failed = true;
+			}
+			k_mem_slab_free(&cache_mslab, w->blocks[i]);
+		}
+
+		w->count += BLOCKS_PER_THREAD;
+	}
+}
+
+static void thread_alloc(void *p1, void *p2, void *p3)
+{
+	void **mem = p1;
+
+	if (k_mem_slab_alloc(&cache_mslab, mem, TIMEOUT) != 0) {
+		*mem = NULL;
+	}
+}
+
+static void mslab_cpu_cache_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_equal(k_mem_slab_num_used_get(&cache_mslab), 0, "blocks leaked by a previous test");
+}
+
+/**
+ * @brief Test a freed block is reused by the next allocation
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_cpu_cache, test_mslab_cpu_cache_reuse)
+{
+	void *block;
+	void *again;
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	zassert_ok(k_mem_slab_runtime_stats_reset_max(&cache_mslab));
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+
+	/* Stay on the same CPU, whose cache serves both allocations */
+	k_sched_lock();
+	zassert_ok(k_mem_slab_alloc(&cache_mslab, &block, K_NO_WAIT));
+	zassert_equal(k_mem_slab_num_used_get(&cache_mslab), 1);
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	/* The blocks cached meanwhile are not counted */
+	zassert_equal(k_mem_slab_max_used_get(&cache_mslab), 1);
+#endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+	k_mem_slab_free(&cache_mslab, block);
+	zassert_equal(k_mem_slab_num_used_get(&cache_mslab), 0);
+	zassert_ok(k_mem_slab_alloc(&cache_mslab, &again, K_NO_WAIT));
+	k_sched_unlock();
+
+	zassert_equal_ptr(again, block, "freed block was not reused");
+	k_mem_slab_free(&cache_mslab, again);
+}
+
+/**
+ * @brief Test all blocks can be allocated while cached by other CPUs
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_cpu_cache, test_mslab_cpu_cache_exhaust)
+{
+	start_workers(alloc_free_entry);
+	join_workers();
+
+	zassert_equal(k_mem_slab_num_free_get(&cache_mslab), SLAB_BLOCKS);
+
+	for (int i = 0; i < SLAB_BLOCKS; i++) {
+		zassert_ok(k_mem_slab_alloc(&cache_mslab, &blocks[i], K_NO_WAIT),
+			   "block %d not allocated", i);
+	}
+	zassert_equal(k_mem_slab_num_free_get(&cache_mslab), 0);
+	zassert_equal(k_mem_slab_alloc(&cache_mslab, &blocks[0], K_NO_WAIT), -ENOMEM);
+
+	for (int i = 0; i < SLAB_BLOCKS; i++) {
+		k_mem_slab_free(&cache_mslab, blocks[i]);
+	}
+}
+
+/**
+ * @brief Test a thread waiting for a block gets the next one freed
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_cpu_cache, test_mslab_cpu_cache_pending)
+{
+	void *block = NULL;
+	k_tid_t tid;
+
+	for (int i = 0; i < SLAB_BLOCKS; i++) {
+		zassert_ok(k_mem_slab_alloc(&cache_mslab, &blocks[i], K_NO_WAIT));
+	}
+
+	tid = k_thread_create(&workers[0].thread, stacks[0], STACK_SIZE, thread_alloc, &block,
+			      NULL, NULL, THREAD_PRIO, 0, K_NO_WAIT);
+
+	/* Sleep long enough for the thread to go into pending */
+	k_msleep(50);
+
+	k_mem_slab_free(&cache_mslab, blocks[0]);
+	k_thread_join(tid, K_FOREVER);
+	zassert_equal_ptr(block, blocks[0], "waiting thread did not get the freed block");
+	blocks[0] = block;
+
+	for (int i = 0; i < SLAB_BLOCKS; i++) {
+		k_mem_slab_free(&cache_mslab, blocks[i]);
+	}
+}
+
+/**
+ * @brief Measure allocations and frees from all CPUs
+ *
+ * @details A thread per CPU repeatedly allocates and frees its share of
+ * the slab blocks, competing for them when the caches hold some. Reports
+ * the number of blocks allocated and freed per second.
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_cpu_cache, test_mslab_cpu_cache_contention)
+{
+	uint32_t count = 0;
+
+	start_workers(contention_entry);
+	k_msleep(INTERVAL_MS);
+	atomic_set(&stop, 1);
+	join_workers();
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		count += workers[i].count;
+	}
+
+	TC_PRINT("Alloc/free pairs %s CPU caches: %u (%u/s), %u CPUs\n",
+		 IS_ENABLED(CONFIG_MEM_SLAB_CPU_CACHE) ? "with" : "without", count,
+		 (uint32_t)((count * 1000ULL) / INTERVAL_MS), arch_num_cpus());
+
+	zassert_true(count > 0, "no block allocated");
+	zassert_true(k_mem_slab_max_used_get(&cache_mslab) <= SLAB_BLOCKS);
+}
+
+ZTEST_SUITE(mslab_cpu_cache, NULL, NULL, mslab_cpu_cache_before, NULL, NULL);
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define BATCH_LEN 4
+#define NUM_MSGS  (BATCH_LEN + 2)
+
+K_MSGQ_DEFINE(batch_msgq, MSG_SIZE, BATCH_LEN, 4);
+
+static K_THREAD_STACK_DEFINE(batch_stack, STACK_SIZE);
+static struct k_thread batch_thread;
+
+static ZTEST_DMEM uint32_t batch_data[NUM_MSGS];
+static ZTEST_DMEM uint32_t batch_rx[NUM_MSGS];
+static int thread_ret;
+
+static void fill_batch_data(uint32_t first)
+{
+	for (int i = 0; i < NUM_MSGS; i++) {
+		batch_data[i] = first + i;
+	}
+}
+
+static void check_rx(uint32_t first, int num)
+{
+	for (int i = 0; i < num; i++) {
+		zassert_equal(batch_rx[i], first + i, "message %d is %u, expected %u", i,
+			      batch_rx[i], first + i);
+	}
+}
+
+static void put_get_many(struct k_msgq *q)
+{
+	/* Only the messages that fit are put */
+	fill_batch_data(0);
+	zassert_equal(k_msgq_put_many(q, batch_data, NUM_MSGS, K_NO_WAIT), BATCH_LEN);
+	zassert_equal(k_msgq_num_used_get(q), BATCH_LEN);
+	zassert_equal(k_msgq_put_many(q, batch_data, NUM_MSGS, K_NO_WAIT), -ENOMSG);
+
+	zassert_equal(k_msgq_get_many(q, batch_rx, 3, K_NO_WAIT), 3);
+	check_rx(0, 3);
+
+	/* Wraps around the end of the ring buffer */
+	fill_batch_data(BATCH_LEN);
+	zassert_equal(k_msgq_put_many(q, batch_data, NUM_MSGS, K_NO_WAIT), 3);
+	zassert_equal(k_msgq_get_many(q, batch_rx, NUM_MSGS, K_NO_WAIT), BATCH_LEN);
+	check_rx(3, BATCH_LEN);
+
+	zassert_equal(k_msgq_get_many(q, batch_rx, NUM_MSGS, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_put_many(q, batch_data, 0, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_get_many(q, batch_rx, 0, K_NO_WAIT), 0);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test putting and getting several messages at once
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api, test_msgq_put_get_many)
+{
+	k_msgq_purge(&batch_msgq);
+
+	put_get_many(&batch_msgq);
+}
+
+#ifdef CONFIG_USERSPACE
+/**
+ * @brief Test putting and getting several messages at once from user mode
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST_USER(msgq_api, test_msgq_user_put_get_many)
+{
+	struct k_msgq *q;
+
+	q = k_object_alloc(K_OBJ_MSGQ);
+	zassert_not_null(q, "couldn't alloc message queue");
+	zassert_false(k_msgq_alloc_init(q, MSG_SIZE, BATCH_LEN));
+
+	put_get_many(q);
+}
+#endif
+
+static void get_many_entry(void *p1, void *p2, void *p3)
+{
+	thread_ret = k_msgq_get_many(&batch_msgq, batch_rx, NUM_MSGS, K_FOREVER);
+}
+
+/**
+ * @brief Test a reader waiting on an empty queue gets all messages put
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_get_many_wait)
+{
+	k_msgq_purge(&batch_msgq);
+
+	k_thread_create(&batch_thread, batch_stack, STACK_SIZE, get_many_entry, NULL, NULL,
+			NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	/* The first message is handed to the reader, which then takes the others */
+	fill_batch_data(0);
+	zassert_equal(k_msgq_put_many(&batch_msgq, batch_data, 3, K_NO_WAIT), 3);
+	k_thread_join(&batch_thread, K_FOREVER);
+
+	zassert_equal(thread_ret, 3);
+	check_rx(0, 3);
+	zassert_equal(k_msgq_num_used_get(&batch_msgq), 0);
+}
+
+static void put_many_entry(void *p1, void *p2, void *p3)
+{
+	thread_ret = k_msgq_put_many(&batch_msgq, batch_data, 3, K_FOREVER);
+}
+
+/**
+ * @brief Test a writer waiting on a full queue is woken up by a batch get
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_put_many_wait)
+{
+	uint32_t msg;
+
+	k_msgq_purge(&batch_msgq);
+
+	fill_batch_data(0);
+	zassert_equal(k_msgq_put_many(&batch_msgq, batch_data, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN);
+
+	fill_batch_data(BATCH_LEN);
+	k_thread_create(&batch_thread, batch_stack, STACK_SIZE, put_many_entry, NULL, NULL,
+			NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	/* Only the first message of the waiting writer is put */
+	zassert_equal(k_msgq_get_many(&batch_msgq, batch_rx, 2, K_NO_WAIT), 2);
+	check_rx(0, 2);
+	k_thread_join(&batch_thread, K_FOREVER);
+	zassert_equal(thread_ret, 1);
+
+	zassert_equal(k_msgq_get_many(&batch_msgq, batch_rx, NUM_MSGS, K_NO_WAIT), 3);
+	check_rx(2, 3);
+	zassert_equal(k_msgq_get(&batch_msgq, &msg, K_NO_WAIT), -ENOMSG);
+}
+
+/**
+ * @brief Test batch operations time out like the single message ones
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api, test_msgq_many_timeout)
+{
+	k_msgq_purge(&batch_msgq);
+
+	zassert_equal(k_msgq_get_many(&batch_msgq, batch_rx, NUM_MSGS, TIMEOUT), -EAGAIN);
+
+	fill_batch_data(0);
+	zassert_equal(k_msgq_put_many(&batch_msgq, batch_data, NUM_MSGS, TIMEOUT), BATCH_LEN);
+	zassert_equal(k_msgq_put_many(&batch_msgq, batch_data, NUM_MSGS, TIMEOUT), -EAGAIN);
+
+	k_msgq_purge(&batch_msgq);
+}
+
+static void put_get_many_isr(const void *p)
+{
+	int *ret = (int *)p;
+
+	ret[0] = k_msgq_put_many(&batch_msgq, batch_data, NUM_MSGS, K_NO_WAIT);
+	ret[1] = k_msgq_get_many(&batch_msgq, batch_rx, NUM_MSGS, K_NO_WAIT);
+}
+
+/**
+ * @brief Test putting and getting several messages at once from an ISR
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api, test_msgq_isr_put_get_many)
+{
+	int ret[2];
+
+	k_msgq_purge(&batch_msgq);
+	fill_batch_data(0);
+
+	irq_offload(put_get_many_isr, ret);
+
+	zassert_equal(ret[0], BATCH_LEN);
+	zassert_equal(ret[1], BATCH_LEN);
+	check_rx(0, BATCH_LEN);
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#ifdef CONFIG_MSGQ_MPSC
+
+#define MPSC_LEN  4
+#define NUM_MSGS  (MPSC_LEN + 2)
+#define NUM_LAPS  3
+
+K_MSGQ_MPSC_DEFINE(mpsc_msgq, MSG_SIZE, MPSC_LEN, 4);
+
+static char __aligned(4) mpsc_buffer[MSG_SIZE * MPSC_LEN];
+static atomic_t mpsc_seqs[MPSC_LEN];
+static struct k_msgq mpsc_init_msgq;
+
+static K_THREAD_STACK_DEFINE(mpsc_stack, STACK_SIZE);
+static struct k_thread mpsc_thread;
+
+static uint32_t mpsc_data[NUM_MSGS];
+static uint32_t mpsc_rx[NUM_MSGS];
+static int thread_ret;
+
+static void fill_mpsc_data(uint32_t first)
+{
+	for (int i = 0; i < NUM_MSGS; i++) {
+		mpsc_data[i] = first + i;
+	}
+}
+
+static void put_get_laps(struct k_msgq *q)
+{
+	uint32_t msg;
+
+	/* Every slot is reused on every lap */
+	for (uint32_t i = 0; i < NUM_LAPS * MPSC_LEN; i++) {
+		zassert_ok(k_msgq_put(q, &i, K_NO_WAIT));
+		zassert_equal(k_msgq_num_used_get(q), 1);
+		zassert_ok(k_msgq_peek(q, &msg));
+		zassert_equal(msg, i);
+		zassert_ok(k_msgq_get(q, &msg, K_NO_WAIT));
+		zassert_equal(msg, i);
+	}
+
+	/* Only the messages that fit are put */
+	fill_mpsc_data(0);
+	zassert_equal(k_msgq_put_many(q, mpsc_data, NUM_MSGS, K_NO_WAIT), MPSC_LEN);
+	zassert_equal(k_msgq_num_free_get(q), 0);
+	zassert_equal(k_msgq_put(q, &mpsc_data[0], K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_put_front(q, &mpsc_data[0]), -ENOTSUP);
+
+	zassert_ok(k_msgq_peek_at(q, &msg, MPSC_LEN - 1));
+	zassert_equal(msg, MPSC_LEN - 1);
+	zassert_equal(k_msgq_peek_at(q, &msg, MPSC_LEN), -ENOMSG);
+
+	zassert_equal(k_msgq_get_many(q, mpsc_rx, NUM_MSGS, K_NO_WAIT), MPSC_LEN);
+	for (int i = 0; i < MPSC_LEN; i++) {
+		zassert_equal(mpsc_rx[i], i);
+	}
+
+	zassert_equal(k_msgq_get(q, &msg, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_get(q, &msg, TIMEOUT), -EAGAIN);
+	zassert_equal(k_msgq_num_used_get(q), 0);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test putting and getting messages of lock-free message queues
+ * @see K_MSGQ_MPSC_DEFINE(), k_msgq_mpsc_init()
+ */
+ZTEST(msgq_api, test_msgq_mpsc_put_get)
+{
+	k_msgq_purge(&mpsc_msgq);
+	put_get_laps(&mpsc_msgq);
+
+	k_msgq_mpsc_init(&mpsc_init_msgq, mpsc_buffer, mpsc_seqs, MSG_SIZE, MPSC_LEN);
+	put_get_laps(&mpsc_init_msgq);
+}
+
+static void put_isr(const void *p)
+{
+	const uint32_t *first = p;
+
+	for (uint32_t i = 0; i < MPSC_LEN; i++) {
+		uint32_t msg = *first + i;
+
+		zassert_ok(k_msgq_put(&mpsc_msgq, &msg, K_NO_WAIT));
+	}
+}
+
+static void get_entry(void *p1, void *p2, void *p3)
+{
+	thread_ret = k_msgq_get(&mpsc_msgq, &mpsc_rx[0], K_FOREVER);
+}
+
+/**
+ * @brief Test a reader waiting on a lock-free queue is woken up by an ISR
+ * @see K_MSGQ_MPSC_DEFINE()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_mpsc_isr_put)
+{
+	uint32_t first = 0x100;
+
+	k_msgq_purge(&mpsc_msgq);
+
+	k_thread_create(&mpsc_thread, mpsc_stack, STACK_SIZE, get_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	irq_offload(put_isr, &first);
+	k_thread_join(&mpsc_thread, K_FOREVER);
+
+	zassert_ok(thread_ret);
+	zassert_equal(mpsc_rx[0], first);
+
+	/* The other messages stay queued in order */
+	zassert_equal(k_msgq_get_many(&mpsc_msgq, mpsc_rx, NUM_MSGS, K_NO_WAIT), MPSC_LEN - 1);
+	for (int i = 0; i < MPSC_LEN - 1; i++) {
+		zassert_equal(mpsc_rx[i], first + 1 + i);
+	}
+}
+
+static void put_entry(void *p1, void *p2, void *p3)
+{
+	thread_ret = k_msgq_put(&mpsc_msgq, &mpsc_data[MPSC_LEN], K_FOREVER);
+}
+
+/**
+ * @brief Test a writer waiting on a full lock-free queue
+ * @see K_MSGQ_MPSC_DEFINE(), k_msgq_purge()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_mpsc_put_wait)
+{
+	uint32_t msg;
+
+	k_msgq_purge(&mpsc_msgq);
+	fill_mpsc_data(0);
+	zassert_equal(k_msgq_put_many(&mpsc_msgq, mpsc_data, MPSC_LEN, K_NO_WAIT), MPSC_LEN);
+
+	/* Freeing a slot lets the writer put its message behind the others */
+	k_thread_create(&mpsc_thread, mpsc_stack, STACK_SIZE, put_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	zassert_ok(k_msgq_get(&mpsc_msgq, &msg, K_NO_WAIT));
+	zassert_equal(msg, 0);
+	k_thread_join(&mpsc_thread, K_FOREVER);
+	zassert_ok(thread_ret);
+
+	zassert_equal(k_msgq_get_many(&mpsc_msgq, mpsc_rx, NUM_MSGS, K_NO_WAIT), MPSC_LEN);
+	for (int i = 0; i < MPSC_LEN; i++) {
+		zassert_equal(mpsc_rx[i], i + 1);
+	}
+
+	/* A purge makes the writer fail */
+	zassert_equal(k_msgq_put_many(&mpsc_msgq, mpsc_data, MPSC_LEN, K_NO_WAIT), MPSC_LEN);
+	k_thread_create(&mpsc_thread, mpsc_stack, STACK_SIZE, put_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	k_msgq_purge(&mpsc_msgq);
+	k_thread_join(&mpsc_thread, K_FOREVER);
+	zassert_equal(thread_ret, -ENOMSG);
+	zassert_equal(k_msgq_num_used_get(&mpsc_msgq), 0);
+}
+
+/**
+ * @}
+ */
+
+#endif /* CONFIG_MSGQ_MPSC */
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <inttypes.h>
 #include <zephyr/ztest.h>
 #include <zephyr/sys/mem_blocks.h>
 
@@ -693,6 +694,129 @@ ZTEST(obj_core_stats_mem_slab, test_obj_core_stats_mem_slab)
 	k_mem_slab_free(&mem_slab, mem2);
 }
 
+/***************** MUTEX, SEMAPHORE AND MESSAGE QUEUE CONTENTION ******************/
+
+K_MUTEX_DEFINE(contention_mutex);
+K_SEM_DEFINE(contention_sem, 1, 1);
+K_MSGQ_DEFINE(contention_msgq, sizeof(uint32_t), 1, 4);
+
+static K_THREAD_STACK_DEFINE(contention_stack, 1024 + CONFIG_TEST_EXTRA_STACK_SIZE);
+static struct k_thread contention_thread;
+
+static void test_contention_stats(const char *str, struct k_obj_core *obj_core,
+				  uint64_t acquisitions, uint64_t contended)
+{
+	struct k_obj_contention_stats stats;
+	int  status;
+
+	status = k_obj_core_stats_query(obj_core, &stats, sizeof(stats));
+	zassert_equal(status, 0,
+		      "%s: Failed to get query stats (%d)\n", str, status);
+
+	zassert_equal(stats.acquisitions, acquisitions,
+		      "%s: Expected %" PRIu64 " acquisitions, got %" PRIu64 "\n", str,
+		      acquisitions, stats.acquisitions);
+	zassert_equal(stats.contended, contended,
+		      "%s: Expected %" PRIu64 " contended, got %" PRIu64 "\n", str,
+		      contended, stats.contended);
+	zassert_true(stats.wait_total >= stats.wait_max,
+		     "%s: Wait total below the max wait\n", str);
+	zassert_true(stats.hold_total >= stats.hold_max,
+		     "%s: Hold total below the max hold\n", str);
+}
+
+static void mutex_lock_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_mutex_lock(&contention_mutex, K_FOREVER);
+	k_mutex_unlock(&contention_mutex);
+}
+
+ZTEST(obj_core_stats_contention, test_obj_core_stats_mutex)
+{
+	struct k_obj_core *obj_core = K_OBJ_CORE(&contention_mutex);
+	struct k_obj_contention_stats stats;
+	int  status;
+
+	status = k_obj_core_stats_reset(obj_core);
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	test_contention_stats("Reset", obj_core, 0, 0);
+
+	k_mutex_lock(&contention_mutex, K_FOREVER);
+	k_mutex_unlock(&contention_mutex);
+	test_contention_stats("Uncontended", obj_core, 1, 0);
+
+	/* A higher priority thread waits for the mutex while it is held */
+
+	k_mutex_lock(&contention_mutex, K_FOREVER);
+	k_thread_create(&contention_thread, contention_stack,
+			K_THREAD_STACK_SIZEOF(contention_stack),
+			mutex_lock_entry, NULL, NULL, NULL,
+			K_HIGHEST_THREAD_PRIO, 0, K_NO_WAIT);
+	k_busy_wait(1000);
+	k_mutex_unlock(&contention_mutex);
+	k_thread_join(&contention_thread, K_FOREVER);
+
+	test_contention_stats("Contended", obj_core, 3, 1);
+
+	status = k_obj_core_stats_raw(obj_core, &stats, sizeof(stats));
+	zassert_equal(status, 0, "Failed to get raw stats (%d)\n", status);
+	zassert_true(stats.wait_max > 0, "No wait time recorded\n");
+	zassert_true(stats.hold_max > 0, "No hold time recorded\n");
+}
+
+ZTEST(obj_core_stats_contention, test_obj_core_stats_sem)
+{
+	struct k_obj_core *obj_core = K_OBJ_CORE(&contention_sem);
+	int  status;
+
+	status = k_obj_core_stats_reset(obj_core);
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+
+	status = k_sem_take(&contention_sem, K_NO_WAIT);
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	test_contention_stats("Taken", obj_core, 1, 0);
+
+	status = k_sem_take(&contention_sem, K_NO_WAIT);
+	zassert_equal(status, -EBUSY, "Expected %d, got %d\n", -EBUSY, status);
+	test_contention_stats("Busy", obj_core, 1, 1);
+
+	status = k_sem_take(&contention_sem, K_MSEC(10));
+	zassert_equal(status, -EAGAIN, "Expected %d, got %d\n", -EAGAIN, status);
+	test_contention_stats("Timed out", obj_core, 1, 2);
+
+	k_sem_give(&contention_sem);
+}
+
+ZTEST(obj_core_stats_contention, test_obj_core_stats_msgq)
+{
+	struct k_obj_core *obj_core = K_OBJ_CORE(&contention_msgq);
+	uint32_t data = 0;
+	int  status;
+
+	status = k_obj_core_stats_reset(obj_core);
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+
+	status = k_msgq_put(&contention_msgq, &data, K_NO_WAIT);
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	test_contention_stats("Put", obj_core, 1, 0);
+
+	status = k_msgq_put(&contention_msgq, &data, K_NO_WAIT);
+	zassert_equal(status, -ENOMSG, "Expected %d, got %d\n", -ENOMSG, status);
+	test_contention_stats("Full", obj_core, 1, 1);
+
+	status = k_msgq_get(&contention_msgq, &data, K_NO_WAIT);
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	test_contention_stats("Get", obj_core, 2, 1);
+
+	status = k_msgq_get(&contention_msgq, &data, K_NO_WAIT);
+	zassert_equal(status, -ENOMSG, "Expected %d, got %d\n", -ENOMSG, status);
+	test_contention_stats("Empty", obj_core, 2, 2);
+}
+
 ZTEST_SUITE(obj_core_stats_system, NULL, NULL,
 	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
 
@@ -704,3 +828,6 @@ ZTEST_SUITE(obj_core_stats_mem_block, NULL, NULL,
 
 ZTEST_SUITE(obj_core_stats_mem_slab, NULL, NULL,
 	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
+
+ZTEST_SUITE(obj_core_stats_contention, NULL, NULL,
+	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
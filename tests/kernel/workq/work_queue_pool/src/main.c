@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2026 Sensirion
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/ztest.h>
+
+#define NUM_THREADS 3
+#define NUM_ITEMS   NUM_THREADS
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define POOL_PRIO   K_PRIO_PREEMPT(1)
+
+/* Long enough for the pool threads to pick up any work item left */
+#define SETTLE_TIME K_MSEC(20)
+
+struct test_item {
+	struct k_work work;
+	atomic_t running;
+	uint32_t runs;
+	bool overlapped;
+};
+
+static K_THREAD_STACK_ARRAY_DEFINE(pool_stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread pool_threads[NUM_THREADS];
+static struct k_work_q pool;
+
+/* Pool started and stopped by test_stop */
+static K_THREAD_STACK_ARRAY_DEFINE(stop_stacks, NUM_THREADS, STACK_SIZE);
+static struct k_thread stop_threads[NUM_THREADS];
+static struct k_work_q stop_pool;
+
+static struct test_item items[NUM_ITEMS];
+static atomic_t num_running;
+static atomic_t max_running;
+
+static K_SEM_DEFINE(started, 0, K_SEM_MAX_LIMIT);
+static K_SEM_DEFINE(release, 0, K_SEM_MAX_LIMIT);
+
+static void release_items_cb(struct k_timer *timer)
+{
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_sem_give(&release);
+	}
+}
+
+static K_TIMER_DEFINE(release_timer, release_items_cb, NULL);
+
+/* Run until the test releases the item */
+static void blocking_handler(struct k_work *work)
+{
+	struct test_item *item = CONTAINER_OF(work, struct test_item, work);
+	atomic_val_t running;
+	atomic_val_t max;
+
+	if (atomic_inc(&item->running) != 0) {
+		item->overlapped = true;
+	}
+
+	running = atomic_inc(&num_running) + 1;
+	do {
+		max = atomic_get(&max_running);
+	} while ((running > max) && !atomic_cas(&max_running, max, running));
+
+	k_sem_give(&started);
+	k_sem_take(&release, K_FOREVER);
+
+	item->runs++;
+	atomic_dec(&num_running);
+	atomic_dec(&item->running);
+}
+
+static void release_items_later(void)
+{
+	k_timer_start(&release_timer, K_MSEC(10), K_NO_WAIT);
+}
+
+static void wait_started(int num)
+{
+	for (int i = 0; i < num; i++) {
+		zassert_ok(k_sem_take(&started, K_MSEC(100)), "item %d did not start", i);
+	}
+}
+
+static void check_item_runs(struct test_item *item, uint32_t runs)
+{
+	zassert_false(item->overlapped, "item ran concurrently with itself");
+	zassert_equal(item->runs, runs, "item ran %u times, expected %u", item->runs, runs);
+	zassert_equal(k_work_busy_get(&item->work), 0);
+}
+
+ZTEST(work_queue_pool, test_concurrent)
+{
+	struct k_work_sync sync;
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_submit_to_queue(&pool, &items[i].work), 1);
+	}
+
+	/* Every item is picked up by its own thread */
+	wait_started(NUM_ITEMS);
+	zassert_equal(atomic_get(&max_running), NUM_ITEMS);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_sem_give(&release);
+	}
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_work_flush(&items[i].work, &sync);
+		check_item_runs(&items[i], 1);
+	}
+}
+
+ZTEST(work_queue_pool, test_no_reentrancy)
+{
+	struct test_item *item = &items[0];
+	struct k_work_sync sync;
+
+	zassert_equal(k_work_submit_to_queue(&pool, &item->work), 1);
+	wait_started(1);
+
+	/* Requeued while running, but not run by the idle threads */
+	zassert_equal(k_work_submit_to_queue(&pool, &item->work), 2);
+	k_sleep(SETTLE_TIME);
+	zassert_equal(k_sem_count_get(&started), 0, "running item was started again");
+
+	k_sem_give(&release);
+	wait_started(1);
+	k_sem_give(&release);
+
+	k_work_flush(&item->work, &sync);
+	check_item_runs(item, 2);
+	zassert_equal(atomic_get(&max_running), 1);
+}
+
+ZTEST(work_queue_pool, test_flush_running)
+{
+	struct test_item *item = &items[0];
+	struct k_work_sync sync;
+
+	zassert_equal(k_work_submit_to_queue(&pool, &item->work), 1);
+	wait_started(1);
+
+	/* Idle threads of the pool must not complete the flush early */
+	release_items_later();
+	zassert_true(k_work_flush(&item->work, &sync));
+	check_item_runs(item, 1);
+}
+
+ZTEST(work_queue_pool, test_flush_queued)
+{
+	struct test_item *item = &items[0];
+	struct k_work_sync sync;
+
+	zassert_equal(k_work_submit_to_queue(&pool, &item->work), 1);
+	wait_started(1);
+	zassert_equal(k_work_submit_to_queue(&pool, &item->work), 2);
+
+	/* Completes after the run of the queued submission */
+	release_items_later();
+	zassert_true(k_work_flush(&item->work, &sync));
+	check_item_runs(item, 2);
+}
+
+ZTEST(work_queue_pool, test_cancel_sync_running)
+{
+	struct test_item *item = &items[0];
+	struct k_work_sync sync;
+
+	zassert_equal(k_work_submit_to_queue(&pool, &item->work), 1);
+	wait_started(1);
+	zassert_equal(k_work_submit_to_queue(&pool, &item->work), 2);
+
+	/* The queued submission is dropped, the running one completes */
+	release_items_later();
+	zassert_true(k_work_cancel_sync(&item->work, &sync));
+	check_item_runs(item, 1);
+
+	k_sleep(SETTLE_TIME);
+	zassert_equal(item->runs, 1);
+}
+
+ZTEST(work_queue_pool, test_drain)
+{
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_submit_to_queue(&pool, &items[i].work), 1);
+	}
+	wait_started(NUM_ITEMS);
+
+	/* Waits for all threads of the pool, not just the first idle one */
+	release_items_later();
+	zassert_equal(k_work_queue_drain(&pool, true), 1);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		check_item_runs(&items[i], 1);
+	}
+
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0].work), -EBUSY);
+	zassert_ok(k_work_queue_unplug(&pool));
+}
+
+ZTEST(work_queue_pool, test_stop)
+{
+	k_work_queue_init(&stop_pool);
+	k_work_queue_pool_start(&stop_pool, stop_threads, stop_stacks[0], NUM_THREADS,
+				STACK_SIZE, POOL_PRIO, NULL);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_submit_to_queue(&stop_pool, &items[i].work), 1);
+	}
+	wait_started(NUM_ITEMS);
+
+	zassert_equal(k_work_queue_stop(&stop_pool, K_FOREVER), -EBUSY);
+
+	release_items_later();
+	zassert_equal(k_work_queue_drain(&stop_pool, true), 1);
+	zassert_ok(k_work_queue_stop(&stop_pool, K_FOREVER));
+
+	/* All threads of the pool exited */
+	for (int i = 0; i < NUM_THREADS; i++) {
+		zassert_ok(k_thread_join(&stop_threads[i], K_NO_WAIT));
+	}
+	zassert_equal(k_work_submit_to_queue(&stop_pool, &items[0].work), -ENODEV);
+}
+
+static void *pool_setup(void)
+{
+	static const struct k_work_queue_config cfg = {
+		.name = "test_pool",
+	};
+
+	k_work_queue_pool_start(&pool, pool_threads, pool_stacks[0], NUM_THREADS, STACK_SIZE,
+				POOL_PRIO, &cfg);
+
+	return NULL;
+}
+
+static void pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		items[i] = (struct test_item){0};
+		k_work_init(&items[i].work, blocking_handler);
+	}
+
+	atomic_clear(&num_running);
+	atomic_clear(&max_running);
+	k_sem_reset(&started);
+	k_sem_reset(&release);
+}
+
+ZTEST_SUITE(work_queue_pool, NULL, pool_setup, pool_before, NULL, NULL);
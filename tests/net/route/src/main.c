@@ -544,6 +544,62 @@ static void test_route_preference(void)
 	net_route_del(route_entry);
 }
 
+static void test_route_longest_prefix(void)
+{
+	struct in6_addr net64 = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+				      0, 0, 0, 0, 0, 0, 0, 0 } } };
+	struct in6_addr net48 = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0x1,
+				      0, 0, 0, 0, 0, 0, 0, 0 } } };
+	struct in6_addr in64 = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+				     0, 0, 0, 0, 0, 0, 0, 0x1 } } };
+	struct in6_addr in48 = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0x2,
+				     0, 0, 0, 0, 0, 0, 0, 0x1 } } };
+	struct in6_addr outside = { { { 0x20, 0x01, 0x0d, 0xb9, 0, 0, 0, 0,
+					0, 0, 0, 0, 0, 0, 0, 0x1 } } };
+	struct net_route_entry *route48, *route64, *route128;
+
+	/* Most specific first, as adding a route replaces the one covering
+	 * its address when the next hops differ.
+	 */
+	route128 = net_route_add(my_iface, &generic_addr, 128, &peer_addr,
+				 NET_IPV6_ND_INFINITE_LIFETIME,
+				 NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(route128, "Route /128 add failed");
+
+	route64 = net_route_add(my_iface, &net64, 64, &peer_addr_alt,
+				NET_IPV6_ND_INFINITE_LIFETIME,
+				NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(route64, "Route /64 add failed");
+
+	route48 = net_route_add(my_iface, &net48, 48, &peer_addr,
+				NET_IPV6_ND_INFINITE_LIFETIME,
+				NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(route48, "Route /48 add failed");
+
+	zassert_equal_ptr(net_route_lookup(my_iface, &generic_addr), route128,
+			  "Host route not preferred");
+	zassert_equal_ptr(net_route_lookup(NULL, &in64), route64,
+			  "/64 route not preferred");
+	zassert_equal_ptr(net_route_lookup(my_iface, &in48), route48,
+			  "/48 route not found");
+	zassert_is_null(net_route_lookup(NULL, &outside),
+			"Route found outside the prefixes");
+
+	/* The next longest prefix takes over, also for cached lookups */
+	zassert_false(net_route_del(route128), "Route /128 del failed");
+	zassert_equal_ptr(net_route_lookup(my_iface, &generic_addr), route64,
+			  "/64 route not used after host route removal");
+
+	zassert_false(net_route_del(route64), "Route /64 del failed");
+	zassert_equal_ptr(net_route_lookup(my_iface, &generic_addr), route48,
+			  "/48 route not used after /64 route removal");
+	zassert_equal_ptr(net_route_lookup(my_iface, &in64), route48,
+			  "/48 route not used after /64 route removal");
+
+	zassert_false(net_route_del(route48), "Route /48 del failed");
+	zassert_is_null(net_route_lookup(my_iface, &generic_addr),
+			"Route found after all were removed");
+}
 
 /*test case main entry*/
 ZTEST(route_test_suite, test_route)
@@ -566,6 +622,7 @@ ZTEST(route_test_suite, test_route)
 	test_route_del_many();
 	test_route_lifetime();
 	test_route_preference();
+	test_route_longest_prefix();
 }
 
 ZTEST_SUITE(route_test_suite, NULL, NULL, NULL, NULL, NULL);
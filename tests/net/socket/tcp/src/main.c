@@ -367,6 +367,11 @@ void test_send_recv_large_common(int tcp_nodelay, int family)
 	struct sockaddr_in s_saddr_in;
 	struct sockaddr_in6 c_saddr_in6;
 	struct sockaddr_in6 s_saddr_in6;
+	uint32_t start_time;
+	uint32_t time_diff;
+	int dropped;
+	char ca_name[TCP_CA_NAME_MAX] = "no";
+	socklen_t ca_len = sizeof(ca_name);
 
 	if (family == AF_INET) {
 		prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr_in);
@@ -398,6 +403,9 @@ void test_send_recv_large_common(int tcp_nodelay, int family)
 	rv = zsock_setsockopt(c_sock, IPPROTO_TCP, TCP_NODELAY, (char *) &tcp_nodelay, sizeof(int));
 	zassert_equal(rv, 0, "setsockopt failed (%d)", rv);
 
+	start_time = k_uptime_get_32();
+	dropped = loopback_get_num_dropped_packets();
+
 	/* send piece by piece */
 	ssize_t total_send = 0;
 	int iteration = 0;
@@ -431,6 +439,21 @@ void test_send_recv_large_common(int tcp_nodelay, int family)
 	zassert_equal(k_thread_join(&tcp_server_thread_data, K_SECONDS(60)), 0,
 			"Not successfully wait for TCP thread to finish");
 
+	time_diff = MAX(k_uptime_get_32() - start_time, 1U);
+
+	(void)zsock_getsockopt(c_sock, IPPROTO_TCP, TCP_CONGESTION, ca_name, &ca_len);
+
+	/* Report the throughput, to compare the loss recovery and congestion
+	 * control variants
+	 */
+	TC_PRINT("%d bytes in %u ms (%u kbit/s), %d packets dropped, SACK %s, "
+		 "%s congestion control%s\n",
+		 TEST_LARGE_TRANSFER_SIZE, time_diff,
+		 (uint32_t)(TEST_LARGE_TRANSFER_SIZE * 8ULL / time_diff),
+		 loopback_get_num_dropped_packets() - dropped,
+		 IS_ENABLED(CONFIG_NET_TCP_SACK) ? "enabled" : "disabled", ca_name,
+		 IS_ENABLED(CONFIG_NET_TCP_PACING) ? ", paced" : "");
+
 	test_close(s_sock);
 	test_close(c_sock);
 
@@ -2430,6 +2453,56 @@ ZTEST(net_socket_tcp, test_so_keepalive_opt)
 	test_context_cleanup();
 }
 
+ZTEST(net_socket_tcp, test_tcp_congestion_opt)
+{
+	struct sockaddr_in bind_addr4;
+	char name[TCP_CA_NAME_MAX];
+	socklen_t optlen = sizeof(name);
+	int sock, ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_CONGESTION_AVOIDANCE);
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &sock, &bind_addr4);
+
+	/* Check the default algorithm. */
+	ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_str_equal(name,
+			  IS_ENABLED(CONFIG_NET_TCP_CONGESTION_DEFAULT_CUBIC) ? "cubic" : "reno",
+			  "getsockopt got invalid value");
+	zassert_equal(optlen, strlen(name) + 1, "getsockopt got invalid size");
+
+	ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "reno", strlen("reno"));
+	zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+	optlen = sizeof(name);
+	ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_str_equal(name, "reno", "getsockopt got invalid value");
+
+	ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "cubic", strlen("cubic"));
+	if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_CUBIC)) {
+		zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+		optlen = sizeof(name);
+		ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+		zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+		zassert_str_equal(name, "cubic", "getsockopt got invalid value");
+	} else {
+		zassert_equal(ret, -1, "setsockopt should've failed");
+		zassert_equal(errno, ENOENT, "wrong errno value, %d", errno);
+	}
+
+	/* Unknown algorithm. */
+	ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "vegas", strlen("vegas"));
+	zassert_equal(ret, -1, "setsockopt should've failed");
+	zassert_equal(errno, ENOENT, "wrong errno value, %d", errno);
+
+	test_close(sock);
+
+	test_context_cleanup();
+}
+
 static void test_prepare_keepalive_socks(int *c_sock, int *s_sock, int *new_sock)
 {
 	struct sockaddr_in c_saddr, s_saddr;
@@ -3744,6 +3744,88 @@ ZTEST(net_socket_udp, test_v6_rebinding)
 	test_rebinding_common(AF_INET6);
 }
 
+ZTEST_USER(net_socket_udp, test_v4_sendmmsg_recvmmsg)
+{
+	static const char * const test_msgs[] = { "one", "second", "third one" };
+	char bufs[ARRAY_SIZE(test_msgs) + 1][16];
+	struct sockaddr_in addrs[ARRAY_SIZE(test_msgs) + 1];
+	struct iovec io_vectors[ARRAY_SIZE(test_msgs) + 1];
+	struct mmsghdr msgs[ARRAY_SIZE(test_msgs) + 1];
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	int client_sock;
+	int server_sock;
+	int rv;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(client_sock, (struct sockaddr *)&client_addr, sizeof(client_addr));
+	zassert_equal(rv, 0, "client bind failed");
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	memset(msgs, 0, sizeof(msgs));
+
+	ARRAY_FOR_EACH(test_msgs, i) {
+		io_vectors[i].iov_base = (void *)test_msgs[i];
+		io_vectors[i].iov_len = strlen(test_msgs[i]);
+		msgs[i].msg_hdr.msg_iov = &io_vectors[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		msgs[i].msg_hdr.msg_name = &server_addr;
+		msgs[i].msg_hdr.msg_namelen = sizeof(server_addr);
+	}
+
+	rv = zsock_sendmmsg(client_sock, msgs, 0, 0);
+	zassert_equal(rv, 0, "sendmmsg of no message failed (%d)", -errno);
+
+	rv = zsock_sendmmsg(client_sock, msgs, ARRAY_SIZE(test_msgs), 0);
+	zassert_equal(rv, ARRAY_SIZE(test_msgs), "sendmmsg failed (%d)", -errno);
+
+	ARRAY_FOR_EACH(test_msgs, i) {
+		zassert_equal(msgs[i].msg_len, strlen(test_msgs[i]),
+			      "unexpected sent bytes for message %zu", i);
+	}
+
+	k_msleep(100);
+
+	memset(msgs, 0, sizeof(msgs));
+
+	ARRAY_FOR_EACH(msgs, i) {
+		io_vectors[i].iov_base = bufs[i];
+		io_vectors[i].iov_len = sizeof(bufs[i]);
+		msgs[i].msg_hdr.msg_iov = &io_vectors[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		msgs[i].msg_hdr.msg_name = &addrs[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+	}
+
+	/* Ask for one more message than sent, only the first one is waited for */
+	rv = zsock_recvmmsg(server_sock, msgs, ARRAY_SIZE(msgs), ZSOCK_MSG_WAITFORONE);
+	zassert_equal(rv, ARRAY_SIZE(test_msgs), "recvmmsg failed (%d)", -errno);
+
+	ARRAY_FOR_EACH(test_msgs, i) {
+		zassert_equal(msgs[i].msg_len, strlen(test_msgs[i]),
+			      "unexpected received bytes for message %zu", i);
+		zassert_mem_equal(bufs[i], test_msgs[i], strlen(test_msgs[i]),
+				  "wrong data in message %zu", i);
+		zassert_equal(msgs[i].msg_hdr.msg_namelen, sizeof(client_addr),
+			      "unexpected addrlen for message %zu", i);
+		zassert_equal(addrs[i].sin_port, client_addr.sin_port,
+			      "unexpected client port for message %zu", i);
+	}
+
+	rv = zsock_recvmmsg(server_sock, msgs, ARRAY_SIZE(msgs), ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, -1, "recvmmsg on an empty socket succeeded");
+	zassert_equal(errno, EAGAIN, "unexpected errno (%d)", errno);
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
@@ -116,6 +116,8 @@ static enum test_case_no {
 	TEST_CLIENT_SEQ_VALIDATION = 19,
 	TEST_SERVER_ACK_VALIDATION = 20,
 	TEST_SERVER_FIN_ACK_AFTER_DATA = 21,
+	TEST_SERVER_RECV_SACK = 22,
+	TEST_SERVER_SEND_SACK = 23,
 } test_case_no;
 
 static enum test_state t_state;
@@ -136,6 +138,8 @@ static void handle_client_closing_failure_test(sa_family_t af, struct tcphdr *th
 static void handle_data_fin1_test(sa_family_t af, struct tcphdr *th);
 static void handle_data_during_fin1_test(sa_family_t af, struct tcphdr *th);
 static void handle_server_recv_out_of_order(struct net_pkt *pkt);
+static void handle_server_recv_sack(struct net_pkt *pkt);
+static void handle_server_send_sack(struct net_pkt *pkt);
 static void handle_server_rst_on_closed_port(sa_family_t af, struct tcphdr *th);
 static void handle_server_rst_on_listening_port(sa_family_t af, struct tcphdr *th);
 static void handle_syn_invalid_ack(sa_family_t af, struct tcphdr *th);
@@ -240,6 +244,10 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
+/* SACK option of the ACKs sent in TEST_SERVER_SEND_SACK, empty for none */
+static uint8_t sack_options[4 + 2 * NET_TCP_SACK_BLOCK_SIZE];
+static size_t sack_options_len;
+
 static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 					      uint16_t src_port,
 					      uint16_t dst_port,
@@ -250,11 +258,16 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct net_pkt *pkt;
 	struct tcphdr *th;
+	const uint8_t *opts = NULL;
 	uint8_t opts_len = 0;
 	int ret = -EINVAL;
 
 	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+		opts = tcp_options;
 		opts_len = sizeof(tcp_options);
+	} else if (test_case_no == TEST_SERVER_SEND_SACK) {
+		opts = sack_options;
+		opts_len = sack_options_len;
 	}
 
 	/* Allocate buffer */
@@ -289,11 +302,7 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		th->th_off = 10U;
-	} else {
-		th->th_off = 5U;
-	}
+	th->th_off = 5U + opts_len / 4U;
 
 	th->th_flags = flags;
 	th->th_win = htons(NET_IPV6_MTU);
@@ -308,9 +317,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if (opts_len > 0) {
 		/* Add TCP Options */
-		ret = net_pkt_write(pkt, tcp_options, opts_len);
+		ret = net_pkt_write(pkt, opts, opts_len);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -462,6 +471,12 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_SERVER_RECV_OUT_OF_ORDER_DATA:
 		handle_server_recv_out_of_order(pkt);
 		break;
+	case TEST_SERVER_RECV_SACK:
+		handle_server_recv_sack(pkt);
+		break;
+	case TEST_SERVER_SEND_SACK:
+		handle_server_send_sack(pkt);
+		break;
 	case TEST_CLIENT_FIN_WAIT_1_RETRANSMIT_IPV4:
 		handle_data_fin1_test(net_pkt_family(pkt), &th);
 		break;
@@ -2095,7 +2110,7 @@ static struct out_of_order_check_struct out_of_order_check_list[] = {
 	{ 30, 10, 0, 0}, /* First packet will be out-of-order */
 	{ 20, 12, 0, 0},
 	{ 10,  9, 0, 0}, /* Section with a gap */
-	{ 0,  10, 10, 0},
+	{ 0,  10, 19, 0}, /* Pending data merged up to the gap */
 	{ 10, 10, 40, 0}, /* First sequence complete */
 	{ 32,  6, 40, 0}, /* Invalid seqnum (old) */
 	{ 30, 16, 46, 0}, /* Partial data valid */
@@ -2226,6 +2241,293 @@ ZTEST(net_tcp, test_server_out_of_order_data)
 	test_server_timeout_out_of_order_data();
 }
 
+#define SACK_SEQ_INIT 100
+
+struct sack_check_struct {
+	int seq_offset;
+	int length;
+	int ack_offset;
+	int num_blocks;
+	int blocks[2][2]; /* Start and end offsets of the SACK blocks */
+};
+
+static struct sack_check_struct sack_check_list[] = {
+	{ 20, 10,  0, 1, { { 20, 30 } } }, /* First hole */
+	{ 40, 10,  0, 2, { { 40, 50 }, { 20, 30 } } }, /* Second hole, latest first */
+	{ 30,  5,  0, 2, { { 20, 35 }, { 40, 50 } } }, /* Extends a block */
+	{  0, 20, 35, 1, { { 40, 50 } } }, /* First hole filled */
+	{ 35,  5, 50, 0 }, /* Second hole filled */
+};
+
+static struct sack_check_struct *sack_check;
+
+static void handle_server_recv_sack(struct net_pkt *pkt)
+{
+	struct tcphdr th;
+	uint8_t options[40];
+	size_t options_len;
+	int num_blocks = 0;
+	int ret;
+
+	ret = read_tcp_header(pkt, &th);
+	zassert_equal(ret, 0, "Cannot read the TCP header");
+
+	zassert_equal(ntohl(th.th_ack), SACK_SEQ_INIT + 1 + sack_check->ack_offset,
+		      "Expected ACK %u but got %u",
+		      SACK_SEQ_INIT + 1 + sack_check->ack_offset, ntohl(th.th_ack));
+
+	options_len = (th.th_off - 5) * 4;
+
+	net_pkt_set_overwrite(pkt, true);
+	zassert_ok(net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt) +
+				sizeof(struct tcphdr)));
+	zassert_ok(net_pkt_read(pkt, options, options_len));
+
+	for (size_t pos = 0; pos < options_len; ) {
+		if (options[pos] == NET_TCP_NOP_OPT) {
+			pos++;
+			continue;
+		}
+
+		if (options[pos] == NET_TCP_SACK_OPT) {
+			num_blocks = (options[pos + 1] - 2) / NET_TCP_SACK_BLOCK_SIZE;
+			zassert_equal(num_blocks, sack_check->num_blocks,
+				      "Expected %d SACK blocks but got %d",
+				      sack_check->num_blocks, num_blocks);
+
+			for (int i = 0; i < num_blocks; i++) {
+				uint8_t *block = &options[pos + 2 + i * NET_TCP_SACK_BLOCK_SIZE];
+
+				zassert_equal(sys_get_be32(block),
+					      SACK_SEQ_INIT + 1 + sack_check->blocks[i][0],
+					      "Invalid start of SACK block %d", i);
+				zassert_equal(sys_get_be32(block + 4),
+					      SACK_SEQ_INIT + 1 + sack_check->blocks[i][1],
+					      "Invalid end of SACK block %d", i);
+			}
+		}
+
+		pos += options[pos + 1];
+	}
+
+	zassert_equal(num_blocks, sack_check->num_blocks, "Expected %d SACK blocks",
+		      sack_check->num_blocks);
+
+	test_sem_give();
+}
+
+/* Test case scenario
+ *   Establish a connection with SACK permitted
+ *   Send out-of-order data leaving holes, then fill them
+ *   expect each ACK to report the out-of-order data in SACK blocks
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_server_recv_sack)
+{
+	const uint8_t *data = lorem_ipsum + 10;
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	int ret;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_SACK)) {
+		ztest_test_skip();
+	}
+
+	k_sem_reset(&test_sem);
+
+	ctx = create_server_socket(SACK_SEQ_INIT, 0);
+
+#if defined(CONFIG_NET_TCP_SACK)
+	/* The tester does not send options, so permit SACK here */
+	((struct tcp *)accepted_ctx->tcp)->sack_ok = true;
+#endif
+
+	test_case_no = TEST_SERVER_RECV_SACK;
+
+	for (int i = 0; i < ARRAY_SIZE(sack_check_list); i++) {
+		sack_check = &sack_check_list[i];
+
+		seq = SACK_SEQ_INIT + 1 + sack_check->seq_offset;
+		pkt = prepare_data_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT),
+					  &data[sack_check->seq_offset], sack_check->length);
+		zassert_not_null(pkt, "Cannot create pkt");
+
+		ret = net_recv_data(net_iface, pkt);
+		zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+		test_sem_take(K_MSEC(1000), __LINE__);
+	}
+
+	/* Abort the connection, so that the test does not need to close it */
+	seq = SACK_SEQ_INIT + 1 + 50;
+	pkt = prepare_rst_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT));
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
+#define SACK_SEND_SEG_LEN  10
+#define SACK_SEND_DATA_LEN 50
+#define SACK_SEND_MAX_SEGS 16
+
+struct sack_segment {
+	uint32_t offset;
+	size_t len;
+};
+
+static struct sack_segment sack_sent[SACK_SEND_MAX_SEGS];
+static int sack_sent_cnt;
+static uint32_t sack_seq_base;
+static K_SEM_DEFINE(sack_sent_sem, 0, SACK_SEND_MAX_SEGS);
+
+static void handle_server_send_sack(struct net_pkt *pkt)
+{
+	struct tcphdr th;
+	size_t len;
+	int ret;
+
+	ret = read_tcp_header(pkt, &th);
+	zassert_equal(ret, 0, "Cannot read the TCP header");
+
+	len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt) - net_pkt_ip_opts_len(pkt) -
+	      th.th_off * 4U;
+	if (len == 0) {
+		/* Not data, e.g. a window update */
+		return;
+	}
+
+	zassert_true(sack_sent_cnt < SACK_SEND_MAX_SEGS, "Too many segments sent");
+
+	sack_sent[sack_sent_cnt].offset = ntohl(th.th_seq) - sack_seq_base;
+	sack_sent[sack_sent_cnt].len = len;
+	sack_sent_cnt++;
+
+	k_sem_give(&sack_sent_sem);
+}
+
+static void sack_expect_segment(int index, uint32_t offset, size_t len)
+{
+	zassert_ok(k_sem_take(&sack_sent_sem, K_MSEC(50)), "Segment %d not sent", index);
+	zassert_equal(sack_sent[index].offset, offset,
+		      "Segment %d: expected offset %u but got %u", index, offset,
+		      sack_sent[index].offset);
+	zassert_equal(sack_sent[index].len, len, "Segment %d: expected %zu bytes but got %zu",
+		      index, len, sack_sent[index].len);
+}
+
+/* Acknowledge up to ack_offset and report the given [start, end) blocks */
+static void sack_send_ack(uint32_t ack_offset, const uint32_t blocks[][2], int num_blocks)
+{
+	uint8_t *ptr = sack_options;
+	struct net_pkt *pkt;
+	int ret;
+
+	sack_options_len = 0;
+
+	if (num_blocks > 0) {
+		*ptr++ = NET_TCP_NOP_OPT;
+		*ptr++ = NET_TCP_NOP_OPT;
+		*ptr++ = NET_TCP_SACK_OPT;
+		*ptr++ = 2 + num_blocks * NET_TCP_SACK_BLOCK_SIZE;
+
+		for (int i = 0; i < num_blocks; i++) {
+			sys_put_be32(sack_seq_base + blocks[i][0], ptr);
+			sys_put_be32(sack_seq_base + blocks[i][1], ptr + 4);
+			ptr += NET_TCP_SACK_BLOCK_SIZE;
+		}
+
+		sack_options_len = ptr - sack_options;
+	}
+
+	ack = sack_seq_base + ack_offset;
+	pkt = prepare_ack_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT));
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+}
+
+/* Test case scenario
+ *   Establish a connection with SACK permitted
+ *   Send five segments, of which the peer misses the first and the third
+ *   send duplicate ACKs reporting the others in SACK blocks
+ *   expect the first segment to be retransmitted
+ *   send a partial ACK that still reports the last two segments
+ *   expect the third segment to be retransmitted, and nothing else
+ *   any failures cause test case to fail.
+ */
+ZTEST(net_tcp, test_server_send_sack)
+{
+	static const uint32_t held[][2] = { { 10, 20 }, { 30, 50 } };
+	const uint8_t *data = lorem_ipsum + 10;
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	struct tcp *conn;
+	int ret;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_SACK) || !IS_ENABLED(CONFIG_NET_TCP_FAST_RETRANSMIT)) {
+		ztest_test_skip();
+	}
+
+	k_sem_reset(&test_sem);
+	k_sem_reset(&sack_sent_sem);
+	sack_sent_cnt = 0;
+	sack_options_len = 0;
+
+	ctx = create_server_socket(0, 0);
+	sack_seq_base = ack;
+	conn = accepted_ctx->tcp;
+
+#if defined(CONFIG_NET_TCP_SACK)
+	/* The tester does not send options, so permit SACK here */
+	conn->sack_ok = true;
+#endif
+	/* Small segments, so that the data is split up */
+	conn->recv_options.mss = SACK_SEND_SEG_LEN;
+	conn->recv_options.mss_found = true;
+
+	test_case_no = TEST_SERVER_SEND_SACK;
+
+	ret = net_context_send(accepted_ctx, data, SACK_SEND_DATA_LEN, NULL, K_NO_WAIT, NULL);
+	zassert_equal(ret, SACK_SEND_DATA_LEN, "Failed to send data to peer %d", ret);
+
+	for (int i = 0; i < SACK_SEND_DATA_LEN / SACK_SEND_SEG_LEN; i++) {
+		sack_expect_segment(i, i * SACK_SEND_SEG_LEN, SACK_SEND_SEG_LEN);
+	}
+
+	/* The third duplicate ACK triggers the fast retransmit of the first hole */
+	sack_send_ack(0, held, 1);
+	sack_send_ack(0, held, 2);
+	sack_send_ack(0, held, 2);
+	sack_expect_segment(5, 0, SACK_SEND_SEG_LEN);
+
+	/* The partial ACK retransmits the next hole, skipping the data held */
+	sack_send_ack(20, &held[1], 1);
+	sack_expect_segment(6, 20, SACK_SEND_SEG_LEN);
+
+	sack_send_ack(SACK_SEND_DATA_LEN, NULL, 0);
+	zassert_not_equal(k_sem_take(&sack_sent_sem, K_MSEC(200)), 0,
+			  "Data the peer holds was retransmitted");
+
+	/* Abort the connection, so that the test does not need to close it */
+	pkt = prepare_rst_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT));
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
 static void handle_server_rst_on_closed_port(sa_family_t af, struct tcphdr *th)
 {
 	switch (t_state) {